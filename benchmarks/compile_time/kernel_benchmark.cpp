@@ -0,0 +1,28 @@
+// Unidad de traducción del benchmark de tiempo de compilación.
+// scripts/compile_benchmark.py la compila una vez por escenario y tamaño:
+//   -DLOGIC_BENCH_SCENARIO=<substitute|substitute_sparse|discharge|merge|mp_chain|forall_nest|instantiate_all|deduction>
+//   -DLOGIC_BENCH_DEPTH=<n> -DLOGIC_BENCH_WIDTH=<n>
+
+#include "kernel_scenarios.hpp"
+
+#ifndef LOGIC_BENCH_SCENARIO
+#define LOGIC_BENCH_SCENARIO mp_chain
+#endif
+
+#ifndef LOGIC_BENCH_DEPTH
+#define LOGIC_BENCH_DEPTH 8
+#endif
+
+#ifndef LOGIC_BENCH_WIDTH
+#define LOGIC_BENCH_WIDTH 4
+#endif
+
+using Scenario = logic::bench::scenarios::LOGIC_BENCH_SCENARIO<LOGIC_BENCH_DEPTH, LOGIC_BENCH_WIDTH>;
+
+// Forzar la instanciación completa del escenario
+static_assert(Scenario::checksum > 0, "El escenario debe producir un resultado no vacío");
+
+int main()
+{
+    return Scenario::checksum > 0 ? 0 : 1;
+}
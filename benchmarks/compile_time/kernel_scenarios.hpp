@@ -0,0 +1,343 @@
+#pragma once
+
+#include <logic_language/logic_language.hpp>
+#include <utility>
+
+namespace logic::bench
+{
+
+    // =========================================================
+    // === SYNTHETIC PROOF GENERATORS (Compile-time benchmark) ===
+    // =========================================================
+
+    // Cada escenario construye una demostración sintética parametrizada por
+    // Depth y Width. La generación usa index_sequence y fold expressions
+    // para que el coste medido sea el del kernel y no el del generador.
+
+    // --- Nombres de variables indexados: "v0", "v1", ... ---
+    consteval size_t decimal_digits(size_t value)
+    {
+        size_t len = 1;
+        while (value >= 10)
+        {
+            value /= 10;
+            ++len;
+        }
+        return len;
+    }
+
+    template <size_t I>
+    consteval auto indexed_name()
+    {
+        constexpr size_t len = decimal_digits(I);
+        char buf[len + 2]{};
+        buf[0] = 'v';
+        size_t value = I;
+        for (size_t i = len; i > 0; --i)
+        {
+            buf[i] = static_cast<char>('0' + value % 10);
+            value /= 10;
+        }
+        return FixedString<len + 2>(buf);
+    }
+
+    template <size_t I>
+    using V = Var<indexed_name<I>()>;
+
+    // Átomos distintos sin necesidad de nombres distintos
+    template <size_t I>
+    using Atom = Predicate<"A", Natural<I>>;
+
+    // =========================================================
+    // === HELPERS DE PLEGADO (sin recursión de plantillas) ===
+    // =========================================================
+
+    // Envoltorio para encadenar reglas con un fold expression a izquierda
+    template <typename Thm>
+    struct Chain
+    {
+        using theorem = Thm;
+    };
+
+    // Paso de Modus Ponens: el teorema actual A_i y la premisa A_i -> A_{i+1}
+    template <typename Premise>
+    struct MPStep
+    {
+    };
+
+    template <typename Thm, typename Premise>
+    constexpr auto operator|(Chain<Thm>, MPStep<Premise>)
+    {
+        return Chain<decltype(modus_ponens(Thm{}, Premise{}))>{};
+    }
+
+    // Paso de descarga: implies_intro<Hyp>
+    template <typename Hyp>
+    struct DischargeStep
+    {
+    };
+
+    template <typename Thm, typename Hyp>
+    constexpr auto operator|(Chain<Thm>, DischargeStep<Hyp>)
+    {
+        return Chain<decltype(implies_intro<Hyp>(Thm{}))>{};
+    }
+
+    // Paso de instanciación universal con un término
+    template <typename Term>
+    struct InstStep
+    {
+    };
+
+    template <typename Thm, typename Term>
+    constexpr auto operator|(Chain<Thm>, InstStep<Term>)
+    {
+        return Chain<decltype(universal_instantiation(Thm{}, Term{}))>{};
+    }
+
+    // Paso de generalización sobre una variable
+    template <typename V>
+    struct GenStep
+    {
+    };
+
+    template <typename Thm, typename V>
+    constexpr auto operator|(Chain<Thm>, GenStep<V>)
+    {
+        return Chain<decltype(generalization(V{}, Thm{}))>{};
+    }
+
+    // Fusión de contextos como operación plegable
+    template <typename Ctx>
+    struct Ctx_
+    {
+        using type = Ctx;
+    };
+
+    template <typename C1, typename C2>
+    constexpr auto operator+(Ctx_<C1>, Ctx_<C2>)
+    {
+        return Ctx_<MergeContexts_t<C1, C2>>{};
+    }
+
+    // =========================================================
+    // === ESCENARIOS ===
+    // =========================================================
+
+    namespace scenarios
+    {
+
+        // --- substitute: Substitute_t sobre una conjunción de Width
+        // predicados, cada uno bajo Depth negaciones ---
+        template <size_t Depth, typename T>
+        struct NestNot
+        {
+            using type = Not<typename NestNot<Depth - 1, T>::type>;
+        };
+
+        template <typename T>
+        struct NestNot<0, T>
+        {
+            using type = T;
+        };
+
+        template <typename... Ts>
+        struct AndAll;
+
+        template <typename T>
+        struct AndAll<T>
+        {
+            using type = T;
+        };
+
+        template <typename T, typename... Ts>
+        struct AndAll<T, Ts...>
+        {
+            using type = And<T, typename AndAll<Ts...>::type>;
+        };
+
+        template <size_t Depth, size_t Width>
+        struct substitute
+        {
+            template <size_t... Is>
+            static auto build(std::index_sequence<Is...>)
+                -> typename AndAll<typename NestNot<Depth, Predicate<"P", V<0>, V<Is + 1>>>::type...>::type;
+
+            using formula = decltype(build(std::make_index_sequence<Width>{}));
+            using result = Substitute_t<formula, V<0>, Natural<0>>;
+            static constexpr size_t checksum = sizeof(result);
+        };
+
+        // --- substitute_sparse: misma forma que substitute, pero la variable
+        // sustituida solo aparece en el primer conjunto; el resto de la
+        // fórmula no debería reconstruirse ---
+        template <size_t Depth, size_t Width>
+        struct substitute_sparse
+        {
+            template <size_t... Is>
+            static auto build(std::index_sequence<Is...>)
+                -> typename AndAll<typename NestNot<Depth, Predicate<"P", V<(Is == 0 ? 0 : Is + 1)>>>::type...>::type;
+
+            using formula = decltype(build(std::make_index_sequence<Width>{}));
+            using result = Substitute_t<formula, V<0>, Natural<0>>;
+            static constexpr size_t checksum = sizeof(result);
+        };
+
+        // --- discharge: contexto de Depth * Width hipótesis, se descargan
+        // Depth de ellas (una por bloque) ---
+        template <size_t Depth, size_t Width>
+        struct discharge
+        {
+            template <size_t... Is>
+            static auto context(std::index_sequence<Is...>) -> TypeList<Atom<Is>...>;
+
+            using start = Theorem<decltype(context(std::make_index_sequence<Depth * Width>{})), Atom<0>>;
+
+            template <size_t... Is>
+            static auto run(std::index_sequence<Is...>)
+                -> typename decltype((Chain<start>{} | ... | DischargeStep<Atom<Is * Width>>{}))::theorem;
+
+            using result = decltype(run(std::make_index_sequence<Depth>{}));
+            static constexpr size_t checksum = result::context_type::size + 1;
+        };
+
+        // --- merge: Depth contextos de Width hipótesis fusionados ---
+        template <size_t Depth, size_t Width>
+        struct merge
+        {
+            template <size_t Offset, size_t... Is>
+            static auto context(std::index_sequence<Is...>) -> TypeList<Atom<Offset + Is>...>;
+
+            template <size_t I>
+            using Block = decltype(context<I * Width / 2>(std::make_index_sequence<Width>{}));
+
+            template <size_t... Is>
+            static auto run(std::index_sequence<Is...>)
+                -> typename decltype((Ctx_<TypeList<>>{} + ... + Ctx_<Block<Is>>{}))::type;
+
+            using result = decltype(run(std::make_index_sequence<Depth>{}));
+            static constexpr size_t checksum = result::size;
+        };
+
+        // --- mp_chain: cadena de Depth Modus Ponens; cada premisa arrastra
+        // un contexto lateral de Width hipótesis compartidas ---
+        template <size_t Depth, size_t Width>
+        struct mp_chain
+        {
+            template <size_t... Js>
+            static auto side(std::index_sequence<Js...>) -> TypeList<Predicate<"H", Natural<Js>>...>;
+
+            using Side = decltype(side(std::make_index_sequence<Width>{}));
+
+            template <size_t I>
+            using Premise = Theorem<MergeContexts_t<TypeList<Implies<Atom<I>, Atom<I + 1>>>, Side>,
+                                    Implies<Atom<I>, Atom<I + 1>>>;
+
+            template <size_t... Is>
+            static auto run(std::index_sequence<Is...>)
+                -> typename decltype((Chain<decltype(assume<Atom<0>>())>{} | ... | MPStep<Premise<Is>>{}))::theorem;
+
+            using result = decltype(run(std::make_index_sequence<Depth>{}));
+            static constexpr size_t checksum = result::context_type::size;
+        };
+
+        // --- forall_nest: Depth cuantificadores anidados sobre un cuerpo de
+        // Width predicados; se instancian todos con universal_instantiation
+        // usando variables frescas como términos ---
+        template <size_t Depth, size_t Width>
+        struct forall_nest
+        {
+            template <size_t... Js>
+            static auto body(std::index_sequence<Js...>)
+                -> typename AndAll<Predicate<"P", V<Js % Depth>, V<(Js * 3 + 1) % Depth>>...>::type;
+
+            template <typename Body, size_t... Is>
+            struct Quantify;
+
+            template <typename Body>
+            struct Quantify<Body>
+            {
+                using type = Body;
+            };
+
+            template <typename Body, size_t I, size_t... Is>
+            struct Quantify<Body, I, Is...>
+            {
+                using type = Forall<V<I>, typename Quantify<Body, Is...>::type>;
+            };
+
+            template <size_t... Is>
+            static auto quantify(std::index_sequence<Is...>)
+                -> typename Quantify<decltype(body(std::make_index_sequence<Width>{})), Is...>::type;
+
+            using formula = decltype(quantify(std::make_index_sequence<Depth>{}));
+            using start = Theorem<TypeList<>, formula>;
+
+            template <size_t... Is>
+            static auto run(std::index_sequence<Is...>)
+                -> typename decltype((Chain<start>{} | ... | InstStep<V<Depth + Is>>{}))::theorem;
+
+            using result = decltype(run(std::make_index_sequence<Depth>{}));
+            static constexpr size_t checksum = sizeof(result);
+        };
+
+        // --- instantiate_all: la misma fórmula que forall_nest, instanciada
+        // con una sola llamada a instantiate_all (un único recorrido) ---
+        template <size_t Depth, size_t Width>
+        struct instantiate_all
+        {
+            using start = typename forall_nest<Depth, Width>::start;
+
+            template <size_t... Is>
+            static auto run(std::index_sequence<Is...>) -> decltype(logic::instantiate_all(start{}, V<Depth + Is>{}...));
+
+            using result = decltype(run(std::make_index_sequence<Depth>{}));
+            static constexpr size_t checksum = sizeof(result);
+        };
+
+        // --- deduction: una derivación completa con las seis reglas, la
+        // misma que reproduce benchmarks/runtime/proof_checker_benchmark.cpp.
+        // A_i = A(i, v0, ..., v{Width-1}); se asumen A_0 y A_i → A_{i+1},
+        // Depth Modus Ponens llegan a A_Depth, se descargan todas las
+        // hipótesis, se generaliza sobre las Width variables, se instancia
+        // cada una con un numeral y se cierra con axiom_identity ---
+        template <size_t Depth, size_t Width>
+        struct deduction
+        {
+            template <size_t I, size_t... Js>
+            static auto atom(std::index_sequence<Js...>) -> Predicate<"A", Natural<I>, V<Js>...>;
+
+            template <size_t I>
+            using A = decltype(atom<I>(std::make_index_sequence<Width>{}));
+
+            template <size_t I>
+            using Step = Implies<A<I>, A<I + 1>>;
+
+            template <size_t... Is>
+            static auto chain(std::index_sequence<Is...>)
+                -> typename decltype((Chain<decltype(assume<A<0>>())>{} | ... | MPStep<decltype(assume<Step<Is>>())>{}))::theorem;
+
+            // Se descarga primero la última premisa: ⊢ A_0 → (A_0 → A_1) → ... → A_Depth
+            template <size_t... Is>
+            static auto discharge(std::index_sequence<Is...>)
+                -> typename decltype((Chain<decltype(chain(std::make_index_sequence<Depth>{}))>{} | ... |
+                                      DischargeStep<Step<Depth - 1 - Is>>{}) |
+                                     DischargeStep<A<0>>{})::theorem;
+
+            template <size_t... Js>
+            static auto generalize(std::index_sequence<Js...>)
+                -> typename decltype((Chain<decltype(discharge(std::make_index_sequence<Depth>{}))>{} | ... | GenStep<V<Js>>{}))::theorem;
+
+            template <size_t... Js>
+            static auto instantiate(std::index_sequence<Js...>)
+                -> typename decltype((Chain<decltype(generalize(std::make_index_sequence<Width>{}))>{} | ... |
+                                      InstStep<Natural<Js>>{}))::theorem;
+
+            using closed = decltype(instantiate(std::make_index_sequence<Width>{}));
+            using result = decltype(modus_ponens(closed{}, axiom_identity(typename closed::formula_type{})));
+            static constexpr size_t checksum = sizeof(result) + result::context_type::size;
+        };
+
+    } // namespace scenarios
+
+} // namespace logic::bench
@@ -0,0 +1,115 @@
+// Benchmark de los BDD: comprobaciones de equivalencia y de validez con
+// el orden de la heurística, y el mismo problema con un orden malo.
+//
+//   - silogismo encadenado de n átomos (válido);
+//   - asociatividad de ↔ con n átomos: el BDD de la paridad es lineal;
+//   - igualdad de dos palabras de n bits, ⋀(xi ↔ yi) ↔ ¬⋁¬(xi ↔ yi);
+//   - (x0 ∧ y0) ∨ ... ∨ (xn ∧ yn): 2n + 1 nodos con x0 y0 x1 y1 ... y
+//     2^(n + 1) con todas las x antes que las y.
+//
+// Imprime el tiempo, los nodos del resultado, el máximo de nodos vivos,
+// la memoria, el acierto de la tabla única y de la caché y las
+// recolecciones de basura.
+//
+//   bdd_benchmark
+
+#include <logic_language/bdd.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace logic::runtime;
+    using clock_type = std::chrono::steady_clock;
+
+    std::vector<NodeId> atoms(TermStore &store, const std::string &prefix, size_t n)
+    {
+        std::vector<NodeId> out;
+        for (size_t i = 0; i < n; ++i)
+            out.push_back(store.atom(prefix + std::to_string(i), {}));
+        return out;
+    }
+
+    NodeId fold(TermStore &store, NodeOp op, const std::vector<NodeId> &operands)
+    {
+        NodeId out = operands[0];
+        for (size_t i = 1; i < operands.size(); ++i)
+            out = store.binary(op, out, operands[i]);
+        return out;
+    }
+
+    double percent(std::uint64_t part, std::uint64_t total) { return total == 0 ? 0.0 : 100.0 * static_cast<double>(part) / static_cast<double>(total); }
+
+    // `declared`: átomos a los que se da variable antes de construir (un orden a mano)
+    void measure(const std::string &label, TermStore &store, NodeId formula, const std::vector<NodeId> &declared = {})
+    {
+        const auto begin = clock_type::now();
+        BddManager manager;
+        BddBuilder builder(store, manager);
+        for (const NodeId atom : declared)
+            builder.declare(atom);
+        const Bdd result = builder.build(formula);
+        const double seconds = std::chrono::duration<double>(clock_type::now() - begin).count();
+
+        const BddStats stats = manager.stats();
+        std::printf("%-34s %9.2f ms %s %8zu nodos  máx. %9zu  %7.1f MB  única %5.1f%%  caché %5.1f%%  %ju GC\n", label.c_str(), seconds * 1e3,
+                    result.is_true() ? "válida" : "      ", manager.node_count(result), stats.peak_nodes, stats.bytes / 1048576.0,
+                    percent(stats.unique_hits, stats.unique_lookups), percent(stats.cache_hits, stats.cache_lookups),
+                    static_cast<std::uintmax_t>(stats.collections));
+    }
+} // namespace
+
+int main()
+{
+    for (size_t n : {1000, 10000})
+    {
+        TermStore store;
+        const std::vector<NodeId> p = atoms(store, "p", n);
+        std::vector<NodeId> steps;
+        for (size_t i = 0; i + 1 < n; ++i)
+            steps.push_back(store.binary(NodeOp::Implies, p[i], p[i + 1]));
+        measure("silogismo n = " + std::to_string(n), store,
+                store.binary(NodeOp::Implies, fold(store, NodeOp::And, steps), store.binary(NodeOp::Implies, p[0], p[n - 1])));
+    }
+
+    for (size_t n : {1000, 10000})
+    {
+        TermStore store;
+        const std::vector<NodeId> p = atoms(store, "p", n);
+        NodeId right = p[n - 1];
+        for (size_t i = n - 1; i-- > 0;)
+            right = store.binary(NodeOp::Equiv, p[i], right);
+        measure("asociatividad de Equiv n = " + std::to_string(n), store, store.binary(NodeOp::Equiv, fold(store, NodeOp::Equiv, p), right));
+    }
+
+    for (size_t n : {1000, 10000})
+    {
+        TermStore store;
+        const std::vector<NodeId> x = atoms(store, "x", n), y = atoms(store, "y", n);
+        std::vector<NodeId> same, different;
+        for (size_t i = 0; i < n; ++i)
+        {
+            same.push_back(store.binary(NodeOp::Equiv, x[i], y[i]));
+            different.push_back(store.unary(NodeOp::Not, same.back()));
+        }
+        measure("igualdad de palabras n = " + std::to_string(n), store,
+                store.binary(NodeOp::Equiv, fold(store, NodeOp::And, same), store.unary(NodeOp::Not, fold(store, NodeOp::Or, different))));
+    }
+
+    for (size_t n : {16, 20})
+    {
+        TermStore store;
+        const std::vector<NodeId> x = atoms(store, "x", n), y = atoms(store, "y", n);
+        std::vector<NodeId> products;
+        for (size_t i = 0; i < n; ++i)
+            products.push_back(store.binary(NodeOp::And, x[i], y[i]));
+        const NodeId sum = fold(store, NodeOp::Or, products);
+        measure("suma de productos n = " + std::to_string(n), store, sum);
+        measure("suma de productos n = " + std::to_string(n) + " (x, luego y)", store, sum, x);
+    }
+    return 0;
+}
@@ -0,0 +1,167 @@
+// Benchmark del cierre de congruencia sobre cadenas grandes de igualdades:
+//
+//   - a0 = a1 = ... = an con las ecuaciones en orden aleatorio;
+//   - f^p(a) = a y f^q(a) = a con p y q primos entre sí (dan f(a) = a);
+//   - S^n(a) = S^n(b) con S inyectiva (PA4), que da a = b bajando n veces;
+//   - certificados para el ProofChecker de los mismos problemas, más
+//     pequeños, desde un TermStore.
+//
+// Imprime las uniones (por congruencia y por inyectividad), el tiempo, la
+// longitud de la explicación y, con certificados, los pasos y el tiempo
+// del ProofChecker.
+//
+//   congruence_benchmark [n, un millón por defecto]
+
+#include <logic_language/congruence.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace logic;
+    using namespace logic::runtime;
+    using Clock = std::chrono::steady_clock;
+
+    double seconds_since(Clock::time_point start) { return std::chrono::duration<double>(Clock::now() - start).count(); }
+
+    void report(const char *name, const CongruenceStats &stats, double seconds, size_t explanation, double explain_seconds)
+    {
+        std::printf("%-28s %10ju %10ju %10ju %10ju %10.3f %12zu %10.3f\n", name, static_cast<std::uintmax_t>(stats.terms),
+                    static_cast<std::uintmax_t>(stats.unions), static_cast<std::uintmax_t>(stats.congruences),
+                    static_cast<std::uintmax_t>(stats.injections), seconds * 1e3, explanation, explain_seconds * 1e3);
+    }
+
+    // f^k(x) en el motor
+    CongruenceTerm iterate(CongruenceClosure &cc, std::uint32_t f, CongruenceTerm x, size_t k)
+    {
+        for (size_t i = 0; i < k; ++i)
+            x = cc.term(f, {{x}});
+        return x;
+    }
+
+    void chain(size_t n)
+    {
+        CongruenceClosure cc;
+        std::vector<CongruenceTerm> a;
+        for (std::uint32_t i = 0; i <= n; ++i)
+            a.push_back(cc.term(i, {}));
+        std::vector<std::uint32_t> order(n);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), std::mt19937(1));
+
+        const Clock::time_point start = Clock::now();
+        for (const std::uint32_t i : order)
+            cc.merge(a[i], a[i + 1], i);
+        const double seconds = seconds_since(start);
+        const Clock::time_point explain_start = Clock::now();
+        const size_t explanation = cc.explain(a[0], a[n]).size();
+        report("cadena a0 = ... = an", cc.stats(), seconds, explanation, seconds_since(explain_start));
+    }
+
+    void cycles(size_t p, size_t q)
+    {
+        CongruenceClosure cc;
+        const Clock::time_point start = Clock::now();
+        const CongruenceTerm a = cc.term(0, {});
+        const CongruenceTerm fp = iterate(cc, 1, a, p), fq = iterate(cc, 1, a, q);
+        cc.merge(fp, a, 0);
+        cc.merge(fq, a, 1);
+        const double seconds = seconds_since(start);
+        const Clock::time_point explain_start = Clock::now();
+        const CongruenceTerm fa = cc.term(1, {{a}});
+        const size_t explanation = cc.equal(fa, a) ? cc.explain(fa, a).size() : 0;
+        report("f^p(a) = a, f^q(a) = a", cc.stats(), seconds, explanation, seconds_since(explain_start));
+    }
+
+    void successors(size_t n)
+    {
+        CongruenceClosure cc;
+        cc.set_injective(2);
+        const Clock::time_point start = Clock::now();
+        const CongruenceTerm a = cc.term(0, {}), b = cc.term(1, {});
+        cc.merge(iterate(cc, 2, a, n), iterate(cc, 2, b, n), 0);
+        const double seconds = seconds_since(start);
+        const Clock::time_point explain_start = Clock::now();
+        const size_t explanation = cc.equal(a, b) ? cc.explain(a, b).size() : 0;
+        report("S^n(a) = S^n(b)", cc.stats(), seconds, explanation, seconds_since(explain_start));
+    }
+
+    // --- Con certificados ---
+    NodeId apply(TermStore &store, const char *f, NodeId x, size_t k)
+    {
+        for (size_t i = 0; i < k; ++i)
+            x = store.atom(f, std::span<const NodeId>(&x, 1));
+        return x;
+    }
+
+    void certified(const char *name, TermStore &store, CongruenceProver &prover, NodeId a, NodeId b, double seconds)
+    {
+        ProofCertificate certificate;
+        const Clock::time_point start = Clock::now();
+        prover.certify(a, b, certificate);
+        const double certify_seconds = seconds_since(start);
+        ProofChecker checker(store);
+        const Clock::time_point check_start = Clock::now();
+        const CheckedTheorem theorem = checker.check(certificate);
+        const double check_seconds = seconds_since(check_start);
+        std::printf("%-28s %10.3f %10.3f %10zu %10.3f %10zu %s\n", name, seconds * 1e3, certify_seconds * 1e3, certificate.size(),
+                    check_seconds * 1e3, theorem.context.size(), theorem.formula == prover.equation(a, b) ? "" : "(¡fórmula distinta!)");
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+
+    std::printf("%-28s %10s %10s %10s %10s %10s %12s %10s\n", "problema", "términos", "uniones", "congruen.", "inyect.", "ms", "explicación",
+                "ms expl.");
+    chain(n);
+    cycles(n / 10 + 1, n / 10 + 2);
+    successors(n);
+
+    // Los mismos problemas con certificados, a menor escala: las
+    // demostraciones encadenan un paso de transitividad por arista
+    const size_t small = std::max<size_t>(2, n / 1000);
+    std::printf("\n%-28s %10s %10s %10s %10s %10s\n", "certificado", "ms", "ms cert.", "pasos", "ms check", "hipótesis");
+    {
+        TermStore store;
+        CongruenceProver prover(store);
+        std::vector<NodeId> a;
+        for (size_t i = 0; i <= small; ++i)
+            a.push_back(store.constant("a" + std::to_string(i)));
+        std::vector<size_t> order(small);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), std::mt19937(1));
+        const Clock::time_point start = Clock::now();
+        for (const size_t i : order)
+            prover.add(prover.equation(a[i], a[i + 1]));
+        certified("cadena a0 = ... = an", store, prover, a[0], a[small], seconds_since(start));
+    }
+    {
+        TermStore store;
+        CongruenceProver prover(store);
+        const NodeId a = store.constant("a");
+        const Clock::time_point start = Clock::now();
+        prover.add(prover.equation(apply(store, "f", a, small + 1), a));
+        prover.add(prover.equation(apply(store, "f", a, small + 2), a));
+        certified("f^p(a) = a, f^q(a) = a", store, prover, apply(store, "f", a, 1), a, seconds_since(start));
+    }
+    {
+        TermStore store;
+        CongruenceProver prover(store);
+        prover.injective("S");
+        const NodeId a = store.constant("a"), b = store.constant("b");
+        const Clock::time_point start = Clock::now();
+        prover.add(prover.equation(apply(store, "S", a, small), apply(store, "S", b, small)));
+        certified("S^n(a) = S^n(b)", store, prover, a, b, seconds_since(start));
+    }
+    return 0;
+}
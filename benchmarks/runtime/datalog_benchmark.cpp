@@ -0,0 +1,118 @@
+// Benchmark del motor Datalog: clausuras transitivas y una regla sobre un
+// millón de hechos, con un hilo y con todos.
+//
+//   - le_trans (no lineal: Le ∘ Le) sobre una cadena c0 < c1 < ... < cn;
+//   - Path(x, z) ← Edge(x, y) ∧ Path(y, z) (lineal) sobre un grafo
+//     aleatorio de n nodos y 2n aristas;
+//   - Human(x) → Mortal(x) sobre n constantes.
+//
+// Imprime los hechos, las vueltas, las búsquedas en índices, el tiempo,
+// los hechos derivados por segundo y la memoria de las relaciones.
+//
+//   datalog_benchmark [hilos, todos por defecto]
+
+#include <logic_language/datalog.hpp>
+#include <theorems/peano/order.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    using namespace logic;
+    using namespace logic::runtime;
+
+    using X = Var<"x">;
+    using Y = Var<"y">;
+    using Z = Var<"z">;
+    using PathBase = Forall<X, Forall<Y, Implies<Predicate<"Edge", X, Y>, Predicate<"Path", X, Y>>>>;
+    using PathStep = Forall<X, Forall<Y, Forall<Z, Implies<And<Predicate<"Edge", X, Y>, Predicate<"Path", Y, Z>>, Predicate<"Path", X, Z>>>>>;
+    using Mortality = Forall<X, Implies<Predicate<"Human", X>, Predicate<"Mortal", X>>>;
+
+    std::vector<NodeId> constants(TermStore &store, size_t n)
+    {
+        std::vector<NodeId> out;
+        for (size_t i = 0; i < n; ++i)
+            out.push_back(store.constant("c" + std::to_string(i)));
+        return out;
+    }
+
+    NodeId atom(TermStore &store, const char *name, NodeId a, NodeId b)
+    {
+        const NodeId args[] = {a, b};
+        return store.atom(name, args);
+    }
+
+    // `setup` carga las reglas y los hechos en un Datalog nuevo
+    template <typename Setup>
+    void measure(const std::string &label, TermStore &store, size_t threads, Setup &&setup)
+    {
+        for (const size_t count : {size_t{1}, threads})
+        {
+            Datalog datalog(store);
+            setup(datalog);
+            const DatalogStats stats = datalog.run(count);
+            std::printf("%-32s %5zu %10ju %7ju %10ju %10.2f ms %12.0f %8.1f MB\n", label.c_str(), stats.threads, static_cast<std::uintmax_t>(stats.facts),
+                        static_cast<std::uintmax_t>(stats.iterations), static_cast<std::uintmax_t>(stats.lookups), stats.seconds * 1e3,
+                        stats.facts_per_second(), datalog.engine().bytes() / 1048576.0);
+            if (threads == 1)
+                break;
+        }
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const size_t threads = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : std::max<unsigned>(1, std::thread::hardware_concurrency());
+    std::printf("%-32s %5s %10s %7s %11s %13s %12s %11s\n", "", "hilos", "hechos", "vueltas", "búsquedas", "tiempo", "hechos/s", "memoria");
+
+    for (size_t n : {200, 500})
+    {
+        TermStore store;
+        const std::vector<NodeId> c = constants(store, n);
+        const NodeId le_trans = statement_of<decltype(peano::order::le_trans())>(store);
+        measure("le_trans, cadena n = " + std::to_string(n), store, threads, [&](Datalog &datalog) {
+            datalog.add(le_trans);
+            for (size_t i = 0; i + 1 < n; ++i)
+                datalog.add(atom(store, "Le", c[i], c[i + 1]));
+        });
+    }
+
+    for (size_t n : {1000, 2000})
+    {
+        TermStore store;
+        const std::vector<NodeId> c = constants(store, n);
+        std::mt19937 random(42);
+        std::vector<NodeId> edges;
+        for (size_t e = 0; e < 2 * n; ++e)
+            edges.push_back(atom(store, "Edge", c[random() % n], c[random() % n]));
+        const NodeId base = reify<PathBase>(store), step = reify<PathStep>(store);
+        measure("Path lineal, grafo n = " + std::to_string(n), store, threads, [&](Datalog &datalog) {
+            datalog.add(base);
+            datalog.add(step);
+            for (const NodeId edge : edges)
+                datalog.add(edge);
+        });
+    }
+
+    {
+        constexpr size_t n = 1000000;
+        TermStore store;
+        const std::vector<NodeId> c = constants(store, n);
+        std::vector<NodeId> humans;
+        for (const NodeId constant : c)
+            humans.push_back(store.atom("Human", std::span(&constant, 1)));
+        const NodeId mortality = reify<Mortality>(store);
+        measure("Human → Mortal, n = 1000000", store, threads, [&](Datalog &datalog) {
+            datalog.add(mortality);
+            for (const NodeId human : humans)
+                datalog.add(human);
+        });
+    }
+    return 0;
+}
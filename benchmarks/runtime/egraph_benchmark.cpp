@@ -0,0 +1,164 @@
+// Benchmark de la saturación de igualdades con e-grafos:
+//
+//   - las reglas de los lemas ∀x̄. L ↔ R de peano/ (orden, orden estricto,
+//     add_comm y add_assoc) sobre fórmulas con torres de S, Le/Lt mezclados
+//     y sumas relacionales bajo ∃, con la forma normal (la más pequeña) de
+//     cada una;
+//   - conmutatividad y asociatividad de ∧ sobre conjunciones de n átomos,
+//     con el límite de coincidencias por regla (retroceso) y sin él.
+//
+// Imprime por saturación el motivo de parada, las vueltas, los nodos y las
+// clases, las coincidencias, las uniones, el tiempo y el de la extracción;
+// para la primera, además, cada vuelta.
+//
+//   egraph_benchmark [vueltas, 12 por defecto]
+
+#include <logic_language/egraph.hpp>
+#include <theorems/peano/addition.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace
+{
+    using namespace logic;
+    using namespace logic::runtime;
+    using Clock = std::chrono::steady_clock;
+
+    const char *stop_name(SaturationStop stop)
+    {
+        switch (stop)
+        {
+        case SaturationStop::Saturated:
+            return "saturado";
+        case SaturationStop::IterationLimit:
+            return "vueltas";
+        case SaturationStop::NodeLimit:
+            return "nodos";
+        default:
+            return "tiempo";
+        }
+    }
+
+    void header()
+    {
+        std::printf("%-30s %6s %-9s %7s %9s %9s %10s %9s %10s %10s\n", "saturación", "reglas", "parada", "vueltas", "nodos", "clases",
+                    "coincid.", "uniones", "ms", "ms extr.");
+    }
+
+    void report(const char *name, size_t rules, const SaturationReport &report, double extract_seconds)
+    {
+        std::printf("%-30s %6zu %-9s %7zu %9zu %9zu %10ju %9ju %10.3f %10.3f\n", name, rules, stop_name(report.stop), report.iterations,
+                    report.nodes, report.classes, static_cast<std::uintmax_t>(report.matches), static_cast<std::uintmax_t>(report.unions),
+                    report.seconds * 1e3, extract_seconds * 1e3);
+    }
+
+    double seconds_since(Clock::time_point start) { return std::chrono::duration<double>(Clock::now() - start).count(); }
+} // namespace
+
+#define EQUIVALENCE(theorem) saturation.add_equivalence(#theorem, statement_of<decltype(theorem())>(store))
+
+int main(int argc, char **argv)
+{
+    using namespace logic::peano;
+    SaturationOptions options;
+    options.max_iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 12;
+    options.max_nodes = 1000000;
+    options.max_seconds = 30.0;
+
+    header();
+    {
+        TermStore store;
+        EqualitySaturation saturation(store);
+        EQUIVALENCE(order::le_definition);
+        EQUIVALENCE(order::succ_le_succ_iff);
+        EQUIVALENCE(order::le_iff_lt_succ);
+        EQUIVALENCE(order::le_zero_eq_zero);
+        EQUIVALENCE(strict_order::lt_succ_iff_lt_or_eq);
+        EQUIVALENCE(strict_order::succ_lt_succ_iff);
+        EQUIVALENCE(addition::add_comm);
+        EQUIVALENCE(addition::add_assoc);
+
+        const auto apply = [&](std::string_view f, std::initializer_list<NodeId> args) { return store.atom(f, std::span(args.begin(), args.size())); };
+        const auto tower = [&](NodeId x, size_t k) {
+            for (size_t i = 0; i < k; ++i)
+                x = apply("S", {x});
+            return x;
+        };
+        std::vector<NodeId> constants;
+        for (int i = 0; i < 8; ++i)
+            constants.push_back(store.constant("c" + std::to_string(i)));
+
+        // Torres de S bajo Lt y Le, y sumas de tres términos bajo ∃p
+        std::vector<NodeId> formulas;
+        for (size_t k = 1; k <= 16; ++k)
+        {
+            formulas.push_back(apply("Lt", {tower(constants[k % 8], k), tower(constants[(k + 1) % 8], k)}));
+            formulas.push_back(apply("Le", {tower(constants[k % 8], k + 1), tower(constants[(k + 3) % 8], k)}));
+        }
+        const NodeId p = store.variable("p");
+        for (size_t i = 0; i < 8; ++i)
+        {
+            const NodeId a = constants[i], b = constants[(i + 1) % 8], c = constants[(i + 2) % 8], d = constants[(i + 5) % 8];
+            formulas.push_back(store.binder(NodeOp::Exists, "p", store.binary(NodeOp::And, apply("Add", {a, b, p}), apply("Add", {p, c, d}))));
+        }
+        for (const NodeId formula : formulas)
+            saturation.add(formula);
+
+        const SaturationReport result = saturation.saturate(options);
+        const Clock::time_point start = Clock::now();
+        size_t before = 0, after = 0;
+        std::vector<NodeId> normal;
+        for (const NodeId formula : formulas)
+        {
+            normal.push_back(saturation.extract(formula));
+            before += store.text(formula).size();
+            after += store.text(normal.back()).size();
+        }
+        report("peano/ (lemas ↔)", saturation.rules().size(), result, seconds_since(start));
+
+        std::printf("\n  %5s %9s %9s %10s %9s %7s %10s\n", "vuelta", "nodos", "clases", "coincid.", "uniones", "prohib.", "ms");
+        for (size_t i = 0; i < result.history.size(); ++i)
+        {
+            const SaturationIteration &step = result.history[i];
+            std::printf("  %5zu %9zu %9zu %10ju %9ju %7zu %10.3f\n", i + 1, step.nodes, step.classes, static_cast<std::uintmax_t>(step.matches),
+                        static_cast<std::uintmax_t>(step.unions), step.banned, step.seconds * 1e3);
+        }
+        std::printf("\n  %zu fórmulas: %zu caracteres antes de extraer, %zu después\n", formulas.size(), before, after);
+        std::printf("  %s\n    ⇒ %s\n\n", store.text(formulas[14]).c_str(), store.text(normal[14]).c_str());
+    }
+
+    // ∧ conmutativa y asociativa: todas las formas de una conjunción
+    header();
+    for (const size_t atoms : {6, 8, 10})
+        for (const bool backoff : {true, false})
+        {
+            TermStore store;
+            EqualitySaturation saturation(store);
+            const NodeId x = store.variable("x"), y = store.variable("y"), z = store.variable("z");
+            const auto conj = [&](NodeId l, NodeId r) { return store.binary(NodeOp::And, l, r); };
+            saturation.add_rewrite("and_comm", conj(x, y), conj(y, x));
+            saturation.add_rewrite("and_assoc →", conj(conj(x, y), z), conj(x, conj(y, z)));
+            saturation.add_rewrite("and_assoc ←", conj(x, conj(y, z)), conj(conj(x, y), z));
+            NodeId formula = store.atom("P0", {});
+            for (size_t i = 1; i < atoms; ++i)
+                formula = conj(formula, store.atom("P" + std::to_string(i), {}));
+            saturation.add(formula);
+
+            SaturationOptions run = options;
+            if (!backoff)
+                run.match_limit = ~size_t{0} >> 16;
+            const SaturationReport result = saturation.saturate(run);
+            const Clock::time_point start = Clock::now();
+            saturation.extract(formula);
+            const std::string name = "∧ de " + std::to_string(atoms) + (backoff ? ", retroceso" : ", sin límite");
+            report(name.c_str(), saturation.rules().size(), result, seconds_since(start));
+        }
+    return 0;
+}
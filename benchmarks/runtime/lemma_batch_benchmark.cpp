@@ -0,0 +1,128 @@
+// Benchmark del comprobador de lemas en paralelo: una biblioteca sintética
+// de Layers capas de Width lemas; cada lema es una derivación completa con
+// las seis reglas (como el escenario `deduction`) que además asume los
+// enunciados de dos lemas de la capa anterior. Compara un hilo con N hilos
+// e imprime la latencia por lema (mediana, p99 y máxima), la espera desde
+// que un lema está listo hasta que empieza y la aceleración.
+//
+//   lemma_batch_benchmark                           8 capas de 64 lemas, todos los núcleos
+//   lemma_batch_benchmark <layers> <width> <threads>
+
+#include <logic_language/lemma_batch.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace logic::runtime;
+
+    constexpr size_t chain = 64;    // Modus ponens por lema
+    constexpr size_t variables = 4; // Variables generalizadas e instanciadas
+
+    // Lema (layer, index): A_0, A_i → A_{i+1} ⊢ A_chain, descarga, ∀ e
+    // instanciación de las variables y, por cada dependencia D, D ⊢ φ
+    NodeId lemma(TermStore &store, ProofCertificate &certificate, size_t layer, size_t index, std::span<const NodeId> dependencies)
+    {
+        const std::string name = "L" + std::to_string(layer) + "_" + std::to_string(index);
+        std::vector<NodeId> vars;
+        for (size_t j = 0; j < variables; ++j)
+            vars.push_back(store.variable("v" + std::to_string(j)));
+        auto atom = [&](size_t i) {
+            std::vector<NodeId> args{store.constant(std::to_string(i))};
+            args.insert(args.end(), vars.begin(), vars.end());
+            return store.atom(name, args);
+        };
+
+        std::vector<NodeId> atoms{atom(0)}, steps;
+        StepId current = certificate.assume(atoms[0]);
+        for (size_t i = 0; i < chain; ++i)
+        {
+            atoms.push_back(atom(i + 1));
+            steps.push_back(store.binary(NodeOp::Implies, atoms[i], atoms[i + 1]));
+            current = certificate.modus_ponens(current, certificate.assume(steps.back()));
+        }
+        for (size_t i = chain; i > 0; --i)
+            current = certificate.implies_intro(steps[i - 1], current);
+        current = certificate.implies_intro(atoms[0], current);
+        for (const NodeId var : vars)
+            current = certificate.generalization(var, current);
+        for (size_t j = 0; j < variables; ++j)
+            current = certificate.universal_instantiation(current, store.constant(std::to_string(j)));
+        for (const NodeId dependency : dependencies)
+            current = certificate.modus_ponens(certificate.assume(dependency), certificate.implies_intro(dependency, current));
+        return ProofChecker(store).check(certificate).formula;
+    }
+
+    struct Library
+    {
+        std::unique_ptr<TermStore> store = std::make_unique<TermStore>();
+        std::unique_ptr<LemmaLibrary> library = std::make_unique<LemmaLibrary>(*store);
+    };
+
+    Library build(size_t layers, size_t width)
+    {
+        Library out;
+        std::vector<NodeId> previous;
+        for (size_t layer = 0; layer < layers; ++layer)
+        {
+            std::vector<NodeId> statements;
+            for (size_t index = 0; index < width; ++index)
+            {
+                std::vector<NodeId> dependencies;
+                if (!previous.empty())
+                    dependencies = {previous[index], previous[(index * 7 + 3) % previous.size()]};
+                ProofCertificate certificate;
+                const NodeId statement = lemma(*out.store, certificate, layer, index, dependencies);
+                out.library->add("L" + std::to_string(layer) + "_" + std::to_string(index), statement, std::move(certificate));
+                statements.push_back(statement);
+            }
+            previous = std::move(statements);
+        }
+        return out;
+    }
+
+    double percentile(std::vector<double> values, double p)
+    {
+        std::ranges::sort(values);
+        return values[std::min(values.size() - 1, static_cast<size_t>(p * static_cast<double>(values.size())))];
+    }
+
+    BatchReport measure(size_t layers, size_t width, size_t threads)
+    {
+        const Library library = build(layers, width);
+        const BatchReport report = library.library->check(threads);
+        std::vector<double> latency, wait;
+        for (const LemmaResult &result : report.lemmas)
+        {
+            latency.push_back(result.latency() * 1e3);
+            wait.push_back((result.start - result.ready) * 1e3);
+        }
+        std::printf("%3zu hilos %10.1f ms  latencia p50 %.3f ms  p99 %.3f ms  máx %.3f ms  espera p50 %.3f ms  (%zu/%zu válidos)\n",
+                    report.threads, report.seconds * 1e3, percentile(latency, 0.5), percentile(latency, 0.99), percentile(latency, 1.0),
+                    percentile(wait, 0.5), report.count(LemmaStatus::Valid), report.lemmas.size());
+        if (report.count(LemmaStatus::Valid) != report.lemmas.size())
+        {
+            std::fprintf(stderr, "ERROR: hay lemas no válidos\n");
+            std::exit(1);
+        }
+        return report;
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const size_t layers = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 8;
+    const size_t width = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 64;
+    const size_t threads = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+
+    std::printf("%zu lemas (%zu capas de %zu), %zu núcleos\n", layers * width, layers, width, size_t{std::thread::hardware_concurrency()});
+    const double serial = measure(layers, width, 1).seconds;
+    const double parallel = measure(layers, width, threads).seconds;
+    std::printf("Aceleración con %zu hilos: %.2fx\n", threads, serial / parallel);
+    return 0;
+}
@@ -0,0 +1,149 @@
+// Benchmark de la comprobación incremental: una biblioteca sintética de
+// Layers capas de Width lemas (como en lemma_batch_benchmark, cada uno con
+// dos dependencias en la capa anterior) comprobada entera, otra vez sin
+// cambios y otra con la demostración de un lema cambiada. Cada ejecución
+// construye la biblioteca en un TermStore nuevo y lee la caché del disco,
+// como lo haría un proceso nuevo; el tiempo de construir la biblioteca no
+// se cuenta.
+//
+//   lemma_cache_benchmark                           40 capas de 256 lemas (10240)
+//   lemma_cache_benchmark <layers> <width> <threads>
+
+#include <logic_language/lemma_batch.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace logic::runtime;
+    using clock_type = std::chrono::steady_clock;
+
+    constexpr size_t chain = 16;
+    constexpr size_t variables = 2;
+
+    struct Position
+    {
+        size_t layer, index;
+    };
+
+    // A_0, A_i → A_{i+1} ⊢ A_chain, descarga, ∀ e instanciación y, por cada
+    // dependencia D, D ⊢ φ. Con `detour` la cadena pasa además por ⊢ A_0 → A_0:
+    // otra demostración del mismo enunciado.
+    NodeId lemma(TermStore &store, ProofCertificate &certificate, const std::string &name, std::span<const NodeId> dependencies, bool detour)
+    {
+        std::vector<NodeId> vars;
+        for (size_t j = 0; j < variables; ++j)
+            vars.push_back(store.variable("v" + std::to_string(j)));
+        auto atom = [&](size_t i) {
+            std::vector<NodeId> args{store.constant(std::to_string(i))};
+            args.insert(args.end(), vars.begin(), vars.end());
+            return store.atom(name, args);
+        };
+
+        std::vector<NodeId> atoms{atom(0)}, steps;
+        StepId current = certificate.assume(atoms[0]);
+        if (detour)
+            current = certificate.modus_ponens(current, certificate.axiom_identity(atoms[0]));
+        for (size_t i = 0; i < chain; ++i)
+        {
+            atoms.push_back(atom(i + 1));
+            steps.push_back(store.binary(NodeOp::Implies, atoms[i], atoms[i + 1]));
+            current = certificate.modus_ponens(current, certificate.assume(steps.back()));
+        }
+        for (size_t i = chain; i > 0; --i)
+            current = certificate.implies_intro(steps[i - 1], current);
+        current = certificate.implies_intro(atoms[0], current);
+        for (const NodeId var : vars)
+            current = certificate.generalization(var, current);
+        for (size_t j = 0; j < variables; ++j)
+            current = certificate.universal_instantiation(current, store.constant(std::to_string(j)));
+        for (const NodeId dependency : dependencies)
+            current = certificate.modus_ponens(certificate.assume(dependency), certificate.implies_intro(dependency, current));
+        return ProofChecker(store).check(certificate).formula;
+    }
+
+    struct Library
+    {
+        std::unique_ptr<TermStore> store = std::make_unique<TermStore>();
+        std::unique_ptr<LemmaLibrary> library = std::make_unique<LemmaLibrary>(*store);
+    };
+
+    Library build(size_t layers, size_t width, std::optional<Position> changed)
+    {
+        Library out;
+        std::vector<NodeId> previous;
+        for (size_t layer = 0; layer < layers; ++layer)
+        {
+            std::vector<NodeId> statements;
+            for (size_t index = 0; index < width; ++index)
+            {
+                std::vector<NodeId> dependencies;
+                if (!previous.empty())
+                    dependencies = {previous[index], previous[(index * 7 + 3) % previous.size()]};
+                const std::string name = "L" + std::to_string(layer) + "_" + std::to_string(index);
+                const bool detour = changed && changed->layer == layer && changed->index == index;
+                ProofCertificate certificate;
+                const NodeId statement = lemma(*out.store, certificate, name, dependencies, detour);
+                out.library->add(name, statement, std::move(certificate));
+                statements.push_back(statement);
+            }
+            previous = std::move(statements);
+        }
+        return out;
+    }
+
+    double since(clock_type::time_point begin) { return std::chrono::duration<double>(clock_type::now() - begin).count() * 1e3; }
+
+    // Lee la caché, comprueba la biblioteca y guarda la caché
+    void measure(const char *label, const std::string &path, size_t layers, size_t width, size_t threads, std::optional<Position> changed)
+    {
+        const Library library = build(layers, width, changed);
+
+        auto begin = clock_type::now();
+        LemmaCache cache(path);
+        const double load = since(begin);
+
+        const BatchReport report = library.library->check(cache, threads);
+
+        begin = clock_type::now();
+        cache.save();
+        const double save = since(begin);
+
+        const size_t checked = report.count(LemmaStatus::Valid) - report.cached();
+        std::printf("%-16s %9.1f ms  (leer %.1f ms, guardar %.1f ms)  %6zu comprobados, %6zu de la caché\n", label,
+                    load + report.seconds * 1e3 + save, load, save, checked, report.cached());
+        if (report.count(LemmaStatus::Valid) != report.lemmas.size())
+        {
+            std::fprintf(stderr, "ERROR: hay lemas no válidos\n");
+            std::exit(1);
+        }
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const size_t layers = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 40;
+    const size_t width = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 256;
+    const size_t threads = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+    const std::string path = (std::filesystem::temp_directory_path() / "logic_lemma_cache_benchmark.bin").string();
+    std::filesystem::remove(path);
+
+    std::printf("%zu lemas (%zu capas de %zu), %zu hilos\n", layers * width, layers, width, threads);
+    {
+        const Library library = build(layers, width, std::nullopt);
+        std::printf("%-16s %9.1f ms\n", "sin caché", library.library->check(threads).seconds * 1e3);
+    }
+    measure("caché vacía", path, layers, width, threads, std::nullopt);
+    measure("sin cambios", path, layers, width, threads, std::nullopt);
+    measure("un cambio", path, layers, width, threads, Position{layers / 2, width / 2});
+    std::printf("caché: %ju bytes\n", static_cast<std::uintmax_t>(std::filesystem::file_size(path)));
+
+    std::filesystem::remove(path);
+    return 0;
+}
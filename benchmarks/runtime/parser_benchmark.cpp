@@ -0,0 +1,134 @@
+// Benchmark de ingestión de enunciados en texto: mide el Parser en MB/s y
+// nodos/s construyendo en una FormulaArena y en un TermStore.
+//
+//   parser_benchmark                 corpus sintético de 20000 lemas tipo Peano
+//   parser_benchmark <n>             corpus sintético de n lemas
+//   parser_benchmark --file <ruta>   documento propio, proyectado en memoria
+
+#include <logic_language/mapped_file.hpp>
+#include <logic_language/parser.hpp>
+#include <logic_language/term_store.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    using namespace logic::runtime;
+
+    // Generador congruencial: el corpus es el mismo en cada ejecución
+    struct Random
+    {
+        std::uint64_t state = 0x9E3779B97F4A7C15ull;
+
+        size_t below(size_t n)
+        {
+            state = state * 6364136223846793005ull + 1442695040888963407ull;
+            return static_cast<size_t>(state >> 33) % n;
+        }
+    };
+
+    constexpr std::string_view variables[] = {"n", "m", "k", "p", "q"};
+    constexpr std::string_view predicates[] = {"Natural", "Plus", "Times", "Equal", "Less", "Le"};
+
+    void term(std::string &out, Random &random, size_t depth)
+    {
+        const size_t choice = random.below(depth == 0 ? 2 : 3);
+        if (choice == 0)
+            out += variables[random.below(std::size(variables))];
+        else if (choice == 1)
+            out += std::to_string(random.below(10));
+        else
+        {
+            out += "S(";
+            term(out, random, depth - 1);
+            out += ')';
+        }
+    }
+
+    void atom(std::string &out, Random &random)
+    {
+        const size_t predicate = random.below(std::size(predicates));
+        const size_t arity = predicate == 0 ? 1 : predicate < 3 ? 3 : 2;
+        out += predicates[predicate];
+        out += '(';
+        for (size_t i = 0; i < arity; ++i)
+        {
+            if (i != 0)
+                out += ", ";
+            term(out, random, 2);
+        }
+        out += ')';
+    }
+
+    // forall(n, m, ..., (G1 && G2 && ...) >> C), como los axiomas de peano/
+    std::string corpus(size_t lemmas)
+    {
+        Random random;
+        std::string out;
+        for (size_t i = 0; i < lemmas; ++i)
+        {
+            out += "lemma_" + std::to_string(i) + ": forall(";
+            const size_t bound = 1 + random.below(4);
+            for (size_t v = 0; v < bound; ++v)
+                (out += variables[v]) += ", ";
+            out += '(';
+            const size_t guards = 1 + random.below(4);
+            for (size_t g = 0; g < guards; ++g)
+            {
+                if (g != 0)
+                    out += " && ";
+                if (random.below(4) == 0)
+                    out += '!';
+                atom(out, random);
+            }
+            out += ") >> ";
+            atom(out, random);
+            out += ");\n";
+        }
+        return out;
+    }
+
+    template <typename Builder, typename Nodes>
+    void measure(const char *label, std::string_view source, Nodes nodes)
+    {
+        using clock = std::chrono::steady_clock;
+        size_t runs = 0, statements = 0, built = 0;
+        double seconds = 0;
+        while (seconds < 0.5 || runs < 3)
+        {
+            Builder builder;
+            const auto start = clock::now();
+            Parser<Builder> parser(source, builder);
+            statements = 0;
+            while (parser.next())
+                ++statements;
+            seconds += std::chrono::duration<double>(clock::now() - start).count();
+            built = nodes(builder);
+            ++runs;
+        }
+        const double per_run = seconds / static_cast<double>(runs);
+        std::printf("%-12s %8.1f MB/s %12.0f nodos/s  (%zu enunciados, %zu nodos, %zu repeticiones)\n", label,
+                    static_cast<double>(source.size()) / per_run / 1e6, static_cast<double>(built) / per_run, statements, built, runs);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::optional<MappedFile> file;
+    std::string generated;
+    std::string_view source;
+    if (argc == 3 && std::string_view(argv[1]) == "--file")
+        source = file.emplace(argv[2]).text();
+    else
+        source = generated = corpus(argc == 2 ? std::strtoull(argv[1], nullptr, 10) : 20000);
+
+    std::printf("Fuente: %.2f MB\n", static_cast<double>(source.size()) / 1e6);
+    measure<FormulaArena>("FormulaArena", source, [](const FormulaArena &arena) { return arena.size(); });
+    measure<TermStore>("TermStore", source, [](const TermStore &store) { return store.stats().lookups; });
+    return 0;
+}
@@ -0,0 +1,185 @@
+// Benchmark del comprobador de certificados: la misma derivación que el
+// escenario `deduction` de benchmarks/compile_time (las seis reglas), como
+// certificado comprobado por ProofChecker. Imprime pasos/s por tamaño para
+// compararlo con `compile_benchmark.py run --scenarios deduction`, y después
+// el mismo certificado en formato binario: tamaño, tiempo de carga y memoria
+// residente tras abrirlo, y comprobación sobre la proyección.
+//
+//   proof_checker_benchmark                  tamaños del benchmark de compilación y mayores
+//   proof_checker_benchmark <depth> <width>  un solo tamaño
+
+#include "../compile_time/kernel_scenarios.hpp"
+
+#include <logic_language/certificate_file.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace
+{
+    using namespace logic::runtime;
+
+    // Certificado de deduction<Depth, Width> y la fórmula que demuestra
+    struct Derivation
+    {
+        ProofCertificate certificate;
+        NodeId formula;
+    };
+
+    Derivation deduction(TermStore &store, size_t depth, size_t width)
+    {
+        std::vector<NodeId> variables;
+        for (size_t j = 0; j < width; ++j)
+            variables.push_back(store.variable("v" + std::to_string(j)));
+
+        // A_i = A(i, v0, ..., v{width-1})
+        auto atom = [&](size_t i) {
+            std::vector<NodeId> args{store.constant(std::to_string(i))};
+            args.insert(args.end(), variables.begin(), variables.end());
+            return store.atom("A", args);
+        };
+
+        Derivation derivation;
+        ProofCertificate &certificate = derivation.certificate;
+        certificate.reserve(3 * depth + 2 * width + 4);
+
+        std::vector<NodeId> atoms{atom(0)};
+        std::vector<NodeId> steps;
+        StepId current = certificate.assume(atoms[0]);
+        for (size_t i = 0; i < depth; ++i)
+        {
+            atoms.push_back(atom(i + 1));
+            steps.push_back(store.binary(NodeOp::Implies, atoms[i], atoms[i + 1]));
+            current = certificate.modus_ponens(current, certificate.assume(steps.back()));
+        }
+        for (size_t i = depth; i > 0; --i)
+            current = certificate.implies_intro(steps[i - 1], current);
+        current = certificate.implies_intro(atoms[0], current);
+        for (const NodeId variable : variables)
+            current = certificate.generalization(variable, current);
+        for (size_t j = 0; j < width; ++j)
+            current = certificate.universal_instantiation(current, store.constant(std::to_string(j)));
+
+        // La fórmula cerrada se calcula una vez para el paso de axiom_identity
+        const NodeId closed = ProofChecker(store).check(certificate).formula;
+        certificate.modus_ponens(current, certificate.axiom_identity(closed));
+        derivation.formula = closed;
+        return derivation;
+    }
+
+    void measure(size_t depth, size_t width)
+    {
+        using clock = std::chrono::steady_clock;
+        TermStore store;
+        const Derivation derivation = deduction(store, depth, width);
+
+        size_t runs = 0;
+        double best = 1e30, total = 0;
+        while (total < 0.5 || runs < 3)
+        {
+            ProofChecker checker(store);
+            const auto start = clock::now();
+            const CheckedTheorem theorem = checker.check(derivation.certificate);
+            const double seconds = std::chrono::duration<double>(clock::now() - start).count();
+            if (theorem.formula != derivation.formula || !theorem.context.empty())
+            {
+                std::fprintf(stderr, "ERROR: el certificado %zux%zu no demuestra la fórmula esperada\n", depth, width);
+                std::exit(1);
+            }
+            best = std::min(best, seconds);
+            total += seconds;
+            ++runs;
+        }
+        const size_t steps = derivation.certificate.size();
+        std::printf("%5zux%-3zu %8zu pasos %10.3f ms %12.0f pasos/s  (%zu nodos, %zu repeticiones)\n", depth, width, steps,
+                    best * 1e3, static_cast<double>(steps) / best, store.stats().nodes, runs);
+    }
+
+    // Memoria residente del proceso (solo Linux; 0 en otros sistemas)
+    size_t resident_kb()
+    {
+#if defined(__linux__)
+        std::ifstream statm("/proc/self/statm");
+        size_t pages = 0, resident = 0;
+        statm >> pages >> resident;
+        return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE)) / 1024;
+#else
+        return 0;
+#endif
+    }
+
+    void measure_file(size_t depth, size_t width)
+    {
+        using clock = std::chrono::steady_clock;
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "logic_proof_checker_benchmark.bin";
+        {
+            TermStore store;
+            const Derivation derivation = deduction(store, depth, width);
+            write_certificate(path.string(), store, derivation.certificate);
+        }
+
+        const size_t resident = resident_kb();
+        auto start = clock::now();
+        const CertificateFile file(path.string());
+        const double load = std::chrono::duration<double>(clock::now() - start).count();
+        const size_t loaded = resident_kb();
+
+        start = clock::now();
+        file.validate();
+        CertificateStore store(file);
+        const CheckedTheorem theorem = BasicProofChecker<CertificateStore>(store).check(file.steps());
+        const double check = std::chrono::duration<double>(clock::now() - start).count();
+        if (!theorem.context.empty())
+        {
+            std::fprintf(stderr, "ERROR: el fichero %zux%zu no demuestra un teorema sin hipótesis\n", depth, width);
+            std::exit(1);
+        }
+        std::printf("%5zux%-3zu %8.2f MB %9.1f us  RSS %+6zd KB %10.3f ms  (%zu nodos en el fichero, %zu nuevos)\n", depth, width,
+                    static_cast<double>(std::filesystem::file_size(path)) / 1e6, load * 1e6,
+                    static_cast<std::ptrdiff_t>(loaded) - static_cast<std::ptrdiff_t>(resident), check * 1e3, file.nodes().size(),
+                    store.created());
+        std::filesystem::remove(path);
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    // El certificado demuestra lo mismo que el kernel de tipos
+    {
+        using Scenario = logic::bench::scenarios::deduction<8, 4>;
+        TermStore store;
+        const Derivation derivation = deduction(store, 8, 4);
+        const CheckedTheorem theorem = ProofChecker(store).check(derivation.certificate);
+        if (theorem.formula != logic::runtime::reify<Scenario::result::formula_type>(store) || !theorem.context.empty())
+        {
+            std::fprintf(stderr, "ERROR: el certificado y deduction<8, 4> no demuestran lo mismo\n");
+            return 1;
+        }
+    }
+
+    if (argc == 3)
+    {
+        measure(std::strtoull(argv[1], nullptr, 10), std::strtoull(argv[2], nullptr, 10));
+        measure_file(std::strtoull(argv[1], nullptr, 10), std::strtoull(argv[2], nullptr, 10));
+        return 0;
+    }
+
+    // Los tamaños de compile_benchmark.py y después los que el compilador no alcanza
+    const std::pair<size_t, size_t> sizes[] = {{8, 4}, {32, 8}, {64, 16}, {128, 16}, {256, 16}, {1024, 16}, {4096, 16}, {16384, 16}};
+    for (const auto &[depth, width] : sizes)
+        measure(depth, width);
+    std::printf("\nCertificado binario (carga = abrir y proyectar; comprobación = validate() + check sobre el fichero)\n");
+    for (const auto &[depth, width] : sizes)
+        measure_file(depth, width);
+    return 0;
+}
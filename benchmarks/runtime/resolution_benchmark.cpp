@@ -0,0 +1,156 @@
+// Benchmark del demostrador de superposición sobre el corpus de peano/:
+// cada lema (sus enunciados son BY_AXIOM(φ), φ → φ) se intenta demostrar
+// a partir de todos los demás, axiomas de Peano incluidos. PA5 es un
+// esquema (una plantilla por fórmula) y no entra.
+//
+// Imprime por lema el resultado, el tiempo, las cláusulas activadas y
+// generadas, las cláusulas por segundo y la longitud de la demostración;
+// al final, el total.
+//
+//   resolution_benchmark [segundos por lema, 1 por defecto]
+
+#include <logic_language/resolution.hpp>
+#include <theorems/peano/addition.hpp>
+#include <theorems/peano/max_min.hpp>
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace logic;
+    using namespace logic::runtime;
+
+    struct Lemma
+    {
+        const char *name;
+        NodeId statement;
+    };
+
+    const char *result_name(ProverResult result)
+    {
+        switch (result)
+        {
+        case ProverResult::Proved:
+            return "demostrado";
+        case ProverResult::Saturated:
+            return "saturado";
+        default:
+            return "límite";
+        }
+    }
+} // namespace
+
+#define LEMMA(theorem) corpus.push_back({#theorem, statement_of<decltype(theorem())>(store)})
+
+int main(int argc, char **argv)
+{
+    using namespace logic::peano;
+    ProverOptions options;
+    options.max_seconds = argc > 1 ? std::atof(argv[1]) : 1.0;
+
+    TermStore store;
+    std::vector<Lemma> corpus;
+    LEMMA(PA1);
+    LEMMA(PA2);
+    LEMMA(PA3);
+    LEMMA(PA4);
+    LEMMA(neq_succ);
+    LEMMA(succ_neq_zero);
+    LEMMA(plus_zero);
+    LEMMA(plus_succ);
+    LEMMA(times_zero);
+    LEMMA(times_succ);
+
+    LEMMA(strict_order::lt_then_neq);
+    LEMMA(strict_order::neq_then_lt_or_gt);
+    LEMMA(strict_order::trichotomy);
+    LEMMA(strict_order::lt_asymm);
+    LEMMA(strict_order::lt_irrefl);
+    LEMMA(strict_order::lt_trans);
+    LEMMA(strict_order::lt_succ_self);
+    LEMMA(strict_order::lt_zero);
+    LEMMA(strict_order::zero_lt_succ);
+    LEMMA(strict_order::lt_succ_iff_lt_or_eq);
+    LEMMA(strict_order::succ_lt_succ_iff);
+
+    LEMMA(order::le_definition);
+    LEMMA(order::zero_le);
+    LEMMA(order::le_refl);
+    LEMMA(order::le_trans);
+    LEMMA(order::le_antisymm);
+    LEMMA(order::le_total);
+    LEMMA(order::succ_le_succ_iff);
+    LEMMA(order::le_iff_lt_succ);
+    LEMMA(order::lt_imp_le);
+    LEMMA(order::le_succ_self);
+    LEMMA(order::le_zero_eq_zero);
+
+    LEMMA(addition::add_zero);
+    LEMMA(addition::add_succ);
+    LEMMA(addition::zero_add);
+    LEMMA(addition::add_comm);
+    LEMMA(addition::add_assoc);
+    LEMMA(addition::add_cancelation);
+    LEMMA(addition::le_self_add);
+    LEMMA(addition::lt_self_add);
+    LEMMA(addition::add_lt_add_left);
+    LEMMA(addition::le_then_exists_add);
+    LEMMA(addition::lt_then_exists_add_succ);
+
+    LEMMA(max_min::max_idem);
+    LEMMA(max_min::min_idem);
+    LEMMA(max_min::min_zero_left);
+    LEMMA(max_min::max_zero_left);
+    LEMMA(max_min::max_comm);
+    LEMMA(max_min::min_comm);
+    LEMMA(max_min::max_is_either);
+    LEMMA(max_min::min_is_either);
+    LEMMA(max_min::lt_then_min_left);
+    LEMMA(max_min::lt_then_max_right);
+    LEMMA(max_min::le_max_left);
+    LEMMA(max_min::le_max_right);
+    LEMMA(max_min::min_le_left);
+    LEMMA(max_min::min_le_right);
+    LEMMA(max_min::max_associative);
+    LEMMA(max_min::min_associative);
+    LEMMA(max_min::eq_iff_max_eq_min);
+    LEMMA(max_min::max_distributes_over_min);
+    LEMMA(max_min::min_distributes_over_max);
+
+    std::printf("%zu lemas; cada uno a partir de los demás, límite %.2f s\n\n", corpus.size(), options.max_seconds);
+    std::printf("%-36s %-11s %10s %8s %10s %12s %6s\n", "lema", "resultado", "ms", "activas", "generadas", "cláusulas/s", "pasos");
+
+    size_t proved = 0;
+    std::uint64_t generated = 0;
+    double seconds = 0.0, proof_seconds = 0.0;
+    for (size_t goal = 0; goal < corpus.size(); ++goal)
+    {
+        ResolutionProver prover(store);
+        for (size_t i = 0; i < corpus.size(); ++i)
+            if (i != goal)
+                prover.add_axiom(corpus[i].statement);
+        prover.add_goal(corpus[goal].statement);
+        const ProverResult result = prover.prove(options);
+
+        const ProverStats &stats = prover.stats();
+        std::printf("%-36s %-11s %10.3f %8ju %10ju %12.0f %6zu\n", corpus[goal].name, result_name(result), stats.seconds * 1e3,
+                    static_cast<std::uintmax_t>(stats.given), static_cast<std::uintmax_t>(stats.generated), stats.clauses_per_second(),
+                    prover.proof().size());
+        generated += stats.generated;
+        seconds += stats.seconds;
+        if (result == ProverResult::Proved)
+        {
+            ++proved;
+            proof_seconds += stats.seconds;
+        }
+    }
+
+    std::printf("\n%zu de %zu demostrados (%.2f ms de media), %ju cláusulas generadas en %.2f s: %.0f cláusulas/s\n", proved, corpus.size(),
+                proved ? proof_seconds * 1e3 / static_cast<double>(proved) : 0.0, static_cast<std::uintmax_t>(generated), seconds,
+                seconds > 0.0 ? static_cast<double>(generated) / seconds : 0.0);
+    return 0;
+}
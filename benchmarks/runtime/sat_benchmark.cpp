@@ -0,0 +1,154 @@
+// Benchmark del resolvedor SAT con familias clásicas:
+//
+//   - palomar: n + 1 palomas en n agujeros (insatisfacible, exponencial
+//     para la resolución);
+//   - 3-SAT aleatorio en el umbral (4.26 cláusulas por variable), donde
+//     más o menos la mitad son satisfacibles;
+//   - validez por Tseitin: el silogismo encadenado de n átomos y la
+//     asociatividad de ↔ (p0 ↔ (p1 ↔ ... ) frente a ((p0 ↔ p1) ↔ ...)).
+//
+// Imprime el tiempo, los conflictos por segundo y las propagaciones por
+// segundo de cada caso.
+//
+//   sat_benchmark
+//   sat_benchmark <semilla>
+
+#include <logic_language/sat.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace logic::runtime;
+    using clock_type = std::chrono::steady_clock;
+
+    using Clause = std::vector<SatLiteral>;
+
+    struct Run
+    {
+        SatResult result;
+        double seconds;
+        SatStats stats;
+    };
+
+    Run solve(size_t variables, const std::vector<Clause> &clauses)
+    {
+        const auto begin = clock_type::now();
+        SatSolver solver;
+        for (size_t i = 0; i < variables; ++i)
+            solver.new_variable();
+        for (const Clause &clause : clauses)
+            solver.add_clause(clause);
+        const SatResult result = solver.solve();
+        return {result, std::chrono::duration<double>(clock_type::now() - begin).count(), solver.stats()};
+    }
+
+    void print(const std::string &label, const char *result, double seconds, const SatStats &stats)
+    {
+        std::printf("%-28s %-7s %10.2f ms %9ju conflictos (%7.0f k/s) %8.1f M prop./s\n", label.c_str(), result, seconds * 1e3,
+                    static_cast<std::uintmax_t>(stats.conflicts), stats.conflicts / seconds * 1e-3, stats.propagations / seconds * 1e-6);
+    }
+
+    const char *name(SatResult result) { return result == SatResult::Satisfiable ? "SAT" : result == SatResult::Unsatisfiable ? "UNSAT" : "?"; }
+
+    void pigeonhole(size_t holes)
+    {
+        const auto var = [&](size_t pigeon, size_t hole) { return static_cast<SatVariable>(pigeon * holes + hole); };
+        std::vector<Clause> clauses;
+        for (size_t pigeon = 0; pigeon <= holes; ++pigeon)
+        {
+            Clause some;
+            for (size_t hole = 0; hole < holes; ++hole)
+                some.push_back(SatLiteral::positive(var(pigeon, hole)));
+            clauses.push_back(some);
+        }
+        for (size_t hole = 0; hole < holes; ++hole)
+            for (size_t a = 0; a <= holes; ++a)
+                for (size_t b = a + 1; b <= holes; ++b)
+                    clauses.push_back({SatLiteral::negative(var(a, hole)), SatLiteral::negative(var(b, hole))});
+        const Run run = solve((holes + 1) * holes, clauses);
+        print("palomar " + std::to_string(holes + 1) + "/" + std::to_string(holes), name(run.result), run.seconds, run.stats);
+    }
+
+    // `count` fórmulas de n variables; los totales de todas
+    void random_3sat(size_t n, size_t count, std::mt19937 &random)
+    {
+        double seconds = 0;
+        SatStats total;
+        size_t satisfiable = 0;
+        for (size_t instance = 0; instance < count; ++instance)
+        {
+            std::vector<Clause> clauses(static_cast<size_t>(static_cast<double>(n) * 4.26));
+            for (Clause &clause : clauses)
+                while (clause.size() < 3)
+                {
+                    const auto variable = static_cast<SatVariable>(random() % n);
+                    if (std::ranges::none_of(clause, [&](SatLiteral literal) { return literal.variable() == variable; }))
+                        clause.push_back(random() % 2 ? SatLiteral::positive(variable) : SatLiteral::negative(variable));
+                }
+            const Run run = solve(n, clauses);
+            seconds += run.seconds;
+            satisfiable += run.result == SatResult::Satisfiable;
+            total.conflicts += run.stats.conflicts;
+            total.propagations += run.stats.propagations;
+        }
+        const std::string result = std::to_string(satisfiable) + "/" + std::to_string(count);
+        print("3-SAT n = " + std::to_string(n) + " (x" + std::to_string(count) + ")", result.c_str(), seconds, total);
+    }
+
+    void validity(const std::string &label, TermStore &store, NodeId formula)
+    {
+        const auto begin = clock_type::now();
+        SatProver prover(store, formula);
+        const bool valid = prover.valid();
+        print(label, valid ? "válida" : "no", std::chrono::duration<double>(clock_type::now() - begin).count(), prover.solver().stats());
+    }
+
+    void syllogism(size_t n)
+    {
+        TermStore store;
+        std::vector<NodeId> p;
+        for (size_t i = 0; i < n; ++i)
+            p.push_back(store.atom("p" + std::to_string(i), {}));
+        NodeId chain = store.binary(NodeOp::Implies, p[0], p[1]);
+        for (size_t i = 1; i + 1 < n; ++i)
+            chain = store.binary(NodeOp::And, chain, store.binary(NodeOp::Implies, p[i], p[i + 1]));
+        validity("silogismo n = " + std::to_string(n), store, store.binary(NodeOp::Implies, chain, store.binary(NodeOp::Implies, p[0], p[n - 1])));
+    }
+
+    void equiv_associativity(size_t n)
+    {
+        TermStore store;
+        std::vector<NodeId> p;
+        for (size_t i = 0; i < n; ++i)
+            p.push_back(store.atom("p" + std::to_string(i), {}));
+        NodeId left = p[0], right = p[n - 1];
+        for (size_t i = 1; i < n; ++i)
+        {
+            left = store.binary(NodeOp::Equiv, left, p[i]);
+            right = store.binary(NodeOp::Equiv, p[n - 1 - i], right);
+        }
+        validity("asociatividad de Equiv n = " + std::to_string(n), store, store.binary(NodeOp::Equiv, left, right));
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    std::mt19937 random(argc > 1 ? static_cast<std::uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 2024);
+
+    for (size_t holes : {7, 8, 9})
+        pigeonhole(holes);
+    for (size_t n : {100, 150, 200})
+        random_3sat(n, 20, random);
+    for (size_t n : {1000, 10000, 100000})
+        syllogism(n);
+    for (size_t n : {16, 32, 64, 128})
+        equiv_associativity(n);
+    return 0;
+}
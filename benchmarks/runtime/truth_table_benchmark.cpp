@@ -0,0 +1,95 @@
+// Benchmark de la tabla de verdad: el silogismo encadenado
+// (p0 → p1) ∧ ... ∧ (p(n−2) → p(n−1)) → (p0 → p(n−1)), una tautología, así
+// que hay que evaluar las 2^n asignaciones. Imprime asignaciones por segundo
+// con un hilo y con N, y compara con evaluar una asignación cada vez.
+//
+//   truth_table_benchmark               n = 16, 20, 24, 28, 30
+//   truth_table_benchmark <n> <threads>
+
+#include <logic_language/truth_table.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace
+{
+    using namespace logic::runtime;
+    using clock_type = std::chrono::steady_clock;
+
+    NodeId syllogism(TermStore &store, size_t n)
+    {
+        std::vector<NodeId> p;
+        for (size_t i = 0; i < n; ++i)
+            p.push_back(store.atom("p" + std::to_string(i), {}));
+        NodeId chain = store.binary(NodeOp::Implies, p[0], p[1]);
+        for (size_t i = 1; i + 1 < n; ++i)
+            chain = store.binary(NodeOp::And, chain, store.binary(NodeOp::Implies, p[i], p[i + 1]));
+        return store.binary(NodeOp::Implies, chain, store.binary(NodeOp::Implies, p[0], p[n - 1]));
+    }
+
+    // Una asignación cada vez, recorriendo el árbol (la referencia)
+    bool evaluate(const TermStore &store, const TruthTable &table, NodeId id, std::uint64_t assignment)
+    {
+        const Node &node = store[id];
+        switch (node.op)
+        {
+        case NodeOp::And:
+            return evaluate(store, table, node.operands[0], assignment) && evaluate(store, table, node.operands[1], assignment);
+        case NodeOp::Implies:
+            return !evaluate(store, table, node.operands[0], assignment) || evaluate(store, table, node.operands[1], assignment);
+        default:
+            return TruthTable::value(assignment, static_cast<size_t>(std::ranges::find(table.atoms(), id) - table.atoms().begin()));
+        }
+    }
+
+    double seconds(auto &&body)
+    {
+        const auto begin = clock_type::now();
+        body();
+        return std::chrono::duration<double>(clock_type::now() - begin).count();
+    }
+
+    void measure(size_t n, size_t threads)
+    {
+        TermStore store;
+        const NodeId formula = syllogism(store, n);
+        const TruthTable table(store, formula);
+        const double assignments = static_cast<double>(std::uint64_t{1} << n);
+
+        bool ok = true;
+        const double serial = seconds([&] { ok &= table.tautology(1); });
+        const double parallel = threads > 1 ? seconds([&] { ok &= table.tautology(threads); }) : serial;
+        std::printf("n = %2zu  %3zu instrucciones  1 hilo %9.3f ms (%6.2f G asig./s)  %zu hilos %9.3f ms (%6.2f G asig./s)", n,
+                    table.instructions(), serial * 1e3, assignments / serial * 1e-9, threads, parallel * 1e3, assignments / parallel * 1e-9);
+
+        // La referencia solo hasta 2^20 asignaciones
+        if (n <= 20)
+        {
+            const double naive = seconds([&] {
+                for (std::uint64_t assignment = 0; assignment < std::uint64_t{1} << n; ++assignment)
+                    ok &= evaluate(store, table, formula, assignment);
+            });
+            std::printf("  una a una %9.1f ms (%.0fx)", naive * 1e3, naive / serial);
+        }
+        std::printf("\n");
+        if (!ok)
+        {
+            std::fprintf(stderr, "ERROR: el silogismo no ha salido tautología\n");
+            std::exit(1);
+        }
+    }
+} // namespace
+
+int main(int argc, char **argv)
+{
+    const size_t threads = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : std::max(1u, std::thread::hardware_concurrency());
+    if (argc > 1)
+        measure(std::strtoull(argv[1], nullptr, 10), threads);
+    else
+        for (size_t n : {16, 20, 24, 28, 30})
+            measure(n, threads);
+    return 0;
+}
@@ -0,0 +1,196 @@
+// Auditoría de BY_AXIOM en los teoremas de peano/: axiom_identity(φ) da
+// ⊢ φ → φ, no ⊢ φ, así que citar así un axioma no demuestra su enunciado
+// salvo que φ sea una tautología. Con las demostraciones con traza se
+// recorre el árbol de reglas de cada teorema, se buscan todos los
+// axiom_identity (también los que quedan dentro de otras reglas) y se
+// evalúa φ con la tabla de verdad: cada φ que no es una tautología es un
+// uso incorrecto, y se imprime con una asignación que la hace falsa.
+//
+// Solo cubre las cabeceras que compilan: peano/basic_theorems.hpp, zfc/ y
+// lean_bridge.hpp no compilan hoy.
+
+#define LOGIC_TRACE_PROOFS 1
+
+#include <logic_language/truth_table.hpp>
+#include <theorems/peano/addition.hpp>
+#include <theorems/peano/max_min.hpp>
+
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+using namespace logic;
+using namespace logic::runtime;
+
+// Las fórmulas de los axiom_identity de una demostración, en orden
+template <typename Proof>
+struct AxiomUses
+{
+    using type = TypeList<>;
+};
+
+template <typename A>
+struct AxiomUses<proof::AxiomIdentity<A>>
+{
+    using type = TypeList<A>;
+};
+
+template <typename Hyp, typename Premise>
+struct AxiomUses<proof::ImpliesIntro<Hyp, Premise>> : AxiomUses<Premise>
+{
+};
+
+template <typename Antecedent, typename Implication>
+struct AxiomUses<proof::ModusPonens<Antecedent, Implication>>
+{
+    using type = typename ConcatLists<typename AxiomUses<Antecedent>::type, typename AxiomUses<Implication>::type>::type;
+};
+
+template <typename V, typename Premise>
+struct AxiomUses<proof::Generalization<V, Premise>> : AxiomUses<Premise>
+{
+};
+
+template <typename Premise, typename Term>
+struct AxiomUses<proof::UniversalInstantiation<Premise, Term>> : AxiomUses<Premise>
+{
+};
+
+// El cuerpo bajo los ∀ del principio: ∀x. φ es una tautología si y solo si
+// φ lo es, y el contraejemplo de φ dice qué átomos la hacen falsa
+template <typename F>
+struct Matrix
+{
+    using type = F;
+};
+
+template <typename V, typename Body>
+struct Matrix<Forall<V, Body>> : Matrix<Body>
+{
+};
+
+// Lo que encuentra hoy la auditoría: ctest falla si cambia, para que un
+// teorema nuevo con BY_AXIOM, o uno que deja de usarlo, actualice la cuenta
+inline constexpr int expected_theorems = 63;
+inline constexpr int expected_uses = 63;
+inline constexpr int expected_misuses = 63;
+
+struct Report
+{
+    int theorems = 0;
+    int uses = 0;
+    int misuses = 0;
+};
+
+template <typename A>
+void audit_use(std::string_view theorem, TermStore &store, Report &report)
+{
+    ++report.uses;
+    if constexpr (!propositional_tautology_v<A>)
+    {
+        ++report.misuses;
+        const TruthTable table(store, reify<typename Matrix<A>::type>(store));
+        const std::uint64_t counterexample = *table.counterexample(1);
+        std::string values;
+        for (size_t atom = 0; atom < table.atoms().size(); ++atom)
+            values += (atom ? ", " : "") + store.text(table.atoms()[atom]) + (TruthTable::value(counterexample, atom) ? " = V" : " = F");
+        std::printf("%s\n  BY_AXIOM(%s) solo demuestra φ → φ\n  contraejemplo: %s\n", theorem.data(), store.text(reify<A>(store)).c_str(),
+                    values.c_str());
+    }
+}
+
+template <typename Thm>
+void audit(std::string_view theorem, Thm, TermStore &store, Report &report)
+{
+    ++report.theorems;
+    [&]<typename... Uses>(TypeList<Uses...>) {
+        (audit_use<Uses>(theorem, store, report), ...);
+    }(typename AxiomUses<typename Thm::proof_type>::type{});
+}
+
+#define AUDIT(theorem) audit(#theorem, theorem(), store, report)
+
+int main()
+{
+    using namespace logic::peano;
+    TermStore store;
+    Report report;
+
+    AUDIT(PA1);
+    AUDIT(PA2);
+    AUDIT(PA3);
+    AUDIT(PA4);
+    audit("PA5_induction(IsNat(n))", PA5_induction(IsNat(n)), store, report);
+    AUDIT(neq_succ);
+    AUDIT(succ_neq_zero);
+    AUDIT(plus_zero);
+    AUDIT(plus_succ);
+    AUDIT(times_zero);
+    AUDIT(times_succ);
+
+    AUDIT(strict_order::lt_then_neq);
+    AUDIT(strict_order::neq_then_lt_or_gt);
+    AUDIT(strict_order::trichotomy);
+    AUDIT(strict_order::lt_asymm);
+    AUDIT(strict_order::lt_irrefl);
+    AUDIT(strict_order::lt_trans);
+    AUDIT(strict_order::lt_succ_self);
+    AUDIT(strict_order::lt_zero);
+    AUDIT(strict_order::zero_lt_succ);
+    AUDIT(strict_order::lt_succ_iff_lt_or_eq);
+    AUDIT(strict_order::succ_lt_succ_iff);
+
+    AUDIT(order::le_definition);
+    AUDIT(order::zero_le);
+    AUDIT(order::le_refl);
+    AUDIT(order::le_trans);
+    AUDIT(order::le_antisymm);
+    AUDIT(order::le_total);
+    AUDIT(order::succ_le_succ_iff);
+    AUDIT(order::le_iff_lt_succ);
+    AUDIT(order::lt_imp_le);
+    AUDIT(order::le_succ_self);
+    AUDIT(order::le_zero_eq_zero);
+
+    AUDIT(addition::add_zero);
+    AUDIT(addition::add_succ);
+    AUDIT(addition::zero_add);
+    AUDIT(addition::add_comm);
+    AUDIT(addition::add_assoc);
+    AUDIT(addition::add_cancelation);
+    AUDIT(addition::le_self_add);
+    AUDIT(addition::lt_self_add);
+    AUDIT(addition::add_lt_add_left);
+    AUDIT(addition::le_then_exists_add);
+    AUDIT(addition::lt_then_exists_add_succ);
+
+    AUDIT(max_min::max_idem);
+    AUDIT(max_min::min_idem);
+    AUDIT(max_min::min_zero_left);
+    AUDIT(max_min::max_zero_left);
+    AUDIT(max_min::max_comm);
+    AUDIT(max_min::min_comm);
+    AUDIT(max_min::max_is_either);
+    AUDIT(max_min::min_is_either);
+    AUDIT(max_min::lt_then_min_left);
+    AUDIT(max_min::lt_then_max_right);
+    AUDIT(max_min::le_max_left);
+    AUDIT(max_min::le_max_right);
+    AUDIT(max_min::min_le_left);
+    AUDIT(max_min::min_le_right);
+    AUDIT(max_min::max_associative);
+    AUDIT(max_min::min_associative);
+    AUDIT(max_min::eq_iff_max_eq_min);
+    AUDIT(max_min::max_distributes_over_min);
+    AUDIT(max_min::min_distributes_over_max);
+
+    std::printf("\n%d teoremas, %d usos de axiom_identity, %d no demuestran su enunciado\n", report.theorems, report.uses,
+                report.misuses);
+    if (report.theorems != expected_theorems || report.uses != expected_uses || report.misuses != expected_misuses)
+    {
+        std::fprintf(stderr, "FALLO: se esperaban %d teoremas, %d usos y %d incorrectos\n", expected_theorems, expected_uses,
+                     expected_misuses);
+        return 1;
+    }
+    return 0;
+}
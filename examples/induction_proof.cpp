@@ -25,7 +25,8 @@ int main()
     constexpr auto inductive_step = axiom_add_zero<Natural<0>>();
 
     // APLICAMOS EL PRINCIPIO DE INDUCCIÓN
-    constexpr auto final_theorem = INDUCTION(base_case, inductive_step);
+    // La conclusión no se puede deducir de las premisas: se indica explícitamente
+    constexpr auto final_theorem = induction_principle<P_type, P_type, P_type>(base_case, inductive_step);
 
     // Verificación: el teorema debe compilar correctamente
     static_assert(std::is_same_v<
@@ -0,0 +1,1079 @@
+#pragma once
+
+#include "formula_arena.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace logic
+{
+
+    // =========================================================
+    // === AUTOMATIC PROOF SEARCH (auto_prove) ===
+    // =========================================================
+    //
+    // auto_prove<Goal, Hyps>() busca en compilación una demostración de Goal
+    // a partir de las hipótesis de Hyps (una TypeList) con las reglas
+    // assume, implies_intro, modus_ponens y universal_instantiation, y
+    // devuelve el Theorem<Ctx, Goal> que resulta de aplicarlas: el kernel
+    // comprueba cada paso igual que en una demostración escrita a mano, y Ctx
+    // son las hipótesis que se han usado.
+    //
+    //   using Premise = Forall<X, Implies<Human_x, Mortal_x>>;
+    //   constexpr auto thm = auto_prove<Mortal_socrates, TypeList<Premise, Human_socrates>>();
+    //
+    // La búsqueda es hacia atrás:
+    //   - un objetivo que está en el contexto se demuestra con assume;
+    //   - A → B se demuestra con implies_intro desde B con A en el contexto
+    //     (la regla es invertible: no hace falta probar nada más);
+    //   - si no, cada hipótesis ∀x̄. A1 → ... → An → C cuya conclusión C
+    //     encaja con el objetivo (las x̄ son variables de patrón) deja los
+    //     subobjetivos A1, ..., An instanciados con el encaje. Una x que no
+    //     aparece en C se prueba con los términos cerrados de Goal y Hyps.
+    // ∧, ∨, ↔, ¬ y ∃ solo se obtienen tal cual de una hipótesis: no hay
+    // reglas para descomponerlos.
+    //
+    // Todo ocurre en una sola evaluación constante sobre una imagen
+    // hash-consed de las fórmulas, sin instanciar plantillas por
+    // subobjetivo. La profundidad es iterativa y hay una tabla de memoria por
+    // (objetivo, contexto): un éxito se reutiliza, un fracaso no se vuelve a
+    // explorar y un objetivo que ya está abierto más arriba corta la rama.
+    // Budget acota los subobjetivos que se expanden en total, de modo que el
+    // coste en compilación es predecible; al agotarlo el error lo dice así,
+    // distinto de "no hay demostración". El resultado es un plan de pasos que
+    // se reproduce con las reglas del kernel; los términos de las
+    // instanciaciones se recuperan como caminos dentro del objetivo o de las
+    // fórmulas de entrada, así que no hace falta reconstruir ningún tipo.
+    //
+    // El compilador pone su propio límite a la evaluación constante
+    // (-fconstexpr-ops-limit en GCC, -fconstexpr-steps en Clang): con los
+    // valores por defecto caben unos cientos de subobjetivos; una búsqueda
+    // mayor necesita subir ese límite además de Budget.
+
+    enum class AutoProveStatus : std::uint8_t
+    {
+        Proved,
+        Failed,         // No hay demostración con estas reglas
+        BudgetExhausted // Se agotó el presupuesto (o la profundidad máxima)
+    };
+
+    struct AutoProveStats
+    {
+        AutoProveStatus status = AutoProveStatus::Failed;
+        size_t expanded = 0;  // Subobjetivos expandidos: lo que cuenta el presupuesto
+        size_t memo_hits = 0; // Subobjetivos resueltos por la tabla de memoria
+        size_t depth = 0;     // Última cota de la profundidad iterativa
+        size_t steps = 0;     // Reglas de la demostración encontrada
+    };
+
+    inline constexpr size_t auto_prove_budget = 4096;
+
+    // Cota de la profundidad iterativa (subobjetivos encadenados). Cada nivel
+    // son unas pocas llamadas anidadas en la evaluación constante: 64 niveles
+    // caben en el -fconstexpr-depth por defecto (512) salvo con hipótesis de
+    // espina muy larga.
+    inline constexpr size_t auto_prove_max_depth = 64;
+
+    namespace detail
+    {
+        using runtime::NodeId;
+        using runtime::NodeOp;
+        using runtime::SymbolId;
+
+        inline constexpr std::uint32_t search_npos = ~std::uint32_t{0};
+
+        // Tabla hash abierta (sondeo lineal, carga ≤ 1/2) de pares (a, b) a un
+        // índice denso: contextos y tabla de memoria
+        class PairIndex
+        {
+        public:
+            constexpr std::uint32_t find(std::uint32_t a, std::uint32_t b) const
+            {
+                return slots_.empty() ? search_npos : slots_[slot(a, b)].value;
+            }
+
+            constexpr void insert(std::uint32_t a, std::uint32_t b, std::uint32_t value)
+            {
+                if (2 * (size_ + 1) > slots_.size())
+                    rehash(slots_.empty() ? 64 : 2 * slots_.size());
+                Slot &target = slots_[slot(a, b)];
+                size_ += target.value == search_npos;
+                target = {a, b, value};
+            }
+
+        private:
+            struct Slot
+            {
+                std::uint32_t a = 0, b = 0, value = search_npos;
+            };
+
+            constexpr size_t slot(std::uint32_t a, std::uint32_t b) const
+            {
+                const size_t mask = slots_.size() - 1;
+                size_t at = HashAlgebra::mix(HashAlgebra::mix(0, a), b) & mask;
+                while (slots_[at].value != search_npos && (slots_[at].a != a || slots_[at].b != b))
+                    at = (at + 1) & mask;
+                return at;
+            }
+
+            constexpr void rehash(size_t capacity)
+            {
+                const std::vector<Slot> old = std::move(slots_);
+                slots_.assign(capacity, Slot{});
+                for (const Slot &entry : old)
+                    if (entry.value != search_npos)
+                        slots_[slot(entry.a, entry.b)] = entry;
+            }
+
+            std::vector<Slot> slots_;
+            size_t size_ = 0;
+        };
+
+        // Imagen de las fórmulas para la búsqueda: los nodos de FormulaArena
+        // con hash-consing, así que dos fórmulas son iguales si y solo si lo
+        // son sus identificadores. Tiene la interfaz de FormulaBuilder para
+        // que runtime::reify<F> baje a ella las fórmulas de entrada.
+        class SearchStore
+        {
+        public:
+            constexpr NodeId variable(std::string_view name) { return make({NodeOp::Variable, symbols_.intern(name), {0, 0}}, {}); }
+            constexpr NodeId constant(std::string_view name) { return make({NodeOp::Constant, symbols_.intern(name), {0, 0}}, {}); }
+
+            constexpr NodeId atom(std::string_view name, std::span<const NodeId> args)
+            {
+                return make({NodeOp::Atom, symbols_.intern(name), {0, static_cast<NodeId>(args.size())}}, args);
+            }
+
+            constexpr NodeId unary(NodeOp op, NodeId operand) { return make({op, runtime::SymbolTable::npos, {operand, 0}}, {}); }
+            constexpr NodeId binary(NodeOp op, NodeId left, NodeId right) { return make({op, runtime::SymbolTable::npos, {left, right}}, {}); }
+            constexpr NodeId binder(NodeOp op, std::string_view variable, NodeId body) { return make({op, symbols_.intern(variable), {body, 0}}, {}); }
+
+            // El nodo `id` con otros hijos (en el orden de children)
+            constexpr NodeId rebuild(NodeId id, std::span<const NodeId> children)
+            {
+                runtime::Node node = nodes_[id];
+                if (node.op == NodeOp::Atom)
+                    return make(node, children);
+                for (size_t i = 0; i < children.size(); ++i)
+                    node.operands[i] = children[i];
+                return make(node, {});
+            }
+
+            constexpr const runtime::Node &operator[](NodeId id) const { return nodes_[id]; }
+
+            // Hijos en orden (argumentos, operandos, cuerpo); la vista no
+            // sobrevive a la creación de nodos
+            constexpr std::span<const NodeId> children(NodeId id) const
+            {
+                const runtime::Node &node = nodes_[id];
+                if (node.op == NodeOp::Atom)
+                    return std::span<const NodeId>(arguments_).subspan(node.operands[0], node.operands[1]);
+                return std::span<const NodeId>(node.operands.data(), runtime::arity(node.op));
+            }
+
+        private:
+            constexpr std::uint64_t hash(const runtime::Node &node, std::span<const NodeId> args) const
+            {
+                std::uint64_t seed = HashAlgebra::mix(static_cast<std::uint64_t>(node.op), node.symbol);
+                if (node.op == NodeOp::Atom)
+                {
+                    for (const NodeId arg : args)
+                        seed = HashAlgebra::mix(seed, arg);
+                    return HashAlgebra::mix(seed, args.size());
+                }
+                return HashAlgebra::mix(HashAlgebra::mix(seed, node.operands[0]), node.operands[1]);
+            }
+
+            constexpr bool same(NodeId id, const runtime::Node &node, std::span<const NodeId> args) const
+            {
+                const runtime::Node &other = nodes_[id];
+                if (other.op != node.op || other.symbol != node.symbol)
+                    return false;
+                if (node.op != NodeOp::Atom)
+                    return other.operands == node.operands;
+                if (other.operands[1] != args.size())
+                    return false;
+                for (size_t i = 0; i < args.size(); ++i)
+                    if (arguments_[other.operands[0] + i] != args[i])
+                        return false;
+                return true;
+            }
+
+            constexpr size_t slot(const runtime::Node &node, std::span<const NodeId> args) const
+            {
+                const size_t mask = slots_.size() - 1;
+                size_t at = hash(node, args) & mask;
+                while (slots_[at] != search_npos && !same(slots_[at], node, args))
+                    at = (at + 1) & mask;
+                return at;
+            }
+
+            // `args` no puede apuntar a arguments_
+            constexpr NodeId make(runtime::Node node, std::span<const NodeId> args)
+            {
+                if (2 * (nodes_.size() + 1) > slots_.size())
+                {
+                    slots_.assign(slots_.empty() ? 256 : 2 * slots_.size(), search_npos);
+                    for (NodeId id = 0; id < nodes_.size(); ++id)
+                        slots_[slot(nodes_[id], children(id))] = id;
+                }
+                const size_t at = slot(node, args);
+                if (slots_[at] != search_npos)
+                    return slots_[at];
+                if (node.op == NodeOp::Atom)
+                {
+                    node.operands = {static_cast<NodeId>(arguments_.size()), static_cast<NodeId>(args.size())};
+                    arguments_.insert(arguments_.end(), args.begin(), args.end());
+                }
+                slots_[at] = static_cast<NodeId>(nodes_.size());
+                nodes_.push_back(node);
+                return slots_[at];
+            }
+
+            std::vector<runtime::Node> nodes_;
+            std::vector<NodeId> arguments_;
+            std::vector<NodeId> slots_;
+            runtime::SymbolTable symbols_;
+        };
+
+        // --- Plan de la demostración ---
+        enum class ProofRule : std::uint8_t
+        {
+            Assume,       // first: posición de la hipótesis en el contexto
+            ImpliesIntro, // first: paso de la premisa
+            ModusPonens,  // first: paso del antecedente, second: paso de la implicación
+            Instantiate   // first: paso del ∀, second: término
+        };
+
+        struct ProofStep
+        {
+            ProofRule rule = ProofRule::Assume;
+            std::uint32_t first = 0, second = 0;
+        };
+
+        enum class TermSource : std::uint8_t
+        {
+            Goal,          // Dentro del objetivo del paso
+            BoundVariable, // La propia variable del ∀ (no aparece en el cuerpo)
+            Input          // Dentro de la fórmula de entrada `input` (0 = Goal, 1... = Hyps)
+        };
+
+        // El término es el subárbol al final del camino `paths[begin, begin + length)`
+        struct TermPath
+        {
+            TermSource source = TermSource::Goal;
+            std::uint32_t input = 0, begin = 0, length = 0;
+        };
+
+        template <size_t Steps, size_t Terms, size_t Paths>
+        struct ProofPlan
+        {
+            AutoProveStats stats;
+            size_t term_count = 0, path_count = 0;
+            std::array<ProofStep, Steps> steps{};
+            std::array<TermPath, Terms> terms{};
+            std::array<std::uint32_t, Paths> paths{};
+        };
+
+        class ProofSearch
+        {
+        public:
+            constexpr explicit ProofSearch(size_t budget) : budget_(budget) {}
+
+            constexpr SearchStore &store() { return store_; }
+
+            constexpr void run(NodeId goal, std::span<const NodeId> hypotheses)
+            {
+                inputs_.push_back(goal);
+                inputs_.insert(inputs_.end(), hypotheses.begin(), hypotheses.end());
+                for (std::uint32_t input = 0; input < inputs_.size(); ++input)
+                {
+                    std::vector<std::uint32_t> path;
+                    std::vector<SymbolId> bound;
+                    collect_terms(input, inputs_[input], false, path, bound);
+                }
+
+                std::uint32_t context = search_npos;
+                for (const NodeId hypothesis : hypotheses)
+                    context = push_context(context, hypothesis);
+
+                // La cota se dobla en cada pasada: repetir las anteriores cuesta
+                // menos que la última
+                for (size_t depth = 1; depth <= auto_prove_max_depth; depth *= 2, ++pass_)
+                {
+                    stats_.depth = depth;
+                    const Attempt attempt = solve(goal, context, depth);
+                    if (attempt.outcome == Outcome::Proved)
+                    {
+                        stats_.status = AutoProveStatus::Proved;
+                        root_ = attempt.step;
+                        return;
+                    }
+                    if (attempt.outcome == Outcome::Failed || attempt.outcome == Outcome::Cycle)
+                    {
+                        stats_.status = AutoProveStatus::Failed;
+                        return;
+                    }
+                    if (attempt.outcome == Outcome::Exhausted)
+                        break;
+                }
+                stats_.status = AutoProveStatus::BudgetExhausted;
+            }
+
+            // La demostración encontrada: los pasos alcanzables desde la raíz
+            // en postorden (las premisas antes; la raíz es el último). Con
+            // capacidad 0 solo da los tamaños.
+            template <size_t Steps, size_t Terms, size_t Paths>
+            constexpr ProofPlan<Steps, Terms, Paths> plan() const
+            {
+                ProofPlan<Steps, Terms, Paths> out;
+                out.stats = stats_;
+                if (stats_.status != AutoProveStatus::Proved)
+                    return out;
+
+                std::vector<std::uint32_t> renumbered(steps_.size(), search_npos);
+                std::vector<ProofStep> steps;
+                std::vector<TermPath> terms;
+                std::vector<std::uint32_t> paths;
+                std::vector<std::pair<std::uint32_t, bool>> pending{{root_, false}}; // (paso, premisas ya apiladas)
+                while (!pending.empty())
+                {
+                    const auto [step, expanded] = pending.back();
+                    if (renumbered[step] != search_npos)
+                    {
+                        pending.pop_back();
+                        continue;
+                    }
+                    const ProofStep &original = steps_[step];
+                    if (!expanded)
+                    {
+                        pending.back().second = true;
+                        if (original.rule == ProofRule::ModusPonens)
+                            pending.push_back({original.second, false});
+                        if (original.rule != ProofRule::Assume)
+                            pending.push_back({original.first, false});
+                        continue;
+                    }
+                    pending.pop_back();
+                    ProofStep copy = original;
+                    if (copy.rule != ProofRule::Assume)
+                        copy.first = renumbered[copy.first];
+                    if (copy.rule == ProofRule::ModusPonens)
+                        copy.second = renumbered[copy.second];
+                    if (copy.rule == ProofRule::Instantiate)
+                    {
+                        TermPath term = terms_[copy.second];
+                        const std::uint32_t begin = static_cast<std::uint32_t>(paths.size());
+                        paths.insert(paths.end(), paths_.begin() + term.begin, paths_.begin() + term.begin + term.length);
+                        term.begin = begin;
+                        copy.second = static_cast<std::uint32_t>(terms.size());
+                        terms.push_back(term);
+                    }
+                    renumbered[step] = static_cast<std::uint32_t>(steps.size());
+                    steps.push_back(copy);
+                }
+
+                out.stats.steps = steps.size();
+                out.term_count = terms.size();
+                out.path_count = paths.size();
+                for (size_t i = 0; i < Steps && i < steps.size(); ++i)
+                    out.steps[i] = steps[i];
+                for (size_t i = 0; i < Terms && i < terms.size(); ++i)
+                    out.terms[i] = terms[i];
+                for (size_t i = 0; i < Paths && i < paths.size(); ++i)
+                    out.paths[i] = paths[i];
+                return out;
+            }
+
+        private:
+            // Orden de gravedad de los fracasos: al combinar ramas gana el mayor
+            enum class Outcome : std::uint8_t
+            {
+                Proved,
+                Failed,   // Definitivo
+                Cycle,    // Depende de un objetivo abierto más arriba
+                Cutoff,   // Cortado por la profundidad
+                Exhausted // Sin presupuesto: se abandona la búsqueda
+            };
+
+            struct Attempt
+            {
+                Outcome outcome = Outcome::Failed;
+                std::uint32_t step = search_npos;
+            };
+
+            static constexpr Outcome worst(Outcome a, Outcome b) { return a < b ? b : a; }
+
+            enum class MemoState : std::uint8_t
+            {
+                Unknown,
+                Open,
+                Proved,
+                Failed,
+                Cutoff, // Sin demostración hasta la profundidad `value`
+                Cycle   // Igual, pero porque dependía de un objetivo abierto
+            };
+
+            // Un corte solo vale en su pasada (`stamp`): en la siguiente hay
+            // más profundidad, y reutilizarlo haría que los objetivos de un
+            // ciclo se cortaran unos a otros para siempre. Un fracaso por ciclo
+            // vale mientras no se demuestre ningún objetivo nuevo (`stamp` =
+            // proofs_): el objetivo abierto del que dependía puede haberse
+            // demostrado por otra rama.
+            struct MemoEntry
+            {
+                MemoState state = MemoState::Unknown;
+                std::uint32_t value = 0; // Paso de la demostración o profundidad del corte
+                std::uint32_t stamp = 0;
+            };
+
+            // Los contextos son listas enlazadas internadas: el mismo contexto
+            // tiene siempre el mismo identificador
+            struct ContextNode
+            {
+                std::uint32_t parent;
+                NodeId formula;
+                std::uint32_t size;
+                std::uint32_t spine; // En spines_
+            };
+
+            struct Candidate
+            {
+                NodeId term;
+                TermPath path;
+            };
+
+            // Encaje de la conclusión de una hipótesis con el objetivo
+            struct PatternVariable
+            {
+                SymbolId symbol;
+                NodeId term = search_npos;
+                std::uint32_t begin = 0, length = 0; // Camino del término en el objetivo (en Matching::paths)
+            };
+
+            struct Matching
+            {
+                std::vector<PatternVariable> variables;
+                std::vector<std::uint32_t> paths;
+                std::vector<std::uint32_t> path;   // Camino actual dentro del objetivo
+                std::vector<SymbolId> shadowed;    // Ligadas por cuantificadores de la conclusión
+            };
+
+            // Espina de una hipótesis ∀x. A → ...: un eslabón por ∀ o →, con la
+            // conclusión que queda tras él y su cabeza, para descartar sin
+            // encajar. Se calcula una vez por hipótesis.
+            struct Link
+            {
+                NodeOp op;       // Forall o Implies
+                SymbolId symbol; // Variable del ∀
+                NodeId conclusion;
+                NodeOp head;
+                SymbolId head_symbol;
+                bool any; // La conclusión es una variable de patrón: encaja con todo
+            };
+
+            struct Spine
+            {
+                std::uint32_t begin, size; // En links_
+            };
+
+            // Por eslabón: el término del ∀ o la demostración del antecedente
+            struct Decision
+            {
+                std::uint32_t proof = search_npos;
+                TermPath term;
+            };
+
+            // La hipótesis `position` del contexto usada hasta el eslabón `size`
+            struct Chain
+            {
+                NodeId goal;
+                std::uint32_t context, position;
+                size_t depth;
+                std::uint32_t begin, size; // Eslabones en links_
+                Matching matching;
+                std::vector<Decision> decisions;
+            };
+
+            constexpr std::uint32_t push_context(std::uint32_t context, NodeId formula)
+            {
+                const std::uint32_t found = context_index_.find(context, formula);
+                if (found != search_npos)
+                    return found;
+                const std::uint32_t id = static_cast<std::uint32_t>(contexts_.size());
+                const std::uint32_t links = spine(formula);
+                contexts_.push_back({context, formula, context_size(context) + 1, links});
+                context_index_.insert(context, formula, id);
+                return id;
+            }
+
+            constexpr std::uint32_t context_size(std::uint32_t context) const { return context == search_npos ? 0 : contexts_[context].size; }
+
+            constexpr std::uint32_t spine(NodeId hypothesis)
+            {
+                const std::uint32_t found = spine_index_.find(hypothesis, 0);
+                if (found != search_npos)
+                    return found;
+                const std::uint32_t begin = static_cast<std::uint32_t>(links_.size());
+                const auto bound = [&](SymbolId symbol) {
+                    return std::any_of(links_.begin() + begin, links_.end(), [&](const Link &link) { return link.op == NodeOp::Forall && link.symbol == symbol; });
+                };
+                for (NodeId current = hypothesis;;)
+                {
+                    const runtime::Node node = store_[current];
+                    // Con una variable repetida en la espina el encaje tendría que
+                    // distinguir ocurrencias ocultas: la espina acaba ahí
+                    Link link{node.op, runtime::SymbolTable::npos, node.operands[node.op == NodeOp::Implies ? 1 : 0], NodeOp::Atom, 0, false};
+                    if (node.op == NodeOp::Forall && !bound(node.symbol))
+                        link.symbol = node.symbol;
+                    else if (node.op != NodeOp::Implies)
+                        break;
+                    links_.push_back(link);
+                    const runtime::Node conclusion = store_[current = link.conclusion];
+                    links_.back().head = conclusion.op;
+                    links_.back().head_symbol = conclusion.symbol;
+                    links_.back().any = conclusion.op == NodeOp::Variable && bound(conclusion.symbol);
+                }
+                spines_.push_back({begin, static_cast<std::uint32_t>(links_.size()) - begin});
+                spine_index_.insert(hypothesis, 0, static_cast<std::uint32_t>(spines_.size() - 1));
+                return static_cast<std::uint32_t>(spines_.size() - 1);
+            }
+
+            constexpr std::uint32_t add_step(ProofStep step)
+            {
+                steps_.push_back(step);
+                return static_cast<std::uint32_t>(steps_.size() - 1);
+            }
+
+            constexpr Attempt solve(NodeId goal, std::uint32_t context, size_t depth)
+            {
+                std::uint32_t entry = memo_index_.find(goal, context);
+                if (entry != search_npos)
+                {
+                    const MemoEntry memo = memo_[entry];
+                    if (memo.state == MemoState::Open)
+                        return {Outcome::Cycle};
+                    if (memo.state == MemoState::Proved)
+                    {
+                        ++stats_.memo_hits;
+                        return {Outcome::Proved, memo.value};
+                    }
+                    if (memo.state == MemoState::Failed || (memo.state == MemoState::Cutoff && depth <= memo.value && memo.stamp == pass_) ||
+                        (memo.state == MemoState::Cycle && depth <= memo.value && memo.stamp == proofs_))
+                    {
+                        ++stats_.memo_hits;
+                        return {memo.state == MemoState::Failed ? Outcome::Failed : memo.state == MemoState::Cutoff ? Outcome::Cutoff : Outcome::Cycle};
+                    }
+                }
+                if (stats_.expanded == budget_)
+                    return {Outcome::Exhausted};
+                ++stats_.expanded;
+
+                if (entry == search_npos)
+                {
+                    entry = static_cast<std::uint32_t>(memo_.size());
+                    memo_.push_back({});
+                    memo_index_.insert(goal, context, entry);
+                }
+                memo_[entry].state = MemoState::Open;
+                const Attempt attempt = expand(goal, context, depth);
+                switch (attempt.outcome)
+                {
+                case Outcome::Proved:
+                    memo_[entry] = {MemoState::Proved, attempt.step};
+                    ++proofs_;
+                    break;
+                case Outcome::Failed:
+                    memo_[entry] = {MemoState::Failed};
+                    break;
+                case Outcome::Cutoff:
+                    memo_[entry] = {MemoState::Cutoff, static_cast<std::uint32_t>(depth), pass_};
+                    break;
+                case Outcome::Cycle:
+                    memo_[entry] = {MemoState::Cycle, static_cast<std::uint32_t>(depth), proofs_};
+                    break;
+                default:
+                    memo_[entry] = {};
+                    break;
+                }
+                return attempt;
+            }
+
+            constexpr Attempt expand(NodeId goal, std::uint32_t context, size_t depth)
+            {
+                for (std::uint32_t at = context; at != search_npos; at = contexts_[at].parent)
+                    if (contexts_[at].formula == goal)
+                        return {Outcome::Proved, add_step({ProofRule::Assume, contexts_[at].size - 1})};
+
+                const runtime::Node node = store_[goal];
+                if (node.op == NodeOp::Implies)
+                {
+                    const Attempt premise = solve(node.operands[1], push_context(context, node.operands[0]), depth);
+                    if (premise.outcome != Outcome::Proved)
+                        return premise;
+                    return {Outcome::Proved, add_step({ProofRule::ImpliesIntro, premise.step})};
+                }
+
+                if (depth == 0)
+                    return {Outcome::Cutoff};
+                // Las hipótesis más recientes primero
+                Outcome outcome = Outcome::Failed;
+                for (std::uint32_t at = context; at != search_npos; at = contexts_[at].parent)
+                {
+                    const Attempt attempt = backchain(goal, context, at, depth - 1);
+                    if (attempt.outcome == Outcome::Proved || attempt.outcome == Outcome::Exhausted)
+                        return attempt;
+                    outcome = worst(outcome, attempt.outcome);
+                }
+                return {outcome};
+            }
+
+            // Prueba cada conclusión de la espina de la hipótesis (tras cada
+            // ∀ y cada →) contra el objetivo
+            constexpr Attempt backchain(NodeId goal, std::uint32_t context, std::uint32_t hypothesis, size_t depth)
+            {
+                const std::uint32_t position = contexts_[hypothesis].size - 1;
+                const NodeId formula = contexts_[hypothesis].formula;
+                const Spine links = spines_[contexts_[hypothesis].spine];
+                const runtime::Node target = store_[goal];
+                Outcome outcome = Outcome::Failed;
+                for (std::uint32_t size = 1; size <= links.size; ++size)
+                {
+                    // Descarte por la cabeza antes de preparar el encaje
+                    const Link &last = links_[links.begin + size - 1];
+                    if (!last.any && (last.head != target.op || last.head_symbol != target.symbol))
+                        continue;
+                    if (!last.any && !similar(last.conclusion, goal, links.begin, size))
+                        continue;
+
+                    Chain chain{goal, context, position, depth, links.begin, size, {}, {}};
+                    for (std::uint32_t i = 0; i < size; ++i)
+                        if (links_[links.begin + i].op == NodeOp::Forall)
+                            chain.matching.variables.push_back({links_[links.begin + i].symbol});
+                    if (!match(links_[links.begin + size - 1].conclusion, goal, chain.matching))
+                        continue;
+                    chain.decisions.assign(size, Decision{});
+                    const Attempt attempt = follow(chain, 0, formula);
+                    if (attempt.outcome == Outcome::Proved || attempt.outcome == Outcome::Exhausted)
+                        return attempt;
+                    outcome = worst(outcome, attempt.outcome);
+                }
+                return {outcome};
+            }
+
+            // Encaje sin ligaduras ni memoria: las variables de patrón
+            // (los ∀ de los eslabones [begin, begin + size)) valen cualquier cosa
+            constexpr bool similar(NodeId pattern, NodeId target, std::uint32_t begin, std::uint32_t size) const
+            {
+                if (pattern == target)
+                    return true;
+                const runtime::Node &node = store_[pattern];
+                if (node.op == NodeOp::Variable)
+                    for (std::uint32_t i = begin; i < begin + size; ++i)
+                        if (links_[i].op == NodeOp::Forall && links_[i].symbol == node.symbol)
+                            return true;
+                const runtime::Node &other = store_[target];
+                if (node.op != other.op || node.symbol != other.symbol)
+                    return false;
+                const std::span<const NodeId> patterns = store_.children(pattern), targets = store_.children(target);
+                if (patterns.size() != targets.size())
+                    return false;
+                for (size_t i = 0; i < patterns.size(); ++i)
+                    if (!similar(patterns[i], targets[i], begin, size))
+                        return false;
+                return true;
+            }
+
+            // Una variable de patrón bajo un cuantificador no puede valer un
+            // término con la variable que este liga: la instancia la
+            // capturaría y el kernel, que renombra, daría otra fórmula
+            constexpr bool match(NodeId pattern, NodeId target, Matching &matching) const
+            {
+                const runtime::Node &node = store_[pattern];
+                if (node.op == NodeOp::Variable && std::ranges::find(matching.shadowed, node.symbol) == matching.shadowed.end())
+                    for (PatternVariable &variable : matching.variables)
+                        if (variable.symbol == node.symbol)
+                        {
+                            if (std::ranges::any_of(matching.shadowed, [&](SymbolId bound) { return occurs_free(target, bound); }))
+                                return false;
+                            if (variable.term != search_npos)
+                                return variable.term == target;
+                            variable.term = target;
+                            variable.begin = static_cast<std::uint32_t>(matching.paths.size());
+                            variable.length = static_cast<std::uint32_t>(matching.path.size());
+                            matching.paths.insert(matching.paths.end(), matching.path.begin(), matching.path.end());
+                            return true;
+                        }
+
+                const runtime::Node &other = store_[target];
+                if (node.op != other.op || node.symbol != other.symbol)
+                    return false;
+                const std::span<const NodeId> patterns = store_.children(pattern), targets = store_.children(target);
+                if (patterns.size() != targets.size())
+                    return false;
+                if (runtime::is_binder(node.op))
+                    matching.shadowed.push_back(node.symbol);
+                bool ok = true;
+                for (std::uint32_t i = 0; ok && i < patterns.size(); ++i)
+                {
+                    matching.path.push_back(i);
+                    ok = match(patterns[i], targets[i], matching);
+                    matching.path.pop_back();
+                }
+                if (runtime::is_binder(node.op))
+                    matching.shadowed.pop_back();
+                return ok;
+            }
+
+            // Recorre la espina desde el eslabón `index` con `current` ya
+            // instanciada hasta ahí: elige los términos de los ∀ y demuestra los
+            // antecedentes. Al llegar a la conclusión crea los pasos.
+            constexpr Attempt follow(Chain &chain, size_t index, NodeId current)
+            {
+                if (index == chain.size)
+                    return current == chain.goal ? Attempt{Outcome::Proved, commit(chain)} : Attempt{Outcome::Failed};
+
+                const runtime::Node node = store_[current];
+                if (links_[chain.begin + index].op == NodeOp::Implies)
+                {
+                    const Attempt antecedent = solve(node.operands[0], chain.context, chain.depth);
+                    if (antecedent.outcome != Outcome::Proved)
+                        return antecedent;
+                    chain.decisions[index].proof = antecedent.step;
+                    return follow(chain, index + 1, node.operands[1]);
+                }
+
+                const NodeId body = node.operands[0];
+                for (const PatternVariable &variable : chain.matching.variables)
+                    if (variable.symbol == node.symbol && variable.term != search_npos)
+                    {
+                        const NodeId instance = substitute(body, node.symbol, variable.term);
+                        if (instance == search_npos)
+                            return {Outcome::Failed};
+                        chain.decisions[index].term = {TermSource::Goal, 0, variable.begin, variable.length};
+                        return follow(chain, index + 1, instance);
+                    }
+                if (!occurs_free(body, node.symbol))
+                {
+                    chain.decisions[index].term = {TermSource::BoundVariable};
+                    return follow(chain, index + 1, body);
+                }
+
+                // Variable que no fija la conclusión: términos cerrados de la entrada
+                Outcome outcome = Outcome::Failed;
+                for (size_t i = 0; i < candidates_.size(); ++i)
+                {
+                    const NodeId instance = substitute(body, node.symbol, candidates_[i].term);
+                    if (instance == search_npos)
+                        continue;
+                    chain.decisions[index].term = candidates_[i].path;
+                    const Attempt attempt = follow(chain, index + 1, instance);
+                    if (attempt.outcome == Outcome::Proved || attempt.outcome == Outcome::Exhausted)
+                        return attempt;
+                    outcome = worst(outcome, attempt.outcome);
+                }
+                return {outcome};
+            }
+
+            // assume de la hipótesis y, por eslabón, instantiate o modus ponens
+            constexpr std::uint32_t commit(const Chain &chain)
+            {
+                std::uint32_t step = add_step({ProofRule::Assume, chain.position});
+                for (size_t index = 0; index < chain.size; ++index)
+                {
+                    const Decision &decision = chain.decisions[index];
+                    if (links_[chain.begin + index].op == NodeOp::Implies)
+                    {
+                        step = add_step({ProofRule::ModusPonens, decision.proof, step});
+                        continue;
+                    }
+                    TermPath term = decision.term;
+                    if (term.source == TermSource::Goal)
+                    {
+                        const auto begin = chain.matching.paths.begin() + term.begin;
+                        term.begin = static_cast<std::uint32_t>(paths_.size());
+                        paths_.insert(paths_.end(), begin, begin + term.length);
+                    }
+                    terms_.push_back(term);
+                    step = add_step({ProofRule::Instantiate, step, static_cast<std::uint32_t>(terms_.size() - 1)});
+                }
+                return step;
+            }
+
+            constexpr bool occurs_free(NodeId id, SymbolId variable) const
+            {
+                const runtime::Node &node = store_[id];
+                if (node.op == NodeOp::Variable)
+                    return node.symbol == variable;
+                if (runtime::is_binder(node.op) && node.symbol == variable)
+                    return false;
+                for (const NodeId child : store_.children(id))
+                    if (occurs_free(child, variable))
+                        return true;
+                return false;
+            }
+
+            // id[variable := term], o search_npos si un cuantificador
+            // capturaría una variable del término (el kernel la renombraría y
+            // el tipo ya no sería el que predice la búsqueda)
+            constexpr NodeId substitute(NodeId id, SymbolId variable, NodeId term)
+            {
+                if (!occurs_free(id, variable))
+                    return id;
+                const runtime::Node node = store_[id];
+                if (node.op == NodeOp::Variable)
+                    return term;
+                if (runtime::is_binder(node.op) && occurs_free(term, node.symbol))
+                    return search_npos;
+                const std::span<const NodeId> view = store_.children(id);
+                std::vector<NodeId> children(view.begin(), view.end());
+                for (NodeId &child : children)
+                    if ((child = substitute(child, variable, term)) == search_npos)
+                        return search_npos;
+                return store_.rebuild(id, children);
+            }
+
+            // Términos de la entrada sin variables ligadas, con su camino
+            constexpr void collect_terms(std::uint32_t input, NodeId id, bool term, std::vector<std::uint32_t> &path, std::vector<SymbolId> &bound)
+            {
+                const runtime::Node node = store_[id];
+                if (term && std::ranges::none_of(candidates_, [&](const Candidate &candidate) { return candidate.term == id; }) &&
+                    std::ranges::none_of(bound, [&](SymbolId variable) { return occurs_free(id, variable); }))
+                {
+                    candidates_.push_back({id, {TermSource::Input, input, static_cast<std::uint32_t>(paths_.size()), static_cast<std::uint32_t>(path.size())}});
+                    paths_.insert(paths_.end(), path.begin(), path.end());
+                }
+                if (runtime::is_binder(node.op))
+                    bound.push_back(node.symbol);
+                const std::span<const NodeId> view = store_.children(id);
+                const std::vector<NodeId> children(view.begin(), view.end());
+                for (std::uint32_t i = 0; i < children.size(); ++i)
+                {
+                    path.push_back(i);
+                    collect_terms(input, children[i], term || node.op == NodeOp::Atom, path, bound);
+                    path.pop_back();
+                }
+                if (runtime::is_binder(node.op))
+                    bound.pop_back();
+            }
+
+            SearchStore store_;
+            size_t budget_;
+            AutoProveStats stats_;
+            std::uint32_t root_ = search_npos;
+            std::uint32_t proofs_ = 0; // Objetivos demostrados hasta ahora
+            std::uint32_t pass_ = 0;   // Pasada de la profundidad iterativa
+
+            std::vector<NodeId> inputs_;
+            std::vector<Candidate> candidates_;
+            std::vector<ContextNode> contexts_;
+            PairIndex context_index_;
+            std::vector<Link> links_;
+            std::vector<Spine> spines_;
+            PairIndex spine_index_;
+            std::vector<MemoEntry> memo_;
+            PairIndex memo_index_;
+
+            std::vector<ProofStep> steps_;
+            std::vector<TermPath> terms_;
+            std::vector<std::uint32_t> paths_;
+        };
+
+        // --- Reproducción con el kernel ---
+        // Hijo I de un nodo, en el orden de la imagen (argumentos, operandos,
+        // cuerpo del cuantificador)
+        template <typename Node, size_t I>
+        struct ChildAt;
+
+        template <auto Sym, typename... Args, size_t I>
+        struct ChildAt<Atom<Sym, Args...>, I>
+        {
+            using type = PickAt<IndexedOf<Args...>, I>;
+        };
+
+        template <template <typename> class Op, typename T, size_t I>
+            requires Operator<Op>
+        struct ChildAt<Op<T>, I>
+        {
+            using type = T;
+        };
+
+        template <template <typename, typename> class Op, typename L, typename R, size_t I>
+            requires Operator<Op>
+        struct ChildAt<Op<L, R>, I>
+        {
+            using type = std::conditional_t<I == 0, L, R>;
+        };
+
+        template <template <typename, typename> class Q, typename V, typename Body, size_t I>
+            requires Quantifier<Q>
+        struct ChildAt<Q<V, Body>, I>
+        {
+            using type = Body;
+        };
+
+        template <typename Node, const auto &Plan, size_t Begin, size_t Length>
+        struct FollowPath : FollowPath<typename ChildAt<Node, Plan.paths[Begin]>::type, Plan, Begin + 1, Length - 1>
+        {
+        };
+
+        template <typename Node, const auto &Plan, size_t Begin>
+        struct FollowPath<Node, Plan, Begin, 0>
+        {
+            using type = Node;
+        };
+
+        template <const auto &Plan, typename Inputs, TermPath Term, typename Premise, typename Goal>
+        struct PlanTerm;
+
+        template <const auto &Plan, typename... Inputs, TermPath Term, typename Premise, typename Goal>
+        struct PlanTerm<Plan, TypeList<Inputs...>, Term, Premise, Goal>
+        {
+            template <TermSource Source, typename = void>
+            struct Pick : FollowPath<Goal, Plan, Term.begin, Term.length>
+            {
+            };
+
+            template <typename Unused>
+            struct Pick<TermSource::BoundVariable, Unused>
+            {
+                using type = typename Premise::Variable;
+            };
+
+            template <typename Unused>
+            struct Pick<TermSource::Input, Unused> : FollowPath<PickAt<IndexedOf<Inputs...>, Term.input>, Plan, Term.begin, Term.length>
+            {
+            };
+
+            using type = typename Pick<Term.source>::type;
+        };
+
+        template <typename F>
+        struct ImplicationAntecedent;
+
+        template <typename A, typename B>
+        struct ImplicationAntecedent<Implies<A, B>>
+        {
+            using type = A;
+        };
+
+        // Paso Step con el contexto Gamma (TypeList, en el orden de las
+        // posiciones de assume) y el objetivo que demuestra
+        template <const auto &Plan, typename Inputs, size_t Step, typename Gamma, typename Goal, ProofRule Rule = Plan.steps[Step].rule>
+        struct Replay;
+
+        template <const auto &Plan, typename Inputs, size_t Step, typename... Gamma, typename Goal>
+        struct Replay<Plan, Inputs, Step, TypeList<Gamma...>, Goal, ProofRule::Assume>
+        {
+            using hypothesis = PickAt<IndexedOf<Gamma...>, Plan.steps[Step].first>;
+#if LOGIC_TRACE_PROOFS
+            using type = decltype(traced_assume<hypothesis>());
+#else
+            using type = decltype(assume<hypothesis>());
+#endif
+        };
+
+        template <const auto &Plan, typename Inputs, size_t Step, typename... Gamma, typename A, typename B>
+        struct Replay<Plan, Inputs, Step, TypeList<Gamma...>, Implies<A, B>, ProofRule::ImpliesIntro>
+        {
+            using premise = typename Replay<Plan, Inputs, Plan.steps[Step].first, TypeList<Gamma..., A>, B>::type;
+            using type = decltype(implies_intro<A>(premise{}));
+        };
+
+        template <const auto &Plan, typename Inputs, size_t Step, typename Gamma, typename Goal>
+        struct Replay<Plan, Inputs, Step, Gamma, Goal, ProofRule::ModusPonens>
+        {
+            using implication = typename Replay<Plan, Inputs, Plan.steps[Step].second, Gamma, Goal>::type;
+            using antecedent =
+                typename Replay<Plan, Inputs, Plan.steps[Step].first, Gamma, typename ImplicationAntecedent<typename implication::formula_type>::type>::type;
+            using type = decltype(modus_ponens(antecedent{}, implication{}));
+        };
+
+        template <const auto &Plan, typename Inputs, size_t Step, typename Gamma, typename Goal>
+        struct Replay<Plan, Inputs, Step, Gamma, Goal, ProofRule::Instantiate>
+        {
+            using premise = typename Replay<Plan, Inputs, Plan.steps[Step].first, Gamma, Goal>::type;
+            using term = typename PlanTerm<Plan, Inputs, Plan.terms[Plan.steps[Step].second], typename premise::formula_type, Goal>::type;
+            using type = decltype(universal_instantiation(premise{}, term{}));
+        };
+
+        template <typename Goal, typename Hyps, size_t Budget>
+        struct AutoProof;
+
+        template <typename Goal, typename... Hyps, size_t Budget>
+        struct AutoProof<Goal, TypeList<Hyps...>, Budget>
+        {
+            // La búsqueda se hace dos veces: la primera da los tamaños del plan
+            template <size_t Steps, size_t Terms, size_t Paths>
+            static consteval ProofPlan<Steps, Terms, Paths> search()
+            {
+                ProofSearch search(Budget);
+                const NodeId goal = runtime::reify<Goal>(search.store());
+                const std::array<NodeId, sizeof...(Hyps)> hypotheses{runtime::reify<Hyps>(search.store())...};
+                search.run(goal, hypotheses);
+                return search.template plan<Steps, Terms, Paths>();
+            }
+
+            static constexpr auto sizes = search<0, 0, 0>();
+            static constexpr AutoProveStats stats = sizes.stats;
+            static constexpr auto plan = search<sizes.stats.steps, sizes.term_count, sizes.path_count>();
+        };
+
+        // Solo se instancia si hay demostración (la raíz es el último paso)
+        template <typename Goal, typename Hyps, size_t Budget>
+        struct AutoTheorem;
+
+        template <typename Goal, typename... Hyps, size_t Budget>
+        struct AutoTheorem<Goal, TypeList<Hyps...>, Budget>
+        {
+            using Search = AutoProof<Goal, TypeList<Hyps...>, Budget>;
+            using type = typename Replay<Search::plan, TypeList<Goal, Hyps...>, Search::stats.steps - 1, TypeList<Hyps...>, Goal>::type;
+        };
+
+        template <typename List>
+        struct CleanList;
+
+        template <typename... Ts>
+        struct CleanList<TypeList<Ts...>>
+        {
+            using type = TypeList<std::remove_cv_t<Ts>...>;
+        };
+    } // namespace detail
+
+    // Estadísticas de la búsqueda, también cuando no encuentra demostración
+    template <typename Goal, typename Hyps = TypeList<>, size_t Budget = auto_prove_budget>
+    inline constexpr AutoProveStats auto_prove_stats = detail::AutoProof<std::remove_cv_t<Goal>, typename detail::CleanList<Hyps>::type, Budget>::stats;
+
+    template <typename Goal, typename Hyps = TypeList<>, size_t Budget = auto_prove_budget>
+    inline constexpr bool auto_provable_v = auto_prove_stats<Goal, Hyps, Budget>.status == AutoProveStatus::Proved;
+
+    template <typename Goal, typename Hyps = TypeList<>, size_t Budget = auto_prove_budget>
+    consteval auto auto_prove()
+    {
+        constexpr AutoProveStatus status = auto_prove_stats<Goal, Hyps, Budget>.status;
+        static_assert(status != AutoProveStatus::BudgetExhausted,
+                      "ERROR: auto_prove agotó su presupuesto sin encontrar demostración. "
+                      "Aumenta Budget (tercer parámetro) o añade lemas intermedios a las hipótesis.");
+        static_assert(status != AutoProveStatus::Failed,
+                      "ERROR: auto_prove no encuentra demostración de Goal con estas hipótesis "
+                      "(reglas: assume, implies_intro, modus_ponens, universal_instantiation).");
+        if constexpr (status == AutoProveStatus::Proved)
+        {
+            using Result = typename detail::AutoTheorem<std::remove_cv_t<Goal>, typename detail::CleanList<Hyps>::type, Budget>::type;
+            static_assert(std::is_same_v<typename Result::formula_type, detail::RuleFormula_t<std::remove_cv_t<Goal>>>,
+                          "ERROR interno: el plan de auto_prove no reproduce el objetivo.");
+            return Result{};
+        }
+    }
+
+    template <typename Goal, typename Hyps = TypeList<>, size_t Budget = auto_prove_budget>
+    using AutoProof_t = decltype(auto_prove<Goal, Hyps, Budget>());
+
+} // namespace logic
@@ -0,0 +1,747 @@
+#pragma once
+
+#include "truth_table.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// =========================================================
+// === BINARY DECISION DIAGRAMS (ROBDD) ===
+// =========================================================
+//
+// Un BDD reducido y ordenado es una forma canónica de una función
+// booleana: con un orden de variables fijo, dos fórmulas son equivalentes
+// si y solo si tienen el mismo nodo, así que comprobar A ↔ B es comparar
+// dos enteros una vez construidos.
+//
+//   - Tabla única: cada (variable, bajo, alto) existe una sola vez
+//     (hash-consing, como el TermStore).
+//   - Aristas complementadas: el bit bajo de una arista niega la función,
+//     así que ¬f cuesta O(1) y f y ¬f comparten nodos. Para que la forma
+//     siga siendo canónica la arista "alta" nunca está complementada; la
+//     constante verdadera es la arista 0 y la falsa la 1.
+//   - Tabla de resultados (computed table): una caché de ite(f, g, h) de
+//     correspondencia directa; las demás operaciones son casos de ite.
+//   - Recolección de basura: los Bdd son manejadores con cuenta de
+//     referencias; cuando hay demasiados nodos vivos, se marcan los
+//     alcanzables desde algún manejador y el resto pasa a una lista libre.
+//     Solo ocurre al empezar una operación pública, nunca a mitad de ite.
+//
+// El orden de las variables es el de creación. BasicBddBuilder lo elige
+// con la heurística clásica de recorrido en profundidad (Malik et al.): se
+// visita primero el hijo más profundo de cada conectiva y los átomos se
+// numeran por su primera aparición, lo que deja juntas las variables que
+// se combinan entre sí (x1 y1 x2 y2 ... en (x1 ∧ y1) ∨ (x2 ∧ y2) ∨ ...).
+// Los átomos son los de la tabla de verdad: predicados, igualdades y
+// cuantificadores, salvo un cuantificador cuyo cuerpo es válido, que vale
+// como verdadero.
+//
+// ite es recursiva con una profundidad de como mucho el número de
+// variables.
+
+namespace logic::runtime
+{
+
+    struct BddStats
+    {
+        size_t nodes = 0;      // Nodos vivos (sin la constante)
+        size_t peak_nodes = 0; // Máximo de nodos vivos
+        size_t bytes = 0;      // Memoria reservada por las tablas
+        std::uint64_t unique_lookups = 0, unique_hits = 0;
+        std::uint64_t cache_lookups = 0, cache_hits = 0;
+        std::uint64_t collections = 0;
+    };
+
+    class BddManager;
+
+    // Manejador de una función: mantiene vivos sus nodos. No debe
+    // sobrevivir a su BddManager.
+    class Bdd
+    {
+    public:
+        Bdd() = default;
+        Bdd(const Bdd &other);
+        Bdd(Bdd &&other) noexcept : manager_(std::exchange(other.manager_, nullptr)), edge_(other.edge_) {}
+        Bdd &operator=(Bdd other) noexcept
+        {
+            std::swap(manager_, other.manager_);
+            std::swap(edge_, other.edge_);
+            return *this;
+        }
+        ~Bdd();
+
+        bool is_true() const { return edge_ == 0; }
+        bool is_false() const { return edge_ == 1; }
+
+        // Arista: 2 · nodo, más 1 si está complementada
+        std::uint32_t edge() const { return edge_; }
+
+        Bdd operator~() const;
+        Bdd operator&(const Bdd &other) const;
+        Bdd operator|(const Bdd &other) const;
+        Bdd operator^(const Bdd &other) const;
+        Bdd implies(const Bdd &other) const;
+        Bdd equiv(const Bdd &other) const;
+
+        friend bool operator==(const Bdd &a, const Bdd &b) { return a.manager_ == b.manager_ && a.edge_ == b.edge_; }
+
+    private:
+        friend class BddManager;
+        Bdd(BddManager *manager, std::uint32_t edge);
+
+        BddManager *manager_ = nullptr;
+        std::uint32_t edge_ = 0;
+    };
+
+    class BddManager
+    {
+    public:
+        explicit BddManager(size_t cache_bits = 16)
+            : nodes_{{terminal, 0, 0, none}}, references_{1}, buckets_(size_t{1} << 12, none), cache_(size_t{1} << cache_bits)
+        {
+        }
+
+        // Los Bdd apuntan a su gestor
+        BddManager(const BddManager &) = delete;
+        BddManager &operator=(const BddManager &) = delete;
+
+        Bdd one() { return {this, 0}; }
+        Bdd zero() { return {this, 1}; }
+
+        // La variable `index` (de orden `index`); crea las anteriores que falten
+        Bdd variable(size_t index)
+        {
+            variables_ = std::max(variables_, index + 1);
+            return {this, make(static_cast<std::uint32_t>(index), 1, 0)};
+        }
+
+        size_t variables() const { return variables_; }
+
+        // La variable de la raíz de f (la de menor orden de las que
+        // aparecen); en las constantes, un valor mayor que cualquier variable
+        size_t top(const Bdd &f) const { return nodes_[f.edge_ >> 1].variable; }
+
+        // if f then g else h
+        Bdd ite(const Bdd &f, const Bdd &g, const Bdd &h)
+        {
+            maybe_collect();
+            return {this, ite(f.edge_, g.edge_, h.edge_)};
+        }
+
+        // Nodos del BDD, contando la constante
+        size_t node_count(const Bdd &f) const
+        {
+            std::vector<std::uint8_t> visited(nodes_.size());
+            std::vector<std::uint32_t> pending{f.edge_ >> 1};
+            size_t count = 0;
+            while (!pending.empty())
+            {
+                const std::uint32_t index = pending.back();
+                pending.pop_back();
+                if (visited[index])
+                    continue;
+                visited[index] = 1;
+                ++count;
+                if (index != 0)
+                {
+                    pending.push_back(nodes_[index].low >> 1);
+                    pending.push_back(nodes_[index].high >> 1);
+                }
+            }
+            return count;
+        }
+
+        // Una asignación (por índice de variable) que hace verdadera f, o
+        // nullopt si f es falsa; las variables que no aparecen valen falso
+        std::optional<std::vector<bool>> satisfying_assignment(const Bdd &f) const
+        {
+            if (f.is_false())
+                return std::nullopt;
+            std::vector<bool> assignment(variables_);
+            for (std::uint32_t edge = f.edge_; edge >> 1 != 0;)
+            {
+                const Node &node = nodes_[edge >> 1];
+                const std::uint32_t high = node.high ^ (edge & 1);
+                if (high != 1)
+                {
+                    assignment[node.variable] = true;
+                    edge = high;
+                }
+                else
+                    edge = node.low ^ (edge & 1);
+            }
+            return assignment;
+        }
+
+        // Libera los nodos que no alcanza ningún Bdd
+        void collect_garbage()
+        {
+            std::vector<std::uint8_t> marked(nodes_.size());
+            std::vector<std::uint32_t> pending;
+            for (std::uint32_t index = 0; index < nodes_.size(); ++index)
+                if (references_[index] > 0)
+                    pending.push_back(index);
+            while (!pending.empty())
+            {
+                const std::uint32_t index = pending.back();
+                pending.pop_back();
+                if (marked[index])
+                    continue;
+                marked[index] = 1;
+                if (index != 0)
+                {
+                    pending.push_back(nodes_[index].low >> 1);
+                    pending.push_back(nodes_[index].high >> 1);
+                }
+            }
+            for (std::uint32_t index = 1; index < nodes_.size(); ++index)
+                if (!marked[index] && nodes_[index].variable != released)
+                {
+                    nodes_[index].variable = released;
+                    free_.push_back(index);
+                    --stats_.nodes;
+                }
+            rehash(buckets_.size());
+            std::ranges::fill(cache_, CacheEntry{});
+            ++stats_.collections;
+        }
+
+        BddStats stats() const
+        {
+            BddStats stats = stats_;
+            stats.bytes = nodes_.capacity() * sizeof(Node) + references_.capacity() * sizeof(std::uint32_t) +
+                          free_.capacity() * sizeof(std::uint32_t) + buckets_.size() * sizeof(std::uint32_t) + cache_.size() * sizeof(CacheEntry);
+            return stats;
+        }
+
+    private:
+        friend class Bdd;
+
+        struct Node
+        {
+            std::uint32_t variable;
+            std::uint32_t low, high; // Aristas; high nunca complementada
+            std::uint32_t next;      // Siguiente en la lista de su cubeta
+        };
+
+        struct CacheEntry
+        {
+            std::uint32_t f = none, g = 0, h = 0, result = 0;
+        };
+
+        static constexpr std::uint32_t none = std::numeric_limits<std::uint32_t>::max();
+        static constexpr std::uint32_t terminal = none;     // Variable de la constante: después de todas
+        static constexpr std::uint32_t released = none - 1; // Variable de un nodo libre
+        static constexpr size_t max_cache = size_t{1} << 22;
+
+        static size_t hash(std::uint32_t a, std::uint32_t b, std::uint32_t c)
+        {
+            return static_cast<size_t>(detail::HashAlgebra::mix(detail::HashAlgebra::mix(detail::HashAlgebra::mix(0x9e3779b97f4a7c15ull, a), b), c));
+        }
+
+        std::uint32_t top(std::uint32_t edge) const { return nodes_[edge >> 1].variable; }
+
+        // Cofactores de `edge` respecto a `variable` (la de menor orden)
+        std::pair<std::uint32_t, std::uint32_t> cofactors(std::uint32_t edge, std::uint32_t variable) const
+        {
+            const Node &node = nodes_[edge >> 1];
+            if (node.variable != variable)
+                return {edge, edge};
+            return {node.low ^ (edge & 1), node.high ^ (edge & 1)};
+        }
+
+        // El nodo (variable, low, high) reducido y normalizado
+        std::uint32_t make(std::uint32_t variable, std::uint32_t low, std::uint32_t high)
+        {
+            if (low == high)
+                return low;
+            const std::uint32_t complement = high & 1;
+            low ^= complement;
+            high ^= complement;
+
+            ++stats_.unique_lookups;
+            const size_t bucket = hash(variable, low, high) & (buckets_.size() - 1);
+            for (std::uint32_t index = buckets_[bucket]; index != none; index = nodes_[index].next)
+                if (nodes_[index].variable == variable && nodes_[index].low == low && nodes_[index].high == high)
+                {
+                    ++stats_.unique_hits;
+                    return index << 1 | complement;
+                }
+
+            std::uint32_t index;
+            if (!free_.empty())
+            {
+                index = free_.back();
+                free_.pop_back();
+                nodes_[index] = {variable, low, high, buckets_[bucket]};
+                references_[index] = 0;
+            }
+            else
+            {
+                index = static_cast<std::uint32_t>(nodes_.size());
+                nodes_.push_back({variable, low, high, buckets_[bucket]});
+                references_.push_back(0);
+            }
+            buckets_[bucket] = index;
+            stats_.peak_nodes = std::max(stats_.peak_nodes, ++stats_.nodes);
+            if (stats_.nodes > buckets_.size())
+                rehash(buckets_.size() * 2);
+            return index << 1 | complement;
+        }
+
+        void rehash(size_t size)
+        {
+            buckets_.assign(size, none);
+            for (std::uint32_t index = 1; index < nodes_.size(); ++index)
+                if (nodes_[index].variable != released)
+                {
+                    const size_t bucket = hash(nodes_[index].variable, nodes_[index].low, nodes_[index].high) & (size - 1);
+                    nodes_[index].next = buckets_[bucket];
+                    buckets_[bucket] = index;
+                }
+        }
+
+        std::uint32_t ite(std::uint32_t f, std::uint32_t g, std::uint32_t h)
+        {
+            // Casos terminales
+            if (f == 0)
+                return g;
+            if (f == 1)
+                return h;
+            if (g == f)
+                g = 0;
+            else if (g == (f ^ 1))
+                g = 1;
+            if (h == f)
+                h = 1;
+            else if (h == (f ^ 1))
+                h = 0;
+            if (g == h)
+                return g;
+            if (g == 0 && h == 1)
+                return f;
+            if (g == 1 && h == 0)
+                return f ^ 1;
+
+            // Forma estándar para la caché: f y g sin complementar
+            if (f & 1)
+            {
+                f ^= 1;
+                std::swap(g, h);
+            }
+            const std::uint32_t complement = g & 1;
+            g ^= complement;
+            h ^= complement;
+
+            ++stats_.cache_lookups;
+            CacheEntry &entry = cache_[hash(f, g, h) & (cache_.size() - 1)];
+            if (entry.f == f && entry.g == g && entry.h == h)
+            {
+                ++stats_.cache_hits;
+                return entry.result ^ complement;
+            }
+
+            const std::uint32_t variable = std::min({top(f), top(g), top(h)});
+            const auto [f0, f1] = cofactors(f, variable);
+            const auto [g0, g1] = cofactors(g, variable);
+            const auto [h0, h1] = cofactors(h, variable);
+            const std::uint32_t low = ite(f0, g0, h0);
+            const std::uint32_t high = ite(f1, g1, h1);
+            const std::uint32_t result = make(variable, low, high);
+            entry = {f, g, h, result};
+            return result ^ complement;
+        }
+
+        // Al empezar una operación: recoge la basura y agranda la caché
+        void maybe_collect()
+        {
+            if (stats_.nodes >= collect_threshold_)
+            {
+                collect_garbage();
+                if (stats_.nodes * 2 > collect_threshold_)
+                    collect_threshold_ *= 2;
+            }
+            if (stats_.nodes > cache_.size() && cache_.size() < max_cache)
+                cache_.assign(cache_.size() * 2, CacheEntry{});
+        }
+
+        std::vector<Node> nodes_;
+        std::vector<std::uint32_t> references_; // Bdd que apuntan a cada nodo
+        std::vector<std::uint32_t> free_;
+        std::vector<std::uint32_t> buckets_;
+        std::vector<CacheEntry> cache_;
+        size_t variables_ = 0;
+        size_t collect_threshold_ = size_t{1} << 18;
+        BddStats stats_;
+    };
+
+    inline Bdd::Bdd(BddManager *manager, std::uint32_t edge) : manager_(manager), edge_(edge) { ++manager_->references_[edge_ >> 1]; }
+
+    inline Bdd::Bdd(const Bdd &other) : manager_(other.manager_), edge_(other.edge_)
+    {
+        if (manager_)
+            ++manager_->references_[edge_ >> 1];
+    }
+
+    inline Bdd::~Bdd()
+    {
+        if (manager_)
+            --manager_->references_[edge_ >> 1];
+    }
+
+    inline Bdd Bdd::operator~() const { return {manager_, edge_ ^ 1}; }
+    inline Bdd Bdd::operator&(const Bdd &other) const { return manager_->ite(*this, other, manager_->zero()); }
+    inline Bdd Bdd::operator|(const Bdd &other) const { return manager_->ite(*this, manager_->one(), other); }
+    inline Bdd Bdd::operator^(const Bdd &other) const { return manager_->ite(*this, ~other, other); }
+    inline Bdd Bdd::implies(const Bdd &other) const { return manager_->ite(*this, other, manager_->one()); }
+    inline Bdd Bdd::equiv(const Bdd &other) const { return manager_->ite(*this, other, ~other); }
+
+    // Construye los BDD de fórmulas de un almacén; los átomos reciben
+    // variables según la heurística de orden (o en el orden de declare())
+    template <typename Store>
+    class BasicBddBuilder
+    {
+    public:
+        BasicBddBuilder(const Store &store, BddManager &manager) : store_(store), manager_(manager) {}
+
+        // Los átomos, en el orden de sus variables
+        std::span<const NodeId> atoms() const { return atoms_; }
+
+        // La variable de un átomo; si no tiene, la siguiente libre
+        Bdd declare(NodeId atom)
+        {
+            const auto [found, inserted] = variables_.try_emplace(atom, atoms_.size());
+            if (inserted)
+                atoms_.push_back(atom);
+            return manager_.variable(found->second);
+        }
+
+        // Da variable a los átomos de la fórmula que aún no tienen: en
+        // profundidad, primero el hijo más profundo de cada conectiva
+        void order(NodeId formula)
+        {
+            const std::unordered_map<NodeId, size_t> depths = depth(formula);
+            std::vector<NodeId> pending{formula};
+            std::unordered_map<NodeId, bool> visited;
+            while (!pending.empty())
+            {
+                const NodeId id = pending.back();
+                pending.pop_back();
+                if (!visited.try_emplace(id, true).second)
+                    continue;
+                const Node &node = store_[id];
+                if (binary(node.op))
+                {
+                    // La pila saca primero el último: el más profundo al final
+                    const bool left_deeper = depths.at(node.operands[0]) >= depths.at(node.operands[1]);
+                    pending.push_back(node.operands[left_deeper ? 1 : 0]);
+                    pending.push_back(node.operands[left_deeper ? 0 : 1]);
+                }
+                else if (node.op == NodeOp::Not)
+                    pending.push_back(node.operands[0]);
+                else
+                    leaf(id);
+            }
+        }
+
+        // Las cadenas de ∧, ∨ y ↔ (asociativas y conmutativas) se aplanan y
+        // sus operandos se combinan empezando por el de variable superior
+        // más profunda: cada paso añade nodos por encima en lugar de
+        // reconstruir el BDD entero. Cada resultado intermedio se suelta
+        // tras su último uso para que la recolección de basura lo libere.
+        Bdd build(NodeId formula)
+        {
+            order(formula);
+
+            // Operandos de cada conectiva y cuántas veces se usa cada subfórmula
+            std::unordered_map<NodeId, std::vector<NodeId>> operands;
+            std::unordered_map<NodeId, size_t> uses;
+            for (std::vector<NodeId> pending{formula}; !pending.empty();)
+            {
+                const NodeId id = pending.back();
+                pending.pop_back();
+                if (operands.contains(id))
+                    continue;
+                std::vector<NodeId> &list = operands[id] = flatten(id);
+                for (const NodeId operand : list)
+                    if (uses[operand]++ == 0)
+                        pending.push_back(operand);
+            }
+
+            std::unordered_map<NodeId, Bdd> built;
+            std::vector<std::pair<NodeId, bool>> pending{{formula, false}}; // (nodo, operandos ya apilados)
+            while (!pending.empty())
+            {
+                const auto [id, expanded] = pending.back();
+                if (built.contains(id))
+                {
+                    pending.pop_back();
+                    continue;
+                }
+                const std::vector<NodeId> &list = operands.at(id);
+                if (!expanded && !list.empty())
+                {
+                    pending.back().second = true;
+                    for (const NodeId operand : list)
+                        pending.push_back({operand, false});
+                    continue;
+                }
+                pending.pop_back();
+                built.emplace(id, combine(id, list, built));
+                for (const NodeId operand : list)
+                    if (--uses.at(operand) == 0)
+                        built.erase(operand);
+            }
+            return built.at(formula);
+        }
+
+    private:
+        static bool binary(NodeOp op) { return op == NodeOp::And || op == NodeOp::Or || op == NodeOp::Implies || op == NodeOp::Equiv; }
+
+        // Profundidad de cada subfórmula (las hojas, 0)
+        std::unordered_map<NodeId, size_t> depth(NodeId formula) const
+        {
+            std::unordered_map<NodeId, size_t> depths;
+            std::vector<std::pair<NodeId, bool>> pending{{formula, false}};
+            while (!pending.empty())
+            {
+                const auto [id, expanded] = pending.back();
+                if (depths.contains(id))
+                {
+                    pending.pop_back();
+                    continue;
+                }
+                const Node &node = store_[id];
+                const bool connective = binary(node.op) || node.op == NodeOp::Not;
+                if (!expanded && connective)
+                {
+                    pending.back().second = true;
+                    pending.push_back({node.operands[0], false});
+                    if (binary(node.op))
+                        pending.push_back({node.operands[1], false});
+                    continue;
+                }
+                pending.pop_back();
+                size_t value = 0;
+                if (connective)
+                    value = 1 + std::max(depths.at(node.operands[0]), binary(node.op) ? depths.at(node.operands[1]) : 0);
+                depths.emplace(id, value);
+            }
+            return depths;
+        }
+
+        // Operandos de la conectiva `id` (vacío en las hojas)
+        std::vector<NodeId> flatten(NodeId id) const
+        {
+            const Node &node = store_[id];
+            if (node.op == NodeOp::Not)
+                return {node.operands[0]};
+            if (node.op == NodeOp::Implies)
+                return {node.operands[0], node.operands[1]};
+            if (node.op != NodeOp::And && node.op != NodeOp::Or && node.op != NodeOp::Equiv)
+                return {};
+            std::vector<NodeId> out;
+            for (std::vector<NodeId> pending{id}; !pending.empty();)
+            {
+                const NodeId current = pending.back();
+                pending.pop_back();
+                if (store_[current].op == node.op)
+                {
+                    pending.push_back(store_[current].operands[1]);
+                    pending.push_back(store_[current].operands[0]);
+                }
+                else
+                    out.push_back(current);
+            }
+            return out;
+        }
+
+        bool valid_body(NodeId quantifier)
+        {
+            if (const auto found = valid_bodies_.find(quantifier); found != valid_bodies_.end())
+                return found->second;
+            // El cuerpo se construye en un builder aparte: sus átomos no son
+            // átomos de la fórmula y no deben entrar en atoms() ni en el orden.
+            // Sus variables se numeran desde 0 sobre el mismo gestor; para
+            // saber si es válido basta cualquier asignación inyectiva.
+            BasicBddBuilder scratch(store_, manager_);
+            const bool valid = scratch.build(store_[quantifier].operands[0]).is_true();
+            valid_bodies_.merge(scratch.valid_bodies_);
+            valid_bodies_.emplace(quantifier, valid);
+            return valid;
+        }
+
+        // Un cuantificador cuyo cuerpo es válido no es un átomo
+        void leaf(NodeId id)
+        {
+            const NodeOp op = store_[id].op;
+            if ((op == NodeOp::Forall || op == NodeOp::Exists) && valid_body(id))
+                return;
+            declare(id);
+        }
+
+        Bdd combine(NodeId id, const std::vector<NodeId> &list, const std::unordered_map<NodeId, Bdd> &built)
+        {
+            const NodeOp op = store_[id].op;
+            switch (op)
+            {
+            case NodeOp::Not:
+                return ~built.at(list[0]);
+            case NodeOp::Implies:
+                return built.at(list[0]).implies(built.at(list[1]));
+            case NodeOp::And:
+            case NodeOp::Or:
+            case NodeOp::Equiv:
+            {
+                std::vector<Bdd> values;
+                for (const NodeId operand : list)
+                    values.push_back(built.at(operand));
+                std::ranges::stable_sort(values, std::greater{}, [&](const Bdd &value) { return manager_.top(value); });
+                Bdd out = values[0];
+                for (size_t i = 1; i < values.size(); ++i)
+                    out = op == NodeOp::And ? out & values[i] : op == NodeOp::Or ? out | values[i] : out.equiv(values[i]);
+                return out;
+            }
+            case NodeOp::Forall:
+            case NodeOp::Exists:
+                if (valid_body(id))
+                    return manager_.one();
+                return declare(id);
+            default:
+                return declare(id);
+            }
+        }
+
+        const Store &store_;
+        BddManager &manager_;
+        std::unordered_map<NodeId, size_t> variables_;
+        std::vector<NodeId> atoms_;
+        std::unordered_map<NodeId, bool> valid_bodies_; // Cuantificadores: si su cuerpo es válido
+    };
+
+    using BddBuilder = BasicBddBuilder<TermStore>;
+
+} // namespace logic::runtime
+
+namespace logic
+{
+
+    // --- Desde los tipos ---
+    // type_bdd<F>(manager): el BDD de F construido directamente sobre sus
+    // tipos, con el átomo i de Atoms como variable i. Por defecto Atoms es
+    // BddOrder_t<F>, los átomos por su primera aparición de izquierda a
+    // derecha; para comparar varias fórmulas, la misma lista para todas
+    // (por ejemplo BddOrder_t<And<F, G>>).
+    namespace detail
+    {
+        template <typename Out, typename In>
+        struct FirstOccurrences;
+
+        template <typename... Out>
+        struct FirstOccurrences<TypeList<Out...>, TypeList<>>
+        {
+            using type = TypeList<Out...>;
+        };
+
+        template <typename... Out, typename T, typename... Rest>
+        struct FirstOccurrences<TypeList<Out...>, TypeList<T, Rest...>>
+            : FirstOccurrences<std::conditional_t<(std::is_same_v<T, Out> || ...), TypeList<Out...>, TypeList<Out..., T>>, TypeList<Rest...>>
+        {
+        };
+
+        template <typename F>
+        struct BddOf
+        {
+            template <typename Atoms>
+            static runtime::Bdd build(runtime::BddManager &manager, Atoms atoms)
+            {
+                static_assert(atom_index<F>(Atoms{}) < Atoms::size, "ERROR: un átomo de la fórmula no está en la lista de átomos del BDD");
+                return manager.variable(atom_index<F>(atoms));
+            }
+        };
+
+        template <typename T>
+        struct BddOf<Not<T>>
+        {
+            template <typename Atoms>
+            static runtime::Bdd build(runtime::BddManager &manager, Atoms atoms)
+            {
+                return ~BddOf<T>::build(manager, atoms);
+            }
+        };
+
+        template <typename L, typename R>
+        struct BddOf<And<L, R>>
+        {
+            template <typename Atoms>
+            static runtime::Bdd build(runtime::BddManager &manager, Atoms atoms)
+            {
+                return BddOf<L>::build(manager, atoms) & BddOf<R>::build(manager, atoms);
+            }
+        };
+
+        template <typename L, typename R>
+        struct BddOf<Or<L, R>>
+        {
+            template <typename Atoms>
+            static runtime::Bdd build(runtime::BddManager &manager, Atoms atoms)
+            {
+                return BddOf<L>::build(manager, atoms) | BddOf<R>::build(manager, atoms);
+            }
+        };
+
+        template <typename L, typename R>
+        struct BddOf<Implies<L, R>>
+        {
+            template <typename Atoms>
+            static runtime::Bdd build(runtime::BddManager &manager, Atoms atoms)
+            {
+                return BddOf<L>::build(manager, atoms).implies(BddOf<R>::build(manager, atoms));
+            }
+        };
+
+        template <typename L, typename R>
+        struct BddOf<Equiv<L, R>>
+        {
+            template <typename Atoms>
+            static runtime::Bdd build(runtime::BddManager &manager, Atoms atoms)
+            {
+                return BddOf<L>::build(manager, atoms).equiv(BddOf<R>::build(manager, atoms));
+            }
+        };
+
+        template <template <typename, typename> class Q, typename V, typename Body>
+            requires Quantifier<Q>
+        struct BddOf<Q<V, Body>>
+        {
+            template <typename Atoms>
+            static runtime::Bdd build(runtime::BddManager &manager, Atoms atoms)
+            {
+                if constexpr (type_tautology<Body>())
+                    return manager.one();
+                else
+                {
+                    static_assert(atom_index<Q<V, Body>>(Atoms{}) < Atoms::size, "ERROR: un átomo de la fórmula no está en la lista de átomos del BDD");
+                    return manager.variable(atom_index<Q<V, Body>>(atoms));
+                }
+            }
+        };
+    } // namespace detail
+
+    template <typename F>
+    using BddOrder_t = typename detail::FirstOccurrences<TypeList<>, typename detail::PropositionalAtoms<F>::type>::type;
+
+    template <typename F, typename Atoms = BddOrder_t<F>>
+    runtime::Bdd type_bdd(runtime::BddManager &manager)
+    {
+        return detail::BddOf<F>::build(manager, Atoms{});
+    }
+
+} // namespace logic
@@ -0,0 +1,630 @@
+#pragma once
+
+#include "mapped_file.hpp"
+#include "proof_checker.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+
+namespace logic::runtime
+{
+
+    // =========================================================
+    // === BINARY PROOF CERTIFICATES ===
+    // =========================================================
+    //
+    // Formato binario versionado para corpus de demostraciones grandes. El
+    // fichero es la imagen en memoria de lo que usa el comprobador, así que
+    // se proyecta con mmap y se recorre sin deserializar:
+    //
+    //   Header        magia, versión, orden de bytes y una Section por tabla
+    //   symbols       nombres internados {hash, posición, longitud}
+    //   text          los nombres, seguidos
+    //   symbol_index  tabla hash abierta de SymbolId (por el hash del nombre)
+    //   nodes         nodos compartidos {Node, hash}, hijos antes que padres
+    //   arguments     argumentos de los átomos
+    //   node_index    tabla hash abierta de NodeId (por el hash del nodo)
+    //   steps         ProofStep tal cual; cada paso cita pasos anteriores,
+    //                 así que las subdemostraciones compartidas se citan
+    //   lemmas        raíces con nombre {símbolo, paso}
+    //
+    // Cada tabla empieza en un múltiplo de 8 bytes. Los hash son los de
+    // TermStore (formula_hash_v), de modo que CertificateStore puede buscar
+    // en las tablas del fichero los nodos que construye el comprobador y
+    // guardar aparte solo los que no están. Abrir un fichero solo lee la
+    // cabecera (tiempo y memoria constantes); validate() recorre el fichero
+    // una vez sin reservar memoria y se debe llamar antes de comprobar un
+    // fichero que no es de confianza. Los errores de formato lanzan
+    // CertificateFormatError.
+
+    class CertificateFormatError : public std::runtime_error
+    {
+    public:
+        using std::runtime_error::runtime_error;
+    };
+
+    namespace certificate_format
+    {
+        inline constexpr std::array<char, 8> magic{'L', 'O', 'G', 'I', 'C', 'P', 'R', 'F'};
+        inline constexpr std::uint32_t version = 1;
+        inline constexpr std::uint32_t byte_order = 0x01020304;
+        inline constexpr std::uint32_t empty_slot = ~std::uint32_t{0};
+
+        struct Section
+        {
+            std::uint64_t offset; // Bytes desde el principio del fichero
+            std::uint64_t count;  // Elementos
+        };
+
+        struct Header
+        {
+            std::array<char, 8> magic;
+            std::uint32_t version;
+            std::uint32_t byte_order;
+            std::uint64_t size; // Bytes del fichero
+            Section symbols;
+            Section text;
+            Section symbol_index;
+            Section nodes;
+            Section arguments;
+            Section node_index;
+            Section steps;
+            Section lemmas;
+        };
+
+        struct Symbol
+        {
+            std::uint64_t hash;
+            std::uint32_t offset;
+            std::uint32_t length;
+        };
+
+        struct Entry
+        {
+            Node node;
+            std::uint64_t hash;
+        };
+
+        struct Lemma
+        {
+            SymbolId name;
+            StepId step;
+        };
+
+        static_assert(sizeof(Header) == 152 && sizeof(Symbol) == 16 && sizeof(Entry) == 24 && sizeof(Lemma) == 8,
+                      "El formato no debe depender del relleno del compilador");
+        static_assert(sizeof(ProofStep) == 16);
+
+        // Tablas hash abiertas: potencia de dos, factor de carga ≤ 1/2
+        constexpr size_t index_capacity(size_t count) { return std::max<size_t>(16, std::bit_ceil(2 * count)); }
+    } // namespace certificate_format
+
+    // Raíz con nombre (un lema del corpus)
+    struct NamedStep
+    {
+        std::string_view name;
+        StepId step;
+    };
+
+    // --- Escritura ---
+    // Copia en el fichero los nodos que citan los pasos (solo esos, con
+    // identificadores densos) y sus nombres. Sin lemas, la raíz es el último
+    // paso.
+    inline std::vector<char> encode_certificate(const TermStore &store, const ProofCertificate &certificate,
+                                                std::span<const NamedStep> lemmas = {})
+    {
+        namespace format = certificate_format;
+
+        std::vector<format::Symbol> symbols;
+        std::string text;
+        std::unordered_map<std::string_view, SymbolId> symbol_ids;
+        auto symbol = [&](std::string_view name) {
+            const auto [found, inserted] = symbol_ids.emplace(name, static_cast<SymbolId>(symbols.size()));
+            if (inserted)
+            {
+                symbols.push_back({logic::detail::fnv1a(name), static_cast<std::uint32_t>(text.size()), static_cast<std::uint32_t>(name.size())});
+                text += name;
+            }
+            return found->second;
+        };
+
+        std::vector<format::Entry> nodes;
+        std::vector<NodeId> arguments;
+        std::unordered_map<NodeId, NodeId> node_ids;
+        auto node = [&](auto &self, NodeId id) -> NodeId {
+            if (const auto found = node_ids.find(id); found != node_ids.end())
+                return found->second;
+            format::Entry entry{store[id], store.hash(id)};
+            if (entry.node.op == NodeOp::Atom)
+            {
+                std::vector<NodeId> args;
+                for (NodeId child : store.children(id))
+                    args.push_back(self(self, child));
+                entry.node.operands = {static_cast<NodeId>(arguments.size()), static_cast<NodeId>(args.size())};
+                arguments.insert(arguments.end(), args.begin(), args.end());
+            }
+            else
+                for (size_t i = 0; i < arity(entry.node.op); ++i)
+                    entry.node.operands[i] = self(self, entry.node.operands[i]);
+            if (entry.node.op <= NodeOp::Atom || is_binder(entry.node.op))
+                entry.node.symbol = symbol(store.symbols().name(entry.node.symbol));
+            const NodeId file_id = static_cast<NodeId>(nodes.size());
+            nodes.push_back(entry);
+            node_ids.emplace(id, file_id);
+            return file_id;
+        };
+
+        std::vector<ProofStep> steps(certificate.steps().begin(), certificate.steps().end());
+        for (ProofStep &step : steps)
+            if (step.rule != Rule::ModusPonens)
+            {
+                if (!store.contains(step.formula))
+                    throw std::invalid_argument("encode_certificate: la fórmula no existe en el TermStore");
+                step.formula = node(node, step.formula);
+            }
+
+        std::vector<format::Lemma> named;
+        for (const NamedStep &lemma : lemmas)
+            named.push_back({symbol(lemma.name), lemma.step});
+
+        auto index = [](size_t count, auto hash_of) {
+            std::vector<std::uint32_t> slots(format::index_capacity(count), format::empty_slot);
+            const size_t mask = slots.size() - 1;
+            for (std::uint32_t id = 0; id < count; ++id)
+            {
+                size_t slot = hash_of(id) & mask;
+                while (slots[slot] != format::empty_slot)
+                    slot = (slot + 1) & mask;
+                slots[slot] = id;
+            }
+            return slots;
+        };
+        const std::vector<std::uint32_t> symbol_index = index(symbols.size(), [&](std::uint32_t id) { return symbols[id].hash; });
+        const std::vector<std::uint32_t> node_index = index(nodes.size(), [&](std::uint32_t id) { return nodes[id].hash; });
+
+        format::Header header{format::magic, format::version, format::byte_order, 0, {}, {}, {}, {}, {}, {}, {}, {}};
+        size_t size = sizeof(format::Header);
+        auto place = [&](format::Section &section, size_t count, size_t element) {
+            size = (size + 7) & ~size_t{7};
+            section = {size, count};
+            size += count * element;
+        };
+        place(header.symbols, symbols.size(), sizeof(format::Symbol));
+        place(header.text, text.size(), 1);
+        place(header.symbol_index, symbol_index.size(), sizeof(std::uint32_t));
+        place(header.nodes, nodes.size(), sizeof(format::Entry));
+        place(header.arguments, arguments.size(), sizeof(NodeId));
+        place(header.node_index, node_index.size(), sizeof(std::uint32_t));
+        place(header.steps, steps.size(), sizeof(ProofStep));
+        place(header.lemmas, named.size(), sizeof(format::Lemma));
+        header.size = size;
+
+        std::vector<char> out(size, 0);
+        auto copy = [&](const format::Section &section, const void *data, size_t bytes) {
+            if (bytes != 0)
+                std::memcpy(out.data() + section.offset, data, bytes);
+        };
+        std::memcpy(out.data(), &header, sizeof(header));
+        copy(header.symbols, symbols.data(), symbols.size() * sizeof(format::Symbol));
+        copy(header.text, text.data(), text.size());
+        copy(header.symbol_index, symbol_index.data(), symbol_index.size() * sizeof(std::uint32_t));
+        copy(header.arguments, arguments.data(), arguments.size() * sizeof(NodeId));
+        copy(header.node_index, node_index.data(), node_index.size() * sizeof(std::uint32_t));
+        copy(header.lemmas, named.data(), named.size() * sizeof(format::Lemma));
+
+        // Entry y ProofStep tienen relleno tras el op y la regla: se escriben
+        // campo a campo sobre el buffer a cero, para que el fichero no lleve
+        // bytes sin inicializar y dos codificaciones iguales den los mismos
+        // bytes
+        auto put = [&](size_t at, const auto &field) { std::memcpy(out.data() + at, &field, sizeof(field)); };
+        for (size_t i = 0; i < nodes.size(); ++i)
+        {
+            const size_t at = header.nodes.offset + i * sizeof(format::Entry);
+            const size_t node_at = at + offsetof(format::Entry, node);
+            put(node_at + offsetof(Node, op), nodes[i].node.op);
+            put(node_at + offsetof(Node, symbol), nodes[i].node.symbol);
+            put(node_at + offsetof(Node, operands), nodes[i].node.operands);
+            put(at + offsetof(format::Entry, hash), nodes[i].hash);
+        }
+        for (size_t i = 0; i < steps.size(); ++i)
+        {
+            const size_t at = header.steps.offset + i * sizeof(ProofStep);
+            put(at + offsetof(ProofStep, rule), steps[i].rule);
+            put(at + offsetof(ProofStep, formula), steps[i].formula);
+            put(at + offsetof(ProofStep, premises), steps[i].premises);
+        }
+        return out;
+    }
+
+    inline void write_certificate(const std::string &path, const TermStore &store, const ProofCertificate &certificate,
+                                  std::span<const NamedStep> lemmas = {})
+    {
+        const std::vector<char> bytes = encode_certificate(store, certificate, lemmas);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out.write(bytes.data(), static_cast<std::streamsize>(bytes.size())) || !out.flush())
+            throw std::system_error(errno ? errno : EIO, std::generic_category(), "write_certificate: " + path);
+    }
+
+    // --- Lectura ---
+    // Las tablas son vistas sobre la proyección, válidas mientras viva el
+    // objeto.
+    class CertificateFile
+    {
+    public:
+        explicit CertificateFile(const std::string &path) : file_(path)
+        {
+            namespace format = certificate_format;
+            const std::string_view bytes = file_.text();
+            if (bytes.size() < sizeof(format::Header))
+                throw CertificateFormatError("certificado: fichero truncado");
+            std::memcpy(&header_, bytes.data(), sizeof(header_));
+            if (header_.magic != format::magic)
+                throw CertificateFormatError("certificado: no es un certificado de demostración");
+            if (header_.byte_order != format::byte_order)
+                throw CertificateFormatError("certificado: orden de bytes distinto");
+            if (header_.version != format::version)
+                throw CertificateFormatError("certificado: versión " + std::to_string(header_.version) + " no soportada");
+            if (header_.size != bytes.size())
+                throw CertificateFormatError("certificado: fichero truncado");
+
+            symbols_ = section<format::Symbol>(header_.symbols);
+            text_ = section<char>(header_.text);
+            symbol_index_ = section<std::uint32_t>(header_.symbol_index);
+            nodes_ = section<format::Entry>(header_.nodes);
+            arguments_ = section<NodeId>(header_.arguments);
+            node_index_ = section<std::uint32_t>(header_.node_index);
+            steps_ = section<ProofStep>(header_.steps);
+            lemmas_ = section<format::Lemma>(header_.lemmas);
+            if (!std::has_single_bit(symbol_index_.size()) || !std::has_single_bit(node_index_.size()))
+                throw CertificateFormatError("certificado: índice sin tamaño potencia de dos");
+            if (nodes_.size() >= format::empty_slot || symbols_.size() >= format::empty_slot || steps_.size() >= ProofCertificate::none)
+                throw CertificateFormatError("certificado: demasiados elementos");
+        }
+
+        std::span<const certificate_format::Symbol> symbols() const { return symbols_; }
+        std::span<const std::uint32_t> symbol_index() const { return symbol_index_; }
+        std::span<const certificate_format::Entry> nodes() const { return nodes_; }
+        std::span<const NodeId> arguments() const { return arguments_; }
+        std::span<const std::uint32_t> node_index() const { return node_index_; }
+        std::span<const ProofStep> steps() const { return steps_; }
+        std::span<const certificate_format::Lemma> lemmas() const { return lemmas_; }
+
+        std::string_view name(SymbolId id) const
+        {
+            const certificate_format::Symbol &symbol = symbols_[id];
+            return std::string_view(text_.data() + symbol.offset, symbol.length);
+        }
+
+        // Pasos cuyo teorema interesa: los lemas, o el último paso
+        std::vector<StepId> roots() const
+        {
+            std::vector<StepId> roots;
+            for (const certificate_format::Lemma &lemma : lemmas_)
+                roots.push_back(lemma.step);
+            if (roots.empty() && !steps_.empty())
+                roots.push_back(static_cast<StepId>(steps_.size() - 1));
+            return roots;
+        }
+
+        // Comprueba que las tablas son coherentes: referencias dentro de
+        // rango, hijos antes que padres, los hash que usa el comprobador e
+        // índices en los que cada elemento está una vez y en la cadena de
+        // sondeo de su hash (así quedan huecos y toda búsqueda termina)
+        void validate() const
+        {
+            namespace format = certificate_format;
+            auto expect = [](bool condition, const char *what) {
+                if (!condition)
+                    throw CertificateFormatError(std::string("certificado: ") + what);
+            };
+
+            for (const format::Symbol &symbol : symbols_)
+                expect(symbol.offset <= text_.size() && symbol.length <= text_.size() - symbol.offset, "nombre fuera del texto");
+            for (SymbolId id = 0; id < symbols_.size(); ++id)
+                expect(symbols_[id].hash == logic::detail::fnv1a(name(id)), "hash de nombre incorrecto");
+
+            for (NodeId id = 0; id < nodes_.size(); ++id)
+            {
+                const Node &node = nodes_[id].node;
+                expect(node.op <= NodeOp::Exists, "operador desconocido");
+                std::uint64_t hash = 0;
+                if (node.op <= NodeOp::Atom || is_binder(node.op))
+                    expect(node.symbol < symbols_.size(), "símbolo fuera de rango");
+                switch (node.op)
+                {
+                case NodeOp::Variable:
+                    hash = detail::NodeHash::leaf(NodeKind::Variable, symbols_[node.symbol].hash);
+                    break;
+                case NodeOp::Constant:
+                    hash = detail::NodeHash::leaf(NodeKind::Constant, symbols_[node.symbol].hash);
+                    break;
+                case NodeOp::Atom:
+                    expect(node.operands[0] <= arguments_.size() && node.operands[1] <= arguments_.size() - node.operands[0],
+                           "argumentos fuera de rango");
+                    hash = detail::NodeHash::atom(symbols_[node.symbol].hash);
+                    for (NodeId arg : arguments_.subspan(node.operands[0], node.operands[1]))
+                    {
+                        expect(arg < id, "un hijo debe ir antes que su padre");
+                        hash = detail::NodeHash::argument(hash, nodes_[arg].hash);
+                    }
+                    break;
+                case NodeOp::Not:
+                    expect(node.operands[0] < id, "un hijo debe ir antes que su padre");
+                    hash = detail::NodeHash::unary(node.op, nodes_[node.operands[0]].hash);
+                    break;
+                case NodeOp::Forall:
+                case NodeOp::Exists:
+                    expect(node.operands[0] < id, "un hijo debe ir antes que su padre");
+                    hash = detail::NodeHash::binder(node.op, symbols_[node.symbol].hash, nodes_[node.operands[0]].hash);
+                    break;
+                default:
+                    expect(node.operands[0] < id && node.operands[1] < id, "un hijo debe ir antes que su padre");
+                    hash = detail::NodeHash::binary(node.op, nodes_[node.operands[0]].hash, nodes_[node.operands[1]].hash);
+                }
+                expect(nodes_[id].hash == hash, "hash de nodo incorrecto");
+            }
+
+            auto index = [&](std::span<const std::uint32_t> slots, size_t count, auto hash_of, const char *out_of_range) {
+                size_t used = 0;
+                for (std::uint32_t slot : slots)
+                    if (slot != format::empty_slot)
+                    {
+                        expect(slot < count, out_of_range);
+                        ++used;
+                    }
+                expect(slots.size() >= 2 * count && used == count, "índice demasiado lleno");
+                // count ocupadas y count elementos encontrados en casillas
+                // distintas: ninguno falta ni se repite
+                const size_t mask = slots.size() - 1;
+                for (std::uint32_t id = 0; id < count; ++id)
+                    for (size_t slot = hash_of(id) & mask; slots[slot] != id; slot = (slot + 1) & mask)
+                        expect(slots[slot] != format::empty_slot, "elemento fuera de su sitio en el índice");
+            };
+            index(symbol_index_, symbols_.size(), [&](std::uint32_t id) { return symbols_[id].hash; }, "índice de nombres fuera de rango");
+            index(node_index_, nodes_.size(), [&](std::uint32_t id) { return nodes_[id].hash; }, "índice de nodos fuera de rango");
+
+            for (const ProofStep &step : steps_)
+            {
+                expect(step.rule <= Rule::UniversalInstantiation, "regla desconocida");
+                expect(step.rule == Rule::ModusPonens || step.formula < nodes_.size(), "fórmula fuera de rango");
+            }
+            for (const format::Lemma &lemma : lemmas_)
+                expect(lemma.name < symbols_.size() && lemma.step < steps_.size(), "lema fuera de rango");
+        }
+
+    private:
+        template <typename T>
+        std::span<const T> section(const certificate_format::Section &section) const
+        {
+            const size_t size = file_.text().size();
+            if (section.offset % alignof(std::uint64_t) != 0 || section.offset > size ||
+                section.count > (size - section.offset) / sizeof(T))
+                throw CertificateFormatError("certificado: tabla fuera del fichero");
+            return std::span<const T>(reinterpret_cast<const T *>(file_.text().data() + section.offset), section.count);
+        }
+
+        MappedFile file_;
+        certificate_format::Header header_{};
+        std::span<const certificate_format::Symbol> symbols_;
+        std::span<const char> text_;
+        std::span<const std::uint32_t> symbol_index_;
+        std::span<const certificate_format::Entry> nodes_;
+        std::span<const NodeId> arguments_;
+        std::span<const std::uint32_t> node_index_;
+        std::span<const ProofStep> steps_;
+        std::span<const certificate_format::Lemma> lemmas_;
+    };
+
+    // --- Almacén sobre el fichero ---
+    // La interfaz de TermStore sobre las tablas de un CertificateFile: los
+    // nodos y nombres del fichero conservan su identificador y se leen en la
+    // proyección; construir un nodo lo busca primero en node_index y solo si
+    // no está lo crea en memoria (identificadores a partir de
+    // file.nodes().size()). Así BasicProofChecker<CertificateStore>
+    // comprueba el fichero sin copiarlo y solo reserva memoria para las
+    // fórmulas nuevas que producen las reglas. Un solo hilo.
+    class CertificateStore
+    {
+    public:
+        explicit CertificateStore(const CertificateFile &file)
+            : file_(file), file_nodes_(static_cast<NodeId>(file.nodes().size())),
+              file_symbols_(static_cast<SymbolId>(file.symbols().size()))
+        {
+        }
+
+        NodeId variable(std::string_view name) { return leaf(NodeOp::Variable, NodeKind::Variable, intern(name)); }
+        NodeId constant(std::string_view name) { return leaf(NodeOp::Constant, NodeKind::Constant, intern(name)); }
+
+        NodeId atom(std::string_view name, std::span<const NodeId> args)
+        {
+            const SymbolId symbol = intern(name);
+            std::uint64_t hash = detail::NodeHash::atom(symbols().hash(symbol));
+            for (NodeId arg : args)
+                hash = detail::NodeHash::argument(hash, this->hash(arg));
+            return lookup({NodeOp::Atom, symbol, {0, static_cast<NodeId>(args.size())}}, hash, args);
+        }
+
+        NodeId unary(NodeOp op, NodeId operand)
+        {
+            return lookup({op, SymbolTable::npos, {operand, 0}}, detail::NodeHash::unary(op, hash(operand)), {});
+        }
+
+        NodeId binary(NodeOp op, NodeId left, NodeId right)
+        {
+            return lookup({op, SymbolTable::npos, {left, right}}, detail::NodeHash::binary(op, hash(left), hash(right)), {});
+        }
+
+        NodeId binder(NodeOp op, std::string_view variable, NodeId body)
+        {
+            const SymbolId symbol = intern(variable);
+            return lookup({op, symbol, {body, 0}}, detail::NodeHash::binder(op, symbols().hash(symbol), hash(body)), {});
+        }
+
+        const Node &operator[](NodeId id) const { return entry(id).node; }
+        bool contains(NodeId id) const { return id < file_nodes_ + nodes_.size(); }
+        std::uint64_t hash(NodeId id) const { return entry(id).hash; }
+
+        std::span<const NodeId> children(NodeId id) const
+        {
+            const Node &node = entry(id).node;
+            if (node.op != NodeOp::Atom)
+                return std::span<const NodeId>(node.operands.data(), arity(node.op));
+            if (node.operands[1] == 0)
+                return {};
+            if (id < file_nodes_)
+                return file_.arguments().subspan(node.operands[0], node.operands[1]);
+            return std::span<const NodeId>(&arguments_[node.operands[0]], node.operands[1]);
+        }
+
+        std::string_view label(NodeId id) const
+        {
+            const Node &node = entry(id).node;
+            return node.op <= NodeOp::Atom ? symbols().name(node.symbol) : op_symbol(node.op);
+        }
+
+        class Symbols
+        {
+        public:
+            explicit Symbols(const CertificateStore &store) : store_(store) {}
+
+            std::string_view name(SymbolId id) const
+            {
+                return id < store_.file_symbols_ ? store_.file_.name(id) : store_.symbols_[id - store_.file_symbols_].name;
+            }
+
+            std::uint64_t hash(SymbolId id) const
+            {
+                return id < store_.file_symbols_ ? store_.file_.symbols()[id].hash : store_.symbols_[id - store_.file_symbols_].hash;
+            }
+
+        private:
+            const CertificateStore &store_;
+        };
+
+        Symbols symbols() const { return Symbols(*this); }
+
+        std::string text(NodeId id) const
+        {
+            std::string out;
+            detail::write_text(*this, out, id);
+            return out;
+        }
+
+        // Nodos creados en memoria (los que no estaban en el fichero)
+        size_t created() const { return nodes_.size(); }
+
+    private:
+        using Entry = certificate_format::Entry;
+
+        struct SymbolEntry
+        {
+            std::string_view name;
+            std::uint64_t hash;
+        };
+
+        const Entry &entry(NodeId id) const { return id < file_nodes_ ? file_.nodes()[id] : nodes_[id - file_nodes_]; }
+
+        SymbolId intern(std::string_view name)
+        {
+            const std::uint64_t hash = logic::detail::fnv1a(name);
+            const std::span<const std::uint32_t> index = file_.symbol_index();
+            for (size_t slot = hash & (index.size() - 1); index[slot] != certificate_format::empty_slot; slot = (slot + 1) & (index.size() - 1))
+                if (file_.symbols()[index[slot]].hash == hash && file_.name(index[slot]) == name)
+                    return index[slot];
+            if (const auto found = symbol_ids_.find(name); found != symbol_ids_.end())
+                return found->second;
+
+            const size_t first = text_.append(std::span<const char>(name.data(), name.size()));
+            const std::string_view stored(name.empty() ? nullptr : &text_[first], name.size());
+            const SymbolId id = file_symbols_ + static_cast<SymbolId>(symbols_.push_back({stored, hash}));
+            symbol_ids_.emplace(stored, id);
+            return id;
+        }
+
+        NodeId leaf(NodeOp op, NodeKind kind, SymbolId symbol)
+        {
+            return lookup({op, symbol, {0, 0}}, detail::NodeHash::leaf(kind, symbols().hash(symbol)), {});
+        }
+
+        bool same(NodeId id, const Node &node, std::span<const NodeId> args) const
+        {
+            const Node &stored = entry(id).node;
+            if (stored.op != node.op || stored.symbol != node.symbol)
+                return false;
+            if (node.op != NodeOp::Atom)
+                return stored.operands == node.operands;
+            const std::span<const NodeId> children = this->children(id);
+            return std::ranges::equal(children, args);
+        }
+
+        // Busca en el índice del fichero y después en los nodos nuevos
+        NodeId lookup(Node node, std::uint64_t hash, std::span<const NodeId> args)
+        {
+            for (NodeId child : node.op == NodeOp::Atom ? args : std::span<const NodeId>(node.operands.data(), arity(node.op)))
+                if (!contains(child))
+                    throw std::out_of_range("CertificateStore: el hijo no existe");
+
+            const std::span<const std::uint32_t> index = file_.node_index();
+            for (size_t slot = hash & (index.size() - 1); index[slot] != certificate_format::empty_slot; slot = (slot + 1) & (index.size() - 1))
+                if (file_.nodes()[index[slot]].hash == hash && same(index[slot], node, args))
+                    return index[slot];
+
+            if (slots_.empty())
+                slots_.assign(64, {0, certificate_format::empty_slot});
+            size_t mask = slots_.size() - 1;
+            size_t slot = hash & mask;
+            for (; slots_[slot].id != certificate_format::empty_slot; slot = (slot + 1) & mask)
+                if (slots_[slot].hash == hash && same(slots_[slot].id, node, args))
+                    return slots_[slot].id;
+
+            if (file_nodes_ + nodes_.size() >= certificate_format::empty_slot)
+                throw std::length_error("CertificateStore: demasiados nodos");
+            if (node.op == NodeOp::Atom)
+                node.operands[0] = static_cast<NodeId>(arguments_.append(args));
+            const NodeId id = file_nodes_ + static_cast<NodeId>(nodes_.push_back({node, hash}));
+            slots_[slot] = {hash, id};
+            if (2 * nodes_.size() > slots_.size())
+                rehash(2 * slots_.size());
+            return id;
+        }
+
+        void rehash(size_t capacity)
+        {
+            std::vector<Slot> slots(capacity, Slot{0, certificate_format::empty_slot});
+            for (const Slot &old : slots_)
+            {
+                if (old.id == certificate_format::empty_slot)
+                    continue;
+                size_t slot = old.hash & (capacity - 1);
+                while (slots[slot].id != certificate_format::empty_slot)
+                    slot = (slot + 1) & (capacity - 1);
+                slots[slot] = old;
+            }
+            slots_ = std::move(slots);
+        }
+
+        struct Slot
+        {
+            std::uint64_t hash;
+            NodeId id;
+        };
+
+        const CertificateFile &file_;
+        NodeId file_nodes_;
+        SymbolId file_symbols_;
+        detail::ChunkedVector<Entry> nodes_;
+        detail::ChunkedVector<NodeId> arguments_;
+        std::vector<Slot> slots_;
+        detail::ChunkedVector<char, 4096> text_;
+        detail::ChunkedVector<SymbolEntry> symbols_;
+        std::unordered_map<std::string_view, SymbolId> symbol_ids_;
+    };
+
+} // namespace logic::runtime
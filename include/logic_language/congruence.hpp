@@ -0,0 +1,761 @@
+#pragma once
+
+#include "proof_checker.hpp"
+#include "stamped_table.hpp"
+#include "term_store.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// =========================================================
+// === CIERRE DE CONGRUENCIA (igualdad entre términos cerrados) ===
+// =========================================================
+//
+// Equal es un predicado sin interpretar: ni el kernel ni las tablas de
+// verdad saben que a = b y b = c dan a = c, o que a = b da S(a) = S(b).
+// CongruenceClosure decide la igualdad entre términos cerrados a partir de
+// un conjunto de ecuaciones, con la reflexividad, la simetría, la
+// transitividad y la congruencia (f(ā) = f(b̄) si cada ai = bi):
+//
+//   - unión-búsqueda con compresión de caminos y unión por tamaño;
+//   - listas de uso: cada clase guarda los términos que la tienen como
+//     argumento, y al unir dos clases solo se revisan los de la menor
+//     contra una tabla de firmas (símbolo y clases de los argumentos);
+//   - símbolos inyectivos opcionales, como S en PA4: f(ā) = f(b̄) da cada
+//     ai = bi (una segunda tabla, por símbolo y clase del término);
+//   - un bosque de demostración (Nieuwenhuis-Oliveras): cada unión añade
+//     una arista con su motivo (ecuación de entrada, congruencia o
+//     inyectividad) entre los dos términos que la causan, y explain(a, b)
+//     recorre el camino entre a y b para dar las ecuaciones de entrada
+//     que hacen falta.
+//
+// BasicCongruenceProver lee las ecuaciones de un TermStore (átomos Equal,
+// sus negaciones y conjunciones de ellos) y además escribe la explicación
+// como un ProofCertificate para el ProofChecker: las ecuaciones usadas y
+// los axiomas de la igualdad que hacen falta (∀x. x = x, la simetría, la
+// transitividad y la congruencia o la inyectividad de cada símbolo) son
+// hipótesis del teorema, y el resto son universal_instantiation y
+// modus_ponens.
+
+namespace logic::runtime
+{
+
+    using CongruenceTerm = std::uint32_t;
+
+    enum class CongruenceReason : std::uint8_t
+    {
+        Input,       // La ecuación de entrada `tag`
+        Congruence,  // from y to tienen el mismo símbolo y argumentos iguales
+        Injectivity, // from = to y el símbolo es inyectivo: argumento `index`
+    };
+
+    // Arista del bosque: la igualdad from = to (en ese orden)
+    struct CongruenceEdge
+    {
+        CongruenceReason reason = CongruenceReason::Input;
+        std::uint32_t index = 0;
+        CongruenceTerm from = 0, to = 0;
+        std::uint32_t tag = 0;
+    };
+
+    struct CongruenceStats
+    {
+        std::uint64_t terms = 0;
+        std::uint64_t inputs = 0;      // Ecuaciones de entrada
+        std::uint64_t unions = 0;      // Uniones de clases
+        std::uint64_t congruences = 0; // Uniones por congruencia
+        std::uint64_t injections = 0;  // Uniones por inyectividad
+    };
+
+    class CongruenceClosure
+    {
+    public:
+        static constexpr CongruenceTerm npos = ~CongruenceTerm{0};
+
+        // El término symbol(args), compartido: los mismos símbolo y
+        // argumentos dan el mismo identificador
+        CongruenceTerm term(std::uint32_t symbol, std::span<const CongruenceTerm> args)
+        {
+            const std::uint64_t hash = structural_hash(symbol, args);
+            if (2 * (terms_.size() + 1) > structure_.size())
+                rehash_structure();
+            size_t at = hash & (structure_.size() - 1);
+            for (; structure_[at] != npos; at = (at + 1) & (structure_.size() - 1))
+            {
+                const CongruenceTerm other = structure_[at];
+                // Las constantes no comparan argumentos: con dos spans vacíos
+                // GCC 12 avisa de un memcmp con puntero nulo (-Wnonnull)
+                if (terms_[other].symbol == symbol && terms_[other].arity == args.size() &&
+                    (args.empty() || std::ranges::equal(this->args(other), args)))
+                    return other;
+            }
+
+            const CongruenceTerm id = static_cast<CongruenceTerm>(terms_.size());
+            structure_[at] = id;
+            terms_.push_back({symbol, static_cast<std::uint32_t>(arguments_.size()), static_cast<std::uint32_t>(args.size())});
+            arguments_.insert(arguments_.end(), args.begin(), args.end());
+            parent_.push_back(id);
+            size_.push_back(1);
+            uses_.emplace_back();
+            injective_members_.emplace_back();
+            proof_parent_.push_back(npos);
+            proof_edge_.emplace_back();
+            mark_.push_back(0);
+            ++stats_.terms;
+
+            for (size_t i = 0; i < args.size(); ++i)
+                if (std::find(args.begin(), args.begin() + i, args[i]) == args.begin() + i)
+                    uses_[find(args[i])].push_back(id);
+            if (!args.empty())
+                if (const CongruenceTerm other = signature(id); other != npos)
+                    pending_.push_back({CongruenceReason::Congruence, 0, id, other, 0});
+            if (is_injective(symbol))
+            {
+                injective_members_[id].push_back(id);
+                injective(id);
+            }
+            propagate();
+            return id;
+        }
+
+        // Desde ahora symbol es inyectivo (también para los términos que ya hay)
+        void set_injective(std::uint32_t symbol)
+        {
+            if (symbol >= injective_symbols_.size())
+                injective_symbols_.resize(symbol + 1, false);
+            if (injective_symbols_[symbol])
+                return;
+            injective_symbols_[symbol] = true;
+            for (CongruenceTerm t = 0; t < terms_.size(); ++t)
+                if (terms_[t].symbol == symbol)
+                {
+                    injective_members_[find(t)].push_back(t);
+                    injective(t);
+                }
+            propagate();
+        }
+
+        // a = b, con el identificador `tag` para las explicaciones
+        void merge(CongruenceTerm a, CongruenceTerm b, std::uint32_t tag)
+        {
+            ++stats_.inputs;
+            pending_.push_back({CongruenceReason::Input, 0, a, b, tag});
+            propagate();
+        }
+
+        // a ≠ b
+        void distinct(CongruenceTerm a, CongruenceTerm b, std::uint32_t tag) { disequalities_.push_back({a, b, tag}); }
+
+        CongruenceTerm find(CongruenceTerm t)
+        {
+            CongruenceTerm root = t;
+            while (parent_[root] != root)
+                root = parent_[root];
+            while (parent_[t] != root)
+                t = std::exchange(parent_[t], root);
+            return root;
+        }
+
+        bool equal(CongruenceTerm a, CongruenceTerm b) { return find(a) == find(b); }
+
+        // El `tag` de una desigualdad que las ecuaciones contradicen, o npos
+        std::uint32_t conflict()
+        {
+            for (const Disequality &disequality : disequalities_)
+                if (equal(disequality.a, disequality.b))
+                    return disequality.tag;
+            return npos;
+        }
+
+        // Los `tag` de las ecuaciones de entrada que dan a = b, sin repetir
+        // (vacío si a y b son el mismo término; a = b debe cumplirse)
+        std::vector<std::uint32_t> explain(CongruenceTerm a, CongruenceTerm b)
+        {
+            if (!equal(a, b))
+                throw std::invalid_argument("CongruenceClosure::explain: los términos no son iguales");
+            std::vector<std::uint32_t> tags;
+            std::vector<std::pair<CongruenceTerm, CongruenceTerm>> pairs{{a, b}};
+            ++epoch_;
+            const std::uint32_t used = epoch_;
+            while (!pairs.empty())
+            {
+                const auto [x, y] = pairs.back();
+                pairs.pop_back();
+                if (x == y)
+                    continue;
+                const CongruenceTerm ancestor = common_ancestor(x, y);
+                for (const CongruenceTerm start : {x, y})
+                    for (CongruenceTerm u = start; u != ancestor; u = proof_parent_[u])
+                    {
+                        if (explained_.size() < terms_.size())
+                            explained_.resize(terms_.size(), 0);
+                        if (explained_[u] == used)
+                            continue;
+                        explained_[u] = used;
+                        const CongruenceEdge &edge = proof_edge_[u];
+                        if (edge.reason == CongruenceReason::Input)
+                            tags.push_back(edge.tag);
+                        else if (edge.reason == CongruenceReason::Injectivity)
+                            pairs.push_back({edge.from, edge.to});
+                        else
+                            for (size_t i = 0; i < terms_[edge.from].arity; ++i)
+                                pairs.push_back({args(edge.from)[i], args(edge.to)[i]});
+                    }
+            }
+            std::ranges::sort(tags);
+            tags.erase(std::unique(tags.begin(), tags.end()), tags.end());
+            return tags;
+        }
+
+        // Antecesor común más cercano de a y b en el bosque (npos si no hay)
+        CongruenceTerm common_ancestor(CongruenceTerm a, CongruenceTerm b)
+        {
+            ++epoch_;
+            for (CongruenceTerm u = a; u != npos; u = proof_parent_[u])
+                mark_[u] = epoch_;
+            for (CongruenceTerm u = b; u != npos; u = proof_parent_[u])
+                if (mark_[u] == epoch_)
+                    return u;
+            return npos;
+        }
+
+        // --- Acceso ---
+        size_t size() const { return terms_.size(); }
+        std::uint32_t symbol(CongruenceTerm t) const { return terms_[t].symbol; }
+        std::span<const CongruenceTerm> args(CongruenceTerm t) const { return {arguments_.data() + terms_[t].first, terms_[t].arity}; }
+        bool is_injective(std::uint32_t symbol) const { return symbol < injective_symbols_.size() && injective_symbols_[symbol]; }
+
+        // El bosque: el padre de t (npos en una raíz) y la arista hasta él
+        CongruenceTerm proof_parent(CongruenceTerm t) const { return proof_parent_[t]; }
+        const CongruenceEdge &proof_edge(CongruenceTerm t) const { return proof_edge_[t]; }
+
+        const CongruenceStats &stats() const { return stats_; }
+
+    private:
+        struct Term
+        {
+            std::uint32_t symbol;
+            std::uint32_t first, arity; // En arguments_
+        };
+
+        struct Disequality
+        {
+            CongruenceTerm a, b;
+            std::uint32_t tag;
+        };
+
+        static std::uint64_t structural_hash(std::uint32_t symbol, std::span<const CongruenceTerm> args)
+        {
+            std::uint64_t hash = detail::HashAlgebra::mix(0x243f6a8885a308d3ull, symbol);
+            for (const CongruenceTerm arg : args)
+                hash = detail::HashAlgebra::mix(hash, arg);
+            return hash;
+        }
+
+        std::uint64_t signature_hash(CongruenceTerm t)
+        {
+            std::uint64_t hash = detail::HashAlgebra::mix(0x13198a2e03707344ull, terms_[t].symbol);
+            for (const CongruenceTerm arg : args(t))
+                hash = detail::HashAlgebra::mix(hash, find(arg));
+            return hash;
+        }
+
+        // La tabla de compartición, al doble de tamaño
+        void rehash_structure()
+        {
+            std::vector<CongruenceTerm> old(std::max<size_t>(16, structure_.size() * 2), npos);
+            old.swap(structure_);
+            const size_t mask = structure_.size() - 1;
+            for (const CongruenceTerm t : old)
+                if (t != npos)
+                {
+                    size_t at = structural_hash(terms_[t].symbol, args(t)) & mask;
+                    while (structure_[at] != npos)
+                        at = (at + 1) & mask;
+                    structure_[at] = t;
+                }
+        }
+
+        // Término con la misma firma que t (npos si no hay)
+        CongruenceTerm signature(CongruenceTerm t)
+        {
+            return signatures_.lookup(t, [&](CongruenceTerm u) { return signature_hash(u); },
+                                      [&](CongruenceTerm u, CongruenceTerm v) { return same_symbol(u, v) && same_arguments(u, v); });
+        }
+
+        bool same_symbol(CongruenceTerm a, CongruenceTerm b) const
+        {
+            return terms_[a].symbol == terms_[b].symbol && terms_[a].arity == terms_[b].arity;
+        }
+
+        bool same_arguments(CongruenceTerm a, CongruenceTerm b)
+        {
+            const std::span<const CongruenceTerm> left = args(a), right = args(b);
+            for (size_t i = 0; i < left.size(); ++i)
+                if (find(left[i]) != find(right[i]))
+                    return false;
+            return true;
+        }
+
+        std::uint64_t injective_hash(CongruenceTerm t)
+        {
+            return detail::HashAlgebra::mix(detail::HashAlgebra::mix(0xa4093822299f31d0ull, terms_[t].symbol), find(t));
+        }
+
+        // Busca otro término del mismo símbolo inyectivo en la clase de t y
+        // une sus argumentos; si no lo hay, t entra en la tabla
+        void injective(CongruenceTerm t)
+        {
+            const CongruenceTerm other = injectives_.lookup(t, [&](CongruenceTerm u) { return injective_hash(u); },
+                                                            [&](CongruenceTerm u, CongruenceTerm v) { return same_symbol(u, v) && find(u) == find(v); });
+            if (other != npos)
+                for (std::uint32_t i = 0; i < terms_[t].arity; ++i)
+                    if (find(args(t)[i]) != find(args(other)[i]))
+                        pending_.push_back({CongruenceReason::Injectivity, i, t, other, 0});
+        }
+
+        // Invierte el camino de t a su raíz: t pasa a ser la raíz de su árbol
+        void reroot(CongruenceTerm t)
+        {
+            CongruenceTerm previous = npos;
+            CongruenceEdge carried{};
+            while (t != npos)
+            {
+                const CongruenceTerm next = proof_parent_[t];
+                const CongruenceEdge edge = proof_edge_[t];
+                proof_parent_[t] = previous;
+                proof_edge_[t] = carried;
+                carried = edge;
+                previous = t;
+                t = next;
+            }
+        }
+
+        void propagate()
+        {
+            while (!pending_.empty())
+            {
+                const CongruenceEdge edge = pending_.back();
+                pending_.pop_back();
+                // Los argumentos de la inyectividad, o los dos términos
+                CongruenceTerm a = edge.from, b = edge.to;
+                if (edge.reason == CongruenceReason::Injectivity)
+                {
+                    a = args(edge.from)[edge.index];
+                    b = args(edge.to)[edge.index];
+                }
+                CongruenceTerm ra = find(a), rb = find(b);
+                if (ra == rb)
+                    continue;
+                if (size_[ra] > size_[rb])
+                {
+                    std::swap(a, b);
+                    std::swap(ra, rb);
+                }
+
+                // La arista va del término de la clase menor al otro
+                reroot(a);
+                proof_parent_[a] = b;
+                proof_edge_[a] = edge;
+                ++stats_.unions;
+                stats_.congruences += edge.reason == CongruenceReason::Congruence;
+                stats_.injections += edge.reason == CongruenceReason::Injectivity;
+
+                parent_[ra] = rb;
+                size_[rb] += size_[ra];
+                std::vector<CongruenceTerm> uses = std::move(uses_[ra]);
+                uses_[ra] = {};
+                for (const CongruenceTerm user : uses)
+                {
+                    if (const CongruenceTerm other = signature(user); other != npos)
+                        pending_.push_back({CongruenceReason::Congruence, 0, user, other, 0});
+                    uses_[rb].push_back(user);
+                }
+                std::vector<CongruenceTerm> members = std::move(injective_members_[ra]);
+                injective_members_[ra] = {};
+                for (const CongruenceTerm member : members)
+                {
+                    injective(member);
+                    injective_members_[rb].push_back(member);
+                }
+            }
+        }
+
+        std::vector<Term> terms_;
+        std::vector<CongruenceTerm> arguments_;
+        std::vector<CongruenceTerm> structure_; // Compartición de términos
+
+        std::vector<CongruenceTerm> parent_; // Unión-búsqueda
+        std::vector<std::uint32_t> size_;
+        std::vector<std::vector<CongruenceTerm>> uses_;              // Por representante
+        std::vector<std::vector<CongruenceTerm>> injective_members_; // Por representante
+        // Firmas y términos inyectivos: su clave cambia con las uniones
+        detail::StampedTable signatures_, injectives_;
+        std::vector<bool> injective_symbols_;
+
+        std::vector<CongruenceTerm> proof_parent_; // Bosque de demostración
+        std::vector<CongruenceEdge> proof_edge_;
+        std::vector<std::uint32_t> mark_, explained_;
+        std::uint32_t epoch_ = 0;
+
+        std::vector<CongruenceEdge> pending_;
+        std::vector<Disequality> disequalities_;
+        CongruenceStats stats_;
+    };
+
+    // --- Desde un TermStore, con certificados ---
+    template <typename Store>
+    class BasicCongruenceProver
+    {
+    public:
+        explicit BasicCongruenceProver(Store &store, std::string_view equality = "Equal") : store_(store), equality_(equality) {}
+
+        // Los símbolos inyectivos (S, por PA4) se declaran antes de usarlos
+        // en un certificado; add() y equal() los tienen en cuenta siempre
+        void injective(std::string_view symbol)
+        {
+            injective_.emplace_back(symbol);
+            if (const SymbolId id = store_.symbols().find(symbol); id != SymbolTable::npos)
+                engine_.set_injective(symbol_key(id, true));
+        }
+
+        // Equal(a, b), ¬Equal(a, b) o una conjunción de ellas, con términos
+        // cerrados. Lanza invalid_argument con cualquier otra cosa.
+        void add(NodeId formula)
+        {
+            const Node &node = store_[formula];
+            if (node.op == NodeOp::And)
+            {
+                add(store_.children(formula)[0]);
+                add(store_.children(formula)[1]);
+                return;
+            }
+            const bool negated = node.op == NodeOp::Not;
+            const NodeId atom = negated ? store_.children(formula)[0] : formula;
+            if (!is_equation(atom))
+                throw std::invalid_argument("CongruenceProver: se esperaba Equal(a, b), su negación o una conjunción de ellas");
+            const std::span<const NodeId> sides = store_.children(atom);
+            const std::uint32_t tag = static_cast<std::uint32_t>(inputs_.size());
+            inputs_.push_back(atom);
+            if (negated)
+                engine_.distinct(term(sides[0]), term(sides[1]), tag);
+            else
+                engine_.merge(term(sides[0]), term(sides[1]), tag);
+        }
+
+        bool equal(NodeId a, NodeId b) { return engine_.equal(term(a), term(b)); }
+
+        // ¿Hay un ¬Equal(a, b) con a = b? Da esa desigualdad, o npos
+        NodeId conflict()
+        {
+            const std::uint32_t tag = engine_.conflict();
+            return tag == CongruenceClosure::npos ? SymbolTable::npos : inputs_[tag];
+        }
+
+        // Las ecuaciones de entrada (átomos Equal) de las que sale a = b
+        std::vector<NodeId> explain(NodeId a, NodeId b)
+        {
+            std::vector<NodeId> out;
+            for (const std::uint32_t tag : engine_.explain(term(a), term(b)))
+                out.push_back(inputs_[tag]);
+            return out;
+        }
+
+        // Añade al certificado los pasos de Γ ⊢ Equal(a, b) y devuelve el
+        // último. Γ son las ecuaciones usadas y los axiomas de la igualdad
+        // que hacen falta (assume). Lanza invalid_argument si a ≠ b.
+        StepId certify(NodeId a, NodeId b, ProofCertificate &certificate)
+        {
+            const CongruenceTerm ta = term(a), tb = term(b);
+            if (!engine_.equal(ta, tb))
+                throw std::invalid_argument("CongruenceProver::certify: los términos no son iguales");
+            certificate_ = &certificate;
+            proved_.clear();
+            assumed_.clear();
+            return prove(ta, tb);
+        }
+
+        // El átomo Equal(a, b) del almacén
+        NodeId equation(NodeId a, NodeId b)
+        {
+            const NodeId sides[] = {a, b};
+            return store_.atom(equality_, sides);
+        }
+
+        CongruenceClosure &engine() { return engine_; }
+        const CongruenceStats &stats() const { return engine_.stats(); }
+
+    private:
+        // El mismo símbolo como constante y como función de aridad 0 no se confunden
+        static std::uint32_t symbol_key(SymbolId symbol, bool function) { return symbol << 1 | (function ? 1 : 0); }
+
+        bool is_equation(NodeId id) const
+        {
+            return store_[id].op == NodeOp::Atom && store_.label(id) == equality_ && store_.children(id).size() == 2;
+        }
+
+        CongruenceTerm term(NodeId id)
+        {
+            if (const auto it = terms_.find(id); it != terms_.end())
+                return it->second;
+            const Node &node = store_[id];
+            if (node.op != NodeOp::Constant && node.op != NodeOp::Atom)
+                throw std::invalid_argument("CongruenceProver: solo términos cerrados (constantes y símbolos de función)");
+            std::vector<CongruenceTerm> args;
+            for (const NodeId arg : store_.children(id))
+                args.push_back(term(arg));
+            const std::uint32_t symbol = symbol_key(node.symbol, node.op == NodeOp::Atom);
+            if (node.op == NodeOp::Atom && std::ranges::find(injective_, store_.label(id)) != injective_.end())
+                engine_.set_injective(symbol);
+            const CongruenceTerm t = engine_.term(symbol, args);
+            terms_.emplace(id, t);
+            if (nodes_.size() <= t)
+                nodes_.resize(t + 1, SymbolTable::npos);
+            if (nodes_[t] == SymbolTable::npos)
+                nodes_[t] = id;
+            return t;
+        }
+
+        // --- Certificados ---
+        StepId assume(NodeId formula)
+        {
+            const auto [it, inserted] = assumed_.try_emplace(formula, 0);
+            if (inserted)
+                it->second = certificate_->assume(formula);
+            return it->second;
+        }
+
+        NodeId forall(std::span<const NodeId> variables, NodeId body)
+        {
+            for (size_t i = variables.size(); i-- > 0;)
+                body = store_.binder(NodeOp::Forall, store_.label(variables[i]), body);
+            return body;
+        }
+
+        // Instancia los ∀ del axioma con `terms`, en orden, y aplica modus
+        // ponens con cada premisa
+        StepId instantiate(NodeId axiom, std::span<const NodeId> terms, std::span<const StepId> premises)
+        {
+            StepId step = assume(axiom);
+            for (const NodeId t : terms)
+                step = certificate_->universal_instantiation(step, t);
+            for (const StepId premise : premises)
+                step = certificate_->modus_ponens(premise, step);
+            return step;
+        }
+
+        std::vector<NodeId> variables(char prefix, size_t n)
+        {
+            std::vector<NodeId> out;
+            for (size_t i = 0; i < n; ++i)
+                out.push_back(store_.variable(std::string(1, prefix) + std::to_string(i + 1)));
+            return out;
+        }
+
+        // ∀x. Equal(x, x)
+        NodeId reflexivity()
+        {
+            const NodeId x = store_.variable("x");
+            return store_.binder(NodeOp::Forall, "x", equation(x, x));
+        }
+
+        // ∀x ∀y. Equal(x, y) → Equal(y, x)
+        NodeId symmetry()
+        {
+            const NodeId x = store_.variable("x"), y = store_.variable("y");
+            const NodeId xy[] = {x, y};
+            return forall(xy, store_.binary(NodeOp::Implies, equation(x, y), equation(y, x)));
+        }
+
+        // ∀x ∀y ∀z. Equal(x, y) → (Equal(y, z) → Equal(x, z))
+        NodeId transitivity()
+        {
+            const NodeId x = store_.variable("x"), y = store_.variable("y"), z = store_.variable("z");
+            const NodeId xyz[] = {x, y, z};
+            return forall(xyz, store_.binary(NodeOp::Implies, equation(x, y), store_.binary(NodeOp::Implies, equation(y, z), equation(x, z))));
+        }
+
+        // ∀x̄ ∀ȳ. Equal(x1, y1) → ... → Equal(f(x̄), f(ȳ))
+        NodeId congruence(std::string_view f, size_t arity)
+        {
+            const std::vector<NodeId> xs = variables('x', arity), ys = variables('y', arity);
+            NodeId body = equation(store_.atom(f, xs), store_.atom(f, ys));
+            for (size_t i = arity; i-- > 0;)
+                body = store_.binary(NodeOp::Implies, equation(xs[i], ys[i]), body);
+            std::vector<NodeId> all = xs;
+            all.insert(all.end(), ys.begin(), ys.end());
+            return forall(all, body);
+        }
+
+        // ∀x̄ ∀ȳ. Equal(f(x̄), f(ȳ)) → Equal(xi, yi)
+        NodeId injectivity(std::string_view f, size_t arity, size_t index)
+        {
+            const std::vector<NodeId> xs = variables('x', arity), ys = variables('y', arity);
+            std::vector<NodeId> all = xs;
+            all.insert(all.end(), ys.begin(), ys.end());
+            return forall(all, store_.binary(NodeOp::Implies, equation(store_.atom(f, xs), store_.atom(f, ys)), equation(xs[index], ys[index])));
+        }
+
+        StepId symmetric(StepId step, NodeId a, NodeId b)
+        {
+            const NodeId terms[] = {a, b};
+            return instantiate(symmetry(), terms, std::span<const StepId>(&step, 1));
+        }
+
+        // Las igualdades que usa la arista de u: los pares de argumentos en
+        // la congruencia, los dos términos en la inyectividad
+        void needs(CongruenceTerm u, std::vector<std::pair<CongruenceTerm, CongruenceTerm>> &out) const
+        {
+            const CongruenceEdge &edge = engine_.proof_edge(u);
+            if (edge.reason == CongruenceReason::Injectivity)
+                out.push_back({edge.from, edge.to});
+            else if (edge.reason == CongruenceReason::Congruence)
+                for (size_t i = 0; i < engine_.args(edge.from).size(); ++i)
+                    out.push_back({engine_.args(edge.from)[i], engine_.args(edge.to)[i]});
+        }
+
+        // La arista de u a su padre en el bosque, como Equal(u, padre); las
+        // igualdades de needs(u) ya están en proved_
+        StepId edge(CongruenceTerm u)
+        {
+            const CongruenceEdge &edge = engine_.proof_edge(u);
+            StepId step;
+            if (edge.reason == CongruenceReason::Input)
+                step = assume(inputs_[edge.tag]);
+            else if (edge.reason == CongruenceReason::Congruence)
+            {
+                const std::span<const CongruenceTerm> left = engine_.args(edge.from), right = engine_.args(edge.to);
+                std::vector<NodeId> terms;
+                std::vector<StepId> premises;
+                for (const CongruenceTerm arg : left)
+                    terms.push_back(nodes_[arg]);
+                for (const CongruenceTerm arg : right)
+                    terms.push_back(nodes_[arg]);
+                for (size_t i = 0; i < left.size(); ++i)
+                    premises.push_back(proved_.at(key(left[i], right[i])));
+                step = instantiate(congruence(store_.label(nodes_[edge.from]), left.size()), terms, premises);
+            }
+            else
+            {
+                std::vector<NodeId> terms;
+                for (const CongruenceTerm arg : engine_.args(edge.from))
+                    terms.push_back(nodes_[arg]);
+                for (const CongruenceTerm arg : engine_.args(edge.to))
+                    terms.push_back(nodes_[arg]);
+                const StepId premise = proved_.at(key(edge.from, edge.to));
+                step = instantiate(injectivity(store_.label(nodes_[edge.from]), engine_.args(edge.from).size(), edge.index), terms,
+                                   std::span<const StepId>(&premise, 1));
+            }
+
+            // Con la inyectividad la arista une los argumentos
+            CongruenceTerm from = edge.from, to = edge.to;
+            if (edge.reason == CongruenceReason::Injectivity)
+            {
+                from = engine_.args(edge.from)[edge.index];
+                to = engine_.args(edge.to)[edge.index];
+            }
+            return from == u ? step : symmetric(step, nodes_[from], nodes_[to]);
+        }
+
+        // El camino del bosque de a al antecesor común y de ahí a b; las
+        // `up` primeras aristas suben desde a
+        std::vector<CongruenceTerm> path(CongruenceTerm a, CongruenceTerm b, size_t &up)
+        {
+            const CongruenceTerm ancestor = engine_.common_ancestor(a, b);
+            std::vector<CongruenceTerm> path;
+            for (CongruenceTerm u = a; u != ancestor; u = engine_.proof_parent(u))
+                path.push_back(u);
+            up = path.size();
+            for (CongruenceTerm u = b; u != ancestor; u = engine_.proof_parent(u))
+                path.push_back(u);
+            std::reverse(path.begin() + up, path.end());
+            path.insert(path.begin() + up, ancestor);
+            return path;
+        }
+
+        // Γ ⊢ Equal(a, b) con una pila de objetivos en lugar de recursión
+        // (las cadenas de congruencia pueden ser tan profundas como los
+        // términos): un objetivo apila las igualdades que piden las aristas
+        // de su camino y se cierra cuando ya están todas demostradas
+        StepId prove(CongruenceTerm a, CongruenceTerm b)
+        {
+            std::vector<std::pair<CongruenceTerm, CongruenceTerm>> goals{{a, b}}, needed;
+            while (!goals.empty())
+            {
+                const auto [x, y] = goals.back();
+                if (proved_.contains(key(x, y)))
+                {
+                    goals.pop_back();
+                    continue;
+                }
+                size_t up = 0;
+                const std::vector<CongruenceTerm> steps = x == y ? std::vector<CongruenceTerm>{x} : path(x, y, up);
+                needed.clear();
+                for (size_t i = 0; i < steps.size(); ++i)
+                    if (i != up)
+                        needs(steps[i], needed);
+                const size_t before = goals.size();
+                // En orden inverso: el primero se demuestra antes, como en la recursión
+                for (size_t i = needed.size(); i-- > 0;)
+                    if (!proved_.contains(key(needed[i].first, needed[i].second)))
+                        goals.push_back(needed[i]);
+                if (goals.size() == before)
+                {
+                    goals.pop_back();
+                    proved_.emplace(key(x, y), chain(x, y, steps, up));
+                }
+            }
+            return proved_.at(key(a, b));
+        }
+
+        // Equal(path[i], path[i + 1]) con cada arista (sube o baja),
+        // encadenadas con la transitividad
+        StepId chain(CongruenceTerm a, CongruenceTerm b, const std::vector<CongruenceTerm> &path, size_t up)
+        {
+            if (a == b)
+            {
+                const NodeId term = nodes_[a];
+                return instantiate(reflexivity(), std::span<const NodeId>(&term, 1), {});
+            }
+            StepId result = ProofCertificate::none;
+            for (size_t i = 0; i + 1 < path.size(); ++i)
+            {
+                const CongruenceTerm from = path[i], to = path[i + 1];
+                const StepId link = i < up ? edge(from) : symmetric(edge(to), nodes_[to], nodes_[from]);
+                if (i == 0)
+                    result = link;
+                else
+                {
+                    const NodeId terms[] = {nodes_[a], nodes_[from], nodes_[to]};
+                    const StepId premises[] = {result, link};
+                    result = instantiate(transitivity(), terms, premises);
+                }
+            }
+            return result;
+        }
+
+        static std::uint64_t key(CongruenceTerm a, CongruenceTerm b) { return std::uint64_t{a} << 32 | b; }
+
+        Store &store_;
+        std::string equality_;
+        CongruenceClosure engine_;
+        std::unordered_map<NodeId, CongruenceTerm> terms_;
+        std::vector<NodeId> nodes_; // Un nodo del almacén por término
+        std::vector<NodeId> inputs_; // Átomo Equal de cada `tag`
+
+        ProofCertificate *certificate_ = nullptr;
+        std::unordered_map<std::uint64_t, StepId> proved_;
+        std::unordered_map<NodeId, StepId> assumed_;
+        std::vector<std::string> injective_;
+    };
+
+    using CongruenceProver = BasicCongruenceProver<TermStore>;
+
+} // namespace logic::runtime
@@ -0,0 +1,755 @@
+#pragma once
+
+#include "term_store.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// =========================================================
+// === DATALOG (encadenamiento hacia delante) ===
+// =========================================================
+//
+// El demostrador de superposición busca una refutación; para saturar
+// muchos hechos cerrados (Human(socrates) y ∀x. Human(x) → Mortal(x)) basta
+// con aplicar las reglas de Horn hacia delante hasta que no salga nada
+// nuevo. DatalogEngine lo hace con evaluación semi-ingenua: en cada vuelta
+// solo se combinan las reglas con los hechos nuevos de la vuelta anterior
+// (el "delta"), de modo que ninguna derivación se repite.
+//
+//   - Las relaciones son columnares: una columna de valores por argumento,
+//     sin repetir filas (una tabla hash sobre la fila entera).
+//   - Cada combinación de columnas que una regla consulta ya ligadas tiene
+//     su índice hash: un join es, para cada fila del delta, una búsqueda en
+//     el índice de la relación siguiente (hash join con el índice ya hecho).
+//   - Una regla con n átomos en el cuerpo se evalúa n veces por vuelta, con
+//     el átomo i en el delta, los anteriores en los hechos viejos y los
+//     posteriores en viejos y delta.
+//   - Las tareas (regla, átomo del delta, trozo del delta) se reparten entre
+//     hilos; durante la vuelta las relaciones solo se leen y cada tarea
+//     guarda lo que deriva en su propio búfer. Después se insertan los
+//     búferes en orden, así que el resultado no depende del número de hilos.
+//
+// BasicDatalog lee los hechos y las reglas de un TermStore (o de una
+// FormulaArena), así que las reglas se escriben en el DSL y se bajan con
+// reify<F>(store): ∀x̄. A1 ∧ ... ∧ An → B, también con → encadenadas,
+// varias conclusiones (B1 ∧ B2) o ↔ entre conjunciones de átomos. Un valor
+// es el NodeId de un término cerrado (los términos están compartidos).
+
+namespace logic::runtime
+{
+
+    using DatalogValue = std::uint32_t;
+    using RelationId = std::uint32_t;
+
+    // Argumento de un átomo de una regla: un valor o la variable número `value`
+    struct DatalogTerm
+    {
+        bool variable = false;
+        std::uint32_t value = 0;
+
+        static constexpr DatalogTerm constant(DatalogValue value) { return {false, value}; }
+        static constexpr DatalogTerm var(std::uint32_t index) { return {true, index}; }
+    };
+
+    struct DatalogAtom
+    {
+        RelationId relation = 0;
+        std::vector<DatalogTerm> args;
+    };
+
+    // head :- body. Toda variable de la conclusión aparece en el cuerpo.
+    struct DatalogRule
+    {
+        DatalogAtom head;
+        std::vector<DatalogAtom> body;
+    };
+
+    struct DatalogStats
+    {
+        std::uint64_t iterations = 0;
+        std::uint64_t facts = 0;      // Hechos en total al acabar
+        std::uint64_t derived = 0;    // Hechos nuevos derivados
+        std::uint64_t duplicates = 0; // Conclusiones que ya estaban
+        std::uint64_t lookups = 0;    // Búsquedas en índices (hash join)
+        std::uint64_t tasks = 0;
+        size_t threads = 1;
+        double seconds = 0.0;
+
+        double facts_per_second() const { return seconds > 0.0 ? static_cast<double>(derived) / seconds : 0.0; }
+    };
+
+    namespace detail
+    {
+        // --- Relación columnar ---
+        // Filas en columnas, en orden de inserción. Los índices se guardan
+        // por máscara de columnas: para cada clave, la última fila con esa
+        // clave y, por fila, la anterior con la misma clave (las filas de
+        // una cadena van de mayor a menor). Un índice cubre las filas que
+        // había cuando se extendió por última vez.
+        class DatalogRelation
+        {
+        public:
+            static constexpr std::uint32_t npos = ~std::uint32_t{0};
+            static constexpr std::uint32_t max_arity = 32;
+
+            DatalogRelation(std::string name, std::uint32_t arity) : name_(std::move(name)), columns_(arity)
+            {
+                if (arity > max_arity)
+                    throw std::invalid_argument("Datalog: aridad mayor que 32");
+                unique_.mask = arity == max_arity ? ~std::uint32_t{0} : (std::uint32_t{1} << arity) - 1;
+            }
+
+            std::string_view name() const { return name_; }
+            std::uint32_t arity() const { return static_cast<std::uint32_t>(columns_.size()); }
+            std::uint32_t size() const { return rows_; }
+            DatalogValue at(std::uint32_t row, std::uint32_t column) const { return columns_[column][row]; }
+            std::span<const DatalogValue> column(std::uint32_t column) const { return columns_[column]; }
+
+            bool contains(std::span<const DatalogValue> tuple) const { return find(unique_, tuple, hash(tuple)) != npos; }
+
+            // false si la fila ya estaba
+            bool insert(std::span<const DatalogValue> tuple)
+            {
+                if (tuple.size() != columns_.size())
+                    throw std::invalid_argument("Datalog: número de argumentos distinto de la aridad");
+                const std::uint64_t key = hash(tuple);
+                if (find(unique_, tuple, key) != npos)
+                    return false;
+                for (std::uint32_t column = 0; column < columns_.size(); ++column)
+                    columns_[column].push_back(tuple[column]);
+                ++rows_;
+                grow(unique_);
+                link(unique_, rows_ - 1, key);
+                unique_.covered = rows_;
+                return true;
+            }
+
+            // Crea o extiende hasta size() el índice de las columnas de mask
+            void prepare(std::uint32_t mask)
+            {
+                Index *index = find_index(mask);
+                if (index == nullptr)
+                {
+                    indexes_.push_back({});
+                    index = &indexes_.back();
+                    index->mask = mask;
+                }
+                grow(*index);
+                for (; index->covered < rows_; ++index->covered)
+                    link(*index, index->covered, row_hash(index->covered, mask));
+            }
+
+            // Última fila (o npos) cuyas columnas de mask valen key, en orden
+            // de columna. prepare(mask) debe haberse llamado antes.
+            std::uint32_t first(std::uint32_t mask, std::span<const DatalogValue> key, std::uint64_t hash) const
+            {
+                return find(*find_index(mask), key, hash);
+            }
+
+            std::uint32_t next(std::uint32_t mask, std::uint32_t row) const { return find_index(mask)->next[row]; }
+
+            static std::uint64_t hash(std::span<const DatalogValue> key)
+            {
+                std::uint64_t out = 0x243f6a8885a308d3ull;
+                for (const DatalogValue value : key)
+                    out = HashAlgebra::mix(out, value);
+                return out;
+            }
+
+            size_t bytes() const
+            {
+                size_t out = columns_.size() * rows_ * sizeof(DatalogValue) + unique_.slots.size() * sizeof(Slot) + unique_.next.size() * 4;
+                for (const Index &index : indexes_)
+                    out += index.slots.size() * sizeof(Slot) + index.next.size() * 4;
+                return out;
+            }
+
+        private:
+            struct Slot
+            {
+                std::uint64_t hash = 0;
+                std::uint32_t row = npos; // Última fila con la clave
+            };
+
+            struct Index
+            {
+                std::uint32_t mask = 0;
+                std::uint32_t covered = 0; // Filas indexadas
+                std::uint32_t keys = 0;
+                std::vector<Slot> slots;         // Direccionamiento abierto, potencia de dos
+                std::vector<std::uint32_t> next; // Por fila
+            };
+
+            const Index *find_index(std::uint32_t mask) const
+            {
+                if (mask == unique_.mask)
+                    return &unique_;
+                for (const Index &index : indexes_)
+                    if (index.mask == mask)
+                        return &index;
+                return nullptr;
+            }
+
+            Index *find_index(std::uint32_t mask) { return const_cast<Index *>(std::as_const(*this).find_index(mask)); }
+
+            std::uint64_t row_hash(std::uint32_t row, std::uint32_t mask) const
+            {
+                std::uint64_t out = 0x243f6a8885a308d3ull;
+                for (std::uint32_t column = 0; column < columns_.size(); ++column)
+                    if (mask >> column & 1)
+                        out = HashAlgebra::mix(out, columns_[column][row]);
+                return out;
+            }
+
+            bool same_key(std::uint32_t row, std::uint32_t mask, std::span<const DatalogValue> key) const
+            {
+                size_t at = 0;
+                for (std::uint32_t column = 0; column < columns_.size(); ++column)
+                    if (mask >> column & 1)
+                        if (columns_[column][row] != key[at++])
+                            return false;
+                return true;
+            }
+
+            std::uint32_t find(const Index &index, std::span<const DatalogValue> key, std::uint64_t hash) const
+            {
+                if (index.slots.empty())
+                    return npos;
+                const size_t mask = index.slots.size() - 1;
+                for (size_t at = hash & mask;; at = (at + 1) & mask)
+                {
+                    const Slot &slot = index.slots[at];
+                    if (slot.row == npos)
+                        return npos;
+                    if (slot.hash == hash && same_key(slot.row, index.mask, key))
+                        return slot.row;
+                }
+            }
+
+            // La fila va delante en la cadena de su clave
+            void link(Index &index, std::uint32_t row, std::uint64_t hash)
+            {
+                const size_t mask = index.slots.size() - 1;
+                for (size_t at = hash & mask;; at = (at + 1) & mask)
+                {
+                    Slot &slot = index.slots[at];
+                    if (slot.row == npos)
+                    {
+                        slot = {hash, row};
+                        index.next[row] = npos;
+                        ++index.keys;
+                        return;
+                    }
+                    if (slot.hash == hash && same_key(slot.row, index.mask, std::span<const DatalogValue>(key_of(row, index.mask))))
+                    {
+                        index.next[row] = slot.row;
+                        slot.row = row;
+                        return;
+                    }
+                }
+            }
+
+            const std::vector<DatalogValue> &key_of(std::uint32_t row, std::uint32_t mask)
+            {
+                scratch_.clear();
+                for (std::uint32_t column = 0; column < columns_.size(); ++column)
+                    if (mask >> column & 1)
+                        scratch_.push_back(columns_[column][row]);
+                return scratch_;
+            }
+
+            // Sitio para todas las filas: carga de las claves ≤ 1/2
+            void grow(Index &index)
+            {
+                index.next.resize(rows_, npos);
+                if (2 * (static_cast<size_t>(index.keys) + (rows_ - index.covered)) < index.slots.size())
+                    return;
+                size_t capacity = std::max<size_t>(16, index.slots.size());
+                while (capacity <= 2 * (static_cast<size_t>(index.keys) + (rows_ - index.covered)))
+                    capacity *= 2;
+                std::vector<Slot> old(capacity);
+                old.swap(index.slots);
+                const size_t mask = capacity - 1;
+                for (const Slot &slot : old)
+                    if (slot.row != npos)
+                    {
+                        size_t at = slot.hash & mask;
+                        while (index.slots[at].row != npos)
+                            at = (at + 1) & mask;
+                        index.slots[at] = slot;
+                    }
+            }
+
+            std::string name_;
+            std::vector<std::vector<DatalogValue>> columns_;
+            std::uint32_t rows_ = 0;
+            Index unique_; // La fila entera: sin repetidos
+            std::vector<Index> indexes_;
+            std::vector<DatalogValue> scratch_;
+        };
+    } // namespace detail
+
+    // --- Motor ---
+    class DatalogEngine
+    {
+    public:
+        static constexpr RelationId npos = ~RelationId{0};
+
+        // La relación de ese nombre y aridad (se crea la primera vez)
+        RelationId relation(std::string_view name, std::uint32_t arity)
+        {
+            const auto [it, inserted] = relation_ids_.try_emplace(key(name, arity), static_cast<RelationId>(relations_.size()));
+            if (inserted)
+                relations_.emplace_back(std::string(name), arity);
+            return it->second;
+        }
+
+        // npos si no existe
+        RelationId find(std::string_view name, std::uint32_t arity) const
+        {
+            const auto it = relation_ids_.find(key(name, arity));
+            return it == relation_ids_.end() ? npos : it->second;
+        }
+
+        // false si el hecho ya estaba
+        bool add_fact(RelationId relation, std::span<const DatalogValue> tuple) { return relations_.at(relation).insert(tuple); }
+
+        void add_rule(DatalogRule rule)
+        {
+            std::uint32_t variables = 0;
+            std::vector<bool> bound;
+            const auto check = [&](const DatalogAtom &atom) {
+                if (atom.relation >= relations_.size() || atom.args.size() != relations_[atom.relation].arity())
+                    throw std::invalid_argument("Datalog: relación o aridad incorrectas en una regla");
+                for (const DatalogTerm &term : atom.args)
+                    if (term.variable)
+                        variables = std::max(variables, term.value + 1);
+            };
+            check(rule.head);
+            for (const DatalogAtom &atom : rule.body)
+                check(atom);
+            bound.assign(variables, false);
+            for (const DatalogAtom &atom : rule.body)
+                for (const DatalogTerm &term : atom.args)
+                    if (term.variable)
+                        bound[term.value] = true;
+            for (const DatalogTerm &term : rule.head.args)
+                if (term.variable && !bound[term.value])
+                    throw std::invalid_argument("Datalog: variable de la conclusión que no está en el cuerpo");
+
+            if (rule.body.empty())
+            {
+                std::vector<DatalogValue> tuple;
+                for (const DatalogTerm &term : rule.head.args)
+                    tuple.push_back(term.value);
+                add_fact(rule.head.relation, tuple);
+                return;
+            }
+            rules_.push_back({std::move(rule), variables});
+            // Una regla nueva debe ver todos los hechos: se empieza de cero
+            for (Relation &relation : relations_)
+                relation.stable = 0;
+        }
+
+        // Semi-ingenua hasta el punto fijo. Con hechos añadidos después de
+        // una ejecución, la siguiente solo parte de ellos.
+        DatalogStats run(size_t threads = std::thread::hardware_concurrency())
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            DatalogStats stats;
+            stats.threads = std::max<size_t>(threads, 1);
+            for (Relation &relation : relations_)
+                relation.delta_end = relation.size();
+
+            std::vector<Plan> plans;
+            std::vector<Task> tasks;
+            while (true)
+            {
+                plan(plans);
+                tasks.clear();
+                for (std::uint32_t index = 0; index < plans.size(); ++index)
+                {
+                    const Relation &delta = relations_[plans[index].steps[0].relation];
+                    for (std::uint32_t first = delta.stable; first < delta.delta_end; first += chunk_rows)
+                        tasks.push_back({index, first, std::min(delta.delta_end, first + chunk_rows), {}, 0});
+                }
+                if (tasks.empty())
+                    break;
+                ++stats.iterations;
+                stats.tasks += tasks.size();
+                evaluate(plans, tasks, stats.threads);
+
+                // Lo de esta vuelta pasa a ser viejo; lo insertado, el delta siguiente
+                for (Relation &relation : relations_)
+                    relation.stable = relation.delta_end;
+                for (const Task &task : tasks)
+                {
+                    stats.lookups += task.lookups;
+                    for (size_t at = 0; at < task.out.size();)
+                    {
+                        Relation &relation = relations_[task.out[at]];
+                        const std::span<const DatalogValue> tuple(task.out.data() + at + 1, relation.arity());
+                        if (relation.insert(tuple))
+                            ++stats.derived;
+                        else
+                            ++stats.duplicates;
+                        at += 1 + relation.arity();
+                    }
+                }
+                for (Relation &relation : relations_)
+                    relation.delta_end = relation.size();
+            }
+            for (Relation &relation : relations_)
+            {
+                relation.stable = relation.size();
+                stats.facts += relation.size();
+            }
+            stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+            return stats;
+        }
+
+        size_t relations() const { return relations_.size(); }
+        const detail::DatalogRelation &facts(RelationId relation) const { return relations_.at(relation); }
+        bool contains(RelationId relation, std::span<const DatalogValue> tuple) const { return relations_.at(relation).contains(tuple); }
+        size_t rules() const { return rules_.size(); }
+
+        size_t bytes() const
+        {
+            size_t out = 0;
+            for (const Relation &relation : relations_)
+                out += relation.bytes();
+            return out;
+        }
+
+    private:
+        static constexpr std::uint32_t chunk_rows = 4096; // Filas del delta por tarea
+
+        static std::string key(std::string_view name, std::uint32_t arity) { return std::string(name) + '/' + std::to_string(arity); }
+
+        // [0, stable) son los hechos viejos, [stable, delta_end) el delta
+        struct Relation : detail::DatalogRelation
+        {
+            using DatalogRelation::DatalogRelation;
+            std::uint32_t stable = 0;
+            std::uint32_t delta_end = 0;
+        };
+
+        struct CompiledRule
+        {
+            DatalogRule rule;
+            std::uint32_t variables = 0;
+        };
+
+        // Un átomo del cuerpo en el orden del join
+        struct Step
+        {
+            RelationId relation = 0;
+            std::uint32_t mask = 0; // Columnas ya ligadas: se buscan en el índice
+            std::uint32_t end = 0;  // Filas que se miran: [0, end)
+            const std::vector<DatalogTerm> *args = nullptr;
+            std::vector<std::uint8_t> binds; // Por argumento: 1 si liga su variable aquí
+        };
+
+        // Una regla con el átomo `steps[0]` en el delta
+        struct Plan
+        {
+            const CompiledRule *rule = nullptr;
+            std::vector<Step> steps;
+        };
+
+        struct Task
+        {
+            std::uint32_t plan = 0;
+            std::uint32_t first = 0, last = 0; // Filas del delta
+            std::vector<DatalogValue> out;     // Relación y valores, seguidos
+            std::uint64_t lookups = 0;
+        };
+
+        // Los planes de esta vuelta, con los índices que necesitan ya extendidos
+        void plan(std::vector<Plan> &plans)
+        {
+            plans.clear();
+            for (const CompiledRule &compiled : rules_)
+            {
+                const std::vector<DatalogAtom> &body = compiled.rule.body;
+                for (size_t delta = 0; delta < body.size(); ++delta)
+                {
+                    const Relation &relation = relations_[body[delta].relation];
+                    if (relation.stable == relation.delta_end)
+                        continue;
+                    Plan plan{&compiled, {}};
+                    std::vector<bool> bound(compiled.variables, false);
+                    for (size_t k = 0; k < body.size(); ++k)
+                    {
+                        const size_t at = k == 0 ? delta : (k <= delta ? k - 1 : k);
+                        const DatalogAtom &atom = body[at];
+                        Step step{atom.relation, 0, at < delta ? relations_[atom.relation].stable : relations_[atom.relation].delta_end, &atom.args,
+                                  std::vector<std::uint8_t>(atom.args.size(), 0)};
+                        for (size_t column = 0; column < atom.args.size(); ++column)
+                        {
+                            const DatalogTerm &term = atom.args[column];
+                            if (k > 0 && (!term.variable || bound[term.value]))
+                                step.mask |= std::uint32_t{1} << column;
+                        }
+                        for (size_t column = 0; column < atom.args.size(); ++column)
+                        {
+                            const DatalogTerm &term = atom.args[column];
+                            if (term.variable && !bound[term.value])
+                            {
+                                bound[term.value] = true;
+                                step.binds[column] = 1;
+                            }
+                        }
+                        if (step.mask != 0)
+                            relations_[atom.relation].prepare(step.mask);
+                        plan.steps.push_back(std::move(step));
+                    }
+                    plans.push_back(std::move(plan));
+                }
+            }
+        }
+
+        void evaluate(const std::vector<Plan> &plans, std::vector<Task> &tasks, size_t threads) const
+        {
+            const size_t workers = std::min(threads, tasks.size());
+            const auto work = [&](std::atomic<size_t> &next) {
+                std::vector<DatalogValue> bindings, key;
+                for (size_t index; (index = next.fetch_add(1, std::memory_order_relaxed)) < tasks.size();)
+                {
+                    Task &task = tasks[index];
+                    const Plan &plan = plans[task.plan];
+                    bindings.assign(plan.rule->variables, 0);
+                    join(plan, task, 0, bindings, key);
+                }
+            };
+            std::atomic<size_t> next{0};
+            if (workers <= 1)
+                work(next);
+            else
+            {
+                std::vector<std::jthread> pool;
+                for (size_t worker = 0; worker < workers; ++worker)
+                    pool.emplace_back([&] { work(next); });
+            }
+        }
+
+        // ¿La fila encaja con el paso? Liga las variables nuevas
+        static bool accept(const Relation &relation, const Step &step, std::uint32_t row, std::vector<DatalogValue> &bindings)
+        {
+            const std::vector<DatalogTerm> &args = *step.args;
+            for (std::uint32_t column = 0; column < args.size(); ++column)
+            {
+                if (step.mask >> column & 1)
+                    continue; // Ya comprobada por el índice
+                const DatalogValue value = relation.at(row, column);
+                const DatalogTerm &term = args[column];
+                if (step.binds[column])
+                    bindings[term.value] = value;
+                else if (value != (term.variable ? bindings[term.value] : term.value))
+                    return false;
+            }
+            return true;
+        }
+
+        void join(const Plan &plan, Task &task, size_t depth, std::vector<DatalogValue> &bindings, std::vector<DatalogValue> &key) const
+        {
+            if (depth == plan.steps.size())
+            {
+                const DatalogAtom &head = plan.rule->rule.head;
+                const size_t at = task.out.size();
+                task.out.push_back(head.relation);
+                for (const DatalogTerm &term : head.args)
+                    task.out.push_back(term.variable ? bindings[term.value] : term.value);
+                // Lo que ya estaba al empezar la vuelta no hace falta llevarlo
+                if (relations_[head.relation].contains(std::span<const DatalogValue>(task.out.data() + at + 1, head.args.size())))
+                    task.out.resize(at);
+                return;
+            }
+
+            const Step &step = plan.steps[depth];
+            const Relation &relation = relations_[step.relation];
+            if (depth == 0)
+            {
+                for (std::uint32_t row = task.first; row < task.last; ++row)
+                    if (accept(relation, step, row, bindings))
+                        join(plan, task, 1, bindings, key);
+                return;
+            }
+            if (step.mask == 0)
+            {
+                for (std::uint32_t row = 0; row < step.end; ++row)
+                    if (accept(relation, step, row, bindings))
+                        join(plan, task, depth + 1, bindings, key);
+                return;
+            }
+
+            key.clear();
+            const std::vector<DatalogTerm> &args = *step.args;
+            for (std::uint32_t column = 0; column < args.size(); ++column)
+                if (step.mask >> column & 1)
+                    key.push_back(args[column].variable ? bindings[args[column].value] : args[column].value);
+            ++task.lookups;
+            constexpr std::uint32_t end = detail::DatalogRelation::npos;
+            std::uint32_t row = relation.first(step.mask, key, detail::DatalogRelation::hash(key));
+            while (row != end && row >= step.end)
+                row = relation.next(step.mask, row);
+            for (; row != end; row = relation.next(step.mask, row))
+                if (accept(relation, step, row, bindings))
+                    join(plan, task, depth + 1, bindings, key);
+        }
+
+        std::vector<Relation> relations_;
+        std::unordered_map<std::string, RelationId> relation_ids_;
+        std::vector<CompiledRule> rules_;
+    };
+
+    // --- Desde un TermStore ---
+    template <typename Store>
+    class BasicDatalog
+    {
+    public:
+        explicit BasicDatalog(const Store &store) : store_(store) {}
+
+        // Un hecho cerrado, una regla de Horn o una conjunción de ellos (los
+        // ∀ del principio se quitan; toda variable es universal). Lanza
+        // invalid_argument si no tiene esa forma.
+        void add(NodeId formula)
+        {
+            while (store_[formula].op == NodeOp::Forall)
+                formula = store_.children(formula)[0];
+            const NodeOp op = store_[formula].op;
+            if (op == NodeOp::And)
+            {
+                add(store_.children(formula)[0]);
+                add(store_.children(formula)[1]);
+                return;
+            }
+            if (op == NodeOp::Equiv)
+            {
+                const std::span<const NodeId> sides = store_.children(formula);
+                rule({sides[0]}, sides[1]);
+                rule({sides[1]}, sides[0]);
+                return;
+            }
+            std::vector<NodeId> body;
+            while (store_[formula].op == NodeOp::Implies)
+            {
+                body.push_back(store_.children(formula)[0]);
+                formula = store_.children(formula)[1];
+                while (store_[formula].op == NodeOp::Forall)
+                    formula = store_.children(formula)[0];
+            }
+            rule(std::move(body), formula);
+        }
+
+        DatalogStats run(size_t threads = std::thread::hardware_concurrency()) { return engine_.run(threads); }
+
+        // ¿Se ha derivado el átomo cerrado?
+        bool holds(NodeId atom) const
+        {
+            const RelationId relation = engine_.find(store_.label(atom), static_cast<std::uint32_t>(store_.children(atom).size()));
+            if (relation == DatalogEngine::npos)
+                return false;
+            const std::span<const NodeId> args = store_.children(atom);
+            std::vector<DatalogValue> tuple;
+            for (const NodeId arg : args)
+            {
+                if (!ground(arg))
+                    throw std::invalid_argument("Datalog: holds() de un átomo con variables");
+                tuple.push_back(arg);
+            }
+            return engine_.contains(relation, tuple);
+        }
+
+        // Hechos del predicado `name` con `arity` argumentos
+        size_t count(std::string_view name, std::uint32_t arity) const
+        {
+            const RelationId relation = engine_.find(name, arity);
+            return relation == DatalogEngine::npos ? 0 : engine_.facts(relation).size();
+        }
+
+        const DatalogEngine &engine() const { return engine_; }
+
+    private:
+        bool ground(NodeId term) const
+        {
+            const NodeOp op = store_[term].op;
+            if (op == NodeOp::Constant)
+                return true;
+            if (op != NodeOp::Atom)
+                return false;
+            for (const NodeId arg : store_.children(term))
+                if (!ground(arg))
+                    return false;
+            return true;
+        }
+
+        RelationId relation(NodeId atom)
+        {
+            if (store_[atom].op != NodeOp::Atom)
+                throw std::invalid_argument("Datalog: la fórmula no es de Horn (se esperaba un átomo)");
+            return engine_.relation(store_.label(atom), static_cast<std::uint32_t>(store_.children(atom).size()));
+        }
+
+        DatalogAtom atom(NodeId id, std::unordered_map<NodeId, std::uint32_t> &variables)
+        {
+            DatalogAtom out{relation(id), {}};
+            for (const NodeId arg : store_.children(id))
+            {
+                if (store_[arg].op == NodeOp::Variable)
+                {
+                    const auto [it, inserted] = variables.try_emplace(arg, static_cast<std::uint32_t>(variables.size()));
+                    out.args.push_back(DatalogTerm::var(it->second));
+                }
+                else if (ground(arg))
+                    out.args.push_back(DatalogTerm::constant(arg));
+                else
+                    throw std::invalid_argument("Datalog: término con variables dentro de un símbolo de función");
+            }
+            return out;
+        }
+
+        // Los átomos de una conjunción
+        void conjuncts(NodeId formula, std::vector<NodeId> &out) const
+        {
+            if (store_[formula].op == NodeOp::And)
+            {
+                conjuncts(store_.children(formula)[0], out);
+                conjuncts(store_.children(formula)[1], out);
+            }
+            else
+                out.push_back(formula);
+        }
+
+        void rule(std::vector<NodeId> premises, NodeId conclusion)
+        {
+            std::vector<NodeId> body, heads;
+            for (const NodeId premise : premises)
+                conjuncts(premise, body);
+            conjuncts(conclusion, heads);
+            std::unordered_map<NodeId, std::uint32_t> variables;
+            std::vector<DatalogAtom> atoms;
+            for (const NodeId id : body)
+                atoms.push_back(atom(id, variables));
+            for (const NodeId head : heads)
+                engine_.add_rule({atom(head, variables), atoms});
+        }
+
+        const Store &store_;
+        DatalogEngine engine_;
+    };
+
+    using Datalog = BasicDatalog<TermStore>;
+
+} // namespace logic::runtime
@@ -0,0 +1,799 @@
+#pragma once
+
+#include "stamped_table.hpp"
+#include "term_store.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// =========================================================
+// === E-GRAFOS (saturación de igualdades) ===
+// =========================================================
+//
+// Lemas como add_comm (Add(n, m, k) ↔ Add(m, n, k)) o le_iff_lt_succ dan
+// muchas formas equivalentes de la misma fórmula. Un e-grafo las guarda
+// todas a la vez: cada e-clase es un conjunto de e-nodos (un símbolo con
+// e-clases como hijos) que representan términos equivalentes, y aplicar
+// una regla L → R solo añade R a la clase de cada coincidencia de L.
+//
+//   - Reconstrucción diferida (egg): merge() solo une las clases y apunta
+//     los padres de la menor; rebuild() los vuelve a buscar en la tabla de
+//     nodos canónicos y une los que han quedado iguales (congruencia), así
+//     que cada vuelta de la saturación reconstruye una sola vez.
+//   - Búsqueda con un pequeño programa por patrón: Bind recorre los nodos
+//     de una clase con el símbolo del patrón y Compare exige que dos
+//     apariciones de la misma variable caigan en la misma clase.
+//   - Planificación con retroceso (backoff): una regla que da más de
+//     match_limit << veces coincidencias en una vuelta queda prohibida
+//     ban_length << veces vueltas y sus coincidencias no se aplican.
+//   - Extracción por coste (tamaño del árbol, con pesos por símbolo): el
+//     nodo más barato de cada clase, hasta un punto fijo.
+//
+// BasicEqualitySaturation lee términos y reglas de un TermStore. Las
+// reglas salen de los lemas ∀x̄. L ↔ R de theorems/peano (las dos
+// direcciones cuyas variables están ligadas por el lado izquierdo). Las
+// variables ligadas dentro de un patrón (∃p en add_assoc) se comparan por
+// nombre, sin α-equivalencia; para no capturar variables, cada clase
+// guarda una máscara de las variables que aparecen en sus términos y una
+// coincidencia no liga a un patrón nada que mencione las variables que la
+// regla liga.
+
+namespace logic::runtime
+{
+
+    using EClassId = std::uint32_t;
+
+    // Patrón: nodos en orden (los hijos antes que el padre); el último es la raíz
+    class EPattern
+    {
+    public:
+        static constexpr std::uint32_t npos = ~std::uint32_t{0};
+
+        struct Node
+        {
+            std::uint32_t symbol = npos;
+            std::uint32_t variable = npos; // Índice de variable, o npos en un nodo
+            std::uint32_t first = 0, arity = 0;
+        };
+
+        std::uint32_t variable(std::uint32_t index)
+        {
+            nodes_.push_back({npos, index, 0, 0});
+            variables_ = std::max(variables_, index + 1);
+            return static_cast<std::uint32_t>(nodes_.size() - 1);
+        }
+
+        std::uint32_t node(std::uint32_t symbol, std::span<const std::uint32_t> children)
+        {
+            nodes_.push_back({symbol, npos, static_cast<std::uint32_t>(children_.size()), static_cast<std::uint32_t>(children.size())});
+            children_.insert(children_.end(), children.begin(), children.end());
+            return static_cast<std::uint32_t>(nodes_.size() - 1);
+        }
+
+        const Node &operator[](std::uint32_t i) const { return nodes_[i]; }
+        std::span<const std::uint32_t> children(std::uint32_t i) const { return {children_.data() + nodes_[i].first, nodes_[i].arity}; }
+        std::uint32_t root() const { return static_cast<std::uint32_t>(nodes_.size() - 1); }
+        size_t size() const { return nodes_.size(); }
+        std::uint32_t variables() const { return variables_; }
+
+    private:
+        std::vector<Node> nodes_;
+        std::vector<std::uint32_t> children_;
+        std::uint32_t variables_ = 0;
+    };
+
+    struct ERewrite
+    {
+        std::string name;
+        EPattern lhs, rhs;
+        std::uint64_t capture = 0; // Máscara de las variables ligadas en los patrones
+    };
+
+    struct SaturationOptions
+    {
+        size_t max_iterations = 30;
+        size_t max_nodes = 100000;
+        double max_seconds = 5.0;
+        size_t match_limit = 1000; // Coincidencias por regla y vuelta antes de prohibirla
+        size_t ban_length = 5;     // Vueltas de la primera prohibición
+    };
+
+    enum class SaturationStop : std::uint8_t
+    {
+        Saturated, // Ninguna regla cambia nada
+        IterationLimit,
+        NodeLimit,
+        TimeLimit,
+    };
+
+    struct SaturationIteration
+    {
+        size_t nodes = 0, classes = 0;
+        std::uint64_t matches = 0, unions = 0;
+        size_t banned = 0; // Reglas prohibidas en esta vuelta
+        double seconds = 0.0;
+    };
+
+    struct SaturationReport
+    {
+        SaturationStop stop = SaturationStop::Saturated;
+        size_t iterations = 0;
+        size_t nodes = 0, classes = 0;
+        std::uint64_t matches = 0, unions = 0;
+        double seconds = 0.0;
+        std::vector<SaturationIteration> history;
+    };
+
+    class EGraph
+    {
+    public:
+        static constexpr EClassId npos = ~EClassId{0};
+
+        // La clase de symbol(children); un nodo nuevo forma su propia clase
+        EClassId add(std::uint32_t symbol, std::span<const EClassId> children)
+        {
+            const EClassId id = static_cast<EClassId>(nodes_.size());
+            nodes_.push_back({symbol, static_cast<std::uint32_t>(children_.size()), static_cast<std::uint32_t>(children.size())});
+            for (const EClassId child : children)
+                children_.push_back(find(child));
+            if (const EClassId other = lookup(id); other != npos)
+            {
+                nodes_.pop_back();
+                children_.resize(children_.size() - children.size());
+                return find(other);
+            }
+
+            parent_.push_back(id);
+            members_.push_back({id});
+            parents_.emplace_back();
+            dead_.push_back(false);
+            masks_.push_back(node_mask(id));
+            ++classes_;
+            ++version_;
+            for (size_t i = 0; i < children.size(); ++i)
+                if (std::find(this->children(id).begin(), this->children(id).begin() + i, this->children(id)[i]) == this->children(id).begin() + i)
+                    parents_[this->children(id)[i]].push_back(id);
+            if (symbol >= by_symbol_.size())
+                by_symbol_.resize(symbol + 1);
+            by_symbol_[symbol].push_back(id);
+            return id;
+        }
+
+        // Une las clases de a y b (false si ya eran la misma); la
+        // congruencia espera a rebuild()
+        bool merge(EClassId a, EClassId b)
+        {
+            EClassId ra = find(a), rb = find(b);
+            if (ra == rb)
+                return false;
+            if (members_[ra].size() > members_[rb].size())
+                std::swap(ra, rb);
+            parent_[ra] = rb;
+            --classes_;
+            ++version_;
+            members_[rb].insert(members_[rb].end(), members_[ra].begin(), members_[ra].end());
+            members_[ra] = {};
+            repair_.insert(repair_.end(), parents_[ra].begin(), parents_[ra].end());
+            parents_[rb].insert(parents_[rb].end(), parents_[ra].begin(), parents_[ra].end());
+            parents_[ra] = {};
+            if ((masks_[rb] | masks_[ra]) != masks_[rb])
+            {
+                masks_[rb] |= masks_[ra];
+                analysis_.push_back(rb);
+            }
+            return true;
+        }
+
+        // Restablece la congruencia (y las máscaras) tras las uniones
+        void rebuild()
+        {
+            while (!repair_.empty() || !analysis_.empty())
+            {
+                while (!repair_.empty())
+                {
+                    const std::uint32_t node = repair_.back();
+                    repair_.pop_back();
+                    if (dead_[node])
+                        continue;
+                    for (EClassId &child : children_mut(node))
+                        child = find(child);
+                    if (const EClassId other = lookup(node); other != npos)
+                    {
+                        // Mismo nodo canónico: sobra uno
+                        dead_[node] = true;
+                        ++dead_count_;
+                        merge(node, other);
+                    }
+                }
+                while (!analysis_.empty() && repair_.empty())
+                {
+                    const EClassId changed = find(analysis_.back());
+                    analysis_.pop_back();
+                    for (size_t i = 0; i < parents_[changed].size(); ++i)
+                    {
+                        const std::uint32_t node = parents_[changed][i];
+                        const EClassId r = find(node);
+                        if (const std::uint64_t mask = masks_[r] | node_mask(node); mask != masks_[r])
+                        {
+                            masks_[r] = mask;
+                            analysis_.push_back(r);
+                        }
+                    }
+                }
+            }
+        }
+
+        EClassId find(EClassId c)
+        {
+            EClassId root = c;
+            while (parent_[root] != root)
+                root = parent_[root];
+            while (parent_[c] != root)
+                c = std::exchange(parent_[c], root);
+            return root;
+        }
+
+        bool equal(EClassId a, EClassId b) { return find(a) == find(b); }
+
+        // Marca de un símbolo (una variable) para las máscaras de las clases
+        void set_mask(std::uint32_t symbol, std::uint64_t mask)
+        {
+            if (symbol >= symbol_masks_.size())
+                symbol_masks_.resize(symbol + 1, 0);
+            symbol_masks_[symbol] = mask;
+        }
+
+        // Variables (su marca) que aparecen en los términos de la clase
+        std::uint64_t mask(EClassId c) { return masks_[find(c)]; }
+
+        // Coincidencias del patrón: yield(clase, sustitución) por cada una
+        // mientras devuelva true. Pide un e-grafo reconstruido.
+        template <typename Yield>
+        void search(const EPattern &pattern, Yield &&yield)
+        {
+            if (pattern[pattern.root()].variable != EPattern::npos)
+                throw std::invalid_argument("EGraph::search: la raíz del patrón es una variable");
+            const std::uint32_t symbol = pattern[pattern.root()].symbol;
+            if (symbol >= by_symbol_.size())
+                return;
+
+            Program program;
+            compile(pattern, pattern.root(), 0, program);
+            program.registers.assign(program.count, npos);
+            std::vector<EClassId> substitution(pattern.variables(), npos);
+            const auto emit = [&] {
+                for (std::uint32_t v = 0; v < pattern.variables(); ++v)
+                    substitution[v] = find(program.registers[program.variables[v]]);
+                return yield(program.registers[0], std::span<const EClassId>(substitution));
+            };
+
+            ++epoch_;
+            if (seen_.size() < nodes_.size())
+                seen_.resize(nodes_.size(), 0);
+            for (size_t i = 0; i < by_symbol_[symbol].size(); ++i)
+            {
+                const EClassId c = find(by_symbol_[symbol][i]);
+                if (seen_[c] == epoch_)
+                    continue;
+                seen_[c] = epoch_;
+                program.registers[0] = c;
+                if (!run(program, 0, emit))
+                    return;
+            }
+        }
+
+        // Añade el patrón con las variables sustituidas y da su clase
+        EClassId instantiate(const EPattern &pattern, std::span<const EClassId> substitution)
+        {
+            std::vector<EClassId> classes(pattern.size());
+            std::vector<EClassId> children;
+            for (std::uint32_t i = 0; i < pattern.size(); ++i)
+            {
+                if (pattern[i].variable != EPattern::npos)
+                {
+                    classes[i] = substitution[pattern[i].variable];
+                    continue;
+                }
+                children.clear();
+                for (const std::uint32_t child : pattern.children(i))
+                    children.push_back(classes[child]);
+                classes[i] = add(pattern[i].symbol, children);
+            }
+            return classes[pattern.root()];
+        }
+
+        // Aplica las reglas por vueltas (buscar todas, aplicar todas,
+        // reconstruir) hasta que nada cambia o se llega a un límite
+        SaturationReport saturate(std::span<const ERewrite> rules, const SaturationOptions &options = {})
+        {
+            using Clock = std::chrono::steady_clock;
+            const Clock::time_point start = Clock::now();
+            const auto elapsed = [&] { return std::chrono::duration<double>(Clock::now() - start).count(); };
+
+            struct Schedule
+            {
+                size_t times_banned = 0, banned_until = 0;
+            };
+            std::vector<Schedule> schedule(rules.size());
+            std::vector<std::vector<EClassId>> matches(rules.size()); // Clase y sustitución, seguidas
+            SaturationReport report;
+            rebuild();
+
+            for (size_t iteration = 0;; ++iteration)
+            {
+                if (iteration >= options.max_iterations)
+                {
+                    report.stop = SaturationStop::IterationLimit;
+                    break;
+                }
+                if (nodes() > options.max_nodes)
+                {
+                    report.stop = SaturationStop::NodeLimit;
+                    break;
+                }
+                if (elapsed() > options.max_seconds)
+                {
+                    report.stop = SaturationStop::TimeLimit;
+                    break;
+                }
+
+                const double iteration_start = elapsed();
+                SaturationIteration step;
+                for (size_t r = 0; r < rules.size(); ++r)
+                {
+                    matches[r].clear();
+                    Schedule &rule = schedule[r];
+                    if (rule.banned_until > iteration)
+                    {
+                        ++step.banned;
+                        continue;
+                    }
+                    const size_t threshold = options.match_limit << rule.times_banned;
+                    size_t count = 0;
+                    search(rules[r].lhs, [&](EClassId c, std::span<const EClassId> substitution) {
+                        if (rules[r].capture)
+                            for (const EClassId bound : substitution)
+                                if (masks_[bound] & rules[r].capture)
+                                    return true;
+                        if (++count > threshold)
+                            return false;
+                        matches[r].push_back(c);
+                        matches[r].insert(matches[r].end(), substitution.begin(), substitution.end());
+                        return true;
+                    });
+                    if (count > threshold)
+                    {
+                        rule.banned_until = iteration + (options.ban_length << rule.times_banned);
+                        ++rule.times_banned;
+                        matches[r].clear();
+                        ++step.banned;
+                        continue;
+                    }
+                    step.matches += count;
+                }
+
+                for (size_t r = 0; r < rules.size(); ++r)
+                {
+                    const size_t width = 1 + rules[r].lhs.variables();
+                    for (size_t at = 0; at < matches[r].size(); at += width)
+                    {
+                        const std::span<const EClassId> substitution(matches[r].data() + at + 1, width - 1);
+                        step.unions += merge(matches[r][at], instantiate(rules[r].rhs, substitution));
+                    }
+                }
+                rebuild();
+
+                step.nodes = nodes();
+                step.classes = classes();
+                step.seconds = elapsed() - iteration_start;
+                report.history.push_back(step);
+                report.matches += step.matches;
+                report.unions += step.unions;
+                report.iterations = iteration + 1;
+
+                if (step.unions == 0)
+                {
+                    // Sin cambios: se acaba si no hay reglas prohibidas; si
+                    // las hay, se adelanta el fin de la prohibición más corta
+                    size_t first = std::numeric_limits<size_t>::max();
+                    for (const Schedule &rule : schedule)
+                        if (rule.banned_until > iteration + 1)
+                            first = std::min(first, rule.banned_until);
+                    if (first == std::numeric_limits<size_t>::max())
+                    {
+                        report.stop = SaturationStop::Saturated;
+                        break;
+                    }
+                    for (Schedule &rule : schedule)
+                        if (rule.banned_until > iteration + 1)
+                            rule.banned_until -= first - (iteration + 1);
+                }
+            }
+
+            report.nodes = nodes();
+            report.classes = classes();
+            report.seconds = elapsed();
+            return report;
+        }
+
+        // --- Extracción ---
+        // El nodo más barato de cada clase: cost(símbolo) > 0 más el coste
+        // de los hijos, hasta que no mejora ninguno
+        template <typename Cost>
+        void choose(Cost &&cost)
+        {
+            rebuild();
+            best_cost_.assign(nodes_.size(), std::numeric_limits<double>::infinity());
+            best_node_.assign(nodes_.size(), npos);
+            for (bool changed = true; changed;)
+            {
+                changed = false;
+                for (std::uint32_t node = 0; node < nodes_.size(); ++node)
+                {
+                    if (dead_[node])
+                        continue;
+                    double total = cost(nodes_[node].symbol);
+                    for (const EClassId child : children(node))
+                        total += best_cost_[find(child)];
+                    if (const EClassId c = find(node); total < best_cost_[c])
+                    {
+                        best_cost_[c] = total;
+                        best_node_[c] = node;
+                        changed = true;
+                    }
+                }
+            }
+        }
+
+        // Tras choose(): el nodo elegido de la clase y su coste
+        std::uint32_t best(EClassId c) { return best_node_[find(c)]; }
+        double cost(EClassId c) { return best_cost_[find(c)]; }
+
+        // --- Acceso ---
+        std::uint32_t symbol(std::uint32_t node) const { return nodes_[node].symbol; }
+        std::span<const EClassId> children(std::uint32_t node) const { return {children_.data() + nodes_[node].first, nodes_[node].arity}; }
+        std::span<const std::uint32_t> members(EClassId c) { return members_[find(c)]; }
+        bool dead(std::uint32_t node) const { return dead_[node]; }
+        size_t nodes() const { return nodes_.size() - dead_count_; }
+        size_t classes() const { return classes_; }
+        // Cambia con cada nodo o unión nuevos
+        std::uint64_t version() const { return version_; }
+
+    private:
+        struct Node
+        {
+            std::uint32_t symbol;
+            std::uint32_t first, arity; // En children_
+        };
+
+        // Bind: recorre los nodos de la clase registers[reg] con `symbol` y
+        // deja sus hijos en registers[out...]; Compare: registers[reg] y
+        // registers[out] en la misma clase
+        struct Instruction
+        {
+            bool bind;
+            std::uint32_t reg, symbol, arity, out;
+        };
+
+        struct Program
+        {
+            std::vector<Instruction> code;
+            std::vector<std::uint32_t> variables; // Registro de cada variable
+            std::vector<EClassId> registers;
+            std::uint32_t count = 1;
+        };
+
+        void compile(const EPattern &pattern, std::uint32_t i, std::uint32_t reg, Program &program)
+        {
+            if (const std::uint32_t v = pattern[i].variable; v != EPattern::npos)
+            {
+                if (program.variables.size() <= v)
+                    program.variables.resize(v + 1, EPattern::npos);
+                if (program.variables[v] == EPattern::npos)
+                    program.variables[v] = reg;
+                else
+                    program.code.push_back({false, program.variables[v], 0, 0, reg});
+                return;
+            }
+            const std::uint32_t out = program.count;
+            program.count += pattern[i].arity;
+            program.code.push_back({true, reg, pattern[i].symbol, pattern[i].arity, out});
+            for (std::uint32_t j = 0; j < pattern[i].arity; ++j)
+                compile(pattern, pattern.children(i)[j], out + j, program);
+        }
+
+        // false si yield pide parar
+        template <typename Emit>
+        bool run(Program &program, size_t pc, Emit &emit)
+        {
+            if (pc == program.code.size())
+                return emit();
+            const Instruction instruction = program.code[pc];
+            if (!instruction.bind)
+                return find(program.registers[instruction.reg]) != find(program.registers[instruction.out]) || run(program, pc + 1, emit);
+            const EClassId c = find(program.registers[instruction.reg]);
+            for (size_t i = 0; i < members_[c].size(); ++i)
+            {
+                const std::uint32_t node = members_[c][i];
+                if (dead_[node] || nodes_[node].symbol != instruction.symbol || nodes_[node].arity != instruction.arity)
+                    continue;
+                for (std::uint32_t j = 0; j < instruction.arity; ++j)
+                    program.registers[instruction.out + j] = find(children(node)[j]);
+                if (!run(program, pc + 1, emit))
+                    return false;
+            }
+            return true;
+        }
+
+        std::span<EClassId> children_mut(std::uint32_t node) { return {children_.data() + nodes_[node].first, nodes_[node].arity}; }
+
+        std::uint64_t node_mask(std::uint32_t node)
+        {
+            std::uint64_t mask = nodes_[node].symbol < symbol_masks_.size() ? symbol_masks_[nodes_[node].symbol] : 0;
+            for (const EClassId child : children(node))
+                mask |= masks_[find(child)];
+            return mask;
+        }
+
+        std::uint64_t node_hash(std::uint32_t node)
+        {
+            std::uint64_t hash = detail::HashAlgebra::mix(0x452821e638d01377ull, nodes_[node].symbol);
+            for (const EClassId child : children(node))
+                hash = detail::HashAlgebra::mix(hash, find(child));
+            return hash;
+        }
+
+        bool same_node(std::uint32_t a, std::uint32_t b)
+        {
+            if (nodes_[a].symbol != nodes_[b].symbol || nodes_[a].arity != nodes_[b].arity)
+                return false;
+            for (std::uint32_t i = 0; i < nodes_[a].arity; ++i)
+                if (find(children(a)[i]) != find(children(b)[i]))
+                    return false;
+            return true;
+        }
+
+        // Otro nodo vivo igual que `node` en la tabla de nodos canónicos, o
+        // lo inserta y da npos
+        std::uint32_t lookup(std::uint32_t node)
+        {
+            return table_.lookup(node, [&](std::uint32_t u) { return node_hash(u); },
+                                 [&](std::uint32_t u, std::uint32_t v) { return same_node(u, v); });
+        }
+
+        std::vector<Node> nodes_;
+        std::vector<EClassId> children_;
+        std::vector<bool> dead_; // Nodos repetidos tras una unión
+        size_t dead_count_ = 0;
+
+        std::vector<EClassId> parent_;                       // Unión-búsqueda
+        std::vector<std::vector<std::uint32_t>> members_;    // Nodos, por representante
+        std::vector<std::vector<std::uint32_t>> parents_;    // Nodos que usan la clase
+        std::vector<std::vector<std::uint32_t>> by_symbol_;  // Nodos de cada símbolo
+        std::vector<std::uint64_t> masks_, symbol_masks_;
+        size_t classes_ = 0;
+        std::uint64_t version_ = 0;
+
+        detail::StampedTable table_; // Nodos canónicos: su clave cambia con las uniones
+
+        std::vector<std::uint32_t> repair_; // Padres por volver a buscar
+        std::vector<EClassId> analysis_;    // Clases con la máscara cambiada
+        std::vector<std::uint32_t> seen_;
+        std::uint32_t epoch_ = 0;
+
+        std::vector<double> best_cost_;
+        std::vector<std::uint32_t> best_node_;
+    };
+
+    // --- Desde un TermStore ---
+    template <typename Store>
+    class BasicEqualitySaturation
+    {
+    public:
+        explicit BasicEqualitySaturation(Store &store) : store_(store) {}
+
+        // Las reglas de un lema ∀x̄. L ↔ R: L → R si las variables de R salen
+        // en L, y R → L igual. Da cuántas añade (0, 1 o 2); lanza
+        // invalid_argument si el lema no tiene esa forma.
+        size_t add_equivalence(std::string_view name, NodeId lemma)
+        {
+            NodeId body = lemma;
+            while (store_[body].op == NodeOp::Forall)
+                body = store_.children(body)[0];
+            if (store_[body].op != NodeOp::Equiv)
+                throw std::invalid_argument("EqualitySaturation: se esperaba un lema ∀x̄. L ↔ R");
+            const NodeId left = store_.children(body)[0], right = store_.children(body)[1];
+            const size_t added = add_rewrite(std::string(name) + " →", left, right) ? 1 : 0;
+            return added + (add_rewrite(std::string(name) + " ←", right, left) ? 1 : 0);
+        }
+
+        // La regla lhs → rhs. Las variables libres de los patrones son las
+        // de la regla; false (y no se añade) si lhs es una variable o rhs
+        // tiene variables que lhs no liga.
+        bool add_rewrite(std::string name, NodeId lhs, NodeId rhs)
+        {
+            ERewrite rule{std::move(name), {}, {}, 0};
+            std::vector<SymbolId> variables, bound;
+            compile(lhs, variables, bound, rule.lhs, rule.capture);
+            if (rule.lhs[rule.lhs.root()].variable != EPattern::npos)
+                return false;
+            const size_t before = variables.size();
+            compile(rhs, variables, bound, rule.rhs, rule.capture);
+            if (variables.size() != before)
+                return false;
+            rules_.push_back(std::move(rule));
+            return true;
+        }
+
+        // La clase del término (sus variables son hojas, no de patrón)
+        EClassId add(NodeId term)
+        {
+            if (const auto it = classes_.find(term); it != classes_.end())
+                return engine_.find(it->second);
+            const Node &node = store_[term];
+            std::vector<EClassId> children;
+            for (const NodeId child : store_.children(term))
+                children.push_back(add(child));
+            const EClassId c = engine_.add(symbol(node.op, node.symbol), children);
+            classes_.emplace(term, c);
+            return c;
+        }
+
+        SaturationReport saturate(const SaturationOptions &options = {}) { return engine_.saturate(rules_, options); }
+
+        bool equivalent(NodeId a, NodeId b)
+        {
+            const EClassId ca = add(a), cb = add(b);
+            engine_.rebuild();
+            return engine_.equal(ca, cb);
+        }
+
+        // Coste de un símbolo en la extracción (1 por defecto): el nombre de
+        // un átomo, constante o variable, o el de una conectiva (TermStore::label)
+        void weight(std::string_view label, double cost)
+        {
+            if (!(cost > 0.0))
+                throw std::invalid_argument("EqualitySaturation::weight: el coste debe ser positivo");
+            weights_.insert_or_assign(std::string(label), cost);
+            chosen_ = false;
+        }
+
+        // El término más barato equivalente a `term`
+        NodeId extract(NodeId term)
+        {
+            const EClassId c = add(term);
+            engine_.rebuild();
+            if (!chosen_ || chosen_version_ != engine_.version())
+            {
+                engine_.choose([&](std::uint32_t s) { return cost(s); });
+                chosen_ = true;
+                chosen_version_ = engine_.version();
+                built_.clear();
+            }
+            return build(c);
+        }
+
+        EGraph &engine() { return engine_; }
+        std::span<const ERewrite> rules() const { return rules_; }
+
+    private:
+        struct Symbol
+        {
+            NodeOp op;
+            SymbolId symbol;
+        };
+
+        std::uint32_t symbol(NodeOp op, SymbolId id)
+        {
+            const std::uint64_t key = std::uint64_t{id} << 8 | static_cast<std::uint8_t>(op);
+            const auto [it, inserted] = symbol_ids_.try_emplace(key, static_cast<std::uint32_t>(symbols_.size()));
+            if (inserted)
+            {
+                symbols_.push_back({op, id});
+                if (op == NodeOp::Variable)
+                    engine_.set_mask(it->second, variable_mask(id));
+            }
+            return it->second;
+        }
+
+        static std::uint64_t variable_mask(SymbolId id) { return std::uint64_t{1} << (id % 64); }
+
+        // `pattern` recibe el término; las variables libres (no ligadas por
+        // un cuantificador del propio patrón) son variables de patrón
+        std::uint32_t compile(NodeId term, std::vector<SymbolId> &variables, std::vector<SymbolId> &bound, EPattern &pattern,
+                              std::uint64_t &capture)
+        {
+            const Node &node = store_[term];
+            if (node.op == NodeOp::Variable && std::ranges::find(bound, node.symbol) == bound.end())
+            {
+                auto at = std::ranges::find(variables, node.symbol);
+                if (at == variables.end())
+                    at = variables.insert(at, node.symbol);
+                return pattern.variable(static_cast<std::uint32_t>(at - variables.begin()));
+            }
+            if (is_binder(node.op))
+            {
+                bound.push_back(node.symbol);
+                capture |= variable_mask(node.symbol);
+            }
+            std::vector<std::uint32_t> children;
+            for (const NodeId child : store_.children(term))
+                children.push_back(compile(child, variables, bound, pattern, capture));
+            if (is_binder(node.op))
+                bound.pop_back();
+            return pattern.node(symbol(node.op, node.symbol), children);
+        }
+
+        double cost(std::uint32_t s)
+        {
+            if (weights_.empty())
+                return 1.0;
+            const Symbol &entry = symbols_[s];
+            const std::string_view label = entry.op <= NodeOp::Atom ? store_.symbols().name(entry.symbol) : op_symbol(entry.op);
+            const auto it = weights_.find(std::string(label));
+            return it == weights_.end() ? 1.0 : it->second;
+        }
+
+        NodeId build(EClassId c)
+        {
+            c = engine_.find(c);
+            if (const auto it = built_.find(c); it != built_.end())
+                return it->second;
+            const std::uint32_t node = engine_.best(c);
+            const Symbol entry = symbols_[engine_.symbol(node)];
+            std::vector<NodeId> children;
+            for (const EClassId child : engine_.children(node))
+                children.push_back(build(child));
+
+            NodeId out;
+            switch (entry.op)
+            {
+            case NodeOp::Variable:
+                out = store_.variable(store_.symbols().name(entry.symbol));
+                break;
+            case NodeOp::Constant:
+                out = store_.constant(store_.symbols().name(entry.symbol));
+                break;
+            case NodeOp::Atom:
+                out = store_.atom(store_.symbols().name(entry.symbol), children);
+                break;
+            case NodeOp::Forall:
+            case NodeOp::Exists:
+                out = store_.binder(entry.op, store_.symbols().name(entry.symbol), children[0]);
+                break;
+            case NodeOp::Not:
+                out = store_.unary(entry.op, children[0]);
+                break;
+            default:
+                out = store_.binary(entry.op, children[0], children[1]);
+                break;
+            }
+            built_.emplace(c, out);
+            return out;
+        }
+
+        Store &store_;
+        EGraph engine_;
+        std::vector<ERewrite> rules_;
+        std::unordered_map<NodeId, EClassId> classes_;
+        std::unordered_map<std::uint64_t, std::uint32_t> symbol_ids_;
+        std::vector<Symbol> symbols_;
+
+        std::unordered_map<std::string, double> weights_;
+        bool chosen_ = false;
+        std::uint64_t chosen_version_ = 0;
+        std::unordered_map<EClassId, NodeId> built_;
+    };
+
+    using EqualitySaturation = BasicEqualitySaturation<TermStore>;
+
+} // namespace logic::runtime
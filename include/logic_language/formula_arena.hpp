@@ -0,0 +1,472 @@
+#pragma once
+
+#include "logic_language.hpp"
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace logic::runtime
+{
+
+    // =========================================================
+    // === RUNTIME FORMULAS (Flat Arena) ===
+    // =========================================================
+    //
+    // Las fórmulas del kernel son tipos: cada fórmula distinta cuesta
+    // instanciaciones de plantilla y no se pueden construir a partir de datos
+    // que llegan en ejecución. FormulaArena es la representación en tiempo de
+    // ejecución: los nodos se guardan en postorden en un vector contiguo
+    // (los hijos siempre antes que el padre, la raíz al final), los hijos se
+    // referencian con índices de 32 bits y los nombres con identificadores de
+    // símbolo internados. Todo es constexpr, así que reify<F>() se puede
+    // comprobar también con static_assert.
+
+    using NodeId = std::uint32_t;
+    using SymbolId = std::uint32_t;
+
+    // --- Símbolos ---
+    // Tabla de nombres internados: cada nombre distinto recibe un
+    // identificador denso (0, 1, 2, ...). Los textos se guardan seguidos en
+    // un único buffer y el índice es una tabla hash abierta de identificadores
+    // (sondeo lineal, factor de carga ≤ 1/2).
+    class SymbolTable
+    {
+    public:
+        static constexpr SymbolId npos = ~SymbolId{0};
+
+        constexpr SymbolId intern(std::string_view name)
+        {
+            if (slots_.empty())
+                slots_.assign(16, npos);
+            size_t slot = find_slot(name);
+            if (slots_[slot] != npos)
+                return slots_[slot];
+
+            const SymbolId id = static_cast<SymbolId>(size());
+            text_.insert(text_.end(), name.begin(), name.end());
+            offsets_.push_back(static_cast<std::uint32_t>(text_.size()));
+            slots_[slot] = id;
+            if (2 * size() > slots_.size())
+                rehash(2 * slots_.size());
+            return id;
+        }
+
+        // Identificador de un nombre ya internado, o npos
+        constexpr SymbolId find(std::string_view name) const
+        {
+            return slots_.empty() ? npos : slots_[find_slot(name)];
+        }
+
+        // La vista es válida hasta el siguiente intern
+        constexpr std::string_view name(SymbolId id) const
+        {
+            return std::string_view(text_.data() + offsets_[id], offsets_[id + 1] - offsets_[id]);
+        }
+
+        constexpr size_t size() const { return offsets_.size() - 1; }
+
+    private:
+        constexpr size_t find_slot(std::string_view text) const
+        {
+            const size_t mask = slots_.size() - 1;
+            size_t slot = logic::detail::fnv1a(text) & mask;
+            while (slots_[slot] != npos && name(slots_[slot]) != text)
+                slot = (slot + 1) & mask;
+            return slot;
+        }
+
+        constexpr void rehash(size_t capacity)
+        {
+            slots_.assign(capacity, npos);
+            for (SymbolId id = 0; id < size(); ++id)
+                slots_[find_slot(name(id))] = id;
+        }
+
+        std::vector<char> text_; // No std::string: GCC 12 no admite en constexpr vistas a su buffer corto
+        std::vector<std::uint32_t> offsets_{0};
+        std::vector<SymbolId> slots_;
+    };
+
+    // --- Nodos ---
+    enum class NodeOp : std::uint8_t
+    {
+        Variable,
+        Constant,
+        Atom, // Predicados y símbolos de función (Succ): símbolo + argumentos
+        Not,
+        And,
+        Or,
+        Implies,
+        Equiv,
+        Forall,
+        Exists
+    };
+
+    // 16 bytes por nodo. En los átomos `operands` es {posición, número} de sus
+    // argumentos en FormulaArena::arguments; en las conectivas son los hijos;
+    // en los cuantificadores operands[0] es el cuerpo y `symbol` la variable
+    // ligada.
+    struct Node
+    {
+        NodeOp op;
+        SymbolId symbol;
+        std::array<NodeId, 2> operands;
+    };
+
+    static_assert(sizeof(Node) == 16, "Node debe ocupar 16 bytes");
+
+    // Símbolo de las conectivas y cuantificadores, el mismo que usa el kernel
+    constexpr std::string_view op_symbol(NodeOp op)
+    {
+        switch (op)
+        {
+        case NodeOp::Not:
+            return operator_symbol<Not>;
+        case NodeOp::And:
+            return operator_symbol<And>;
+        case NodeOp::Or:
+            return operator_symbol<Or>;
+        case NodeOp::Implies:
+            return operator_symbol<Implies>;
+        case NodeOp::Equiv:
+            return operator_symbol<Equiv>;
+        case NodeOp::Forall:
+            return binder_symbol<Forall>;
+        case NodeOp::Exists:
+            return binder_symbol<Exists>;
+        default:
+            return {};
+        }
+    }
+
+    // Conectiva o cuantificador con ese símbolo; Atom para cualquier otro
+    // operador del kernel (símbolos de función como Succ)
+    constexpr NodeOp op_from_symbol(std::string_view symbol)
+    {
+        for (NodeOp op : {NodeOp::Not, NodeOp::And, NodeOp::Or, NodeOp::Implies, NodeOp::Equiv, NodeOp::Forall, NodeOp::Exists})
+            if (op_symbol(op) == symbol)
+                return op;
+        return NodeOp::Atom;
+    }
+
+    constexpr size_t arity(NodeOp op)
+    {
+        switch (op)
+        {
+        case NodeOp::Not:
+        case NodeOp::Forall:
+        case NodeOp::Exists:
+            return 1;
+        case NodeOp::And:
+        case NodeOp::Or:
+        case NodeOp::Implies:
+        case NodeOp::Equiv:
+            return 2;
+        default:
+            return 0;
+        }
+    }
+
+    constexpr bool is_binder(NodeOp op) { return op == NodeOp::Forall || op == NodeOp::Exists; }
+
+    // --- Interfaz común ---
+    // FormulaArena y TermStore (term_store.hpp) construyen nodos con la misma
+    // interfaz: reify<F> baja fórmulas a cualquiera de las dos y la
+    // impresión solo necesita operator[], children, label y symbols.
+    template <typename B>
+    concept FormulaBuilder = requires(B &builder, std::string_view name, std::span<const NodeId> args, NodeOp op, NodeId id) {
+        { builder.variable(name) } -> std::same_as<NodeId>;
+        { builder.constant(name) } -> std::same_as<NodeId>;
+        { builder.atom(name, args) } -> std::same_as<NodeId>;
+        { builder.unary(op, id) } -> std::same_as<NodeId>;
+        { builder.binary(op, id, id) } -> std::same_as<NodeId>;
+        { builder.binder(op, name, id) } -> std::same_as<NodeId>;
+    };
+
+    namespace detail
+    {
+        using logic::detail::HashAlgebra;
+        using logic::detail::is_identifier;
+
+        // Misma notación que logic::to_string: P(x, y), S(n), ¬φ, (φ ∧ ψ), ∀x. φ
+        template <typename Store>
+        constexpr void write_text(const Store &store, std::string &out, NodeId id)
+        {
+            const std::span<const NodeId> args = store.children(id);
+            const std::string_view op = store.label(id);
+            if (is_binder(store[id].op))
+            {
+                out.append(op);
+                out.append(store.symbols().name(store[id].symbol));
+                out.append(". ");
+                write_text(store, out, args[0]);
+            }
+            else if (args.size() == 1 && !is_identifier(op))
+            {
+                out.append(op);
+                write_text(store, out, args[0]);
+            }
+            else if (args.size() == 2 && !is_identifier(op))
+            {
+                out.push_back('(');
+                write_text(store, out, args[0]);
+                out.push_back(' ');
+                out.append(op);
+                out.push_back(' ');
+                write_text(store, out, args[1]);
+                out.push_back(')');
+            }
+            else
+            {
+                out.append(op);
+                for (size_t i = 0; i < args.size(); ++i)
+                {
+                    out.append(i == 0 ? "(" : ", ");
+                    write_text(store, out, args[i]);
+                }
+                if (!args.empty())
+                    out.push_back(')');
+            }
+        }
+    } // namespace detail
+
+    // --- Arena ---
+    // Los constructores reciben índices de nodos ya creados, de modo que el
+    // orden de creación es siempre un postorden. Un índice que todavía no
+    // existe lanza std::out_of_range (en compilación, un error).
+    class FormulaArena
+    {
+    public:
+        constexpr void reserve(size_t nodes)
+        {
+            nodes_.reserve(nodes);
+        }
+
+        constexpr NodeId variable(std::string_view name) { return leaf(NodeOp::Variable, symbols_.intern(name)); }
+        constexpr NodeId constant(std::string_view name) { return leaf(NodeOp::Constant, symbols_.intern(name)); }
+
+        constexpr NodeId atom(std::string_view name, std::span<const NodeId> args)
+        {
+            for (NodeId arg : args)
+                check(arg);
+            // args puede apuntar a arguments_ (los children() de otro átomo) y
+            // insert lo invalidaría al crecer: se copia antes
+            const std::vector<NodeId> copy(args.begin(), args.end());
+            const NodeId first = static_cast<NodeId>(arguments_.size());
+            arguments_.insert(arguments_.end(), copy.begin(), copy.end());
+            return push({NodeOp::Atom, symbols_.intern(name), {first, static_cast<NodeId>(args.size())}});
+        }
+
+        constexpr NodeId unary(NodeOp op, NodeId operand)
+        {
+            expect(arity(op) == 1 && !is_binder(op), "FormulaArena::unary: operador no unario");
+            return push({op, SymbolTable::npos, {check(operand), 0}});
+        }
+
+        constexpr NodeId binary(NodeOp op, NodeId left, NodeId right)
+        {
+            expect(arity(op) == 2, "FormulaArena::binary: operador no binario");
+            return push({op, SymbolTable::npos, {check(left), check(right)}});
+        }
+
+        constexpr NodeId binder(NodeOp op, std::string_view variable, NodeId body)
+        {
+            expect(is_binder(op), "FormulaArena::binder: no es un cuantificador");
+            return push({op, symbols_.intern(variable), {check(body), 0}});
+        }
+
+        constexpr const Node &operator[](NodeId id) const { return nodes_[id]; }
+        constexpr size_t size() const { return nodes_.size(); }
+        constexpr bool empty() const { return nodes_.empty(); }
+
+        // El último nodo creado: la raíz de la última fórmula construida
+        constexpr NodeId root() const { return static_cast<NodeId>(nodes_.size() - 1); }
+
+        // Hijos en orden (argumentos de un átomo, operandos, cuerpo)
+        constexpr std::span<const NodeId> children(NodeId id) const
+        {
+            const Node &node = nodes_[id];
+            if (node.op == NodeOp::Atom)
+                return std::span<const NodeId>(arguments_).subspan(node.operands[0], node.operands[1]);
+            return std::span<const NodeId>(node.operands.data(), arity(node.op));
+        }
+
+        constexpr const SymbolTable &symbols() const { return symbols_; }
+        constexpr SymbolId intern(std::string_view name) { return symbols_.intern(name); }
+
+        // Nombre de la variable, constante o predicado, o el símbolo de la
+        // conectiva o cuantificador
+        constexpr std::string_view label(NodeId id) const
+        {
+            const Node &node = nodes_[id];
+            return node.op <= NodeOp::Atom ? symbols_.name(node.symbol) : op_symbol(node.op);
+        }
+
+        // Misma notación que logic::to_string
+        constexpr std::string text(NodeId id) const
+        {
+            std::string out;
+            detail::write_text(*this, out, id);
+            return out;
+        }
+
+        constexpr std::string text() const { return text(root()); }
+
+    private:
+        constexpr void expect(bool condition, const char *message) const
+        {
+            if (!condition)
+                throw std::invalid_argument(message);
+        }
+
+        constexpr NodeId check(NodeId id) const
+        {
+            if (id >= nodes_.size())
+                throw std::out_of_range("FormulaArena: el hijo todavía no existe");
+            return id;
+        }
+
+        constexpr NodeId leaf(NodeOp op, SymbolId symbol) { return push({op, symbol, {0, 0}}); }
+
+        constexpr NodeId push(const Node &node)
+        {
+            nodes_.push_back(node);
+            return root();
+        }
+
+        std::vector<Node> nodes_;
+        std::vector<NodeId> arguments_;
+        SymbolTable symbols_;
+    };
+
+    // --- Reificación ---
+    // reify<F>(builder) baja la fórmula tipo F a una arena (o a un TermStore)
+    // y devuelve su raíz.
+    // Sigue los mismos cinco patrones que los recorridos del kernel
+    // (constantes, variables, predicados, operadores y cuantificadores), así
+    // que cubre cualquier LogicExpression, Succ y Natural incluidos.
+    namespace detail
+    {
+        template <typename Node>
+        struct Reify
+        {
+            template <typename Builder>
+            static constexpr NodeId emit(Builder &builder) { return builder.constant(LeafShape<Node>::info.label); }
+        };
+
+        template <auto Sym>
+        struct Reify<Variable<Sym>>
+        {
+            template <typename Builder>
+            static constexpr NodeId emit(Builder &builder) { return builder.variable(name_of<Variable<Sym>>); }
+        };
+
+        template <auto Sym, typename... Args>
+        struct Reify<Atom<Sym, Args...>>
+        {
+            template <typename Builder>
+            static constexpr NodeId emit(Builder &builder)
+            {
+                const std::array<NodeId, sizeof...(Args)> args{Reify<Args>::emit(builder)...};
+                return builder.atom(AtomShape<Sym>::info.label, args);
+            }
+        };
+
+        template <template <typename> class Op, typename T>
+            requires logic::detail::Operator<Op>
+        struct Reify<Op<T>>
+        {
+            template <typename Builder>
+            static constexpr NodeId emit(Builder &builder)
+            {
+                const NodeId operand = Reify<T>::emit(builder);
+                if constexpr (op_from_symbol(operator_symbol<Op>) == NodeOp::Atom)
+                    return builder.atom(operator_symbol<Op>, std::span<const NodeId>(&operand, 1));
+                else
+                    return builder.unary(op_from_symbol(operator_symbol<Op>), operand);
+            }
+        };
+
+        template <template <typename, typename> class Op, typename L, typename R>
+            requires logic::detail::Operator<Op>
+        struct Reify<Op<L, R>>
+        {
+            template <typename Builder>
+            static constexpr NodeId emit(Builder &builder)
+            {
+                const std::array<NodeId, 2> operands{Reify<L>::emit(builder), Reify<R>::emit(builder)};
+                if constexpr (op_from_symbol(operator_symbol<Op>) == NodeOp::Atom)
+                    return builder.atom(operator_symbol<Op>, operands);
+                else
+                    return builder.binary(op_from_symbol(operator_symbol<Op>), operands[0], operands[1]);
+            }
+        };
+
+        template <template <typename, typename> class Q, typename V, typename Body>
+            requires logic::detail::Quantifier<Q>
+        struct Reify<Q<V, Body>>
+        {
+            static_assert(is_binder(op_from_symbol(binder_symbol<Q>)), "ERROR: cuantificador sin equivalente en tiempo de ejecución.");
+
+            template <typename Builder>
+            static constexpr NodeId emit(Builder &builder)
+            {
+                const NodeId body = Reify<Body>::emit(builder);
+                return builder.binder(op_from_symbol(binder_symbol<Q>), name_of<V>, body);
+            }
+        };
+    } // namespace detail
+
+    template <LogicExpression F, FormulaBuilder Builder>
+    constexpr NodeId reify(Builder &builder)
+    {
+        return detail::Reify<std::remove_cv_t<F>>::emit(builder);
+    }
+
+    // Arena nueva con F como única fórmula (raíz en root())
+    template <LogicExpression F>
+    constexpr FormulaArena reify()
+    {
+        FormulaArena arena;
+        arena.reserve(formula_size_v<F>);
+        reify<F>(arena);
+        return arena;
+    }
+
+    template <LogicExpression F>
+    constexpr FormulaArena reify(F)
+    {
+        return reify<F>();
+    }
+
+    // --- Enunciados de la biblioteca ---
+    // Un BY_AXIOM(φ) da ⊢ φ → φ; StatementOf<Thm> es ese φ y
+    // statement_of<Thm>(builder) lo reifica, para usar los teoremas de la
+    // biblioteca como hechos, reglas o hipótesis de los motores.
+    namespace detail
+    {
+        template <typename F>
+        struct AxiomStatement;
+
+        template <typename L, typename R>
+        struct AxiomStatement<Implies<L, R>>
+        {
+            using type = L;
+        };
+    } // namespace detail
+
+    template <typename Thm>
+    using StatementOf = typename detail::AxiomStatement<typename Thm::formula_type>::type;
+
+    template <typename Thm, FormulaBuilder Builder>
+    constexpr NodeId statement_of(Builder &builder)
+    {
+        return reify<StatementOf<Thm>>(builder);
+    }
+
+} // namespace logic::runtime
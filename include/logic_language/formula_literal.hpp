@@ -0,0 +1,319 @@
+#pragma once
+
+#include "logic_language.hpp"
+#include "parser.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <utility>
+
+namespace logic
+{
+
+    // =========================================================
+    // === FORMULA LITERALS (Text -> Types) ===
+    // =========================================================
+    //
+    // Formula_t<"..."> es el tipo de la fórmula escrita en el texto, con la
+    // sintaxis de runtime::Parser:
+    //
+    //   Formula_t<"forall n m. Natural(n) & Natural(m) & S(n) = S(m) -> n = m">
+    //
+    // es exactamente el tipo de PA4 escrito con el DSL,
+    //
+    //   forall(n, m, (IsNat(n) && IsNat(m) && Eq(S(n), S(m))) >> Eq(n, m))
+    //
+    // pero sin instanciar un operador ni una lambda por nodo: el texto se lee
+    // en una única evaluación constante a una imagen plana de nodos
+    // (FormulaImage) y cada nodo de la imagen se traduce a su tipo con una
+    // especialización de Build. Como en los tipos del DSL, las subfórmulas
+    // repetidas son un único nodo y se traducen una sola vez.
+    //
+    // En posición de término S(t) es Succ<t>, un número es Natural<N> y un
+    // nombre es Var<nombre>; en posición de fórmula P(t, ...) es
+    // Predicate<"P", ...> y t = u es Equal<t, u>. Los nombres de los
+    // predicados son los del tipo (Natural, no IsNat). Un error de sintaxis
+    // es un error de compilación que señala el motivo.
+
+    namespace detail
+    {
+        using runtime::NodeId;
+        using runtime::NodeOp;
+
+        struct LiteralNode
+        {
+            NodeOp op;
+            bool successor;       // S(t): Succ<t> en posición de término
+            std::uint32_t symbol; // Nombre de variables, constantes y átomos; variable ligada
+            NodeId operands[2];   // Hijos; en los átomos {primer argumento, número}
+        };
+
+        // Cada nodo consume al menos un carácter del texto, así que el texto
+        // acota el número de nodos, de argumentos y de nombres. Los nombres
+        // son vistas sobre el propio literal (un objeto estático).
+        template <size_t Capacity>
+        struct FormulaImage
+        {
+            LiteralNode nodes[Capacity]{};
+            NodeId arguments[Capacity]{};
+            std::string_view symbols[Capacity]{};
+            NodeId root = 0;
+        };
+
+        // Huecos de las tablas de nodos y de nombres: potencia de dos con al
+        // menos la mitad libre para cualquier número de nodos que quepa
+        consteval size_t literal_slots(size_t capacity)
+        {
+            size_t slots = 16;
+            while (slots < 2 * capacity)
+                slots *= 2;
+            return slots;
+        }
+
+        // Construye sobre los arrays de una FormulaImage sin depender de su
+        // capacidad. Un nodo igual a otro ya creado devuelve el existente:
+        // nodos y nombres se buscan en dos tablas de direccionamiento
+        // abierto (identificador + 1; 0 es un hueco libre), que viven en la
+        // evaluación y no en la imagen.
+        struct LiteralBuilder
+        {
+            LiteralNode *nodes;
+            NodeId *arguments;
+            std::string_view *symbols;
+            NodeId *node_slots;
+            std::uint32_t *symbol_slots;
+            size_t mask; // Huecos - 1, el mismo en las dos tablas
+            size_t size = 0;
+            size_t argument_count = 0;
+            size_t symbol_count = 0;
+
+            constexpr NodeId variable(std::string_view name) { return push({NodeOp::Variable, false, intern(name), {0, 0}}); }
+            constexpr NodeId constant(std::string_view name) { return push({NodeOp::Constant, false, intern(name), {0, 0}}); }
+
+            constexpr NodeId atom(std::string_view name, std::span<const NodeId> args)
+            {
+                const bool successor = args.size() == 1 && name == operator_symbol<Succ>;
+                return push({NodeOp::Atom, successor, intern(name), {0, static_cast<NodeId>(args.size())}}, args.data());
+            }
+
+            constexpr NodeId unary(NodeOp op, NodeId operand) { return push({op, false, 0, {operand, 0}}); }
+            constexpr NodeId binary(NodeOp op, NodeId left, NodeId right) { return push({op, false, 0, {left, right}}); }
+            constexpr NodeId binder(NodeOp op, std::string_view variable, NodeId body) { return push({op, false, intern(variable), {body, 0}}); }
+
+        private:
+            constexpr std::uint32_t intern(std::string_view name)
+            {
+                // Los mismos nombres reservados que rechaza _var
+                if (name.front() == '#')
+                    throw "Formula_t: los nombres que empiezan por '#' están reservados para las variables ligadas canónicas";
+                size_t slot = fnv1a(name) & mask;
+                for (; symbol_slots[slot] != 0; slot = (slot + 1) & mask)
+                    if (symbols[symbol_slots[slot] - 1] == name)
+                        return symbol_slots[slot] - 1;
+                symbols[symbol_count] = name;
+                symbol_slots[slot] = static_cast<std::uint32_t>(++symbol_count);
+                return static_cast<std::uint32_t>(symbol_count - 1);
+            }
+
+            // En los átomos cuentan los argumentos, no su posición
+            static constexpr std::uint64_t hash(const LiteralNode &node, const NodeId *args)
+            {
+                std::uint64_t hash = HashAlgebra::mix(HashAlgebra::mix(static_cast<std::uint64_t>(node.op), node.symbol), node.operands[1]);
+                if (node.op != NodeOp::Atom)
+                    return HashAlgebra::mix(hash, node.operands[0]);
+                for (NodeId i = 0; i < node.operands[1]; ++i)
+                    hash = HashAlgebra::mix(hash, args[i]);
+                return hash;
+            }
+
+            constexpr bool same(const LiteralNode &node, const LiteralNode &other, const NodeId *args) const
+            {
+                if (node.op != other.op || node.symbol != other.symbol || node.operands[1] != other.operands[1])
+                    return false;
+                if (node.op != NodeOp::Atom)
+                    return node.operands[0] == other.operands[0];
+                for (NodeId i = 0; i < node.operands[1]; ++i)
+                    if (args[i] != arguments[other.operands[0] + i])
+                        return false;
+                return true;
+            }
+
+            constexpr NodeId push(LiteralNode node, const NodeId *args = nullptr)
+            {
+                size_t slot = hash(node, args) & mask;
+                for (; node_slots[slot] != 0; slot = (slot + 1) & mask)
+                    if (same(node, nodes[node_slots[slot] - 1], args))
+                        return node_slots[slot] - 1;
+                if (node.op == NodeOp::Atom)
+                {
+                    node.operands[0] = static_cast<NodeId>(argument_count);
+                    for (NodeId i = 0; i < node.operands[1]; ++i)
+                        arguments[argument_count++] = args[i];
+                }
+                nodes[size] = node;
+                node_slots[slot] = static_cast<NodeId>(++size);
+                return static_cast<NodeId>(size - 1);
+            }
+        };
+
+        // El texto se lee con la gramática de runtime::Parser (la misma
+        // instancia de plantilla para cualquier literal), que construye la
+        // imagen a través de LiteralBuilder. Un error es un error de
+        // compilación cuya traza lleva el motivo.
+        template <FixedString Source>
+        struct ParsedFormula
+        {
+            static constexpr size_t capacity = sizeof(Source.buf);
+            static constexpr FormulaImage<capacity> image = [] {
+                constexpr size_t slots = literal_slots(capacity);
+                FormulaImage<capacity> image;
+                NodeId node_slots[slots]{};
+                std::uint32_t symbol_slots[slots]{};
+                LiteralBuilder builder{image.nodes, image.arguments, image.symbols, node_slots, symbol_slots, slots - 1};
+                image.root = runtime::parse_formula(std::string_view(Source.buf, capacity - 1), builder);
+                return image;
+            }();
+        };
+
+        // Build se indexa con una referencia a la imagen y no con el texto:
+        // comparar argumentos de plantilla cuesta lo mismo para cualquier
+        // longitud del literal.
+        template <const auto &Image, std::uint32_t Symbol>
+        consteval auto symbol_name()
+        {
+            constexpr std::string_view text = Image.symbols[Symbol];
+            char buf[text.size() + 1]{};
+            std::copy_n(text.data(), text.size(), buf);
+            return FixedString<text.size() + 1>(buf);
+        }
+
+        consteval size_t numeral_value(std::string_view digits)
+        {
+            size_t value = 0;
+            for (const char digit : digits)
+                value = value * 10 + static_cast<size_t>(digit - '0');
+            return value;
+        }
+
+        template <NodeOp Op>
+        struct Connective;
+
+        template <>
+        struct Connective<NodeOp::And>
+        {
+            template <typename L, typename R>
+            using apply = And<L, R>;
+        };
+
+        template <>
+        struct Connective<NodeOp::Or>
+        {
+            template <typename L, typename R>
+            using apply = Or<L, R>;
+        };
+
+        template <>
+        struct Connective<NodeOp::Implies>
+        {
+            template <typename L, typename R>
+            using apply = Implies<L, R>;
+        };
+
+        template <>
+        struct Connective<NodeOp::Equiv>
+        {
+            template <typename L, typename R>
+            using apply = Equiv<L, R>;
+        };
+
+        template <>
+        struct Connective<NodeOp::Forall>
+        {
+            template <typename V, typename Body>
+            using apply = Forall<V, Body>;
+        };
+
+        template <>
+        struct Connective<NodeOp::Exists>
+        {
+            template <typename V, typename Body>
+            using apply = Exists<V, Body>;
+        };
+
+        // Term indica posición de término (argumento de un átomo)
+        template <const auto &Image, NodeId Id, bool Term = false, NodeOp Op = Image.nodes[Id].op>
+        struct Build
+        {
+            static_assert(Term, "ERROR: un término no es una fórmula.");
+        };
+
+        template <const auto &Image, NodeId Id, bool Successor, typename = std::make_index_sequence<Image.nodes[Id].operands[1]>>
+        struct BuildAtom;
+
+        template <const auto &Image, NodeId Id, size_t... Is>
+        struct BuildAtom<Image, Id, false, std::index_sequence<Is...>>
+        {
+            using type = Predicate<symbol_name<Image, Image.nodes[Id].symbol>(),
+                                   typename Build<Image, Image.arguments[Image.nodes[Id].operands[0] + Is], true>::type...>;
+        };
+
+        template <const auto &Image, NodeId Id>
+        struct BuildAtom<Image, Id, true, std::index_sequence<0>>
+        {
+            using type = Succ<typename Build<Image, Image.arguments[Image.nodes[Id].operands[0]], true>::type>;
+        };
+
+        template <const auto &Image, NodeId Id, bool Term>
+        struct Build<Image, Id, Term, NodeOp::Atom> : BuildAtom<Image, Id, Term && Image.nodes[Id].successor>
+        {
+        };
+
+        template <const auto &Image, NodeId Id>
+        struct Build<Image, Id, true, NodeOp::Variable>
+        {
+            using type = Var<symbol_name<Image, Image.nodes[Id].symbol>()>;
+        };
+
+        template <const auto &Image, NodeId Id>
+        struct Build<Image, Id, true, NodeOp::Constant>
+        {
+            using type = Natural<numeral_value(Image.symbols[Image.nodes[Id].symbol])>;
+        };
+
+        template <const auto &Image, NodeId Id>
+        struct Build<Image, Id, false, NodeOp::Not>
+        {
+            using type = Not<typename Build<Image, Image.nodes[Id].operands[0]>::type>;
+        };
+
+        template <const auto &Image, NodeId Id, NodeOp Op>
+            requires(runtime::arity(Op) == 2)
+        struct Build<Image, Id, false, Op>
+        {
+            using type = typename Connective<Op>::template apply<typename Build<Image, Image.nodes[Id].operands[0]>::type,
+                                                                 typename Build<Image, Image.nodes[Id].operands[1]>::type>;
+        };
+
+        template <const auto &Image, NodeId Id, NodeOp Op>
+            requires(runtime::is_binder(Op))
+        struct Build<Image, Id, false, Op>
+        {
+            using type = typename Connective<Op>::template apply<Var<symbol_name<Image, Image.nodes[Id].symbol>()>,
+                                                                 typename Build<Image, Image.nodes[Id].operands[0]>::type>;
+        };
+    } // namespace detail
+
+    template <FixedString Source>
+    using Formula_t = typename detail::Build<detail::ParsedFormula<Source>::image, detail::ParsedFormula<Source>::image.root>::type;
+
+    // "forall n. Natural(n) -> Natural(S(n))"_formula, para usarlo como el DSL
+    template <FixedString Source>
+    constexpr auto operator""_formula()
+    {
+        return Formula_t<Source>{};
+    }
+
+} // namespace logic
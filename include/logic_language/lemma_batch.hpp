@@ -0,0 +1,622 @@
+#pragma once
+
+#include "proof_checker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace logic::runtime
+{
+
+    // =========================================================
+    // === PARALLEL LEMMA CHECKING (Work Stealing) ===
+    // =========================================================
+    //
+    // Una biblioteca de lemas (como lean_bridge::TheoremLibrary o los
+    // teoremas de peano/) es un DAG: cada lema se apoya en axiomas y en
+    // otros lemas. LemmaLibrary guarda cada lema como un enunciado y su
+    // certificado; check() deduce el DAG de las hipótesis que asume cada
+    // certificado y comprueba los lemas en varios hilos. Un lema entra en la
+    // cola en cuanto terminan todas sus dependencias, en la del hilo que
+    // terminó la última (sus fórmulas aún están en su caché), y los hilos
+    // sin trabajo lo roban de las colas de los demás. El informe da la
+    // latencia de cada lema y el tiempo total, para compararlo con una
+    // ejecución en un solo hilo.
+    //
+    // Con una LemmaCache la comprobación es incremental: cada lema tiene una
+    // clave estructural (enunciado, pasos del certificado y de qué tipo es
+    // cada hipótesis) y los lemas válidos cuya clave ya estaba en la caché
+    // no se vuelven a comprobar. La caché se guarda en disco entre
+    // ejecuciones.
+
+    // --- Reparto de tareas ---
+    // Una cola por hilo: su dueño saca por detrás (lo último que encoló) y
+    // los demás roban por delante (lo más antiguo). run() termina cuando no
+    // queda ninguna tarea pendiente, incluidas las que encolan las propias
+    // tareas con push(). Un hilo sin nada que robar se duerme en epoch_
+    // hasta que llega una tarea o termina la última. Con un hilo todo se
+    // ejecuta en el que llama.
+    class WorkStealingPool
+    {
+    public:
+        explicit WorkStealingPool(size_t threads = std::thread::hardware_concurrency())
+            : queues_(std::max<size_t>(threads, 1))
+        {
+        }
+
+        size_t size() const { return queues_.size(); }
+
+        // body(task, worker) para cada tarea; una excepción de body se
+        // relanza al final, cuando han terminado todas las demás
+        template <typename Body>
+        void run(std::span<const std::uint32_t> tasks, Body body)
+        {
+            for (size_t i = 0; i < tasks.size(); ++i)
+                push(i % size(), tasks[i]);
+
+            if (size() == 1)
+                work(0, body);
+            else
+            {
+                std::vector<std::jthread> workers;
+                for (size_t worker = 1; worker < size(); ++worker)
+                    workers.emplace_back([this, worker, &body] { work(worker, body); });
+                work(0, body);
+            }
+            if (error_)
+                std::rethrow_exception(std::exchange(error_, nullptr));
+        }
+
+        // Encola una tarea en la cola del hilo `worker`
+        void push(size_t worker, std::uint32_t task)
+        {
+            pending_.fetch_add(1, std::memory_order_relaxed);
+            Queue &queue = queues_[worker];
+            {
+                std::lock_guard lock(queue.mutex);
+                queue.tasks.push_back(task);
+            }
+            wake();
+        }
+
+    private:
+        struct alignas(64) Queue
+        {
+            std::mutex mutex;
+            std::deque<std::uint32_t> tasks;
+        };
+
+        bool take(size_t worker, std::uint32_t &task)
+        {
+            {
+                Queue &own = queues_[worker];
+                std::lock_guard lock(own.mutex);
+                if (!own.tasks.empty())
+                {
+                    task = own.tasks.back();
+                    own.tasks.pop_back();
+                    return true;
+                }
+            }
+            for (size_t i = 1; i < size(); ++i)
+            {
+                Queue &victim = queues_[(worker + i) % size()];
+                std::lock_guard lock(victim.mutex);
+                if (!victim.tasks.empty())
+                {
+                    task = victim.tasks.front();
+                    victim.tasks.pop_front();
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        void wake()
+        {
+            epoch_.fetch_add(1, std::memory_order_release);
+            epoch_.notify_all();
+        }
+
+        template <typename Body>
+        void work(size_t worker, Body &body)
+        {
+            std::uint32_t task;
+            while (true)
+            {
+                // epoch_ se lee antes de buscar: un push() o el final que
+                // llegan después lo cambian y wait() no se queda dormido
+                const std::uint64_t epoch = epoch_.load(std::memory_order_acquire);
+                if (pending_.load(std::memory_order_acquire) == 0)
+                    break;
+                if (!take(worker, task))
+                {
+                    epoch_.wait(epoch, std::memory_order_acquire);
+                    continue;
+                }
+                try
+                {
+                    body(task, worker);
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(error_mutex_);
+                    if (!error_)
+                        error_ = std::current_exception();
+                }
+                if (pending_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    wake();
+            }
+        }
+
+        std::vector<Queue> queues_;
+        std::atomic<size_t> pending_{0};
+        std::atomic<std::uint64_t> epoch_{0};
+        std::mutex error_mutex_;
+        std::exception_ptr error_;
+    };
+
+    // --- Claves de la caché ---
+    // Resumen de 128 bits en dos carriles independientes (el finalizador de
+    // splitmix64). El hash de los nodos del TermStore es de 64 bits y basta
+    // para las tablas; una clave de la caché que coincida por accidente se
+    // salta una comprobación, así que aquí se usa uno más ancho. No está
+    // pensado contra colisiones buscadas a propósito.
+    struct Digest
+    {
+        std::uint64_t low = 0x6a09e667f3bcc908ull;
+        std::uint64_t high = 0xbb67ae8584caa73bull;
+
+        Digest &add(std::uint64_t value)
+        {
+            low = avalanche(low ^ value);
+            high = avalanche(high + std::rotl(value, 32) + 0x9e3779b97f4a7c15ull);
+            return *this;
+        }
+
+        Digest &add(const Digest &digest) { return add(digest.low).add(digest.high); }
+
+        Digest &add(std::string_view text)
+        {
+            add(text.size());
+            for (size_t i = 0; i < text.size(); i += 8)
+            {
+                std::uint64_t word = 0;
+                std::memcpy(&word, text.data() + i, std::min<size_t>(8, text.size() - i));
+                add(word);
+            }
+            return *this;
+        }
+
+        bool operator==(const Digest &) const = default;
+
+        struct Hasher
+        {
+            size_t operator()(const Digest &digest) const { return static_cast<size_t>(digest.low); }
+        };
+
+    private:
+        static std::uint64_t avalanche(std::uint64_t x)
+        {
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+            return x ^ (x >> 31);
+        }
+    };
+
+    namespace detail
+    {
+        // Resúmenes ya calculados de las fórmulas de un lema: direccionamiento
+        // abierto sobre un vector que se reutiliza de un lema a otro (reset()
+        // solo cambia de generación), porque casi todos los nodos de un lema
+        // son suyos y una tabla para todo el lote no cabría en caché
+        class DigestMemo
+        {
+        public:
+            void reset()
+            {
+                used_ = 0;
+                if (++generation_ == 0)
+                {
+                    std::ranges::fill(slots_, Slot{});
+                    generation_ = 1;
+                }
+            }
+
+            const Digest *find(NodeId id) const
+            {
+                if (slots_.empty())
+                    return nullptr;
+                for (size_t i = index(id);; i = (i + 1) & (slots_.size() - 1))
+                {
+                    const Slot &slot = slots_[i];
+                    if (slot.generation != generation_)
+                        return nullptr;
+                    if (slot.id == id)
+                        return &slot.digest;
+                }
+            }
+
+            void insert(NodeId id, const Digest &digest)
+            {
+                if (2 * (used_ + 1) > slots_.size())
+                    grow();
+                size_t i = index(id);
+                while (slots_[i].generation == generation_)
+                    i = (i + 1) & (slots_.size() - 1);
+                slots_[i] = {id, generation_, digest};
+                ++used_;
+            }
+
+        private:
+            struct Slot
+            {
+                NodeId id = 0;
+                std::uint32_t generation = 0;
+                Digest digest;
+            };
+
+            size_t index(NodeId id) const { return static_cast<size_t>((id * 0x9e3779b97f4a7c15ull) >> (64 - std::countr_zero(slots_.size()))); }
+
+            void grow()
+            {
+                std::vector<Slot> old = std::exchange(slots_, std::vector<Slot>(std::max<size_t>(64, 2 * slots_.size())));
+                const std::uint32_t generation = std::exchange(generation_, 1);
+                used_ = 0;
+                for (const Slot &slot : old)
+                    if (slot.generation == generation)
+                        insert(slot.id, slot.digest);
+            }
+
+            std::vector<Slot> slots_;
+            size_t used_ = 0;
+            std::uint32_t generation_ = 1;
+        };
+    } // namespace detail
+
+    // --- Caché de lemas comprobados ---
+    // Las claves de los lemas válidos de la última comprobación. Un fichero
+    // que falta, está truncado o es de otra versión se trata como una caché
+    // vacía: como mucho obliga a comprobarlo todo de nuevo. save() escribe
+    // en un temporal y lo renombra, así que una ejecución interrumpida no
+    // deja un fichero a medias.
+    class LemmaCache
+    {
+    public:
+        LemmaCache() = default; // Solo en memoria
+        explicit LemmaCache(std::string path) : path_(std::move(path)) { load(); }
+
+        bool contains(const Digest &key) const { return keys_.contains(key); }
+        void insert(const Digest &key) { keys_.insert(key); }
+        void clear() { keys_.clear(); }
+        size_t size() const { return keys_.size(); }
+
+        void save() const
+        {
+            if (path_.empty())
+                throw std::logic_error("LemmaCache::save: caché sin fichero");
+            const std::string temporary = path_ + ".tmp";
+            {
+                std::ofstream out(temporary, std::ios::binary | std::ios::trunc);
+                Header header{{}, version, keys_.size()};
+                std::memcpy(header.magic, magic, sizeof(header.magic));
+                out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+                for (const Digest &key : keys_)
+                    out.write(reinterpret_cast<const char *>(&key), sizeof(key));
+                if (!out.flush())
+                    throw std::runtime_error("LemmaCache::save: no se puede escribir " + temporary);
+            }
+            std::filesystem::rename(temporary, path_);
+        }
+
+    private:
+        static constexpr char magic[8] = {'L', 'O', 'G', 'I', 'C', 'C', 'H', 'K'};
+        static constexpr std::uint64_t version = 1;
+
+        struct Header
+        {
+            char magic[8];
+            std::uint64_t version;
+            std::uint64_t count;
+        };
+
+        void load()
+        {
+            std::ifstream in(path_, std::ios::binary);
+            Header header{};
+            if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) || std::memcmp(header.magic, magic, sizeof(magic)) != 0 ||
+                header.version != version)
+                return;
+            // Una cuenta que no cabe en lo que queda del fichero (truncado o
+            // corrupto) no reserva nada: la caché empieza vacía
+            std::error_code error;
+            const std::uintmax_t size = std::filesystem::file_size(path_, error);
+            if (error || size < sizeof(header) || header.count > (size - sizeof(header)) / sizeof(Digest))
+                return;
+            std::vector<Digest> keys(header.count);
+            if (!in.read(reinterpret_cast<char *>(keys.data()), static_cast<std::streamsize>(keys.size() * sizeof(Digest))))
+                return;
+            keys_.insert(keys.begin(), keys.end());
+        }
+
+        std::string path_;
+        std::unordered_set<Digest, Digest::Hasher> keys_;
+    };
+
+    // --- Biblioteca de lemas ---
+    enum class LemmaStatus : std::uint8_t
+    {
+        Valid,
+        Invalid,  // El certificado falla o no demuestra el enunciado
+        Skipped,  // Depende de un lema que no es válido
+        Circular  // Forma parte de un ciclo de dependencias (o depende de uno)
+    };
+
+    struct LemmaResult
+    {
+        LemmaStatus status = LemmaStatus::Circular;
+        std::string message;
+        std::vector<std::uint32_t> dependencies; // Lemas cuyos enunciados asume
+        Digest key;                              // Solo si se comprobó con una caché
+        bool cached = false;                     // Válido por la caché, sin comprobarlo
+        // Segundos desde el inicio de check(): listo (dependencias
+        // terminadas), empieza y termina su comprobación
+        double ready = 0;
+        double start = 0;
+        double finish = 0;
+
+        double latency() const { return finish - start; }
+    };
+
+    struct BatchReport
+    {
+        std::vector<LemmaResult> lemmas;
+        double seconds = 0; // Tiempo de pared de todo el lote
+        size_t threads = 1;
+
+        size_t count(LemmaStatus status) const
+        {
+            return static_cast<size_t>(std::ranges::count(lemmas, status, &LemmaResult::status));
+        }
+
+        size_t cached() const { return static_cast<size_t>(std::ranges::count(lemmas, true, &LemmaResult::cached)); }
+    };
+
+    class LemmaLibrary
+    {
+    public:
+        explicit LemmaLibrary(TermStore &store) : store_(store) {}
+
+        // Fórmula que los lemas pueden asumir sin demostrarla
+        void axiom(NodeId formula) { axioms_.insert(formula); }
+
+        // El certificado debe concluir el enunciado; sus hipótesis solo
+        // pueden ser axiomas o enunciados de otros lemas
+        std::uint32_t add(std::string name, NodeId statement, ProofCertificate certificate)
+        {
+            lemmas_.push_back({std::move(name), statement, std::move(certificate)});
+            return static_cast<std::uint32_t>(lemmas_.size() - 1);
+        }
+
+        // Un lema escrito con las macros del kernel (LOGIC_TRACE_PROOFS): su
+        // enunciado es la conclusión del teorema
+        template <typename Thm, typename Proof>
+        std::uint32_t add(std::string name, Traced<Thm, Proof> theorem)
+        {
+            ProofCertificate certificate;
+            ProofExporter(store_, certificate).add(theorem);
+            return add(std::move(name), reify<typename Thm::formula_type>(store_), std::move(certificate));
+        }
+
+        size_t size() const { return lemmas_.size(); }
+        const std::string &name(std::uint32_t lemma) const { return lemmas_[lemma].name; }
+
+        BatchReport check(size_t threads = std::thread::hardware_concurrency()) const { return run(threads, nullptr); }
+
+        // Comprobación incremental: se salta los lemas cuya clave está en la
+        // caché y al terminar la deja con las claves de los lemas válidos.
+        // Un lema cuya dependencia deja de ser válida se omite aunque su
+        // clave esté en la caché; uno cuya dependencia cambia de demostración
+        // pero no de enunciado no se vuelve a comprobar.
+        BatchReport check(LemmaCache &cache, size_t threads = std::thread::hardware_concurrency()) const
+        {
+            BatchReport report = run(threads, &cache);
+            cache.clear();
+            for (const LemmaResult &result : report.lemmas)
+                if (result.status == LemmaStatus::Valid)
+                    cache.insert(result.key);
+            return report;
+        }
+
+    private:
+        struct Lemma
+        {
+            std::string name;
+            NodeId statement;
+            ProofCertificate certificate;
+        };
+
+        // Estado de cada hilo: su comprobador y los resúmenes de las
+        // fórmulas del lema que está comprobando
+        struct Worker
+        {
+            explicit Worker(TermStore &store) : checker(store) {}
+
+            ProofChecker checker;
+            detail::DigestMemo digests;
+        };
+
+        BatchReport run(size_t threads, const LemmaCache *cache) const
+        {
+            using clock = std::chrono::steady_clock;
+            const auto begin = clock::now();
+            auto now = [&] { return std::chrono::duration<double>(clock::now() - begin).count(); };
+
+            // El DAG: cada hipótesis asumida que es el enunciado de otro lema
+            // (y no un axioma) es una arista
+            std::unordered_map<NodeId, std::uint32_t> statements;
+            for (std::uint32_t lemma = 0; lemma < lemmas_.size(); ++lemma)
+                statements.emplace(lemmas_[lemma].statement, lemma);
+
+            BatchReport report{std::vector<LemmaResult>(lemmas_.size()), 0, 0};
+            std::vector<std::vector<std::uint32_t>> dependents(lemmas_.size());
+            auto remaining = std::make_unique<std::atomic<std::uint32_t>[]>(lemmas_.size());
+            std::vector<std::uint32_t> ready;
+            for (std::uint32_t lemma = 0; lemma < lemmas_.size(); ++lemma)
+            {
+                std::vector<std::uint32_t> &dependencies = report.lemmas[lemma].dependencies;
+                for (const ProofStep &step : lemmas_[lemma].certificate.steps())
+                    if (step.rule == Rule::Assume && !axioms_.contains(step.formula))
+                        if (const auto found = statements.find(step.formula); found != statements.end())
+                            dependencies.push_back(found->second);
+                std::ranges::sort(dependencies);
+                const auto [first, last] = std::ranges::unique(dependencies);
+                dependencies.erase(first, last);
+
+                for (std::uint32_t dependency : dependencies)
+                    dependents[dependency].push_back(lemma);
+                remaining[lemma].store(static_cast<std::uint32_t>(dependencies.size()), std::memory_order_relaxed);
+                if (dependencies.empty())
+                    ready.push_back(lemma);
+            }
+
+            WorkStealingPool pool(threads);
+            // Resumen del enunciado de cada lema con clave, para las claves
+            // de los que dependen de él
+            std::vector<Digest> statements_digest(cache ? lemmas_.size() : 0);
+            std::vector<Worker> workers;
+            workers.reserve(pool.size());
+            for (size_t worker = 0; worker < pool.size(); ++worker)
+                workers.emplace_back(store_);
+
+            pool.run(ready, [&](std::uint32_t lemma, size_t worker) {
+                LemmaResult &result = report.lemmas[lemma];
+                result.start = now();
+                verify(lemma, workers[worker], report, cache, statements_digest);
+                result.finish = now();
+                for (std::uint32_t dependent : dependents[lemma])
+                    if (remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    {
+                        report.lemmas[dependent].ready = result.finish;
+                        pool.push(worker, dependent);
+                    }
+            });
+
+            // Los lemas que nunca estuvieron listos están en un ciclo o
+            // dependen de uno
+            for (LemmaResult &result : report.lemmas)
+                if (result.status == LemmaStatus::Circular)
+                    result.message = "dependencia circular";
+            report.seconds = now();
+            report.threads = pool.size();
+            return report;
+        }
+
+        void verify(std::uint32_t lemma, Worker &worker, BatchReport &report, const LemmaCache *cache, std::span<Digest> statements) const
+        {
+            LemmaResult &result = report.lemmas[lemma];
+            for (std::uint32_t dependency : result.dependencies)
+                if (report.lemmas[dependency].status != LemmaStatus::Valid)
+                {
+                    result.status = LemmaStatus::Skipped;
+                    result.message = "depende de " + lemmas_[dependency].name + ", que no es válido";
+                    return;
+                }
+
+            if (cache)
+            {
+                result.key = key(lemma, worker, result.dependencies, statements);
+                if (cache->contains(result.key))
+                {
+                    result.status = LemmaStatus::Valid;
+                    result.cached = true;
+                    return;
+                }
+            }
+
+            try
+            {
+                const CheckedTheorem theorem = worker.checker.check(lemmas_[lemma].certificate);
+                if (theorem.formula != lemmas_[lemma].statement)
+                    throw std::runtime_error("la conclusión no es el enunciado: " + store_.text(theorem.formula));
+                for (NodeId hypothesis : theorem.context)
+                    if (!axioms_.contains(hypothesis) &&
+                        !std::ranges::any_of(result.dependencies, [&](std::uint32_t d) { return lemmas_[d].statement == hypothesis; }))
+                        throw std::runtime_error("hipótesis sin justificar: " + store_.text(hypothesis));
+                result.status = LemmaStatus::Valid;
+            }
+            catch (const std::exception &error)
+            {
+                result.status = LemmaStatus::Invalid;
+                result.message = error.what();
+            }
+        }
+
+        // La clave de un lema: su enunciado, cada paso del certificado y, por
+        // cada hipótesis, si es un axioma, el enunciado de una dependencia o
+        // ninguna de las dos. Es todo lo que decide verify() salvo la validez
+        // de las dependencias, que se mira en cada ejecución.
+        Digest key(std::uint32_t lemma, Worker &worker, std::span<const std::uint32_t> dependencies, std::span<Digest> statements) const
+        {
+            enum : std::uint64_t { axiom, dependency, unjustified };
+            worker.digests.reset();
+            for (std::uint32_t d : dependencies)
+                worker.digests.insert(lemmas_[d].statement, statements[d]);
+            statements[lemma] = digest(lemmas_[lemma].statement, worker);
+
+            Digest key;
+            key.add(statements[lemma]);
+            for (const ProofStep &step : lemmas_[lemma].certificate.steps())
+            {
+                key.add(static_cast<std::uint64_t>(step.rule)).add(step.premises[0]).add(step.premises[1]);
+                if (step.rule == Rule::ModusPonens)
+                    continue;
+                key.add(digest(step.formula, worker));
+                if (step.rule == Rule::Assume)
+                    key.add(axioms_.contains(step.formula) ? axiom
+                            : std::ranges::any_of(dependencies, [&](std::uint32_t d) { return lemmas_[d].statement == step.formula; })
+                                ? dependency
+                                : unjustified);
+            }
+            return key;
+        }
+
+        // Resumen estructural de una fórmula: operador, nombre y los
+        // resúmenes de sus hijos (no depende de los NodeId, que cambian de
+        // una ejecución a otra)
+        Digest digest(NodeId id, Worker &worker) const
+        {
+            if (const Digest *found = worker.digests.find(id))
+                return *found;
+            const Node &node = store_[id];
+            Digest digest;
+            digest.add(static_cast<std::uint64_t>(node.op));
+            if (node.symbol != SymbolTable::npos)
+                digest.add(store_.symbols().name(node.symbol));
+            for (const NodeId child : store_.children(id))
+                digest.add(this->digest(child, worker));
+            worker.digests.insert(id, digest);
+            return digest;
+        }
+
+        TermStore &store_;
+        std::unordered_set<NodeId> axioms_;
+        std::vector<Lemma> lemmas_;
+    };
+
+} // namespace logic::runtime
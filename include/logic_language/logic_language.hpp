@@ -4,7 +4,12 @@
 #include <concepts>
 #include <tuple>
 #include <cstddef>
+#include <cstdint>
 #include <algorithm>
+#include <array>
+#include <initializer_list>
+#include <string_view>
+#include <utility>
 
 namespace logic
 {
@@ -26,6 +31,20 @@ namespace logic
     template <size_t N>
     FixedString(const char (&)[N]) -> FixedString<N>;
 
+    namespace detail
+    {
+        // Concatenación de textos en tiempo de compilación
+        template <size_t... Ns>
+        consteval auto concat(const FixedString<Ns> &...parts)
+        {
+            constexpr size_t size = (Ns + ... + 1) - sizeof...(Ns);
+            char buf[size]{};
+            size_t pos = 0;
+            ((std::copy_n(parts.buf, Ns - 1, buf + pos), pos += Ns - 1), ...);
+            return FixedString<size>(buf);
+        }
+    } // namespace detail
+
     template <typename T>
     concept LogicExpression = requires { typename T::IsLogicExpression; };
 
@@ -34,24 +53,92 @@ namespace logic
         using IsLogicExpression = void;
     };
 
+    // --- 0. SÍMBOLOS ---
+    // Los nombres de variables y predicados viajan dentro del tipo como un
+    // símbolo. Por defecto el símbolo es el propio FixedString. Con
+    // LOGIC_COMPACT_NAMES los nombres de hasta 8 caracteres se empaquetan en un
+    // entero (un byte por carácter): el nombre decorado de Var<"n"> pasa de
+    // codificar un FixedString carácter a carácter a un único literal entero,
+    // y lo mismo ocurre en la información de depuración de cada fórmula que lo
+    // contiene. La macro debe tener el mismo valor en todas las unidades de
+    // traducción de un programa.
+#ifndef LOGIC_COMPACT_NAMES
+#define LOGIC_COMPACT_NAMES 0
+#endif
+
+    namespace detail
+    {
+        template <size_t N>
+        consteval auto intern(const FixedString<N> &name)
+        {
+            if constexpr (LOGIC_COMPACT_NAMES && N - 1 <= sizeof(std::uint64_t))
+            {
+                std::uint64_t code = 0;
+                for (size_t i = 0; i + 1 < N; ++i)
+                    code |= std::uint64_t{static_cast<unsigned char>(name.buf[i])} << (8 * i);
+                return code;
+            }
+            else
+                return name;
+        }
+
+        consteval size_t packed_length(std::uint64_t code)
+        {
+            size_t n = 0;
+            for (; code != 0; code >>= 8)
+                ++n;
+            return n;
+        }
+
+        // Tabla inversa: el texto de un símbolo, para imprimir y para derivar
+        // nombres nuevos (x -> x')
+        template <auto Sym>
+        consteval auto symbol_text()
+        {
+            if constexpr (std::is_integral_v<decltype(Sym)>)
+            {
+                char buf[packed_length(Sym) + 1]{};
+                for (size_t i = 0; i < packed_length(Sym); ++i)
+                    buf[i] = static_cast<char>((Sym >> (8 * i)) & 0xFF);
+                return FixedString<packed_length(Sym) + 1>(buf);
+            }
+            else
+                return Sym;
+        }
+    } // namespace detail
+
     // --- 1. VARIABLES ---
-    template <FixedString Name>
-    struct Var : ExpressionBase
+    template <auto Sym>
+    struct Variable : ExpressionBase
     {
-        static constexpr auto name = Name;
-        using Type = Var<Name>;
+        static constexpr auto name = detail::symbol_text<Sym>();
+        using Type = Variable<Sym>;
     };
 
+    template <FixedString Name>
+    using Var = Variable<detail::intern(Name)>;
+
     template <FixedString S>
-    constexpr auto operator""_var() { return Var<S>{}; }
+    constexpr auto operator""_var()
+    {
+        static_assert(S.buf[0] != '#', "ERROR: los nombres que empiezan por '#' están reservados para las variables ligadas canónicas.");
+        return Var<S>{};
+    }
 
     // --- 2. PREDICADOS ---
-    template <FixedString Name, typename... Args>
-    struct Predicate : ExpressionBase
+    template <auto Sym, typename... Args>
+    struct Atom : ExpressionBase
     {
-        static constexpr auto name = Name;
+        static constexpr auto name = detail::symbol_text<Sym>();
     };
 
+    template <FixedString Name, typename... Args>
+    using Predicate = Atom<detail::intern(Name), Args...>;
+
+    // Nombre legible de una variable o predicado
+    template <typename T>
+    constexpr std::string_view name_of = std::string_view(T::name.buf, sizeof(T::name.buf) - 1);
+
     // --- 3. OPERADORES ---
     template <typename T>
     struct Not : ExpressionBase
@@ -102,6 +189,10 @@ namespace logic
         using Formula = Body;
     };
 
+    // Contenedor de tipos (definido en CONTEXT MANAGEMENT)
+    template <typename... Ts>
+    struct TypeList;
+
     // --- CONSTRUCTORES ---
     template <LogicExpression L, LogicExpression R>
     constexpr auto operator&&(L, R) { return And<L, R>{}; }
@@ -114,11 +205,71 @@ namespace logic
     template <LogicExpression T>
     constexpr auto operator!(T) { return Not<T>{}; }
 
-    template <typename V, typename Func>
-    constexpr auto forall(V var, Func f)
+    namespace detail
+    {
+        template <typename T>
+        inline constexpr bool is_var = false;
+
+        template <auto Sym>
+        inline constexpr bool is_var<Variable<Sym>> = true;
+
+        // El cuerpo es una fórmula o una función de las variables ligadas
+        template <typename Body, typename... Vs>
+        struct BinderBody
+        {
+            using type = decltype(std::declval<Body>()(Vs{}...));
+        };
+
+        template <LogicExpression Body, typename... Vs>
+        struct BinderBody<Body, Vs...>
+        {
+            using type = Body;
+        };
+
+        // Q<V1, Q<V2, ... Q<Vn, Body>>> sin pasar por un constructor por nivel
+        template <template <typename, typename> class Q, typename Body, typename... Vs>
+        struct Nest
+        {
+            using type = Body;
+        };
+
+        template <template <typename, typename> class Q, typename Body, typename V, typename... Vs>
+        struct Nest<Q, Body, V, Vs...>
+        {
+            using type = Q<V, typename Nest<Q, Body, Vs...>::type>;
+        };
+
+        // Separa las variables (todos los argumentos salvo el último) del cuerpo
+        template <template <typename, typename> class Q, typename Vars, typename... Args>
+        struct Bind;
+
+        template <template <typename, typename> class Q, typename... Vs, typename Body>
+        struct Bind<Q, TypeList<Vs...>, Body>
+        {
+            static_assert((is_var<Vs> && ...), "ERROR: forall/exists solo pueden ligar variables (Var).");
+            using type = typename Nest<Q, typename BinderBody<Body, Vs...>::type, Vs...>::type;
+        };
+
+        template <template <typename, typename> class Q, typename... Vs, typename V, typename Next, typename... Rest>
+        struct Bind<Q, TypeList<Vs...>, V, Next, Rest...> : Bind<Q, TypeList<Vs..., V>, Next, Rest...>
+        {
+        };
+    } // namespace detail
+
+    // forall(x, y, ..., cuerpo) = ∀x. ∀y. ... cuerpo
+    template <typename... Args>
+        requires(sizeof...(Args) >= 2)
+    constexpr auto forall(Args...)
     {
-        using BodyType = decltype(f(var));
-        return Forall<V, BodyType>{};
+        return typename detail::Bind<Forall, TypeList<>, Args...>::type{};
+    }
+
+    // exists(x, y, ..., cuerpo) = ∃x. ∃y. ... cuerpo
+    template <typename... Args>
+        requires(sizeof...(Args) >= 2)
+    constexpr auto exists(Args...)
+    {
+        return typename detail::Bind<Exists, TypeList<>, Args...>::type{};
     }
 
     template <typename... Args>
@@ -127,115 +278,1521 @@ namespace logic
     constexpr auto Q(Args... args) { return Predicate<"Q", Args...>{}; }
 
     // =========================================================
-    // === SUBSTITUTION ENGINE (Metaprogramming) ===
+    // === CONTEXT MANAGEMENT (TypeList Ops) ===
     // =========================================================
 
-    template <typename Node, typename Target, typename Replacement>
-    struct Substitute;
+    // Contenedor básico de hipótesis
+    template <typename... Ts>
+    struct TypeList
+    {
+        static constexpr size_t size = sizeof...(Ts);
+    };
 
-    template <typename Node, typename Target, typename Replacement>
-    using Substitute_t = typename Substitute<Node, Target, Replacement>::type;
+    // --- Concat (Unión de contextos) ---
+    template <typename List1, typename List2>
+    struct ConcatLists;
 
-    // 1. Caso Var
-    template <auto N, typename Target, typename Replacement>
-    struct Substitute<Var<N>, Target, Replacement>
+    template <typename... As, typename... Bs>
+    struct ConcatLists<TypeList<As...>, TypeList<Bs...>>
+    {
+        using type = TypeList<As..., Bs...>;
+    };
+
+    // --- Remove (Para descargar hipótesis) ---
+    // Elimina TODAS las ocurrencias del tipo T de la lista.
+    //
+    // La versión recursiva elemento a elemento costaba N instanciaciones
+    // anidadas (chocaba con -ftemplate-depth en contextos de ~900 hipótesis)
+    // y reconstruía la lista en cada paso: O(N²) argumentos de plantilla.
+    // Aquí cada elemento se convierte en TypeList<> o TypeList<T> (Keep) con
+    // una sola expansión de pack, y las listas se concatenan en bloques de 64
+    // por especialización (ConcatBlocks):
+    //   - profundidad de instanciación ⌈N/64⌉ en lugar de N,
+    //   - cada bloque se une a la cola ya concatenada en un único paso
+    //     (FlatConcat), sin recursión.
+    // Se evita a propósito un fold (is_same_v<T, Ts> || ...) sobre toda la
+    // lista: GCC lo evalúa como un árbol de N niveles y domina el coste.
+    namespace detail
+    {
+        template <typename Target, typename T>
+        using Keep = std::conditional_t<std::is_same_v<Target, T>, TypeList<>, TypeList<T>>;
+
+        // Concatenación recursiva para el último bloque (menos de 64 listas)
+        template <typename... Lists>
+        struct ConcatAll;
+
+        template <typename... Ts>
+        struct ConcatAll<TypeList<Ts...>>
+        {
+            using type = TypeList<Ts...>;
+        };
+
+        template <typename... As, typename... Bs, typename... Rest>
+        struct ConcatAll<TypeList<As...>, TypeList<Bs...>, Rest...>
+            : ConcatAll<TypeList<As..., Bs...>, Rest...>
+        {
+        };
+
+        // Concatena 64 listas de un bloque y la cola en un solo paso
+        template <typename... Lists>
+        struct FlatConcat;
+
+        template <typename... A0, typename... A1, typename... A2, typename... A3, typename... A4, typename... A5, typename... A6, typename... A7,
+                  typename... A8, typename... A9, typename... A10, typename... A11, typename... A12, typename... A13, typename... A14, typename... A15,
+                  typename... A16, typename... A17, typename... A18, typename... A19, typename... A20, typename... A21, typename... A22, typename... A23,
+                  typename... A24, typename... A25, typename... A26, typename... A27, typename... A28, typename... A29, typename... A30, typename... A31,
+                  typename... A32, typename... A33, typename... A34, typename... A35, typename... A36, typename... A37, typename... A38, typename... A39,
+                  typename... A40, typename... A41, typename... A42, typename... A43, typename... A44, typename... A45, typename... A46, typename... A47,
+                  typename... A48, typename... A49, typename... A50, typename... A51, typename... A52, typename... A53, typename... A54, typename... A55,
+                  typename... A56, typename... A57, typename... A58, typename... A59, typename... A60, typename... A61, typename... A62, typename... A63,
+                  typename... Tail>
+        struct FlatConcat<TypeList<A0...>, TypeList<A1...>, TypeList<A2...>, TypeList<A3...>, TypeList<A4...>, TypeList<A5...>, TypeList<A6...>, TypeList<A7...>,
+                          TypeList<A8...>, TypeList<A9...>, TypeList<A10...>, TypeList<A11...>, TypeList<A12...>, TypeList<A13...>, TypeList<A14...>, TypeList<A15...>,
+                          TypeList<A16...>, TypeList<A17...>, TypeList<A18...>, TypeList<A19...>, TypeList<A20...>, TypeList<A21...>, TypeList<A22...>, TypeList<A23...>,
+                          TypeList<A24...>, TypeList<A25...>, TypeList<A26...>, TypeList<A27...>, TypeList<A28...>, TypeList<A29...>, TypeList<A30...>, TypeList<A31...>,
+                          TypeList<A32...>, TypeList<A33...>, TypeList<A34...>, TypeList<A35...>, TypeList<A36...>, TypeList<A37...>, TypeList<A38...>, TypeList<A39...>,
+                          TypeList<A40...>, TypeList<A41...>, TypeList<A42...>, TypeList<A43...>, TypeList<A44...>, TypeList<A45...>, TypeList<A46...>, TypeList<A47...>,
+                          TypeList<A48...>, TypeList<A49...>, TypeList<A50...>, TypeList<A51...>, TypeList<A52...>, TypeList<A53...>, TypeList<A54...>, TypeList<A55...>,
+                          TypeList<A56...>, TypeList<A57...>, TypeList<A58...>, TypeList<A59...>, TypeList<A60...>, TypeList<A61...>, TypeList<A62...>, TypeList<A63...>,
+                          TypeList<Tail...>>
+        {
+            using type = TypeList<A0..., A1..., A2..., A3..., A4..., A5..., A6..., A7...,
+                                  A8..., A9..., A10..., A11..., A12..., A13..., A14..., A15...,
+                                  A16..., A17..., A18..., A19..., A20..., A21..., A22..., A23...,
+                                  A24..., A25..., A26..., A27..., A28..., A29..., A30..., A31...,
+                                  A32..., A33..., A34..., A35..., A36..., A37..., A38..., A39...,
+                                  A40..., A41..., A42..., A43..., A44..., A45..., A46..., A47...,
+                                  A48..., A49..., A50..., A51..., A52..., A53..., A54..., A55...,
+                                  A56..., A57..., A58..., A59..., A60..., A61..., A62..., A63...,
+                                  Tail...>;
+        };
+
+        // Concatena una secuencia de listas de 64 en 64 (profundidad ⌈N/64⌉).
+        // Caso general: menos de 64 listas restantes
+        template <typename... Lists>
+        struct ConcatBlocks
+        {
+            using type = typename ConcatAll<TypeList<>, Lists...>::type;
+        };
+
+        // Bloque completo de 64 listas + resto
+        template <typename L0, typename L1, typename L2, typename L3, typename L4, typename L5, typename L6, typename L7,
+                  typename L8, typename L9, typename L10, typename L11, typename L12, typename L13, typename L14, typename L15,
+                  typename L16, typename L17, typename L18, typename L19, typename L20, typename L21, typename L22, typename L23,
+                  typename L24, typename L25, typename L26, typename L27, typename L28, typename L29, typename L30, typename L31,
+                  typename L32, typename L33, typename L34, typename L35, typename L36, typename L37, typename L38, typename L39,
+                  typename L40, typename L41, typename L42, typename L43, typename L44, typename L45, typename L46, typename L47,
+                  typename L48, typename L49, typename L50, typename L51, typename L52, typename L53, typename L54, typename L55,
+                  typename L56, typename L57, typename L58, typename L59, typename L60, typename L61, typename L62, typename L63,
+                  typename... Rest>
+        struct ConcatBlocks<L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15,
+                            L16, L17, L18, L19, L20, L21, L22, L23, L24, L25, L26, L27, L28, L29, L30, L31,
+                            L32, L33, L34, L35, L36, L37, L38, L39, L40, L41, L42, L43, L44, L45, L46, L47,
+                            L48, L49, L50, L51, L52, L53, L54, L55, L56, L57, L58, L59, L60, L61, L62, L63,
+                            Rest...>
+        {
+            using type = typename FlatConcat<
+                L0, L1, L2, L3, L4, L5, L6, L7, L8, L9, L10, L11, L12, L13, L14, L15,
+                L16, L17, L18, L19, L20, L21, L22, L23, L24, L25, L26, L27, L28, L29, L30, L31,
+                L32, L33, L34, L35, L36, L37, L38, L39, L40, L41, L42, L43, L44, L45, L46, L47,
+                L48, L49, L50, L51, L52, L53, L54, L55, L56, L57, L58, L59, L60, L61, L62, L63,
+                typename ConcatBlocks<Rest...>::type>::type;
+        };
+    } // namespace detail
+
+    template <typename Target, typename List>
+    struct RemoveType;
+
+    template <typename Target, typename... Ts>
+    struct RemoveType<Target, TypeList<Ts...>>
+    {
+        using type = typename detail::ConcatBlocks<detail::Keep<Target, Ts>...>::type;
+    };
+
+    // La descarga conserva el orden y no introduce repetidos: un contexto
+    // canónico sigue siéndolo
+    template <typename T, typename List>
+    using DischargeContext_t = typename RemoveType<T, List>::type;
+
+    // --- Nombres de tipos ---
+    // Nombre de un tipo según el compilador (etiqueta de las constantes que
+    // no son numerales) y FNV-1a, la base de los hashes estructurales.
+    namespace detail
+    {
+        template <typename T>
+        consteval std::string_view type_key()
+        {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+
+        constexpr std::uint64_t fnv1a(std::string_view text)
+        {
+            std::uint64_t hash = 14695981039346656037ull;
+            for (char c : text)
+            {
+                hash ^= static_cast<unsigned char>(c);
+                hash *= 1099511628211ull;
+            }
+            return hash;
+        }
+
+        // Se calcula una sola vez por tipo
+        template <typename T>
+        inline constexpr std::string_view type_name = type_key<T>();
+    } // namespace detail
+
+    // =========================================================
+    // === SUBSTITUTION ENGINE (Metaprogramming) ===
+    // =========================================================
+
+    // --- Estructura de los nodos ---
+    // Todos los análisis recorren las fórmulas con los tres recorridos
+    // genéricos de más abajo (fold_v, Fold_t y Transform), que distinguen
+    // cinco clases de nodo:
+    //   - constantes: cualquier tipo sin hijos que no sea variable (Natural<N>)
+    //   - variables: Variable<Sym>
+    //   - predicados: Atom<Sym, Args...>
+    //   - operadores: Op<T> y Op<L, R> con operator_symbol<Op> (conectivas, Succ)
+    //   - cuantificadores: Q<V, Body> con binder_symbol<Q> (Forall, Exists)
+    // Un operador o cuantificador nuevo solo necesita su símbolo; máscara y
+    // conjunto de variables libres, sustitución, forma canónica, tamaño,
+    // profundidad, hash e impresión lo cubren sin más especializaciones.
+    //
+    // Los símbolos son por plantilla y no por instancia, y lo mismo las
+    // formas (*Shape) que describen la cabeza de un nodo: los recorridos no
+    // instancian ninguna clase auxiliar por nodo.
+    template <template <typename...> class Op>
+    inline constexpr std::string_view operator_symbol{};
+
+    template <template <typename...> class Q>
+    inline constexpr std::string_view binder_symbol{};
+
+    template <>
+    inline constexpr std::string_view operator_symbol<Not> = "¬";
+    template <>
+    inline constexpr std::string_view operator_symbol<And> = "∧";
+    template <>
+    inline constexpr std::string_view operator_symbol<Or> = "∨";
+    template <>
+    inline constexpr std::string_view operator_symbol<Implies> = "→";
+    template <>
+    inline constexpr std::string_view operator_symbol<Equiv> = "↔";
+    template <>
+    inline constexpr std::string_view binder_symbol<Forall> = "∀";
+    template <>
+    inline constexpr std::string_view binder_symbol<Exists> = "∃";
+
+    enum class NodeKind
     {
-        using type = std::conditional_t<std::is_same_v<Var<N>, Target>, Replacement, Var<N>>;
+        Constant,
+        Variable,
+        Compound, // Predicados y operadores
+        Binder
     };
 
-    // 2. Caso Predicate
-    template <auto N, typename... Args, typename Target, typename Replacement>
-    struct Substitute<Predicate<N, Args...>, Target, Replacement>
+    // Clase y etiqueta (nombre o símbolo) de la cabeza de un nodo
+    struct NodeInfo
     {
-        using type = Predicate<N, Substitute_t<Args, Target, Replacement>...>;
+        NodeKind kind;
+        std::string_view label;
     };
 
-    // 3. Operador Unario
-    template <typename Op, typename T, typename Rep>
-    struct Substitute<Not<Op>, T, Rep>
+    // Hojas: el nombre de la variable o, para constantes, el nombre del tipo
+    // (Natural<N> especializa LeafShape para imprimirse con su valor)
+    template <typename Node>
+    struct LeafShape
     {
-        using type = Not<Substitute_t<Op, T, Rep>>;
+        static constexpr NodeInfo info = {NodeKind::Constant, detail::type_name<Node>};
     };
 
-    // 4. Cuantificadores (especializaciones específicas para evitar ambigüedad)
-    template <typename V, typename Body, typename T, typename Rep>
-    struct Substitute<Forall<V, Body>, T, Rep>
+    template <auto Sym>
+    struct LeafShape<Variable<Sym>>
     {
-        using type = std::conditional_t<
-            std::is_same_v<std::remove_cv_t<V>, std::remove_cv_t<T>>,
-            Forall<V, Body>, // Shadowing
-            Forall<V, Substitute_t<Body, T, Rep>>>;
+        static constexpr NodeInfo info = {NodeKind::Variable, name_of<Variable<Sym>>};
     };
 
-    template <typename V, typename Body, typename T, typename Rep>
-    struct Substitute<Exists<V, Body>, T, Rep>
+    template <auto Sym>
+    struct AtomShape
     {
-        using type = std::conditional_t<
-            std::is_same_v<std::remove_cv_t<V>, std::remove_cv_t<T>>,
-            Exists<V, Body>, // Shadowing
-            Exists<V, Substitute_t<Body, T, Rep>>>;
+        static constexpr auto name = detail::symbol_text<Sym>();
+        static constexpr NodeInfo info = {NodeKind::Compound, std::string_view(name.buf, sizeof(name.buf) - 1)};
     };
 
-    // 5. Operadores Binarios (debe ir después de cuantificadores para evitar ambigüedad)
-    template <template <typename, typename> class Op, typename L, typename R, typename T, typename Rep>
-        requires std::is_base_of_v<ExpressionBase, Op<L, R>>
-    struct Substitute<Op<L, R>, T, Rep>
+    template <template <typename...> class Op>
+    struct OperatorShape
     {
-        using type = Op<Substitute_t<L, T, Rep>, Substitute_t<R, T, Rep>>;
+        static constexpr NodeInfo info = {NodeKind::Compound, operator_symbol<Op>};
     };
 
-    // =========================================================
-    // === CONTEXT MANAGEMENT (TypeList Ops) ===
-    // =========================================================
+    template <template <typename...> class Q>
+    struct BinderShape
+    {
+        static constexpr NodeInfo info = {NodeKind::Binder, binder_symbol<Q>};
+        template <typename V, typename Body>
+        using rebind = Q<V, Body>;
+    };
+
+    namespace detail
+    {
+        template <template <typename...> class Op>
+        concept Operator = !operator_symbol<Op>.empty();
+
+        template <template <typename...> class Q>
+        concept Quantifier = !binder_symbol<Q>.empty();
+    } // namespace detail
+
+    // --- Recorridos genéricos ---
+    // fold_v<Algebra, F>: valor calculado de abajo arriba. El álgebra da
+    //   Algebra::leaf(info)                    para variables y constantes,
+    //   Algebra::combine(info, hijos...)       para predicados y operadores,
+    //   Algebra::bind(info, variable, cuerpo)  para cuantificadores.
+    // Solo dependen de los tipos de los valores: se instancian una vez por
+    // álgebra y no una vez por nodo.
+    //
+    // Fold_t<Algebra, F>: lo mismo con tipos, con Algebra::leaf<F>,
+    // Algebra::combine<Shape, hijos...> y Algebra::bind<Shape, V, cuerpo>
+    // (aquí V es la propia variable ligada).
+    //
+    // Ambos se memorizan por nodo: cada subfórmula compartida se calcula una
+    // sola vez.
+    namespace detail
+    {
+        template <typename Algebra, typename Node>
+        inline constexpr auto fold_value = Algebra::leaf(LeafShape<Node>::info);
+
+        template <typename Algebra, auto Sym, typename... Args>
+        inline constexpr auto fold_value<Algebra, Atom<Sym, Args...>> =
+            Algebra::combine(AtomShape<Sym>::info, fold_value<Algebra, Args>...);
+
+        template <typename Algebra, template <typename> class Op, typename T>
+            requires Operator<Op>
+        inline constexpr auto fold_value<Algebra, Op<T>> = Algebra::combine(OperatorShape<Op>::info, fold_value<Algebra, T>);
+
+        template <typename Algebra, template <typename, typename> class Op, typename L, typename R>
+            requires Operator<Op>
+        inline constexpr auto fold_value<Algebra, Op<L, R>> =
+            Algebra::combine(OperatorShape<Op>::info, fold_value<Algebra, L>, fold_value<Algebra, R>);
+
+        template <typename Algebra, template <typename, typename> class Q, typename V, typename Body>
+            requires Quantifier<Q>
+        inline constexpr auto fold_value<Algebra, Q<V, Body>> =
+            Algebra::bind(BinderShape<Q>::info, fold_value<Algebra, V>, fold_value<Algebra, Body>);
+
+        template <typename Algebra, typename Node>
+        struct Fold
+        {
+            using type = typename Algebra::template leaf<Node>;
+        };
+
+        template <typename Algebra, auto Sym, typename... Args>
+        struct Fold<Algebra, Atom<Sym, Args...>>
+        {
+            using type = typename Algebra::template combine<AtomShape<Sym>, typename Fold<Algebra, Args>::type...>;
+        };
+
+        template <typename Algebra, template <typename> class Op, typename T>
+            requires Operator<Op>
+        struct Fold<Algebra, Op<T>>
+        {
+            using type = typename Algebra::template combine<OperatorShape<Op>, typename Fold<Algebra, T>::type>;
+        };
+
+        template <typename Algebra, template <typename, typename> class Op, typename L, typename R>
+            requires Operator<Op>
+        struct Fold<Algebra, Op<L, R>>
+        {
+            using type = typename Algebra::template combine<OperatorShape<Op>, typename Fold<Algebra, L>::type,
+                                                            typename Fold<Algebra, R>::type>;
+        };
+
+        template <typename Algebra, template <typename, typename> class Q, typename V, typename Body>
+            requires Quantifier<Q>
+        struct Fold<Algebra, Q<V, Body>>
+        {
+            using type = typename Algebra::template bind<BinderShape<Q>, V, typename Fold<Algebra, Body>::type>;
+        };
+
+        // Transform<Pass, F, Env>: reconstruye F en un entorno Env (el mapa de
+        // la sustitución, el nivel de De Bruijn, ...). El pase resuelve las
+        // variables (Pass::variable<V, Env>) y los cuantificadores
+        // (Pass::binder<Shape, V, Body, Env>); los predicados y operadores se
+        // reconstruyen aquí aplicando Pass::apply a cada hijo, y apply puede
+        // devolver el hijo tal cual sin recorrerlo.
+        template <typename Pass, typename Node, typename Env>
+        struct Transform
+        {
+            using type = Node;
+        };
+
+        template <typename Pass, auto Sym, typename Env>
+        struct Transform<Pass, Variable<Sym>, Env>
+        {
+            using type = typename Pass::template variable<Variable<Sym>, Env>;
+        };
+
+        template <typename Pass, auto Sym, typename... Args, typename Env>
+        struct Transform<Pass, Atom<Sym, Args...>, Env>
+        {
+            using type = Atom<Sym, typename Pass::template apply<Args, Env>...>;
+        };
+
+        template <typename Pass, template <typename> class Op, typename T, typename Env>
+            requires Operator<Op>
+        struct Transform<Pass, Op<T>, Env>
+        {
+            using type = Op<typename Pass::template apply<T, Env>>;
+        };
+
+        template <typename Pass, template <typename, typename> class Op, typename L, typename R, typename Env>
+            requires Operator<Op>
+        struct Transform<Pass, Op<L, R>, Env>
+        {
+            using type = Op<typename Pass::template apply<L, Env>, typename Pass::template apply<R, Env>>;
+        };
+
+        template <typename Pass, template <typename, typename> class Q, typename V, typename Body, typename Env>
+            requires Quantifier<Q>
+        struct Transform<Pass, Q<V, Body>, Env>
+        {
+            using type = typename Pass::template binder<BinderShape<Q>, V, Body, Env>;
+        };
+    } // namespace detail
+
+    template <typename Algebra, typename Node>
+    inline constexpr auto fold_v = detail::fold_value<Algebra, Node>;
+
+    template <typename Algebra, typename Node>
+    using Fold_t = typename detail::Fold<Algebra, Node>::type;
+
+    // --- Canonical (Contextos como conjuntos) ---
+    // Un contexto canónico no tiene duplicados y está ordenado por la clave
+    // estructural de cada hipótesis: el recorrido en preorden de la fórmula,
+    // con un byte por nodo (clase y aridad) seguido de la longitud de la
+    // etiqueta y la etiqueta. Los numerales llevan su valor en lugar de la
+    // etiqueta (longitud 0, que ninguna otra constante tiene) y se ordenan
+    // por él. Dos fórmulas distintas tienen claves distintas: el mismo
+    // conjunto de hipótesis produce siempre el mismo TypeList, sea cual sea el
+    // orden de la derivación, y el tamaño crece con las hipótesis distintas,
+    // no con los pasos. Las etiquetas de variables, predicados, operadores y
+    // numerales salen del código, así que con ellas el orden es el mismo en
+    // todos los compiladores; las constantes que no son numerales se
+    // etiquetan con el nombre del tipo (LeafShape), que sale de la firma de
+    // una función (__PRETTY_FUNCTION__ o __FUNCSIG__), y el orden de los
+    // contextos que las contienen puede cambiar de un compilador a otro.
+    namespace detail
+    {
+        template <size_t N>
+        struct StructureKey
+        {
+            unsigned char bytes[N];
+        };
+
+        consteval size_t label_bytes(size_t size) { return size < 0xFF ? 1 + size : 3 + size; }
+
+        // Un bucle simple: std::copy_n pasa por varias capas de llamadas, y
+        // en la evaluación constante cada llamada cuesta más que la copia
+        consteval void copy_key_bytes(unsigned char *to, const unsigned char *from, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+                to[i] = from[i];
+        }
+
+        // Cabecera, etiqueta y claves de los hijos. L es la longitud de la
+        // etiqueta: el tamaño de la clave depende de ella.
+        template <size_t L, size_t... Ns>
+        consteval StructureKey<((1 + label_bytes(L)) + ... + Ns)> node_key(NodeInfo info, const StructureKey<Ns> &...children)
+        {
+            static_assert(sizeof...(Ns) < 64 && L < 0x10000, "ERROR: nodo demasiado grande para la clave estructural.");
+            StructureKey<((1 + label_bytes(L)) + ... + Ns)> key{};
+            size_t pos = 0;
+            key.bytes[pos++] = static_cast<unsigned char>(static_cast<size_t>(info.kind) << 6 | sizeof...(Ns));
+            if constexpr (L < 0xFF)
+                key.bytes[pos++] = static_cast<unsigned char>(L);
+            else
+            {
+                key.bytes[pos++] = 0xFF;
+                key.bytes[pos++] = static_cast<unsigned char>(L >> 8);
+                key.bytes[pos++] = static_cast<unsigned char>(L & 0xFF);
+            }
+            for (char c : info.label)
+                key.bytes[pos++] = static_cast<unsigned char>(c);
+            ((copy_key_bytes(key.bytes + pos, children.bytes, Ns), pos += Ns), ...);
+            return key;
+        }
+
+        // Se calcula una sola vez por subfórmula, como fold_value
+        template <typename Node>
+        inline constexpr auto structure_key = node_key<LeafShape<Node>::info.label.size()>(LeafShape<Node>::info);
+
+        template <auto Sym, typename... Args>
+        inline constexpr auto structure_key<Atom<Sym, Args...>> =
+            node_key<AtomShape<Sym>::info.label.size()>(AtomShape<Sym>::info, structure_key<Args>...);
+
+        template <template <typename> class Op, typename T>
+            requires Operator<Op>
+        inline constexpr auto structure_key<Op<T>> =
+            node_key<operator_symbol<Op>.size()>(OperatorShape<Op>::info, structure_key<T>);
+
+        template <template <typename, typename> class Op, typename L, typename R>
+            requires Operator<Op>
+        inline constexpr auto structure_key<Op<L, R>> =
+            node_key<operator_symbol<Op>.size()>(OperatorShape<Op>::info, structure_key<L>, structure_key<R>);
+
+        template <template <typename, typename> class Q, typename V, typename Body>
+            requires Quantifier<Q>
+        inline constexpr auto structure_key<Q<V, Body>> =
+            node_key<binder_symbol<Q>.size()>(BinderShape<Q>::info, structure_key<V>, structure_key<Body>);
+
+        // Numeral: número de bytes significativos y el valor en big-endian
+        consteval StructureKey<11> numeral_key(std::uint64_t value)
+        {
+            StructureKey<11> key{};
+            size_t count = 0;
+            for (std::uint64_t rest = value; rest != 0; rest >>= 8)
+                ++count;
+            key.bytes[2] = static_cast<unsigned char>(count);
+            for (size_t i = 0; i < count; ++i)
+                key.bytes[3 + i] = static_cast<unsigned char>(value >> (8 * (count - 1 - i)));
+            return key;
+        }
+
+        // Vista de una clave con sus 16 primeros bytes en dos palabras: en los
+        // bucles de las fusiones casi todas las comparaciones se resuelven con
+        // ellas, sin llamar a key_compare
+        struct KeyView
+        {
+            std::uint64_t head;
+            std::uint64_t next;
+            const unsigned char *bytes;
+            size_t size;
+        };
+
+        // Una sola llamada por hipótesis: key_of se instancia para cada fórmula
+        // distinta de los contextos y es la mayor parte del coste de ordenarlos
+        template <size_t N>
+        consteval KeyView key_view(const StructureKey<N> &key)
+        {
+            KeyView view{0, 0, key.bytes, N};
+            for (size_t i = 0; i < 8; ++i)
+            {
+                view.head = view.head << 8 | (i < N ? key.bytes[i] : 0);
+                view.next = view.next << 8 | (i + 8 < N ? key.bytes[i + 8] : 0);
+            }
+            return view;
+        }
+
+        template <typename T>
+        inline constexpr KeyView key_of = key_view(structure_key<T>);
+
+        // Orden lexicográfico de los bytes (una clave que es prefijo de otra
+        // va antes; las palabras se rellenan con ceros, así que lo respetan)
+        constexpr int key_compare(const KeyView &a, const KeyView &b)
+        {
+            if (a.head != b.head)
+                return a.head < b.head ? -1 : 1;
+            if (a.next != b.next)
+                return a.next < b.next ? -1 : 1;
+            const size_t n = a.size < b.size ? a.size : b.size;
+            for (size_t i = 16; i < n; ++i)
+                if (a.bytes[i] != b.bytes[i])
+                    return a.bytes[i] < b.bytes[i] ? -1 : 1;
+            return a.size == b.size ? 0 : (a.size < b.size ? -1 : 1);
+        }
+
+        // ¿Está [begin, end) estrictamente ordenado (ordenado y sin repetidos)?
+        constexpr bool strictly_sorted(const KeyView *const *keys, size_t begin, size_t end)
+        {
+            for (size_t i = begin + 1; i < end; ++i)
+            {
+                const KeyView &a = *keys[i - 1];
+                const KeyView &b = *keys[i];
+                if (a.head != b.head ? a.head > b.head : (a.next != b.next ? a.next > b.next : key_compare(a, b) >= 0))
+                    return false;
+            }
+            return true;
+        }
+
+        // Las funciones siguientes copian las claves del pack a un array local:
+        // una variable global indexada por el pack entero (un contexto nuevo en
+        // cada fusión) es mucho más cara de instanciar que evaluar el bucle.
+        // Se recorren con un puntero y se comparan las palabras en línea: en
+        // la evaluación constante cada llamada (std::array::operator[],
+        // key_compare) cuesta bastante más que la comparación en sí.
+
+        template <typename... Ts>
+        consteval bool is_canonical()
+        {
+            if constexpr (sizeof...(Ts) < 2)
+                return true;
+            else
+            {
+                const KeyView *const keys[] = {&key_of<Ts>...};
+                return strictly_sorted(keys, 0, sizeof...(Ts));
+            }
+        }
+
+        // Orden canónico completo de una lista cualquiera: índices de los
+        // elementos a conservar, ordenados por clave y sin repetidos
+        template <size_t N>
+        struct CanonicalOrder
+        {
+            std::array<size_t, N> index{};
+            size_t size = 0;
+        };
+
+        template <typename... Ts>
+        consteval auto canonical_order()
+        {
+            const std::array<KeyView, sizeof...(Ts)> keys{key_of<Ts>...};
+            std::array<size_t, sizeof...(Ts)> sorted{};
+            for (size_t i = 0; i < sorted.size(); ++i)
+                sorted[i] = i;
+            std::sort(sorted.begin(), sorted.end(), [&](size_t a, size_t b) {
+                const int order = key_compare(keys[a], keys[b]);
+                return order < 0 || (order == 0 && a < b);
+            });
+
+            CanonicalOrder<sizeof...(Ts)> order;
+            for (size_t i = 0; i < sorted.size(); ++i)
+                if (order.size == 0 || key_compare(keys[order.index[order.size - 1]], keys[sorted[i]]) != 0)
+                    order.index[order.size++] = sorted[i];
+            return order;
+        }
+
+        enum class MergeMode
+        {
+            KeepLeft,   // Bs no aporta hipótesis nuevas
+            Append,     // Todas las nuevas van detrás de As
+            Prepend,    // Todas las nuevas van delante de As
+            Insert,     // Todas las nuevas van juntas en un mismo hueco de As
+            Interleave, // Las nuevas caen entre las de As
+            Normalize   // Alguna no es canónica: se ordena por separado
+        };
+
+        // Fusión de dos listas As y Bs (Ts = As ++ Bs), que de paso comprueba
+        // que ambas son canónicas: fresh[k] es el índice en Bs de la k-ésima
+        // hipótesis nueva y at[k] el de la hipótesis de As que la sigue (NA si
+        // va al final). En una cadena As es larga y Bs aporta pocas: As se
+        // recorre una sola vez para comprobar el orden y cada hipótesis de Bs
+        // se sitúa por búsqueda binaria, sin comparar As entera contra Bs.
+        template <size_t NB>
+        struct MergePlan
+        {
+            MergeMode mode = MergeMode::Normalize;
+            std::array<size_t, NB> fresh{};
+            std::array<size_t, NB> at{};
+            size_t fresh_count = 0;
+        };
+
+        template <size_t NB>
+        consteval MergePlan<NB> merge_plan(std::initializer_list<const KeyView *> list)
+        {
+            const KeyView *const *keys = list.begin();
+            const size_t N = list.size();
+            const size_t NA = N - NB;
+            MergePlan<NB> plan;
+            if (!strictly_sorted(keys, 0, NA) || !strictly_sorted(keys, NA, N))
+                return plan;
+
+            size_t low = 0;
+            for (size_t j = NA; j < N; ++j)
+            {
+                // Primera hipótesis de As en [low, NA) que no es menor que
+                // Bs[j]; si es igual, Bs[j] está repetida y se conserva la de As
+                const KeyView &b = *keys[j];
+                size_t high = NA;
+                bool repeated = false;
+                while (low < high && !repeated)
+                {
+                    const size_t mid = low + (high - low) / 2;
+                    const KeyView &a = *keys[mid];
+                    const int order = a.head != b.head   ? (a.head < b.head ? -1 : 1)
+                                      : a.next != b.next ? (a.next < b.next ? -1 : 1)
+                                                         : key_compare(a, b);
+                    if (order < 0)
+                        low = mid + 1;
+                    else if (order > 0)
+                        high = mid;
+                    else
+                        low = mid, repeated = true;
+                }
+                if (repeated)
+                    continue;
+                plan.fresh[plan.fresh_count] = j - NA;
+                plan.at[plan.fresh_count++] = low;
+            }
+
+            if (plan.fresh_count == 0)
+                plan.mode = MergeMode::KeepLeft;
+            else if (plan.at[0] == NA)
+                plan.mode = MergeMode::Append;
+            else if (plan.at[plan.fresh_count - 1] == 0)
+                plan.mode = MergeMode::Prepend;
+            else if (plan.at[0] == plan.at[plan.fresh_count - 1])
+                plan.mode = MergeMode::Insert;
+            else
+                plan.mode = MergeMode::Interleave;
+            return plan;
+        }
+
+        // Solo para Interleave: bound[i] es el número de hipótesis nuevas que
+        // van antes de As[i]
+        template <size_t NA, size_t NB>
+        consteval std::array<size_t, NA + 1> merge_bounds(const MergePlan<NB> &plan)
+        {
+            std::array<size_t, NA + 1> bound{};
+            size_t k = 0;
+            for (size_t i = 0; i <= NA; ++i)
+            {
+                while (k < plan.fresh_count && plan.at[k] < i)
+                    ++k;
+                bound[i] = k;
+            }
+            return bound;
+        }
+
+        // Acceso por índice sin recursión: cada elemento es una base distinta
+        template <size_t I, typename T>
+        struct IndexedLeaf
+        {
+        };
+
+        template <typename Seq, typename... Ts>
+        struct IndexedPack;
+
+        template <size_t... Is, typename... Ts>
+        struct IndexedPack<std::index_sequence<Is...>, Ts...> : IndexedLeaf<Is, Ts>...
+        {
+        };
+
+        // Solo para contextos no evaluados
+        template <size_t I, typename T>
+        std::type_identity<T> pick(const IndexedLeaf<I, T> *);
+
+        template <typename Indexed, size_t I>
+        using PickAt = typename decltype(pick<I>(static_cast<const Indexed *>(nullptr)))::type;
+
+        // TypeList<Ts[Index[Begin + K]]..., Extra...>
+        template <typename Indexed, auto Index, size_t Begin, typename Seq, typename... Extra>
+        struct Gather;
+
+        template <typename Indexed, auto Index, size_t Begin, size_t... Ks, typename... Extra>
+        struct Gather<Indexed, Index, Begin, std::index_sequence<Ks...>, Extra...>
+        {
+            using type = TypeList<PickAt<Indexed, Index[Begin + Ks]>..., Extra...>;
+        };
+
+        template <typename... Ts>
+        using IndexedOf = IndexedPack<std::index_sequence_for<Ts...>, Ts...>;
+
+        // Hueco delante de Last con Fresh[Begin .. Begin + Count). Casi todos
+        // están vacíos y se resuelven con un alias, sin instanciar nada.
+        template <typename Indexed, size_t Begin, typename Seq, typename... Last>
+        struct Run;
+
+        template <typename Indexed, size_t Begin, size_t... Ks, typename... Last>
+        struct Run<Indexed, Begin, std::index_sequence<Ks...>, Last...>
+        {
+            using type = TypeList<PickAt<Indexed, Begin + Ks>..., Last...>;
+        };
+
+        template <bool Empty>
+        struct Slot
+        {
+            template <typename Fresh, size_t Begin, size_t Count, typename Last>
+            using apply = TypeList<Last>;
+        };
+
+        template <>
+        struct Slot<false>
+        {
+            template <typename Fresh, size_t Begin, size_t Count, typename Last>
+            using apply = typename Run<Fresh, Begin, std::make_index_sequence<Count>, Last>::type;
+        };
+
+        // Una clase por modo con la fusión como alias miembro: el modo elige
+        // la especialización directamente, sin deducir los packs de los dos
+        // contextos enteros contra cada especialización parcial candidata
+        template <MergeMode Mode>
+        struct MergeSelect;
+
+        template <>
+        struct MergeSelect<MergeMode::KeepLeft>
+        {
+            template <typename L1, typename L2, auto Plan>
+            using apply = L1;
+        };
+
+        // Las nuevas de Bs en orden canónico: Bs tal cual si no repite
+        // ninguna de As, sin acceso por índice
+        template <bool All, auto Fresh, size_t Count, typename List>
+        struct FreshOf
+        {
+            using type = List;
+        };
+
+        template <auto Fresh, size_t Count, typename... Bs>
+        struct FreshOf<false, Fresh, Count, TypeList<Bs...>>
+        {
+            using type = typename Gather<IndexedOf<Bs...>, Fresh, 0, std::make_index_sequence<Count>>::type;
+        };
+
+        template <auto Plan, typename List>
+        using FreshOf_t = typename FreshOf<Plan.fresh_count == List::size, Plan.fresh, Plan.fresh_count, List>::type;
+
+        // Los dos casos habituales de una cadena de derivaciones no tocan As:
+        // las hipótesis nuevas van todas detrás o todas delante
+        template <>
+        struct MergeSelect<MergeMode::Append>
+        {
+            template <typename L1, typename L2, auto Plan>
+            using apply = typename ConcatLists<L1, FreshOf_t<Plan, L2>>::type;
+        };
+
+        template <>
+        struct MergeSelect<MergeMode::Prepend>
+        {
+            template <typename L1, typename L2, auto Plan>
+            using apply = typename ConcatLists<FreshOf_t<Plan, L2>, L1>::type;
+        };
+
+        // Un solo hueco, delante de As[At]: As se parte por índice en dos
+        // tramos y las nuevas van entre ellos. Repartir As en listas de uno y
+        // concatenarlas (como Interleave) costaba más que la propia fusión
+        // en los contextos pequeños de una cadena de derivaciones.
+        template <typename Indexed, typename Fresh, size_t At, typename Head, typename Tail>
+        struct InsertMerge;
+
+        template <typename Indexed, typename... Fs, size_t At, size_t... Is, size_t... Js>
+        struct InsertMerge<Indexed, TypeList<Fs...>, At, std::index_sequence<Is...>, std::index_sequence<Js...>>
+        {
+            using type = TypeList<PickAt<Indexed, Is>..., Fs..., PickAt<Indexed, At + Js>...>;
+        };
+
+        template <typename L1>
+        struct IndexedList;
+
+        template <typename... As>
+        struct IndexedList<TypeList<As...>>
+        {
+            using type = IndexedOf<As...>;
+        };
+
+        template <>
+        struct MergeSelect<MergeMode::Insert>
+        {
+            template <typename L1, typename L2, auto Plan>
+            using apply = typename InsertMerge<typename IndexedList<L1>::type, FreshOf_t<Plan, L2>, Plan.at[0],
+                                               std::make_index_sequence<Plan.at[0]>,
+                                               std::make_index_sequence<L1::size - Plan.at[0]>>::type;
+        };
+
+        // Cada As[i] arrastra el hueco de hipótesis nuevas que le precede y las
+        // listas resultantes se concatenan por bloques. Lo que se expande por
+        // elemento son solo parámetros de Interleave: nombrar miembros de
+        // InterleaveMerge<...> dentro de la expansión obligaría a buscar otra
+        // vez esa especialización, cuyos argumentos son los dos contextos enteros.
+        template <typename Fresh, typename Begins, typename Counts, typename List, typename Tail>
+        struct Interleave;
+
+        template <typename Fresh, size_t... Begin, size_t... Count, typename... As, typename Tail>
+        struct Interleave<Fresh, std::index_sequence<Begin...>, std::index_sequence<Count...>, TypeList<As...>, Tail>
+        {
+            using type = typename ConcatBlocks<
+                typename Slot<Count == 0>::template apply<Fresh, Begin, Count, As>..., Tail>::type;
+        };
+
+        template <auto Bound, size_t... Is>
+        auto plan_begins(std::index_sequence<Is...>) -> std::index_sequence<Bound[Is]...>;
+
+        template <auto Bound, size_t... Is>
+        auto plan_counts(std::index_sequence<Is...>) -> std::index_sequence<(Bound[Is + 1] - Bound[Is])...>;
+
+        template <typename L1, typename L2, auto Plan>
+        struct InterleaveMerge;
+
+        template <typename... As, typename... Bs, auto Plan>
+        struct InterleaveMerge<TypeList<As...>, TypeList<Bs...>, Plan>
+        {
+            static constexpr auto bound = merge_bounds<sizeof...(As)>(Plan);
+
+            // Las nuevas ya en orden canónico
+            template <size_t... Ks>
+            static auto fresh(std::index_sequence<Ks...>) -> IndexedOf<PickAt<IndexedOf<Bs...>, Plan.fresh[Ks]>...>;
+
+            using Fresh = decltype(fresh(std::make_index_sequence<Plan.fresh_count>{}));
+            using Tail = typename Run<Fresh, bound[sizeof...(As)],
+                                      std::make_index_sequence<Plan.fresh_count - bound[sizeof...(As)]>>::type;
+
+            using type = typename Interleave<Fresh,
+                                             decltype(plan_begins<bound>(std::index_sequence_for<As...>{})),
+                                             decltype(plan_counts<bound>(std::index_sequence_for<As...>{})),
+                                             TypeList<As...>, Tail>::type;
+        };
+
+        template <>
+        struct MergeSelect<MergeMode::Interleave>
+        {
+            template <typename L1, typename L2, auto Plan>
+            using apply = typename InterleaveMerge<L1, L2, Plan>::type;
+        };
+
+        // Ordenar cuesta más que fusionar (el acceso por índice es lineal en
+        // el tamaño del pack), así que solo se ordena la lista que no es
+        // canónica, no la concatenación
+        template <typename List, bool Canonical>
+        struct Canonicalize
+        {
+            using type = List;
+        };
+
+        template <typename... Ts>
+        struct Canonicalize<TypeList<Ts...>, false>
+        {
+            static constexpr auto order = canonical_order<Ts...>();
+            using type = typename Gather<IndexedOf<Ts...>, order.index, 0,
+                                         std::make_index_sequence<order.size>>::type;
+        };
+
+        template <typename List>
+        struct CanonicalizeList;
+
+        template <typename... Ts>
+        struct CanonicalizeList<TypeList<Ts...>> : Canonicalize<TypeList<Ts...>, is_canonical<Ts...>()>
+        {
+        };
+
+        template <typename L1, typename L2>
+        struct MergeCanonical;
+
+        template <>
+        struct MergeSelect<MergeMode::Normalize>
+        {
+            template <typename L1, typename L2, auto Plan>
+            using apply = typename MergeCanonical<typename CanonicalizeList<L1>::type,
+                                                  typename CanonicalizeList<L2>::type>::type;
+        };
+
+        template <typename L1, typename L2, auto Plan>
+        using MergeApply_t = typename MergeSelect<Plan.mode>::template apply<L1, L2, Plan>;
+
+        // El plan va directamente como argumento: un miembro estático de esta
+        // clase sería una variable más con los dos contextos en el nombre
+        template <typename... As, typename... Bs>
+        struct MergeCanonical<TypeList<As...>, TypeList<Bs...>>
+        {
+            using type = MergeApply_t<TypeList<As...>, TypeList<Bs...>,
+                                      merge_plan<sizeof...(Bs)>({&key_of<As>..., &key_of<Bs>...})>;
+        };
+
+        template <>
+        struct MergeCanonical<TypeList<>, TypeList<>>
+        {
+            using type = TypeList<>;
+        };
+    } // namespace detail
+
+    // Forma canónica de un contexto arbitrario
+    template <typename List>
+    struct CanonicalContext;
 
-    // Contenedor básico de hipótesis
     template <typename... Ts>
-    struct TypeList
+    struct CanonicalContext<TypeList<Ts...>>
     {
-        static constexpr size_t size = sizeof...(Ts);
+        using type = typename detail::MergeCanonical<TypeList<>, TypeList<Ts...>>::type;
     };
 
-    // --- Concat (Unión de contextos) ---
-    template <typename List1, typename List2>
-    struct ConcatLists;
+    template <typename List>
+    using CanonicalContext_t = typename CanonicalContext<List>::type;
 
-    template <typename... As, typename... Bs>
-    struct ConcatLists<TypeList<As...>, TypeList<Bs...>>
+    // La fusión devuelve siempre un contexto canónico
+    template <typename L1, typename L2>
+    using MergeContexts_t = typename detail::MergeCanonical<L1, L2>::type;
+
+    // --- Variables libres ---
+    // free_var_mask<F>: resumen de 64 bits de las variables libres de F; cada
+    // variable activa un bit según el hash de su nombre. Es conservador: un bit
+    // a 0 garantiza que ninguna variable de ese bit aparece libre, un bit a 1
+    // solo dice que puede aparecer. Se calcula una vez por nodo combinando los
+    // hijos con OR, sin construir tipos. Los cuantificadores no descuentan su
+    // variable (otra variable libre podría compartir el bit).
+    namespace detail
+    {
+        struct FreeVarMaskAlgebra
+        {
+            static constexpr std::uint64_t leaf(NodeInfo info)
+            {
+                return info.kind == NodeKind::Variable ? std::uint64_t{1} << (fnv1a(info.label) % 64) : 0;
+            }
+
+            template <typename... Masks>
+            static consteval std::uint64_t combine(NodeInfo, Masks... masks) { return (std::uint64_t{0} | ... | masks); }
+
+            static consteval std::uint64_t bind(NodeInfo, std::uint64_t, std::uint64_t body) { return body; }
+        };
+    } // namespace detail
+
+    template <typename Node>
+    inline constexpr std::uint64_t free_var_mask = fold_v<detail::FreeVarMaskAlgebra, Node>;
+
+    // OccursFree<V, F>: ¿aparece V libre en F? Respuesta exacta; la máscara
+    // poda los subárboles en los que V no puede aparecer sin recorrerlos.
+    template <typename V, typename Node>
+    struct OccursFree : std::false_type
     {
-        using type = TypeList<As..., Bs...>;
     };
 
-    // --- Remove (Para descargar hipótesis) ---
-    // Elimina TODAS las ocurrencias del tipo T de la lista
-    template <typename Target, typename List>
-    struct RemoveType;
+    namespace detail
+    {
+        template <typename V, typename Node>
+        struct OccursFreeIn
+            : std::conjunction<std::bool_constant<(free_var_mask<Node> & free_var_mask<V>) != 0>, OccursFree<V, Node>>
+        {
+        };
+    } // namespace detail
 
-    template <typename Target>
-    struct RemoveType<Target, TypeList<>>
+    template <typename V, typename Node>
+    inline constexpr bool occurs_free_v = detail::OccursFreeIn<std::remove_cv_t<V>, Node>::value;
+
+    template <typename V, auto Sym>
+    struct OccursFree<V, Variable<Sym>> : std::is_same<V, Variable<Sym>>
     {
-        using type = TypeList<>;
     };
 
-    template <typename Target, typename Head, typename... Tail>
-    struct RemoveType<Target, TypeList<Head, Tail...>>
+    template <typename V, auto Sym, typename... Args>
+    struct OccursFree<V, Atom<Sym, Args...>> : std::disjunction<detail::OccursFreeIn<V, Args>...>
     {
-        using TailRemoved = typename RemoveType<Target, TypeList<Tail...>>::type;
-        // Si Head es Target, no lo incluimos. Si es distinto, lo concatenamos.
-        using type = std::conditional_t<
-            std::is_same_v<Target, Head>,
-            TailRemoved,
-            typename ConcatLists<TypeList<Head>, TailRemoved>::type>;
     };
 
-    // --- Unique (Para evitar contextos gigantes con duplicados) ---
-    // Nota: Para una implementación completa, se necesitaría un 'Filter' o 'Unique' más complejo.
-    // Por ahora, permitiremos duplicados en la lista pero 'Remove' los quitará todos.
-    // Alias helper:
-    template <typename L1, typename L2>
-    using MergeContexts_t = typename ConcatLists<L1, L2>::type;
+    template <typename V, template <typename> class Op, typename T>
+        requires detail::Operator<Op>
+    struct OccursFree<V, Op<T>> : detail::OccursFreeIn<V, T>
+    {
+    };
 
-    template <typename T, typename List>
-    using DischargeContext_t = typename RemoveType<T, List>::type;
+    template <typename V, template <typename, typename> class Op, typename L, typename R>
+        requires detail::Operator<Op>
+    struct OccursFree<V, Op<L, R>> : std::disjunction<detail::OccursFreeIn<V, L>, detail::OccursFreeIn<V, R>>
+    {
+    };
+
+    template <typename V, template <typename, typename> class Q, typename W, typename Body>
+        requires detail::Quantifier<Q>
+    struct OccursFree<V, Q<W, Body>>
+        : std::conjunction<std::negation<std::is_same<V, W>>, detail::OccursFreeIn<V, Body>>
+    {
+    };
+
+    // --- Variables libres como conjunto ---
+    // FreeVars_t<F>: contexto canónico con las variables libres de F. La
+    // sustitución no lo necesita (le bastan free_var_mask y OccursFree); sirve
+    // para inspeccionar fórmulas.
+    namespace detail
+    {
+        template <typename... Sets>
+        struct UnionOf
+        {
+            using type = CanonicalContext_t<typename ConcatAll<TypeList<>, Sets...>::type>;
+        };
+
+        template <>
+        struct UnionOf<>
+        {
+            using type = TypeList<>;
+        };
+
+        template <typename Set>
+        struct UnionOf<Set>
+        {
+            using type = Set;
+        };
+
+        template <typename L, typename R>
+        struct UnionOf<L, R>
+        {
+            using type = MergeContexts_t<L, R>;
+        };
+
+        struct FreeVarsAlgebra
+        {
+            template <typename Node>
+            using leaf = std::conditional_t<LeafShape<Node>::info.kind == NodeKind::Variable, TypeList<Node>, TypeList<>>;
+
+            template <typename Shape, typename... Sets>
+            using combine = typename UnionOf<Sets...>::type;
+
+            template <typename Shape, typename V, typename Set>
+            using bind = DischargeContext_t<V, Set>;
+        };
+    } // namespace detail
+
+    template <typename Node>
+    struct FreeVars
+    {
+        using type = Fold_t<detail::FreeVarsAlgebra, Node>;
+    };
+
+    template <typename Node>
+    using FreeVars_t = typename FreeVars<Node>::type;
+
+    // --- Sustitución ---
+    // La sustitución trabaja con un mapa de variables a términos, una lista
+    // TypeList<Binding<V, T>...>, y los sustituye todos a la vez en un único
+    // recorrido. SubstituteAll<F, Map> es un paso de Transform;
+    // SubstituteAll_t devuelve tal cual (el mismo tipo, sin reconstruirlo) todo
+    // subárbol cuya máscara descarta todas las variables del mapa. Se evita la
+    // captura: si un cuantificador liga una variable libre de algún término,
+    // se renombra en el mismo recorrido a x', x'', ...
+    template <typename V, typename Term>
+    struct Binding
+    {
+        using variable = V;
+        using term = Term;
+    };
+
+    template <typename Node, typename Map>
+    struct SubstituteAll;
+
+    namespace detail
+    {
+        template <typename Map>
+        inline constexpr std::uint64_t map_mask = 0;
+
+        template <typename... Vs, typename... Ts>
+        inline constexpr std::uint64_t map_mask<TypeList<Binding<Vs, Ts>...>> = (std::uint64_t{0} | ... | free_var_mask<Vs>);
+
+        struct SubstitutionPass;
+
+        template <bool MayOccur>
+        struct SubstituteIf
+        {
+            template <typename Node, typename Map>
+            using apply = Node;
+        };
+
+        template <>
+        struct SubstituteIf<true>
+        {
+            template <typename Node, typename Map>
+            using apply = typename Transform<SubstitutionPass, Node, Map>::type;
+        };
+
+        // Recursión interna: el mapa ya viene sin const/volatile
+        template <typename Node, typename Map>
+        using SubstituteMap_t = typename SubstituteIf<(free_var_mask<Node> & map_mask<Map>) != 0>::template apply<Node, Map>;
+
+        template <typename Map>
+        struct CleanMap;
+
+        template <typename... Vs, typename... Ts>
+        struct CleanMap<TypeList<Binding<Vs, Ts>...>>
+        {
+            using type = TypeList<Binding<std::remove_cv_t<Vs>, std::remove_cv_t<Ts>>...>;
+        };
+    } // namespace detail
+
+    // Si una variable aparece dos veces en el mapa, vale la primera
+    template <typename Node, typename Map>
+    using SubstituteAll_t = detail::SubstituteMap_t<Node, typename detail::CleanMap<Map>::type>;
+
+    // Sustitución de una sola variable: F[Target := Replacement]
+    template <typename Node, typename Target, typename Replacement>
+    using Substitute_t = SubstituteAll_t<Node, TypeList<Binding<Target, Replacement>>>;
+
+    template <typename Node, typename Target, typename Replacement>
+    struct Substitute
+    {
+        using type = Substitute_t<Node, Target, Replacement>;
+    };
+
+    namespace detail
+    {
+        template <typename V, typename Map>
+        struct Lookup;
+
+        // Índice de la primera ligadura de V (o el tamaño del mapa si no hay)
+        template <typename V, typename... Vs, typename... Ts>
+        struct Lookup<V, TypeList<Binding<Vs, Ts>...>>
+        {
+            static constexpr size_t index = []
+            {
+                constexpr bool hits[] = {std::is_same_v<V, Vs>..., true};
+                size_t i = 0;
+                while (!hits[i])
+                    ++i;
+                return i;
+            }();
+            using type = PickAt<IndexedOf<Ts..., V>, index>;
+        };
+
+        // El mapa sin la variable V (la liga un cuantificador)
+        template <typename V, typename Map>
+        struct Unbind;
+
+        template <typename V, typename... Bs>
+        struct Unbind<V, TypeList<Bs...>>
+        {
+            using type = typename ConcatAll<
+                TypeList<>, std::conditional_t<std::is_same_v<V, typename Bs::variable>, TypeList<>, TypeList<Bs>>...>::type;
+        };
+
+        template <typename V, typename Nodes>
+        inline constexpr bool occurs_free_in_any = false;
+
+        template <typename V, typename... Nodes>
+        inline constexpr bool occurs_free_in_any<V, TypeList<Nodes...>> = (occurs_free_v<V, Nodes> || ...);
+
+        // x -> x'
+        template <size_t N>
+        consteval FixedString<N + 1> primed(const FixedString<N> &name)
+        {
+            char buf[N + 1]{};
+            std::copy_n(name.buf, N - 1, buf);
+            buf[N - 1] = '\'';
+            return FixedString<N + 1>(buf);
+        }
+
+        // Primera de V', V'', ... que no aparece libre en ninguno de los nodos
+        template <typename Candidate, typename Avoid, bool Taken = occurs_free_in_any<Candidate, Avoid>>
+        struct FreshVar
+        {
+            using type = Candidate;
+        };
+
+        template <auto N, typename Avoid>
+        struct FreshVar<Variable<N>, Avoid, true> : FreshVar<Var<primed(Variable<N>::name)>, Avoid>
+        {
+        };
+
+        enum class BinderCase
+        {
+            Untouched, // Ninguna variable del mapa aparece libre en el cuerpo
+            Direct,    // Ningún término menciona V: se sustituye en el cuerpo
+            Rename     // Algún término menciona V: se renombra V en el mismo recorrido
+        };
+
+        // Map ya no contiene V. El recorrido exacto del cuerpo solo se paga si
+        // hay riesgo de captura.
+        template <typename V, typename Body, typename... Vs, typename... Ts>
+        consteval BinderCase binder_case(TypeList<Binding<Vs, Ts>...> *)
+        {
+            if constexpr (sizeof...(Vs) == 0)
+                return BinderCase::Untouched;
+            else if constexpr (!occurs_free_in_any<V, TypeList<Ts...>>)
+                return BinderCase::Direct;
+            else if constexpr (!(occurs_free_v<Vs, Body> || ...))
+                return BinderCase::Untouched;
+            else
+                return BinderCase::Rename;
+        }
+
+        template <typename Map>
+        struct MapTerms;
+
+        template <typename... Vs, typename... Ts>
+        struct MapTerms<TypeList<Binding<Vs, Ts>...>>
+        {
+            using type = TypeList<Ts...>;
+        };
+
+        template <typename Shape, typename V, typename Body, typename Map,
+                  BinderCase Case = binder_case<V, Body>(static_cast<Map *>(nullptr))>
+        struct SubstituteBinder
+        {
+            using type = typename Shape::template rebind<V, Body>;
+        };
+
+        template <typename Shape, typename V, typename Body, typename Map>
+        struct SubstituteBinder<Shape, V, Body, Map, BinderCase::Direct>
+        {
+            using type = typename Shape::template rebind<V, SubstituteMap_t<Body, Map>>;
+        };
+
+        template <typename Shape, typename V, typename Body, typename Map>
+        struct SubstituteBinder<Shape, V, Body, Map, BinderCase::Rename>
+        {
+            using Avoid = typename ConcatLists<TypeList<Body>, typename MapTerms<Map>::type>::type;
+            using Fresh = typename FreshVar<Var<primed(V::name)>, Avoid>::type;
+            using type = typename Shape::template rebind<
+                Fresh, SubstituteMap_t<Body, typename ConcatLists<Map, TypeList<Binding<V, Fresh>>>::type>>;
+        };
+
+        struct SubstitutionPass
+        {
+            template <typename Node, typename Map>
+            using apply = SubstituteMap_t<Node, Map>;
+
+            template <typename V, typename Map>
+            using variable = typename Lookup<V, Map>::type;
+
+            // La variable ligada sale del mapa (shadowing); la captura se
+            // resuelve en SubstituteBinder
+            template <typename Shape, typename V, typename Body, typename Map>
+            using binder = typename SubstituteBinder<Shape, V, Body, typename Unbind<V, Map>::type>::type;
+        };
+    } // namespace detail
+
+    template <typename Node, typename Map>
+    struct SubstituteAll
+    {
+        using type = typename detail::Transform<detail::SubstitutionPass, Node, Map>::type;
+    };
+
+    // --- Forma canónica módulo α (De Bruijn) ---
+    // DeBruijn_t<F> renombra cada variable ligada según la profundidad de su
+    // cuantificador (niveles de De Bruijn): el cuantificador más externo liga
+    // #0, el siguiente #1, etc. Las variables libres conservan su nombre. Dos
+    // fórmulas son α-equivalentes si y solo si tienen la misma forma canónica,
+    // y esa forma sigue siendo una fórmula con nombres, así que las reglas y la
+    // sustitución se le aplican sin cambios. Los nombres que empiezan por '#'
+    // quedan reservados para el kernel.
+    namespace detail
+    {
+        consteval size_t decimal_digits(size_t value)
+        {
+            size_t n = 1;
+            for (; value >= 10; value /= 10)
+                ++n;
+            return n;
+        }
+
+        template <size_t Value>
+        consteval auto decimal_text()
+        {
+            constexpr size_t len = decimal_digits(Value);
+            char buf[len + 1]{};
+            for (size_t i = len, value = Value; i > 0; --i, value /= 10)
+                buf[i - 1] = static_cast<char>('0' + value % 10);
+            return FixedString<len + 1>(buf);
+        }
+
+        template <size_t Level>
+        consteval auto bound_name()
+        {
+            return concat(FixedString("#"), decimal_text<Level>());
+        }
+    } // namespace detail
+
+    template <size_t Level>
+    using BoundVar = Var<detail::bound_name<Level>()>;
+
+    namespace detail
+    {
+        // Map: ligaduras de las variables ligadas visibles, la más interna primero
+        template <size_t Level, typename Map>
+        struct DeBruijnEnv
+        {
+            using map = Map;
+        };
+
+        template <typename Shape, typename V, typename Body, typename Env>
+        struct DeBruijnBinder;
+
+        struct DeBruijnPass
+        {
+            template <typename Node, typename Env>
+            using apply = typename Transform<DeBruijnPass, Node, Env>::type;
+
+            template <typename V, typename Env>
+            using variable = typename Lookup<V, typename Env::map>::type;
+
+            template <typename Shape, typename V, typename Body, typename Env>
+            using binder = typename DeBruijnBinder<Shape, V, Body, Env>::type;
+        };
+
+        template <typename Shape, typename V, typename Body, size_t Level, typename... Bs>
+        struct DeBruijnBinder<Shape, V, Body, DeBruijnEnv<Level, TypeList<Bs...>>>
+        {
+            using Bound = BoundVar<Level>;
+            using Env = DeBruijnEnv<Level + 1, TypeList<Binding<V, Bound>, Bs...>>;
+            using type = typename Shape::template rebind<Bound, DeBruijnPass::apply<Body, Env>>;
+        };
+    } // namespace detail
+
+    template <typename Node, size_t Level, typename Map>
+    struct DeBruijn
+    {
+        using type = typename detail::Transform<detail::DeBruijnPass, Node, detail::DeBruijnEnv<Level, Map>>::type;
+    };
+
+    template <typename F>
+    using DeBruijn_t = typename DeBruijn<std::remove_cv_t<F>, 0, TypeList<>>::type;
+
+    template <typename A, typename B>
+    inline constexpr bool alpha_equivalent_v = std::is_same_v<DeBruijn_t<A>, DeBruijn_t<B>>;
+
+    template <typename A, typename B>
+    constexpr bool alpha_equivalent(A, B) { return alpha_equivalent_v<A, B>; }
+
+    // Modo canónico: con LOGIC_ALPHA_CANONICAL las reglas devuelven sus
+    // fórmulas en forma canónica, de modo que teoremas α-equivalentes son el
+    // mismo tipo (una sola instanciación por lema) y los contextos se
+    // deduplican módulo renombrado. Como LOGIC_COMPACT_NAMES, debe tener el
+    // mismo valor en todo el programa.
+#ifndef LOGIC_ALPHA_CANONICAL
+#define LOGIC_ALPHA_CANONICAL 0
+#endif
+
+    namespace detail
+    {
+        template <typename F, bool Canonical = LOGIC_ALPHA_CANONICAL>
+        struct RuleFormula
+        {
+            using type = F;
+        };
+
+        template <typename F>
+        struct RuleFormula<F, true>
+        {
+            using type = DeBruijn_t<F>;
+        };
+
+        template <typename F>
+        using RuleFormula_t = typename RuleFormula<F>::type;
+    } // namespace detail
+
+    // --- Medidas e impresión ---
+    // Más álgebras sobre los mismos recorridos: tamaño (número de nodos sin
+    // contar la variable de cada cuantificador), profundidad, hash estructural
+    // y texto. Cada una se calcula una vez por subfórmula distinta.
+    namespace detail
+    {
+        struct SizeAlgebra
+        {
+            static consteval size_t leaf(NodeInfo) { return 1; }
+
+            template <typename... Sizes>
+            static consteval size_t combine(NodeInfo, Sizes... sizes) { return (size_t{1} + ... + sizes); }
+
+            static consteval size_t bind(NodeInfo, size_t, size_t body) { return 1 + body; }
+        };
+
+        struct DepthAlgebra
+        {
+            static consteval size_t leaf(NodeInfo) { return 1; }
+
+            template <typename... Depths>
+            static consteval size_t combine(NodeInfo, Depths... depths) { return 1 + std::max({size_t{0}, depths...}); }
+
+            static consteval size_t bind(NodeInfo, size_t, size_t body) { return 1 + body; }
+        };
+
+        // Etiqueta, clase de nodo, variable ligada e hijos en orden: fórmulas
+        // α-equivalentes solo comparten hash en forma canónica (DeBruijn_t).
+        // Es constexpr para que runtime::TermStore calcule el mismo hash.
+        struct HashAlgebra
+        {
+            static constexpr std::uint64_t mix(std::uint64_t hash, std::uint64_t value)
+            {
+                return (hash ^ value) * 1099511628211ull;
+            }
+
+            static constexpr std::uint64_t leaf(NodeInfo info)
+            {
+                return mix(fnv1a(info.label), static_cast<std::uint64_t>(info.kind));
+            }
+
+            template <typename... Hashes>
+            static constexpr std::uint64_t combine(NodeInfo info, Hashes... hashes)
+            {
+                std::uint64_t hash = leaf(info);
+                ((hash = mix(hash, hashes)), ...);
+                return hash;
+            }
+
+            static constexpr std::uint64_t bind(NodeInfo info, std::uint64_t variable, std::uint64_t body)
+            {
+                return mix(mix(leaf(info), variable), body);
+            }
+        };
+
+        template <FixedString S>
+        struct Text
+        {
+            static constexpr auto value = S;
+        };
+
+        template <typename Shape>
+        consteval auto label_text()
+        {
+            constexpr std::string_view text = Shape::info.label;
+            char buf[text.size() + 1]{};
+            std::copy_n(text.data(), text.size(), buf);
+            return FixedString<text.size() + 1>(buf);
+        }
+
+        template <size_t N, size_t... Ns>
+        consteval auto join(const FixedString<N> &first, const FixedString<Ns> &...rest)
+        {
+            return concat(first, concat(FixedString(", "), rest)...);
+        }
+
+        // Símbolo alfanumérico (se imprime con paréntesis). constexpr y no
+        // consteval: la impresión de runtime (formula_arena.hpp) usa la misma
+        constexpr bool is_identifier(std::string_view text)
+        {
+            const char c = text.empty() ? ' ' : text.front();
+            return c == '_' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+        }
+
+        template <size_t Op, size_t L, size_t R>
+        consteval auto infix(const FixedString<Op> &op, const FixedString<L> &left, const FixedString<R> &right)
+        {
+            return concat(FixedString("("), left, FixedString(" "), op, FixedString(" "), right, FixedString(")"));
+        }
+
+        // Notación: P(x, y), S(n), ¬φ, (φ ∧ ψ); los símbolos alfanuméricos se
+        // escriben como llamadas
+        template <typename Shape, size_t... Ns>
+        consteval auto render(const FixedString<Ns> &...children)
+        {
+            constexpr auto text = label_text<Shape>();
+            if constexpr (sizeof...(Ns) == 0)
+                return text;
+            else if constexpr (is_identifier(Shape::info.label) || sizeof...(Ns) > 2)
+                return concat(text, FixedString("("), join(children...), FixedString(")"));
+            else if constexpr (sizeof...(Ns) == 1)
+                return concat(text, children...);
+            else
+                return infix(text, children...);
+        }
+
+        struct TextAlgebra
+        {
+            template <typename Node>
+            using leaf = Text<label_text<LeafShape<Node>>()>;
+
+            template <typename Shape, typename... Texts>
+            using combine = Text<render<Shape>(Texts::value...)>;
+
+            // ∀x. φ
+            template <typename Shape, typename V, typename Body>
+            using bind = Text<concat(label_text<Shape>(), label_text<LeafShape<V>>(), FixedString(". "), Body::value)>;
+        };
+    } // namespace detail
+
+    template <typename F>
+    inline constexpr size_t formula_size_v = fold_v<detail::SizeAlgebra, std::remove_cv_t<F>>;
+
+    template <typename F>
+    inline constexpr size_t formula_depth_v = fold_v<detail::DepthAlgebra, std::remove_cv_t<F>>;
+
+    template <typename F>
+    inline constexpr std::uint64_t formula_hash_v = fold_v<detail::HashAlgebra, std::remove_cv_t<F>>;
+
+    template <typename F>
+    inline constexpr auto formula_text_v = Fold_t<detail::TextAlgebra, std::remove_cv_t<F>>::value;
+
+    // Texto de una fórmula, calculado en compilación
+    template <typename F>
+    constexpr std::string_view to_string(F)
+    {
+        return std::string_view(formula_text_v<F>.buf, sizeof(formula_text_v<F>.buf) - 1);
+    }
 
     // =========================================================
     // === DEDUCTIVE SYSTEM (Natural Deduction) ===
@@ -288,12 +1845,32 @@ namespace logic
         constexpr Theorem() = default;
     };
 
+    // Representante canónico módulo α: hipótesis y conclusión en forma de
+    // De Bruijn, contexto ordenado y sin duplicados
+    template <typename Thm>
+    struct CanonicalTheorem;
+
+    template <typename... Hyps, typename Formula>
+    struct CanonicalTheorem<Theorem<TypeList<Hyps...>, Formula>>
+    {
+        using type = Theorem<CanonicalContext_t<TypeList<DeBruijn_t<Hyps>...>>, DeBruijn_t<Formula>>;
+    };
+
+    template <typename Thm>
+    using CanonicalTheorem_t = typename CanonicalTheorem<std::remove_cv_t<Thm>>::type;
+
+    template <typename Ctx, typename Formula>
+    constexpr auto canonical(Theorem<Ctx, Formula>) -> CanonicalTheorem_t<Theorem<Ctx, Formula>>
+    {
+        return {};
+    }
+
     // --- REGLAS DE INFERENCIA (CON IMPLEMENTACIONES INLINE) ---
 
     // 1. Assumption (Gamma, A |- A)
     template <typename A>
         requires ValidFormula<A>
-    constexpr auto assume() -> Theorem<TypeList<A>, A>
+    constexpr auto assume() -> Theorem<TypeList<detail::RuleFormula_t<A>>, detail::RuleFormula_t<A>>
     {
         return {};
     }
@@ -302,7 +1879,7 @@ namespace logic
     // Descarga la hipótesis A del contexto de B
     template <typename Hyp, typename Ctx, typename Conseq>
     constexpr auto implies_intro(Theorem<Ctx, Conseq>)
-        -> Theorem<DischargeContext_t<Hyp, Ctx>, Implies<Hyp, Conseq>>
+        -> Theorem<DischargeContext_t<detail::RuleFormula_t<Hyp>, Ctx>, Implies<detail::RuleFormula_t<Hyp>, Conseq>>
     {
         return {};
     }
@@ -318,14 +1895,14 @@ namespace logic
 
     // 4. Axiom Identity (Ahora derivado o mantenido como base vacía)
     template <typename A>
-    constexpr auto axiom_identity(A) -> Theorem<TypeList<>, Implies<A, A>>
+    constexpr auto axiom_identity(A) -> Theorem<TypeList<>, detail::RuleFormula_t<Implies<A, A>>>
     {
         return {};
     }
 
     // 5. Generalization (Mantiene contexto)
     template <typename V, typename Ctx, typename A>
-    constexpr auto generalization(V, Theorem<Ctx, A>) -> Theorem<Ctx, Forall<V, A>>
+    constexpr auto generalization(V, Theorem<Ctx, A>) -> Theorem<Ctx, detail::RuleFormula_t<Forall<V, A>>>
     {
         return {};
     }
@@ -333,7 +1910,130 @@ namespace logic
     // 6. Universal Instantiation (Mantiene contexto)
     template <typename V, typename Ctx, typename Body, typename Term>
     constexpr auto universal_instantiation(Theorem<Ctx, Forall<V, Body>>, Term)
-        -> Theorem<Ctx, Substitute_t<Body, V, Term>>
+        -> Theorem<Ctx, detail::RuleFormula_t<Substitute_t<Body, V, Term>>>
+    {
+        return {};
+    }
+
+    // 7. Instanciación universal múltiple: ∀x1 ... ∀xn. A  ⊢  A[x1 := t1, ..., xn := tn]
+    // Quita los n primeros ∀ y sustituye todas sus variables en un solo
+    // recorrido del cuerpo, en lugar de n llamadas a universal_instantiation.
+    namespace detail
+    {
+        template <typename Formula, typename Map, typename... Terms>
+        struct InstantiateAll
+        {
+            static_assert(sizeof...(Terms) == 0,
+                          "ERROR: instantiate_all recibe más términos que cuantificadores universales tiene la fórmula.");
+            using type = RuleFormula_t<SubstituteAll_t<Formula, Map>>;
+        };
+
+        // Cada ligadura nueva va delante: en el mapa vale la primera, así que un
+        // ∀ interior con la misma variable oculta al exterior
+        template <typename V, typename Body, typename... Bs, typename Term, typename... Terms>
+        struct InstantiateAll<Forall<V, Body>, TypeList<Bs...>, Term, Terms...>
+            : InstantiateAll<Body, TypeList<Binding<V, Term>, Bs...>, Terms...>
+        {
+        };
+    } // namespace detail
+
+    template <typename Ctx, typename Formula, typename... Terms>
+    constexpr auto instantiate_all(Theorem<Ctx, Formula>, Terms...)
+        -> Theorem<Ctx, typename detail::InstantiateAll<Formula, TypeList<>, Terms...>::type>
+    {
+        return {};
+    }
+
+    // 8. Demostraciones con traza
+    // Un Theorem solo guarda su conclusión. Traced<Thm, Proof> es el mismo
+    // teorema (hereda de Thm, así que vale donde valga Thm) y además el árbol
+    // de reglas que lo demuestra, como tipo: las seis reglas de arriba lo
+    // extienden cuando sus premisas tienen traza. Es lo que exporta
+    // runtime::ProofExporter (proof_checker.hpp) a un certificado. Otra regla
+    // (instantiate_all, inducción) o una premisa sin traza devuelven un
+    // Theorem normal. Con LOGIC_TRACE_PROOFS, ASSUME y BY_AXIOM empiezan con
+    // traza y las demostraciones escritas con las macros la conservan; como
+    // LOGIC_ALPHA_CANONICAL, debe tener el mismo valor en todo el programa.
+#ifndef LOGIC_TRACE_PROOFS
+#define LOGIC_TRACE_PROOFS 0
+#endif
+
+    namespace proof
+    {
+        template <typename A>
+        struct Assume
+        {
+        };
+
+        template <typename Hyp, typename Premise>
+        struct ImpliesIntro
+        {
+        };
+
+        template <typename Antecedent, typename Implication>
+        struct ModusPonens
+        {
+        };
+
+        template <typename A>
+        struct AxiomIdentity
+        {
+        };
+
+        template <typename V, typename Premise>
+        struct Generalization
+        {
+        };
+
+        template <typename Premise, typename Term>
+        struct UniversalInstantiation
+        {
+        };
+    } // namespace proof
+
+    template <typename Thm, typename Proof>
+    struct Traced : Thm
+    {
+        using theorem_type = Thm;
+        using proof_type = Proof;
+    };
+
+    template <typename A>
+        requires ValidFormula<A>
+    constexpr auto traced_assume() -> Traced<decltype(assume<A>()), proof::Assume<std::remove_cv_t<detail::RuleFormula_t<A>>>>
+    {
+        return {};
+    }
+
+    template <typename A>
+    constexpr auto traced_axiom_identity(A) -> Traced<decltype(axiom_identity(A{})), proof::AxiomIdentity<A>>
+    {
+        return {};
+    }
+
+    template <typename Hyp, typename Thm, typename P>
+    constexpr auto implies_intro(Traced<Thm, P>)
+        -> Traced<decltype(implies_intro<Hyp>(Thm{})), proof::ImpliesIntro<std::remove_cv_t<detail::RuleFormula_t<Hyp>>, P>>
+    {
+        return {};
+    }
+
+    template <typename Thm1, typename P1, typename Thm2, typename P2>
+    constexpr auto modus_ponens(Traced<Thm1, P1>, Traced<Thm2, P2>)
+        -> Traced<decltype(modus_ponens(Thm1{}, Thm2{})), proof::ModusPonens<P1, P2>>
+    {
+        return {};
+    }
+
+    template <typename V, typename Thm, typename P>
+    constexpr auto generalization(V, Traced<Thm, P>) -> Traced<decltype(generalization(V{}, Thm{})), proof::Generalization<V, P>>
+    {
+        return {};
+    }
+
+    template <typename Thm, typename P, typename Term>
+    constexpr auto universal_instantiation(Traced<Thm, P>, Term)
+        -> Traced<decltype(universal_instantiation(Thm{}, Term{})), proof::UniversalInstantiation<P, Term>>
     {
         return {};
     }
@@ -343,12 +2043,18 @@ namespace logic
     // =========================================================
 
     // Macros para hacer las demostraciones más legibles
+#if LOGIC_TRACE_PROOFS
+    #define ASSUME(formula) traced_assume<decltype(formula)>()
+    #define BY_AXIOM(formula) traced_axiom_identity(formula)
+#else
     #define ASSUME(formula) assume<decltype(formula)>()
+    #define BY_AXIOM(formula) axiom_identity(formula)
+#endif
     #define DISCHARGE(hyp, theorem) implies_intro<decltype(hyp)>(theorem)
     #define APPLY_MP(a, b) modus_ponens(a, b)
-    #define BY_AXIOM(formula) axiom_identity(formula)
     #define FORALL_INTRO(var, theorem) generalization(var, theorem)
     #define FORALL_ELIM(theorem, term) universal_instantiation(theorem, term)
+    #define FORALL_ELIM_ALL(theorem, ...) instantiate_all(theorem, __VA_ARGS__)
 
     // Macros para inducción y aritmética
     #define INDUCTION(base_case, inductive_step) induction_principle(base_case, inductive_step)
@@ -412,6 +2118,21 @@ namespace logic
     template<typename N>
     constexpr auto succ(N) { return Succ<N>{}; }
 
+    // Succ es un nodo compuesto más (S(n)); Natural<N> es una constante que
+    // se imprime con su valor
+    template<>
+    inline constexpr std::string_view operator_symbol<Succ> = "S";
+
+    template<size_t N>
+    struct LeafShape<Natural<N>> {
+        static constexpr auto digits = detail::decimal_text<N>();
+        static constexpr NodeInfo info = {NodeKind::Constant, std::string_view(digits.buf, sizeof(digits.buf) - 1)};
+    };
+
+    // En la clave estructural el valor sustituye a la etiqueta
+    template<size_t N>
+    inline constexpr auto detail::structure_key<Natural<N>> = detail::numeral_key(N);
+
     // --- PREDICADOS ARITMÉTICOS ---
     
     // Predicados básicos para aritmética (como tipos, no funciones)
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace logic::runtime
+{
+
+    // =========================================================
+    // === MEMORY-MAPPED FILES ===
+    // =========================================================
+    //
+    // Fichero de solo lectura proyectado en memoria: text() es una vista sobre
+    // su contenido, sin copiarlo, válida mientras viva el objeto. Pensado para
+    // pasar documentos grandes directamente al Parser. Los errores lanzan
+    // std::system_error.
+    class MappedFile
+    {
+    public:
+        explicit MappedFile(const std::string &path)
+        {
+#if defined(_WIN32)
+            file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file_ == INVALID_HANDLE_VALUE)
+                fail("CreateFile", path);
+            LARGE_INTEGER size{};
+            if (!GetFileSizeEx(file_, &size))
+                fail("GetFileSize", path);
+            size_ = static_cast<size_t>(size.QuadPart);
+            if (size_ == 0)
+                return;
+            mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping_ == nullptr)
+                fail("CreateFileMapping", path);
+            data_ = static_cast<const char *>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+            if (data_ == nullptr)
+                fail("MapViewOfFile", path);
+#else
+            file_ = ::open(path.c_str(), O_RDONLY);
+            if (file_ < 0)
+                fail("open", path);
+            struct stat info{};
+            if (::fstat(file_, &info) != 0)
+                fail("fstat", path);
+            size_ = static_cast<size_t>(info.st_size);
+            if (size_ == 0)
+                return;
+            void *data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file_, 0);
+            if (data == MAP_FAILED)
+                fail("mmap", path);
+            data_ = static_cast<const char *>(data);
+            ::madvise(data, size_, MADV_SEQUENTIAL);
+#endif
+        }
+
+        MappedFile(MappedFile &&other) noexcept
+            : file_(std::exchange(other.file_, invalid_file)),
+#if defined(_WIN32)
+              mapping_(std::exchange(other.mapping_, nullptr)),
+#endif
+              data_(std::exchange(other.data_, nullptr)), size_(std::exchange(other.size_, 0))
+        {
+        }
+
+        MappedFile &operator=(MappedFile &&other) noexcept
+        {
+            if (this != &other)
+            {
+                close();
+                file_ = std::exchange(other.file_, invalid_file);
+#if defined(_WIN32)
+                mapping_ = std::exchange(other.mapping_, nullptr);
+#endif
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+            }
+            return *this;
+        }
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        ~MappedFile() { close(); }
+
+        std::string_view text() const { return std::string_view(data_, data_ ? size_ : 0); }
+        size_t size() const { return size_; }
+
+    private:
+#if defined(_WIN32)
+        static inline const HANDLE invalid_file = INVALID_HANDLE_VALUE;
+#else
+        static constexpr int invalid_file = -1;
+#endif
+
+        [[noreturn]] void fail(const char *call, const std::string &path)
+        {
+#if defined(_WIN32)
+            const std::error_code error(static_cast<int>(GetLastError()), std::system_category());
+#else
+            const std::error_code error(errno, std::system_category());
+#endif
+            close();
+            throw std::system_error(error, std::string(call) + ": " + path);
+        }
+
+        void close() noexcept
+        {
+#if defined(_WIN32)
+            if (data_ != nullptr)
+                UnmapViewOfFile(data_);
+            if (mapping_ != nullptr)
+                CloseHandle(mapping_);
+            if (file_ != INVALID_HANDLE_VALUE)
+                CloseHandle(file_);
+            mapping_ = nullptr;
+#else
+            if (data_ != nullptr)
+                ::munmap(const_cast<char *>(data_), size_);
+            if (file_ >= 0)
+                ::close(file_);
+#endif
+            file_ = invalid_file;
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+#if defined(_WIN32)
+        HANDLE file_ = INVALID_HANDLE_VALUE;
+        HANDLE mapping_ = nullptr;
+#else
+        int file_ = -1;
+#endif
+        const char *data_ = nullptr;
+        size_t size_ = 0;
+    };
+
+} // namespace logic::runtime
@@ -0,0 +1,624 @@
+#pragma once
+
+#include "formula_arena.hpp"
+
+#include <array>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace logic::runtime
+{
+
+    // =========================================================
+    // === TEXT PARSER (Runtime Formulas) ===
+    // =========================================================
+    //
+    // Lee fórmulas escritas con la misma sintaxis que el DSL y las construye
+    // en cualquier FormulaBuilder (FormulaArena o TermStore):
+    //
+    //   plus_succ: forall(n, m, k, (IsNat(n) && IsNat(m) && Plus(n, m, k)) >> Plus(n, S(m), S(k)));
+    //
+    //   - conectivas: ! && || >> == con la precedencia y asociatividad de
+    //     C++ (! > >> > == > && > ||, todas por la izquierda), para que el
+    //     texto copiado de las cabeceras signifique lo mismo
+    //   - forall(x, y, ..., φ) y exists(x, ..., φ)
+    //   - también la notación de to_string: ¬ ∧ ∨ → ↔ y ∀x. φ / ∃x. φ (el
+    //     cuerpo de ∀x. se lee como el operando de ¬)
+    //   - y la notación matemática habitual, que liga menos que los
+    //     operadores de C++: <-> (↔) < -> (→, por la derecha) < | (∨) < & (∧),
+    //     ~ como negación, t = u como Equal(t, u) y forall x y. φ /
+    //     exists x. φ, cuyo cuerpo llega tan lejos como sea posible:
+    //
+    //       forall n m. Natural(n) & Natural(m) & S(n) = S(m) -> n = m
+    //
+    //   - en posición de fórmula, P(t, ...) es un predicado y un nombre solo
+    //     (R) un predicado sin argumentos; en posición de término, f(t, ...)
+    //     es un símbolo de función (S(n)), un nombre solo es una variable y
+    //     un número es una constante, igual que reify con Succ y Natural
+    //   - un documento es una secuencia de enunciados `[nombre:] fórmula`
+    //     separados por ';', con comentarios // hasta fin de línea
+    //
+    // El parser no copia el texto: los tokens y los nombres de los
+    // enunciados son vistas sobre la fuente, y cada nombre se copia una sola
+    // vez al internarlo. Tampoco reserva memoria por nodo: los argumentos en
+    // curso se apilan en una única pila que se reutiliza. Los errores lanzan
+    // ParseError con línea y columna.
+    //
+    // La misma gramática lee los literales Formula_t<"..."> de
+    // formula_literal.hpp en una evaluación constante, con un builder que
+    // escribe una imagen plana de nodos.
+
+    class ParseError : public std::runtime_error
+    {
+    public:
+        ParseError(const std::string &message, size_t line, size_t column)
+            : std::runtime_error(message + " (línea " + std::to_string(line) + ", columna " + std::to_string(column) + ")"),
+              line_(line), column_(column)
+        {
+        }
+
+        size_t line() const { return line_; }
+        size_t column() const { return column_; }
+
+    private:
+        size_t line_;
+        size_t column_;
+    };
+
+    // Enunciado de un documento: el nombre (vacío si no tiene) es una vista
+    // sobre la fuente
+    struct Statement
+    {
+        std::string_view name;
+        NodeId formula;
+    };
+
+    namespace detail
+    {
+        enum class TokenKind : std::uint8_t
+        {
+            End,
+            Identifier,
+            Number,
+            LParen,
+            RParen,
+            Comma,
+            Dot,
+            Colon,
+            Semicolon,
+            Not,
+            And,
+            Or,
+            Implies,
+            Equiv,
+            Forall,
+            Exists,
+            // Notación matemática
+            Amp,
+            Bar,
+            Arrow,
+            DoubleArrow,
+            Equals
+        };
+
+        struct Token
+        {
+            TokenKind kind;
+            std::string_view text;
+        };
+
+        constexpr bool is_digit(char c) { return c >= '0' && c <= '9'; }
+        constexpr bool is_name_start(char c) { return c == '_' || c == '#' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+        constexpr bool is_name_char(char c) { return is_name_start(c) || is_digit(c) || c == '\''; }
+
+        // Símbolos de to_string
+        struct Spelling
+        {
+            std::string_view text;
+            TokenKind kind;
+        };
+
+        inline constexpr Spelling unicode_spellings[] = {
+            {operator_symbol<Not>, TokenKind::Not},
+            {operator_symbol<And>, TokenKind::Amp},
+            {operator_symbol<Or>, TokenKind::Bar},
+            {operator_symbol<Implies>, TokenKind::Arrow},
+            {operator_symbol<Equiv>, TokenKind::DoubleArrow},
+            {binder_symbol<Forall>, TokenKind::Forall},
+            {binder_symbol<Exists>, TokenKind::Exists},
+        };
+
+        constexpr NodeOp binary_op(TokenKind kind)
+        {
+            switch (kind)
+            {
+            case TokenKind::And:
+            case TokenKind::Amp:
+                return NodeOp::And;
+            case TokenKind::Or:
+            case TokenKind::Bar:
+                return NodeOp::Or;
+            case TokenKind::Implies:
+            case TokenKind::Arrow:
+                return NodeOp::Implies;
+            default:
+                return NodeOp::Equiv;
+            }
+        }
+
+        // t = u se lee como el átomo de logic::Equal
+        inline constexpr std::string_view equality = "Equal";
+
+        // Notación matemática (<-> < -> < | < &) y después la precedencia de
+        // C++ (|| < && < == < >>); 0 si el token no es un operador binario
+        constexpr size_t precedence(TokenKind kind)
+        {
+            switch (kind)
+            {
+            case TokenKind::DoubleArrow:
+                return 1;
+            case TokenKind::Arrow:
+                return 2;
+            case TokenKind::Bar:
+                return 3;
+            case TokenKind::Amp:
+                return 4;
+            case TokenKind::Or:
+                return 5;
+            case TokenKind::And:
+                return 6;
+            case TokenKind::Equiv:
+                return 7;
+            case TokenKind::Implies:
+                return 8;
+            default:
+                return 0;
+            }
+        }
+
+        // Espacios y comentarios // hasta fin de línea
+        constexpr size_t skip_space(std::string_view source, size_t pos)
+        {
+            for (;;)
+            {
+                while (pos < source.size() && (source[pos] == ' ' || source[pos] == '\t' || source[pos] == '\r' || source[pos] == '\n'))
+                    ++pos;
+                if (pos + 1 >= source.size() || source[pos] != '/' || source[pos + 1] != '/')
+                    return pos;
+                while (pos < source.size() && source[pos] != '\n')
+                    ++pos;
+            }
+        }
+
+        struct Symbol
+        {
+            TokenKind kind;
+            size_t length;
+        };
+
+        // Puntuación u operador que empieza en pos (End si no hay ninguno)
+        constexpr Symbol symbol_at(std::string_view source, size_t pos)
+        {
+            const char c = source[pos];
+            // Un solo carácter decide el token; los símbolos UTF-8 de
+            // to_string se buscan solo si el byte no es ASCII
+            TokenKind kind = TokenKind::End;
+            size_t length = 1;
+            const char next = pos + 1 < source.size() ? source[pos + 1] : '\0';
+            switch (c)
+            {
+            case '(':
+                kind = TokenKind::LParen;
+                break;
+            case ')':
+                kind = TokenKind::RParen;
+                break;
+            case ',':
+                kind = TokenKind::Comma;
+                break;
+            case '.':
+                kind = TokenKind::Dot;
+                break;
+            case ':':
+                kind = TokenKind::Colon;
+                break;
+            case ';':
+                kind = TokenKind::Semicolon;
+                break;
+            case '!':
+            case '~':
+                kind = TokenKind::Not;
+                break;
+            case '&':
+            case '|':
+            case '=':
+                if (next == c)
+                {
+                    kind = c == '&' ? TokenKind::And : c == '|' ? TokenKind::Or : TokenKind::Equiv;
+                    length = 2;
+                }
+                else
+                    kind = c == '&' ? TokenKind::Amp : c == '|' ? TokenKind::Bar : TokenKind::Equals;
+                break;
+            case '>':
+                if (next == '>')
+                {
+                    kind = TokenKind::Implies;
+                    length = 2;
+                }
+                break;
+            case '-':
+                if (next == '>')
+                {
+                    kind = TokenKind::Arrow;
+                    length = 2;
+                }
+                break;
+            case '<':
+                if (source.substr(pos, 3) == "<->")
+                {
+                    kind = TokenKind::DoubleArrow;
+                    length = 3;
+                }
+                break;
+            default:
+                if (static_cast<unsigned char>(c) >= 0x80)
+                    for (const Spelling &spelling : unicode_spellings)
+                        if (source.substr(pos).starts_with(spelling.text))
+                        {
+                            kind = spelling.kind;
+                            length = spelling.text.size();
+                        }
+            }
+            return {kind, length};
+        }
+
+        // Pila contigua con los N primeros elementos en el propio objeto: los
+        // argumentos y las variables en curso casi nunca pasan de unos
+        // pocos, y la memoria dinámica es lo más caro de leer un Formula_t
+        // en una evaluación constante. Al desbordar pasa entera a un vector.
+        template <typename T, size_t N>
+        class SmallStack
+        {
+        public:
+            constexpr size_t size() const { return size_; }
+            constexpr const T *data() const { return spilled_ ? heap_.data() : inline_; }
+            constexpr const T &back() const { return data()[size_ - 1]; }
+
+            constexpr void push_back(const T &value)
+            {
+                if (!spilled_ && size_ == N)
+                {
+                    heap_.assign(inline_, inline_ + N);
+                    spilled_ = true;
+                }
+                if (spilled_)
+                    heap_.push_back(value);
+                else
+                    inline_[size_] = value;
+                ++size_;
+            }
+
+            constexpr void pop_back() { resize(size_ - 1); }
+
+            // Solo para encoger
+            constexpr void resize(size_t size)
+            {
+                if (spilled_)
+                    heap_.resize(size);
+                size_ = size;
+            }
+
+        private:
+            T inline_[N]{};
+            size_t size_ = 0;
+            bool spilled_ = false; // Desde que desborda, los elementos están en heap_
+            std::vector<T> heap_;
+        };
+    } // namespace detail
+
+    template <FormulaBuilder Builder>
+    class Parser
+    {
+    public:
+        // Límite de anidamiento (paréntesis, ¬, cuantificadores, argumentos)
+        static constexpr size_t max_depth = 4096;
+
+        constexpr Parser(std::string_view source, Builder &builder)
+            : source_(source), builder_(builder)
+        {
+            advance();
+        }
+
+        constexpr bool done() const { return token_.kind == detail::TokenKind::End; }
+
+        // Siguiente enunciado del documento, o nullopt al final
+        constexpr std::optional<Statement> next()
+        {
+            while (accept(detail::TokenKind::Semicolon))
+                ;
+            if (done())
+                return std::nullopt;
+
+            Statement statement{{}, 0};
+            if (token_.kind == detail::TokenKind::Identifier && peek().kind == detail::TokenKind::Colon)
+            {
+                statement.name = token_.text;
+                advance();
+                advance();
+            }
+            statement.formula = formula();
+            if (!done())
+                expect(detail::TokenKind::Semicolon, "se esperaba ';' al final del enunciado");
+            return statement;
+        }
+
+        // Una fórmula completa (sin nombre ni ';')
+        constexpr NodeId formula() { return binary(0); }
+
+    private:
+        using TokenKind = detail::TokenKind;
+
+        // --- Léxico ---
+        // Los tokens son vistas sin substr (ya están dentro del texto): en
+        // una evaluación constante cada comprobación de límites cuenta
+        constexpr detail::Token lex(size_t &pos) const
+        {
+            if (pos == source_.size() || static_cast<unsigned char>(source_[pos]) <= ' ' || source_[pos] == '/')
+                pos = detail::skip_space(source_, pos);
+            const size_t start = pos;
+            if (pos == source_.size())
+                return {TokenKind::End, std::string_view(source_.data() + pos, 0)};
+
+            const char c = source_[pos];
+            if (detail::is_name_start(c) || detail::is_digit(c))
+            {
+                const bool number = detail::is_digit(c);
+                while (pos < source_.size() && (number ? detail::is_digit(source_[pos]) : detail::is_name_char(source_[pos])))
+                    ++pos;
+                return {number ? TokenKind::Number : TokenKind::Identifier, std::string_view(source_.data() + start, pos - start)};
+            }
+            const detail::Symbol symbol = detail::symbol_at(source_, pos);
+            if (symbol.kind == TokenKind::End)
+                fail("carácter inesperado", start);
+            pos += symbol.length;
+            return {symbol.kind, std::string_view(source_.data() + start, symbol.length)};
+        }
+
+        constexpr void advance()
+        {
+            token_ = lex(end_);
+            offset_ = static_cast<size_t>(token_.text.data() - source_.data());
+        }
+
+        constexpr detail::Token peek() const
+        {
+            size_t pos = end_;
+            return lex(pos);
+        }
+
+        constexpr bool accept(TokenKind kind)
+        {
+            if (token_.kind != kind)
+                return false;
+            advance();
+            return true;
+        }
+
+        constexpr std::string_view expect(TokenKind kind, const char *message)
+        {
+            const std::string_view text = token_.text;
+            if (!accept(kind))
+                fail(message);
+            return text;
+        }
+
+        [[noreturn]] constexpr void fail(const char *message) const { fail(message, offset_); }
+
+        [[noreturn]] constexpr void fail(const char *message, size_t offset) const
+        {
+            size_t line = 1, column = 1;
+            for (size_t i = 0; i < offset && i < source_.size(); ++i)
+                source_[i] == '\n' ? (++line, column = 1) : ++column;
+            throw ParseError(message, line, column);
+        }
+
+        // --- Sintaxis ---
+        struct Nesting
+        {
+            constexpr explicit Nesting(Parser &parser) : parser(parser)
+            {
+                if (++parser.depth_ > max_depth)
+                    parser.fail("anidamiento demasiado profundo");
+            }
+            constexpr ~Nesting() { --parser.depth_; }
+            Parser &parser;
+        };
+
+        // Operadores de precedencia >= level, por escalada de precedencia:
+        // una llamada por operador en lugar de una por nivel
+        constexpr NodeId binary(size_t level)
+        {
+            NodeId left = unary();
+            for (size_t current = detail::precedence(token_.kind); current != 0 && current >= level; current = detail::precedence(token_.kind))
+            {
+                const TokenKind kind = token_.kind;
+                advance();
+                const Nesting nesting(*this);
+                // a -> b -> c es a -> (b -> c); el resto asocia por la izquierda
+                const NodeId right = binary(kind == TokenKind::Arrow ? current : current + 1);
+                left = builder_.binary(detail::binary_op(kind), left, right);
+            }
+            return left;
+        }
+
+        constexpr NodeId unary()
+        {
+            const Nesting nesting(*this);
+            if (accept(TokenKind::Not))
+                return builder_.unary(NodeOp::Not, unary());
+            if (token_.kind == TokenKind::Forall || token_.kind == TokenKind::Exists)
+            {
+                const NodeOp op = token_.kind == TokenKind::Forall ? NodeOp::Forall : NodeOp::Exists;
+                advance();
+                const std::string_view variable = expect(TokenKind::Identifier, "se esperaba la variable ligada");
+                expect(TokenKind::Dot, "se esperaba '.' tras la variable ligada");
+                return builder_.binder(op, variable, unary());
+            }
+            if (accept(TokenKind::LParen))
+            {
+                const NodeId inner = formula();
+                expect(TokenKind::RParen, "se esperaba ')'");
+                return inner;
+            }
+            if (token_.kind == TokenKind::Number)
+                return equation(term());
+            const std::string_view name = expect(TokenKind::Identifier, "se esperaba una fórmula");
+            if (name == "forall" || name == "exists")
+            {
+                const NodeOp op = name == "forall" ? NodeOp::Forall : NodeOp::Exists;
+                if (token_.kind == TokenKind::LParen)
+                    return binder_call(op);
+                if (token_.kind == TokenKind::Identifier)
+                    return binder_list(op);
+            }
+            // En t = u los dos lados son términos
+            if (token_.kind == TokenKind::Equals)
+                return equation(builder_.variable(name));
+            const NodeId id = application(name);
+            return token_.kind == TokenKind::Equals ? equation(id) : id;
+        }
+
+        constexpr NodeId equation(NodeId left)
+        {
+            expect(TokenKind::Equals, "se esperaba '='");
+            const std::array<NodeId, 2> sides{left, term()};
+            return builder_.atom(detail::equality, sides);
+        }
+
+        // forall(x, y, ..., φ): las variables se apilan y se ligan de dentro
+        // hacia fuera
+        constexpr NodeId binder_call(NodeOp op)
+        {
+            advance();
+            const size_t mark = names_.size();
+            do
+            {
+                if (token_.kind != TokenKind::Identifier || peek().kind != TokenKind::Comma)
+                    break;
+                names_.push_back(token_.text);
+                advance();
+            } while (accept(TokenKind::Comma));
+            if (names_.size() == mark)
+                fail("forall/exists necesitan al menos una variable");
+
+            const NodeId body = formula();
+            expect(TokenKind::RParen, "se esperaba ')' al final del cuantificador");
+            return bind(op, mark, body);
+        }
+
+        // forall x y. φ: el cuerpo es una fórmula completa
+        constexpr NodeId binder_list(NodeOp op)
+        {
+            const size_t mark = names_.size();
+            while (token_.kind == TokenKind::Identifier)
+            {
+                names_.push_back(token_.text);
+                advance();
+            }
+            expect(TokenKind::Dot, "se esperaba '.' tras las variables ligadas");
+            return bind(op, mark, formula());
+        }
+
+        constexpr NodeId bind(NodeOp op, size_t mark, NodeId body)
+        {
+            while (names_.size() > mark)
+            {
+                body = builder_.binder(op, names_.back(), body);
+                names_.pop_back();
+            }
+            return body;
+        }
+
+        // P(t, ...) o P; los argumentos se apilan en args_
+        constexpr NodeId application(std::string_view name)
+        {
+            const size_t mark = args_.size();
+            if (accept(TokenKind::LParen) && !accept(TokenKind::RParen))
+            {
+                do
+                    args_.push_back(term());
+                while (accept(TokenKind::Comma));
+                expect(TokenKind::RParen, "se esperaba ')' al final de los argumentos");
+            }
+            const NodeId id = builder_.atom(name, std::span<const NodeId>(args_.data() + mark, args_.size() - mark));
+            args_.resize(mark);
+            return id;
+        }
+
+        constexpr NodeId term()
+        {
+            const Nesting nesting(*this);
+            if (token_.kind == TokenKind::Number)
+            {
+                const std::string_view digits = token_.text;
+                advance();
+                return builder_.constant(digits);
+            }
+            if (accept(TokenKind::LParen))
+            {
+                const NodeId inner = term();
+                expect(TokenKind::RParen, "se esperaba ')'");
+                return inner;
+            }
+            const std::string_view name = expect(TokenKind::Identifier, "se esperaba un término");
+            if (token_.kind == TokenKind::LParen)
+                return application(name);
+            return builder_.variable(name);
+        }
+
+        std::string_view source_;
+        Builder &builder_;
+        detail::Token token_{TokenKind::End, {}};
+        size_t offset_ = 0; // Posición del token actual
+        size_t end_ = 0;    // Posición tras el token actual
+        size_t depth_ = 0;
+        detail::SmallStack<NodeId, 16> args_;
+        detail::SmallStack<std::string_view, 16> names_;
+    };
+
+    // Una sola fórmula que ocupa todo el texto
+    template <FormulaBuilder Builder>
+    constexpr NodeId parse_formula(std::string_view text, Builder &builder)
+    {
+        Parser<Builder> parser(text, builder);
+        const std::optional<Statement> statement = parser.next();
+        if (!statement || !parser.done() || !statement->name.empty())
+            throw ParseError("se esperaba exactamente una fórmula", 1, 1);
+        return statement->formula;
+    }
+
+    // Arena nueva con la fórmula como raíz
+    constexpr FormulaArena parse_formula(std::string_view text)
+    {
+        FormulaArena arena;
+        parse_formula(text, arena);
+        return arena;
+    }
+
+    // Todos los enunciados de un documento
+    template <FormulaBuilder Builder>
+    std::vector<Statement> parse_statements(std::string_view source, Builder &builder)
+    {
+        std::vector<Statement> statements;
+        Parser<Builder> parser(source, builder);
+        while (const std::optional<Statement> statement = parser.next())
+            statements.push_back(*statement);
+        return statements;
+    }
+
+} // namespace logic::runtime
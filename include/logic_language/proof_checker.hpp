@@ -0,0 +1,575 @@
+#pragma once
+
+#include "term_store.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace logic::runtime
+{
+
+    // =========================================================
+    // === PROOF CERTIFICATES (Runtime Kernel) ===
+    // =========================================================
+    //
+    // El kernel de tipos solo comprueba una demostración cuando el compilador
+    // la ve, y una demostración generada de miles de pasos cuesta minutos de
+    // compilación y gigabytes de memoria. ProofChecker es el mismo kernel en
+    // tiempo de ejecución: comprueba un certificado, una lista de
+    // aplicaciones de reglas (ProofStep) en la que cada paso solo cita pasos
+    // anteriores (un DAG en orden topológico), con las fórmulas como nodos
+    // de un TermStore. Las reglas son las seis del kernel, con la misma
+    // semántica:
+    //
+    //   assume(A)                              A ⊢ A
+    //   implies_intro(H, Γ ⊢ B)                Γ \ {H} ⊢ H → B
+    //   modus_ponens(Γ1 ⊢ A, Γ2 ⊢ A → B)       Γ1 ∪ Γ2 ⊢ B
+    //   axiom_identity(A)                      ⊢ A → A
+    //   generalization(x, Γ ⊢ A)               Γ ⊢ ∀x. A
+    //   universal_instantiation(Γ ⊢ ∀x. A, t)  Γ ⊢ A[x := t]
+    //
+    // La sustitución evita la captura igual que Substitute_t (renombrando a
+    // x', x'', ...), así que la conclusión es el nodo de la misma fórmula que
+    // da el kernel de tipos. Las fórmulas cuestan tiempo lineal en el
+    // certificado: con el hash-consing del TermStore comparar fórmulas es
+    // comparar identificadores y la conclusión de cada paso se construye en
+    // O(1); la sustitución solo recorre la parte del cuerpo donde la variable
+    // aparece libre. Los contextos son conjuntos compartidos entre los pasos
+    // que los citan: pasan sin copiarse por las reglas que no los cambian y
+    // la unión añade el menor al mayor. Solo se copia un contexto citado más
+    // de una vez cuando un paso lo cambia (descarga una hipótesis que contiene
+    // o lo une a otro no vacío), así que en el peor caso el coste es
+    // O(pasos × contexto). Un paso mal formado lanza ProofError con su índice.
+    //
+    // Los recorridos de las fórmulas son recursivos, como reify: la
+    // profundidad de anidamiento está limitada por la pila (decenas de miles
+    // de niveles; el Parser ya corta en max_depth).
+
+    using StepId = std::uint32_t;
+
+    enum class Rule : std::uint8_t
+    {
+        Assume,
+        ImpliesIntro,
+        ModusPonens,
+        AxiomIdentity,
+        Generalization,
+        UniversalInstantiation
+    };
+
+    // Pasos que cita cada regla
+    constexpr size_t premise_count(Rule rule)
+    {
+        switch (rule)
+        {
+        case Rule::ModusPonens:
+            return 2;
+        case Rule::ImpliesIntro:
+        case Rule::Generalization:
+        case Rule::UniversalInstantiation:
+            return 1;
+        default:
+            return 0;
+        }
+    }
+
+    // 16 bytes por paso. `formula` es la fórmula de assume y axiom_identity,
+    // la hipótesis de implies_intro, la variable de generalization y el
+    // término de universal_instantiation; `premises` son los pasos citados
+    // (en modus_ponens, {A, A → B}).
+    struct ProofStep
+    {
+        Rule rule;
+        NodeId formula;
+        std::array<StepId, 2> premises;
+    };
+
+    static_assert(sizeof(ProofStep) == 16, "ProofStep debe ocupar 16 bytes");
+
+    class ProofError : public std::runtime_error
+    {
+    public:
+        ProofError(const std::string &message, StepId step)
+            : std::runtime_error(message + " (paso " + std::to_string(step) + ")"), step_(step)
+        {
+        }
+
+        StepId step() const { return step_; }
+
+    private:
+        StepId step_;
+    };
+
+    // --- Certificado ---
+    // Se escribe con las mismas llamadas que una demostración del kernel;
+    // cada una devuelve el índice de su paso.
+    class ProofCertificate
+    {
+    public:
+        static constexpr StepId none = ~StepId{0};
+
+        ProofCertificate() = default;
+        explicit ProofCertificate(std::vector<ProofStep> steps) : steps_(std::move(steps)) {}
+
+        StepId assume(NodeId formula) { return push({Rule::Assume, formula, {none, none}}); }
+        StepId implies_intro(NodeId hypothesis, StepId premise) { return push({Rule::ImpliesIntro, hypothesis, {premise, none}}); }
+        StepId modus_ponens(StepId antecedent, StepId implication)
+        {
+            return push({Rule::ModusPonens, SymbolTable::npos, {antecedent, implication}});
+        }
+        StepId axiom_identity(NodeId formula) { return push({Rule::AxiomIdentity, formula, {none, none}}); }
+        StepId generalization(NodeId variable, StepId premise) { return push({Rule::Generalization, variable, {premise, none}}); }
+        StepId universal_instantiation(StepId premise, NodeId term)
+        {
+            return push({Rule::UniversalInstantiation, term, {premise, none}});
+        }
+
+        void reserve(size_t steps) { steps_.reserve(steps); }
+        std::span<const ProofStep> steps() const { return steps_; }
+        size_t size() const { return steps_.size(); }
+
+    private:
+        StepId push(const ProofStep &step)
+        {
+            steps_.push_back(step);
+            return static_cast<StepId>(steps_.size() - 1);
+        }
+
+        std::vector<ProofStep> steps_;
+    };
+
+    // Γ ⊢ φ con el contexto ordenado por NodeId y sin repetidos (un
+    // conjunto, como los contextos canónicos del kernel)
+    struct CheckedTheorem
+    {
+        std::vector<NodeId> context;
+        NodeId formula;
+    };
+
+    // --- Comprobador ---
+    // Store es TermStore o cualquier almacén con su misma interfaz: la de
+    // construcción (FormulaBuilder), operator[], children, label, contains y
+    // symbols().name/hash, con nodos compartidos (igualdad de fórmulas =
+    // igualdad de NodeId). CertificateStore (certificate_file.hpp) lo usa
+    // para comprobar un certificado binario sin copiarlo.
+    template <typename Store>
+    class BasicProofChecker
+    {
+    public:
+        explicit BasicProofChecker(Store &store) : store_(store) {}
+
+        // Comprueba todos los pasos y devuelve el teorema del último
+        CheckedTheorem check(const ProofCertificate &certificate) { return check(certificate.steps()); }
+
+        CheckedTheorem check(std::span<const ProofStep> steps)
+        {
+            if (steps.empty())
+                throw ProofError("certificado vacío", 0);
+            const StepId last = static_cast<StepId>(steps.size() - 1);
+            return std::move(check(steps, std::span<const StepId>(&last, 1)).front());
+        }
+
+        // Comprueba todos los pasos y devuelve el teorema de cada raíz (los
+        // lemas de un corpus, que comparten pasos)
+        std::vector<CheckedTheorem> check(std::span<const ProofStep> steps, std::span<const StepId> roots)
+        {
+            uses_.assign(steps.size(), 0);
+            for (StepId id = 0; id < steps.size(); ++id)
+                for (size_t i = 0; i < premise_count(steps[id].rule); ++i)
+                {
+                    if (steps[id].premises[i] >= id)
+                        throw ProofError("un paso solo puede citar pasos anteriores", id);
+                    ++uses_[steps[id].premises[i]];
+                }
+            // Cada raíz cuenta como una cita más: su contexto llega al final
+            for (const StepId root : roots)
+            {
+                if (root >= steps.size())
+                    throw ProofError("la raíz no es un paso del certificado", root);
+                ++uses_[root];
+            }
+
+            formulas_.assign(steps.size(), 0);
+            contexts_.assign(steps.size(), {});
+            for (StepId id = 0; id < steps.size(); ++id)
+            {
+                Context context = apply(steps[id], id);
+                if (uses_[id] != 0)
+                    contexts_[id] = std::move(context);
+            }
+
+            std::vector<CheckedTheorem> theorems;
+            theorems.reserve(roots.size());
+            for (const StepId root : roots)
+            {
+                theorems.push_back({{}, formulas_[root]});
+                if (const Context &context = contexts_[root])
+                {
+                    theorems.back().context.assign(context->begin(), context->end());
+                    std::ranges::sort(theorems.back().context);
+                }
+            }
+            contexts_.clear();
+            return theorems;
+        }
+
+        // Conclusión de cada paso del último certificado comprobado
+        NodeId formula(StepId step) const { return formulas_.at(step); }
+
+        // A[x := t] sin captura: el nodo de la fórmula que da Substitute_t
+        NodeId substitute(NodeId formula, NodeId variable, NodeId term)
+        {
+            if (!store_.contains(formula) || !store_.contains(variable) || !store_.contains(term))
+                throw std::out_of_range("ProofChecker::substitute: el nodo no existe");
+            if (store_[variable].op != NodeOp::Variable)
+                throw std::invalid_argument("ProofChecker::substitute: no es una variable");
+            Substitution substitution = make_substitution({{store_[variable].symbol, term}});
+            return substitute(formula, substitution);
+        }
+
+    private:
+        // Conjunto compartido; nullptr es el contexto vacío
+        using Context = std::shared_ptr<std::unordered_set<NodeId>>;
+
+        // Ligaduras variable := término (vale la primera, como en
+        // SubstituteAll_t) y los resultados ya calculados con ellas
+        struct Substitution
+        {
+            std::vector<std::pair<SymbolId, NodeId>> map;
+            std::uint64_t mask = 0;
+            std::unordered_map<NodeId, NodeId> memo;
+        };
+
+        NodeId node(const ProofStep &step, StepId id) const
+        {
+            if (!store_.contains(step.formula))
+                throw ProofError("la fórmula no existe en el TermStore", id);
+            return step.formula;
+        }
+
+        // El contexto de una premisa; su última cita se lo lleva y las demás
+        // lo comparten
+        Context take(StepId premise)
+        {
+            if (--uses_[premise] == 0)
+                return std::move(contexts_[premise]);
+            return contexts_[premise];
+        }
+
+        // El conjunto de context para cambiarlo: se copia si otro lo comparte
+        static std::unordered_set<NodeId> &own(Context &context)
+        {
+            if (!context)
+                context = std::make_shared<std::unordered_set<NodeId>>();
+            else if (context.use_count() > 1)
+                context = std::make_shared<std::unordered_set<NodeId>>(*context);
+            return *context;
+        }
+
+        Context apply(const ProofStep &step, StepId id)
+        {
+            switch (step.rule)
+            {
+            case Rule::Assume:
+                formulas_[id] = node(step, id);
+                return std::make_shared<std::unordered_set<NodeId>>(std::initializer_list<NodeId>{formulas_[id]});
+            case Rule::ImpliesIntro:
+            {
+                const NodeId hypothesis = node(step, id);
+                formulas_[id] = store_.binary(NodeOp::Implies, hypothesis, formulas_[step.premises[0]]);
+                Context context = take(step.premises[0]);
+                if (context && context->contains(hypothesis))
+                    own(context).erase(hypothesis);
+                return context;
+            }
+            case Rule::ModusPonens:
+            {
+                const NodeId implication = formulas_[step.premises[1]];
+                const Node &shape = store_[implication];
+                if (shape.op != NodeOp::Implies)
+                    throw ProofError("modus_ponens: la segunda premisa no es una implicación", id);
+                if (shape.operands[0] != formulas_[step.premises[0]])
+                    throw ProofError("modus_ponens: el antecedente no es la primera premisa", id);
+                formulas_[id] = shape.operands[1];
+                Context left = take(step.premises[0]);
+                Context right = take(step.premises[1]);
+                if (!right || right->empty() || left == right)
+                    return left;
+                if (!left || left->size() < right->size())
+                    std::swap(left, right);
+                // Compartido y ya con todas las hipótesis de right: sin copia
+                if (left.use_count() > 1 && std::ranges::all_of(*right, [&](NodeId h) { return left->contains(h); }))
+                    return left;
+                own(left).insert(right->begin(), right->end());
+                return left;
+            }
+            case Rule::AxiomIdentity:
+            {
+                const NodeId formula = node(step, id);
+                formulas_[id] = store_.binary(NodeOp::Implies, formula, formula);
+                return {};
+            }
+            case Rule::Generalization:
+            {
+                const NodeId variable = node(step, id);
+                if (store_[variable].op != NodeOp::Variable)
+                    throw ProofError("generalization: no es una variable", id);
+                formulas_[id] = store_.binder(NodeOp::Forall, store_.label(variable), formulas_[step.premises[0]]);
+                return take(step.premises[0]);
+            }
+            case Rule::UniversalInstantiation:
+            {
+                const Node &shape = store_[formulas_[step.premises[0]]];
+                if (shape.op != NodeOp::Forall)
+                    throw ProofError("universal_instantiation: la premisa no es un ∀", id);
+                Substitution substitution = make_substitution({{shape.symbol, node(step, id)}});
+                formulas_[id] = substitute(shape.operands[0], substitution);
+                return take(step.premises[0]);
+            }
+            }
+            throw ProofError("regla desconocida", id);
+        }
+
+        // --- Sustitución (la misma que Substitute_t) ---
+        // Resumen de 64 bits de las variables de cada nodo, como
+        // free_var_mask: si no corta el del mapa, el nodo no cambia
+        std::uint64_t bit(SymbolId symbol) const { return std::uint64_t{1} << (store_.symbols().hash(symbol) & 63); }
+
+        std::uint64_t mask(NodeId id)
+        {
+            if (const auto found = masks_.find(id); found != masks_.end())
+                return found->second;
+            std::uint64_t result = 0;
+            if (store_[id].op == NodeOp::Variable)
+                result = bit(store_[id].symbol);
+            else
+                for (NodeId child : store_.children(id))
+                    result |= mask(child);
+            masks_.emplace(id, result);
+            return result;
+        }
+
+        bool occurs_free(SymbolId variable, NodeId id)
+        {
+            if ((mask(id) & bit(variable)) == 0)
+                return false;
+            const Node &shape = store_[id];
+            if (shape.op == NodeOp::Variable)
+                return shape.symbol == variable;
+            if (is_binder(shape.op) && shape.symbol == variable)
+                return false;
+            for (NodeId child : store_.children(id))
+                if (occurs_free(variable, child))
+                    return true;
+            return false;
+        }
+
+        bool occurs_free_in_terms(SymbolId variable, const Substitution &substitution)
+        {
+            for (const auto &binding : substitution.map)
+                if (occurs_free(variable, binding.second))
+                    return true;
+            return false;
+        }
+
+        Substitution make_substitution(std::vector<std::pair<SymbolId, NodeId>> map) const
+        {
+            Substitution substitution{std::move(map), 0, {}};
+            for (const auto &binding : substitution.map)
+                substitution.mask |= bit(binding.first);
+            return substitution;
+        }
+
+        NodeId substitute(NodeId id, Substitution &substitution)
+        {
+            if ((mask(id) & substitution.mask) == 0)
+                return id;
+            if (const auto found = substitution.memo.find(id); found != substitution.memo.end())
+                return found->second;
+
+            const Node shape = store_[id];
+            NodeId result = id;
+            switch (shape.op)
+            {
+            case NodeOp::Variable:
+                for (const auto &binding : substitution.map)
+                    if (binding.first == shape.symbol)
+                    {
+                        result = binding.second;
+                        break;
+                    }
+                break;
+            case NodeOp::Constant:
+                break;
+            case NodeOp::Atom:
+            {
+                const std::span<const NodeId> children = store_.children(id);
+                std::vector<NodeId> args(children.begin(), children.end());
+                bool changed = false;
+                for (NodeId &arg : args)
+                {
+                    const NodeId replaced = substitute(arg, substitution);
+                    changed |= replaced != arg;
+                    arg = replaced;
+                }
+                if (changed)
+                    result = store_.atom(store_.label(id), args);
+                break;
+            }
+            case NodeOp::Not:
+                if (const NodeId operand = substitute(shape.operands[0], substitution); operand != shape.operands[0])
+                    result = store_.unary(shape.op, operand);
+                break;
+            case NodeOp::Forall:
+            case NodeOp::Exists:
+                result = substitute_binder(id, shape, substitution);
+                break;
+            default:
+            {
+                const NodeId left = substitute(shape.operands[0], substitution);
+                const NodeId right = substitute(shape.operands[1], substitution);
+                if (left != shape.operands[0] || right != shape.operands[1])
+                    result = store_.binary(shape.op, left, right);
+            }
+            }
+            substitution.memo.emplace(id, result);
+            return result;
+        }
+
+        // La variable ligada sale del mapa; si algún término la menciona y
+        // el cuerpo se va a tocar, se renombra a v', v'', ... en el mismo
+        // recorrido (SubstituteBinder)
+        NodeId substitute_binder(NodeId id, const Node &shape, Substitution &substitution)
+        {
+            const SymbolId bound = shape.symbol;
+            const NodeId body = shape.operands[0];
+            const bool shadows = std::ranges::any_of(substitution.map, [&](const auto &binding) { return binding.first == bound; });
+
+            Substitution unbound;
+            if (shadows)
+            {
+                std::vector<std::pair<SymbolId, NodeId>> rest;
+                for (const auto &binding : substitution.map)
+                    if (binding.first != bound)
+                        rest.push_back(binding);
+                if (rest.empty())
+                    return id;
+                unbound = make_substitution(std::move(rest));
+            }
+            Substitution &inner = shadows ? unbound : substitution;
+
+            if (!occurs_free_in_terms(bound, inner))
+            {
+                const NodeId replaced = substitute(body, inner);
+                return replaced == body ? id : store_.binder(shape.op, store_.symbols().name(bound), replaced);
+            }
+            if (std::ranges::none_of(inner.map, [&](const auto &binding) { return occurs_free(binding.first, body); }))
+                return id;
+
+            std::string fresh(store_.symbols().name(bound));
+            NodeId variable;
+            do
+            {
+                fresh.push_back('\'');
+                variable = store_.variable(fresh);
+            } while (occurs_free(store_[variable].symbol, body) || occurs_free_in_terms(store_[variable].symbol, inner));
+
+            std::vector<std::pair<SymbolId, NodeId>> renamed = inner.map;
+            renamed.emplace_back(bound, variable);
+            Substitution rename = make_substitution(std::move(renamed));
+            return store_.binder(shape.op, fresh, substitute(body, rename));
+        }
+
+        Store &store_;
+        std::vector<NodeId> formulas_;
+        std::vector<Context> contexts_;
+        std::vector<StepId> uses_;
+        std::unordered_map<NodeId, std::uint64_t> masks_;
+    };
+
+    using ProofChecker = BasicProofChecker<TermStore>;
+
+    // --- Exportación desde el kernel de tipos ---
+    // Baja el árbol de reglas de un Traced<Thm, Proof> (ASSUME, DISCHARGE,
+    // APPLY_MP, FORALL_INTRO, FORALL_ELIM y BY_AXIOM con LOGIC_TRACE_PROOFS)
+    // a pasos de un certificado, con las fórmulas reificadas en el TermStore.
+    // Cada subdemostración distinta (cada tipo distinto) se emite una sola
+    // vez, también entre llamadas a add, así que los lemas de un corpus que
+    // comparten pasos los comparten en el certificado.
+    class ProofExporter
+    {
+    public:
+        ProofExporter(TermStore &store, ProofCertificate &certificate) : store_(store), certificate_(certificate) {}
+
+        // Paso cuya conclusión es el teorema
+        template <typename Thm, typename Proof>
+        StepId add(Traced<Thm, Proof>)
+        {
+            static_assert(!LOGIC_ALPHA_CANONICAL, "ERROR: el comprobador en tiempo de ejecución usa nombres, no la forma canónica.");
+            return step<Proof>();
+        }
+
+    private:
+        template <typename Proof>
+        static constexpr char tag = 0;
+
+        template <typename Proof>
+        StepId step()
+        {
+            if (const auto found = steps_.find(&tag<Proof>); found != steps_.end())
+                return found->second;
+            const StepId id = emit(Proof{});
+            steps_.emplace(&tag<Proof>, id);
+            return id;
+        }
+
+        template <typename A>
+        StepId emit(proof::Assume<A>) { return certificate_.assume(reify<A>(store_)); }
+
+        template <typename Hyp, typename P>
+        StepId emit(proof::ImpliesIntro<Hyp, P>)
+        {
+            const StepId premise = step<P>();
+            return certificate_.implies_intro(reify<Hyp>(store_), premise);
+        }
+
+        template <typename P1, typename P2>
+        StepId emit(proof::ModusPonens<P1, P2>)
+        {
+            const StepId antecedent = step<P1>();
+            return certificate_.modus_ponens(antecedent, step<P2>());
+        }
+
+        template <typename A>
+        StepId emit(proof::AxiomIdentity<A>) { return certificate_.axiom_identity(reify<A>(store_)); }
+
+        template <typename V, typename P>
+        StepId emit(proof::Generalization<V, P>)
+        {
+            const StepId premise = step<P>();
+            return certificate_.generalization(reify<V>(store_), premise);
+        }
+
+        template <typename P, typename Term>
+        StepId emit(proof::UniversalInstantiation<P, Term>)
+        {
+            const StepId premise = step<P>();
+            return certificate_.universal_instantiation(premise, reify<Term>(store_));
+        }
+
+        TermStore &store_;
+        ProofCertificate &certificate_;
+        std::unordered_map<const void *, StepId> steps_;
+    };
+
+} // namespace logic::runtime
@@ -0,0 +1,1705 @@
+#pragma once
+
+#include "term_store.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// =========================================================
+// === RESOLUCIÓN Y SUPERPOSICIÓN (primer orden) ===
+// =========================================================
+//
+// La tabla de verdad, el SAT y los BDD solo ven el esqueleto proposicional:
+// un ∀ es un átomo más. SuperpositionSolver es un demostrador de primer
+// orden por refutación con igualdad, con el bucle "given clause" de
+// DISCOUNT: las cláusulas pendientes esperan en una cola y solo las activas
+// se indexan y se combinan entre sí.
+//
+//   - Cada literal es una ecuación s = t o s ≠ t; un predicado P(t̄) es la
+//     ecuación P(t̄) = ⊤, de modo que la resolución binaria es una
+//     superposición en la raíz seguida de quitar ⊤ ≠ ⊤, y la
+//     factorización es la factorización ecuacional.
+//   - Reglas: superposición (también dentro de los argumentos), resolución
+//     ecuacional y factorización ecuacional, restringidas por el orden de
+//     Knuth-Bendix (peso 1 por símbolo, precedencia por orden de creación,
+//     ⊤ el menor) y por la selección del literal negativo más pesado. Las
+//     restricciones se comprueban antes de aplicar el unificador: salen
+//     algunas inferencias de más, pero ninguna de menos.
+//   - Simplificación: tautologías, literales repetidos y t ≠ t; reescritura
+//     (demodulación) con las ecuaciones unitarias orientadas; subsunción
+//     hacia delante y hacia atrás (por multiconjuntos: la cláusula que
+//     subsume no tiene más literales).
+//
+// Los índices son árboles de discriminación: el término en preorden, con *
+// en lugar de cada variable, recorrido en una trie. Dan los candidatos a
+// unificar (superposición), las generalizaciones (demodulación, subsunción
+// hacia delante) y las instancias (subsunción hacia atrás) sin recorrer
+// todas las cláusulas; la unificación o el encaje de verdad solo se hace
+// con los candidatos. La subsunción filtra además por un vector de
+// características (literales positivos, negativos y símbolos que aparecen).
+// Una cláusula borrada se queda en los índices y se salta al recuperarla.
+//
+// BasicClausifier pasa una fórmula de un TermStore (o de una FormulaArena)
+// a cláusulas: forma normal negativa con ↔ según la polaridad,
+// skolemización (un ∃ bajo los ∀ x̄ es f(x̄)) y distribución. Los átomos
+// `Equal(a, b)` son la igualdad del demostrador y el átomo sin argumentos
+// `False` es ⊥. BasicResolutionProver junta las dos piezas: axiomas, un
+// objetivo (se añade su negación) y prove().
+
+namespace logic::runtime
+{
+
+    using ProverTerm = std::uint32_t;
+    using ProverSymbol = std::uint32_t;
+    using ClauseId = std::uint32_t;
+
+    // s = t o s ≠ t; en un predicado, right es ProverTerms::truth()
+    struct ProverLiteral
+    {
+        ProverTerm left = 0;
+        ProverTerm right = 0;
+        bool positive = true;
+
+        friend bool operator==(const ProverLiteral &, const ProverLiteral &) = default;
+    };
+
+    enum class ProverResult : std::uint8_t
+    {
+        Proved,    // Se derivó la cláusula vacía
+        Saturated, // No quedan inferencias: no hay demostración
+        Unknown    // Se acabó algún límite
+    };
+
+    enum class ProverRule : std::uint8_t
+    {
+        Input,
+        Superposition,
+        EqualityResolution,
+        EqualityFactoring,
+        Demodulation
+    };
+
+    struct ProverOptions
+    {
+        std::uint64_t max_given = 100000;   // Cláusulas activadas
+        std::uint64_t max_clauses = 4000000; // Cláusulas guardadas
+        double max_seconds = 10.0;
+        unsigned age_ratio = 5; // Una de cada age_ratio elecciones es la más antigua; las demás, la más ligera
+    };
+
+    struct ProverStats
+    {
+        std::uint64_t input = 0;             // Cláusulas de entrada
+        std::uint64_t generated = 0;         // Conclusiones de inferencias
+        std::uint64_t given = 0;             // Cláusulas activadas
+        std::uint64_t trivial = 0;           // Tautologías descartadas
+        std::uint64_t forward_subsumed = 0;  // Cláusulas nuevas subsumidas por una activa
+        std::uint64_t backward_subsumed = 0; // Activas subsumidas por una nueva
+        std::uint64_t rewrites = 0;          // Pasos de demodulación
+        std::uint64_t unifications = 0;      // Candidatos de los índices probados
+        double seconds = 0.0;
+
+        double clauses_per_second() const { return seconds > 0.0 ? static_cast<double>(generated) / seconds : 0.0; }
+    };
+
+    // --- Términos ---
+    // Términos con hash-consing: el mismo término es siempre el mismo
+    // ProverTerm. Las variables no se guardan: son ProverTerm con el bit
+    // alto a uno y su número en los demás. Cada nodo guarda su peso, el
+    // número de variables que necesita (0 si es cerrado) y una máscara de
+    // sus símbolos.
+    class ProverTerms
+    {
+    public:
+        static constexpr ProverTerm variable_bit = ProverTerm{1} << 31;
+
+        static constexpr bool is_variable(ProverTerm term) { return (term & variable_bit) != 0; }
+        static constexpr ProverTerm variable(std::uint32_t index) { return variable_bit | index; }
+        static constexpr std::uint32_t index(ProverTerm variable) { return variable & ~variable_bit; }
+
+        enum class Order : std::uint8_t
+        {
+            Equal,
+            Greater,
+            Less,
+            Incomparable
+        };
+
+        ProverTerms() { truth_ = apply(predicate("⊤", 0), {}); }
+
+        // Símbolo de función, por nombre y aridad
+        ProverSymbol symbol(std::string_view name, std::uint32_t arity) { return intern(name, arity, false); }
+
+        // Los predicados (y ⊤) son de otra clase: una variable solo se
+        // liga a términos, nunca a P(t̄) ni a ⊤
+        ProverSymbol predicate(std::string_view name, std::uint32_t arity) { return intern(name, arity, true); }
+
+        // Símbolo nuevo (Skolem), distinto de todos aunque el nombre coincida
+        ProverSymbol fresh_symbol(std::string_view prefix, std::uint32_t arity)
+        {
+            symbols_.push_back({std::string(prefix) + std::to_string(++fresh_), arity, false});
+            return static_cast<ProverSymbol>(symbols_.size() - 1);
+        }
+
+        ProverTerm apply(ProverSymbol symbol, std::span<const ProverTerm> args)
+        {
+            if (symbol >= symbols_.size() || args.size() != symbols_[symbol].arity)
+                throw std::invalid_argument("ProverTerms::apply: símbolo o aridad incorrectos");
+            std::uint64_t hash = logic::detail::HashAlgebra::mix(0xcbf29ce484222325ull, symbol);
+            for (const ProverTerm arg : args)
+                hash = logic::detail::HashAlgebra::mix(hash, arg);
+
+            if (slots_.empty())
+                slots_.assign(1024, empty_slot);
+            size_t mask = slots_.size() - 1;
+            size_t slot = (hash ^ (hash >> 32)) & mask;
+            for (; slots_[slot] != empty_slot; slot = (slot + 1) & mask)
+            {
+                const ProverTerm candidate = slots_[slot];
+                const Node &node = nodes_[candidate];
+                if (node.symbol == symbol && std::ranges::equal(std::span(arguments_).subspan(node.first, args.size()), args))
+                    return candidate;
+            }
+
+            Node node{symbol, static_cast<std::uint32_t>(arguments_.size()), 1, 0, std::uint64_t{1} << (symbol % 64)};
+            for (const ProverTerm arg : args)
+            {
+                if (is_variable(arg))
+                {
+                    node.weight += 1;
+                    node.variables = std::max(node.variables, index(arg) + 1);
+                }
+                else
+                {
+                    node.weight += nodes_[arg].weight;
+                    node.variables = std::max(node.variables, nodes_[arg].variables);
+                    node.symbols |= nodes_[arg].symbols;
+                }
+            }
+            arguments_.insert(arguments_.end(), args.begin(), args.end());
+            const auto id = static_cast<ProverTerm>(nodes_.size());
+            if (id >= variable_bit)
+                throw std::length_error("ProverTerms: demasiados términos");
+            nodes_.push_back(node);
+            slots_[slot] = id;
+            if (2 * nodes_.size() > slots_.size())
+                rehash();
+            return id;
+        }
+
+        ProverTerm apply(ProverSymbol symbol, std::initializer_list<ProverTerm> args) { return apply(symbol, std::span(args.begin(), args.size())); }
+
+        ProverTerm truth() const { return truth_; }
+
+        ProverSymbol head(ProverTerm term) const { return nodes_[term].symbol; }
+        std::span<const ProverTerm> args(ProverTerm term) const
+        {
+            const Node &node = nodes_[term];
+            return std::span(arguments_).subspan(node.first, symbols_[node.symbol].arity);
+        }
+
+        std::uint32_t weight(ProverTerm term) const { return is_variable(term) ? 1 : nodes_[term].weight; }
+        bool ground(ProverTerm term) const { return !is_variable(term) && nodes_[term].variables == 0; }
+        bool boolean(ProverTerm term) const { return !is_variable(term) && symbols_[nodes_[term].symbol].boolean; }
+        // Uno más que la mayor variable del término
+        std::uint32_t variables(ProverTerm term) const { return is_variable(term) ? index(term) + 1 : nodes_[term].variables; }
+        std::uint64_t symbol_mask(ProverTerm term) const { return is_variable(term) ? 0 : nodes_[term].symbols; }
+
+        std::uint32_t arity(ProverSymbol symbol) const { return symbols_[symbol].arity; }
+        std::string_view name(ProverSymbol symbol) const { return symbols_[symbol].name; }
+        size_t size() const { return nodes_.size(); }
+
+        // Orden de Knuth-Bendix con peso 1 para todo y precedencia por
+        // número de símbolo: s > t si pesa más, o pesa igual y su cabeza es
+        // mayor, o tienen la misma cabeza y es mayor en el primer argumento
+        // distinto; en todos los casos cada variable debe aparecer en s al
+        // menos tantas veces como en t
+        Order compare(ProverTerm s, ProverTerm t) const
+        {
+            if (s == t)
+                return Order::Equal;
+            count_variables(s, 1);
+            count_variables(t, -1);
+            bool more = false, fewer = false;
+            for (const std::uint32_t variable : touched_)
+            {
+                more |= balance_[variable] > 0;
+                fewer |= balance_[variable] < 0;
+                balance_[variable] = 0;
+            }
+            touched_.clear();
+
+            Order lexical = Order::Incomparable;
+            if (weight(s) != weight(t))
+                lexical = weight(s) > weight(t) ? Order::Greater : Order::Less;
+            else if (is_variable(s) || is_variable(t))
+                return Order::Incomparable;
+            else if (head(s) != head(t))
+                lexical = head(s) > head(t) ? Order::Greater : Order::Less;
+            else
+            {
+                const std::span<const ProverTerm> left = args(s), right = args(t);
+                for (size_t i = 0; i < left.size(); ++i)
+                    if (left[i] != right[i])
+                    {
+                        lexical = compare(left[i], right[i]);
+                        break;
+                    }
+            }
+            if (lexical == Order::Greater)
+                return fewer ? Order::Incomparable : Order::Greater;
+            if (lexical == Order::Less)
+                return more ? Order::Incomparable : Order::Less;
+            return Order::Incomparable;
+        }
+
+        // f(a, x0): las variables como x0, x1, ...
+        void write(std::string &out, ProverTerm term) const
+        {
+            if (is_variable(term))
+            {
+                out += 'x';
+                out += std::to_string(index(term));
+                return;
+            }
+            out += name(head(term));
+            const std::span<const ProverTerm> arguments = args(term);
+            for (size_t i = 0; i < arguments.size(); ++i)
+            {
+                out += i == 0 ? "(" : ", ";
+                write(out, arguments[i]);
+            }
+            if (!arguments.empty())
+                out += ')';
+        }
+
+        std::string text(ProverTerm term) const
+        {
+            std::string out;
+            write(out, term);
+            return out;
+        }
+
+    private:
+        struct Node
+        {
+            ProverSymbol symbol;
+            std::uint32_t first;     // Argumentos en arguments_
+            std::uint32_t weight;    // Símbolos y variables
+            std::uint32_t variables; // Mayor variable + 1 (0: cerrado)
+            std::uint64_t symbols;   // Bit symbol % 64 de cada símbolo
+        };
+
+        struct Symbol
+        {
+            std::string name;
+            std::uint32_t arity;
+            bool boolean; // Predicado
+        };
+
+        static constexpr ProverTerm empty_slot = ~ProverTerm{0};
+
+        ProverSymbol intern(std::string_view name, std::uint32_t arity, bool boolean)
+        {
+            std::string key(name);
+            key += boolean ? '?' : '/';
+            key += std::to_string(arity);
+            const auto [entry, inserted] = by_name_.try_emplace(std::move(key), static_cast<ProverSymbol>(symbols_.size()));
+            if (inserted)
+                symbols_.push_back({std::string(name), arity, boolean});
+            return entry->second;
+        }
+
+        void count_variables(ProverTerm term, int sign) const
+        {
+            if (is_variable(term))
+            {
+                const std::uint32_t variable = index(term);
+                if (variable >= balance_.size())
+                    balance_.resize(variable + 1, 0);
+                if (balance_[variable] == 0)
+                    touched_.push_back(variable);
+                balance_[variable] += sign;
+                return;
+            }
+            if (nodes_[term].variables == 0)
+                return;
+            for (const ProverTerm arg : args(term))
+                count_variables(arg, sign);
+        }
+
+        void rehash()
+        {
+            slots_.assign(2 * slots_.size(), empty_slot);
+            const size_t mask = slots_.size() - 1;
+            for (ProverTerm id = 0; id < nodes_.size(); ++id)
+            {
+                std::uint64_t hash = logic::detail::HashAlgebra::mix(0xcbf29ce484222325ull, nodes_[id].symbol);
+                for (const ProverTerm arg : args(id))
+                    hash = logic::detail::HashAlgebra::mix(hash, arg);
+                size_t slot = (hash ^ (hash >> 32)) & mask;
+                while (slots_[slot] != empty_slot)
+                    slot = (slot + 1) & mask;
+                slots_[slot] = id;
+            }
+        }
+
+        std::vector<Node> nodes_;
+        std::vector<ProverTerm> arguments_;
+        std::vector<ProverTerm> slots_;
+        std::vector<Symbol> symbols_;
+        std::unordered_map<std::string, ProverSymbol> by_name_;
+        std::uint32_t fresh_ = 0;
+        ProverTerm truth_ = 0;
+
+        // Balance de variables de compare()
+        mutable std::vector<int> balance_;
+        mutable std::vector<std::uint32_t> touched_;
+    };
+
+    namespace detail
+    {
+        // --- Sustitución ---
+        // Ligaduras de dos "bancos" de variables: las de cada premisa de una
+        // inferencia, sin renombrarlas antes. Una variable ligada apunta a un
+        // término de un banco. mark()/undo() deshacen las ligaduras
+        // posteriores a una marca.
+        class Substitution
+        {
+        public:
+            explicit Substitution(const ProverTerms &terms) : terms_(terms) {}
+
+            size_t mark() const { return trail_.size(); }
+
+            void undo(size_t mark)
+            {
+                for (; trail_.size() > mark; trail_.pop_back())
+                    bindings_[trail_.back().first][trail_.back().second].term = unbound;
+            }
+
+            // El término al que lleva una cadena de variables ligadas
+            std::pair<ProverTerm, std::uint8_t> deref(ProverTerm term, std::uint8_t bank) const
+            {
+                while (ProverTerms::is_variable(term))
+                {
+                    const std::uint32_t variable = ProverTerms::index(term);
+                    if (variable >= bindings_[bank].size() || bindings_[bank][variable].term == unbound)
+                        break;
+                    const Binding &binding = bindings_[bank][variable];
+                    term = binding.term;
+                    bank = binding.bank;
+                }
+                return {term, bank};
+            }
+
+            // Unificador más general, con comprobación de ocurrencia
+            bool unify(ProverTerm a, std::uint8_t a_bank, ProverTerm b, std::uint8_t b_bank)
+            {
+                pending_.clear();
+                pending_.push_back({a, b, a_bank, b_bank});
+                while (!pending_.empty())
+                {
+                    Pair pair = pending_.back();
+                    pending_.pop_back();
+                    std::tie(pair.left, pair.left_bank) = deref(pair.left, pair.left_bank);
+                    std::tie(pair.right, pair.right_bank) = deref(pair.right, pair.right_bank);
+                    if (pair.left == pair.right && (pair.left_bank == pair.right_bank || terms_.ground(pair.left)))
+                        continue;
+                    if (ProverTerms::is_variable(pair.left) || ProverTerms::is_variable(pair.right))
+                    {
+                        if (!ProverTerms::is_variable(pair.left))
+                        {
+                            std::swap(pair.left, pair.right);
+                            std::swap(pair.left_bank, pair.right_bank);
+                        }
+                        if (terms_.boolean(pair.right) || occurs(pair.left, pair.left_bank, pair.right, pair.right_bank))
+                            return false;
+                        bind(pair.left, pair.left_bank, pair.right, pair.right_bank);
+                        continue;
+                    }
+                    if (terms_.head(pair.left) != terms_.head(pair.right))
+                        return false;
+                    const std::span<const ProverTerm> left = terms_.args(pair.left), right = terms_.args(pair.right);
+                    for (size_t i = 0; i < left.size(); ++i)
+                        pending_.push_back({left[i], right[i], pair.left_bank, pair.right_bank});
+                }
+                return true;
+            }
+
+            // Encaje: solo se ligan las variables del patrón; las del
+            // objetivo son constantes
+            bool match(ProverTerm pattern, std::uint8_t pattern_bank, ProverTerm target, std::uint8_t target_bank)
+            {
+                pending_.clear();
+                pending_.push_back({pattern, target, pattern_bank, target_bank});
+                while (!pending_.empty())
+                {
+                    const Pair pair = pending_.back();
+                    pending_.pop_back();
+                    if (ProverTerms::is_variable(pair.left))
+                    {
+                        const std::uint32_t variable = ProverTerms::index(pair.left);
+                        if (variable < bindings_[pair.left_bank].size() && bindings_[pair.left_bank][variable].term != unbound)
+                        {
+                            const Binding &binding = bindings_[pair.left_bank][variable];
+                            if (binding.term != pair.right || (binding.bank != pair.right_bank && !terms_.ground(pair.right)))
+                                return false;
+                        }
+                        else if (terms_.boolean(pair.right))
+                            return false;
+                        else
+                            bind(pair.left, pair.left_bank, pair.right, pair.right_bank);
+                        continue;
+                    }
+                    if (ProverTerms::is_variable(pair.right) || terms_.head(pair.left) != terms_.head(pair.right))
+                        return false;
+                    if (pair.left == pair.right && terms_.ground(pair.left))
+                        continue;
+                    const std::span<const ProverTerm> left = terms_.args(pair.left), right = terms_.args(pair.right);
+                    for (size_t i = 0; i < left.size(); ++i)
+                        pending_.push_back({left[i], right[i], pair.left_bank, pair.right_bank});
+                }
+                return true;
+            }
+
+        private:
+            static constexpr ProverTerm unbound = ~ProverTerm{0};
+
+            struct Binding
+            {
+                ProverTerm term = unbound;
+                std::uint8_t bank = 0;
+            };
+
+            struct Pair
+            {
+                ProverTerm left, right;
+                std::uint8_t left_bank, right_bank;
+            };
+
+            void bind(ProverTerm variable, std::uint8_t bank, ProverTerm term, std::uint8_t term_bank)
+            {
+                const std::uint32_t index = ProverTerms::index(variable);
+                if (index >= bindings_[bank].size())
+                    bindings_[bank].resize(index + 1);
+                bindings_[bank][index] = {term, term_bank};
+                trail_.push_back({bank, index});
+            }
+
+            bool occurs(ProverTerm variable, std::uint8_t bank, ProverTerm term, std::uint8_t term_bank) const
+            {
+                std::tie(term, term_bank) = deref(term, term_bank);
+                if (ProverTerms::is_variable(term))
+                    return term == variable && term_bank == bank;
+                if (terms_.ground(term))
+                    return false;
+                for (const ProverTerm arg : terms_.args(term))
+                    if (occurs(variable, bank, arg, term_bank))
+                        return true;
+                return false;
+            }
+
+            const ProverTerms &terms_;
+            std::array<std::vector<Binding>, 2> bindings_;
+            std::vector<std::pair<std::uint8_t, std::uint32_t>> trail_;
+            std::vector<Pair> pending_;
+        };
+
+        // --- Árbol de discriminación ---
+        // Una trie sobre el término en preorden con la clave del símbolo (o
+        // * para una variable). Las consultas recorren a la vez la trie y el
+        // término; saltar un subtérmino de la trie suma la aridad de cada
+        // clave que atraviesa. Es imperfecto (x y x·y dan la misma clave),
+        // así que los valores son candidatos. visit devuelve false para
+        // parar. Las consultas no son reentrantes.
+        template <typename Value>
+        class DiscriminationTree
+        {
+        public:
+            explicit DiscriminationTree(const ProverTerms &terms) : terms_(terms), nodes_(1) {}
+
+            void insert(ProverTerm term, const Value &value)
+            {
+                flatten(term);
+                std::uint32_t node = 0;
+                for (const ProverTerm subterm : flat_)
+                {
+                    const std::uint32_t key = key_of(subterm);
+                    std::uint32_t child = find(node, key);
+                    if (child == npos)
+                    {
+                        child = static_cast<std::uint32_t>(nodes_.size());
+                        nodes_[node].edges.push_back({key, child});
+                        nodes_.emplace_back();
+                    }
+                    node = child;
+                }
+                nodes_[node].values.push_back(value);
+                ++size_;
+            }
+
+            // Términos guardados de los que query es instancia
+            template <typename Visit>
+            void generalizations(ProverTerm query, Visit &&visit)
+            {
+                flatten(query);
+                generalizations(0, 0, visit);
+            }
+
+            // Términos guardados que son instancia de query
+            template <typename Visit>
+            void instances(ProverTerm query, Visit &&visit)
+            {
+                flatten(query);
+                instances(0, 0, visit);
+            }
+
+            // Términos guardados que pueden unificar con query
+            template <typename Visit>
+            void unifiable(ProverTerm query, Visit &&visit)
+            {
+                flatten(query);
+                unifiable(0, 0, visit);
+            }
+
+            size_t size() const { return size_; }
+
+        private:
+            static constexpr std::uint32_t npos = ~std::uint32_t{0};
+            static constexpr std::uint32_t star = 0; // Clave de una variable; la de un símbolo s es s + 1
+
+            struct Node
+            {
+                std::vector<std::pair<std::uint32_t, std::uint32_t>> edges; // (clave, hijo)
+                std::vector<Value> values;
+            };
+
+            std::uint32_t key_of(ProverTerm term) const { return ProverTerms::is_variable(term) ? star : terms_.head(term) + 1; }
+            std::uint32_t arity_of(std::uint32_t key) const { return key == star ? 0 : terms_.arity(key - 1); }
+
+            std::uint32_t find(std::uint32_t node, std::uint32_t key) const
+            {
+                for (const auto &[edge, child] : nodes_[node].edges)
+                    if (edge == key)
+                        return child;
+                return npos;
+            }
+
+            // Preorden de query en flat_; ends_[i] es la posición siguiente
+            // al subtérmino que empieza en i
+            void flatten(ProverTerm query)
+            {
+                flat_.clear();
+                ends_.clear();
+                push(query);
+            }
+
+            void push(ProverTerm term)
+            {
+                const size_t at = flat_.size();
+                flat_.push_back(term);
+                ends_.push_back(0);
+                if (!ProverTerms::is_variable(term))
+                    for (const ProverTerm arg : terms_.args(term))
+                        push(arg);
+                ends_[at] = static_cast<std::uint32_t>(flat_.size());
+            }
+
+            template <typename Visit>
+            bool leaf(std::uint32_t node, Visit &visit) const
+            {
+                for (const Value &value : nodes_[node].values)
+                    if (!visit(value))
+                        return false;
+                return true;
+            }
+
+            // Avanza `pending` términos completos desde node y llama a then
+            // en cada nodo al que se llega
+            template <typename Then>
+            bool skip(std::uint32_t node, std::uint32_t pending, Then &then) const
+            {
+                if (pending == 0)
+                    return then(node);
+                for (const auto &[key, child] : nodes_[node].edges)
+                    if (!skip(child, pending - 1 + arity_of(key), then))
+                        return false;
+                return true;
+            }
+
+            template <typename Visit>
+            bool generalizations(std::uint32_t node, std::uint32_t at, Visit &visit) const
+            {
+                if (at == flat_.size())
+                    return leaf(node, visit);
+                if (const std::uint32_t child = find(node, star); child != npos && !generalizations(child, ends_[at], visit))
+                    return false;
+                if (ProverTerms::is_variable(flat_[at]))
+                    return true;
+                const std::uint32_t child = find(node, key_of(flat_[at]));
+                return child == npos || generalizations(child, at + 1, visit);
+            }
+
+            template <typename Visit>
+            bool instances(std::uint32_t node, std::uint32_t at, Visit &visit) const
+            {
+                if (at == flat_.size())
+                    return leaf(node, visit);
+                if (ProverTerms::is_variable(flat_[at]))
+                {
+                    auto then = [&](std::uint32_t next) { return instances(next, at + 1, visit); };
+                    return skip(node, 1, then);
+                }
+                const std::uint32_t child = find(node, key_of(flat_[at]));
+                return child == npos || instances(child, at + 1, visit);
+            }
+
+            template <typename Visit>
+            bool unifiable(std::uint32_t node, std::uint32_t at, Visit &visit) const
+            {
+                if (at == flat_.size())
+                    return leaf(node, visit);
+                if (ProverTerms::is_variable(flat_[at]))
+                {
+                    auto then = [&](std::uint32_t next) { return unifiable(next, at + 1, visit); };
+                    return skip(node, 1, then);
+                }
+                if (const std::uint32_t child = find(node, star); child != npos && !unifiable(child, ends_[at], visit))
+                    return false;
+                const std::uint32_t child = find(node, key_of(flat_[at]));
+                return child == npos || unifiable(child, at + 1, visit);
+            }
+
+            const ProverTerms &terms_;
+            std::vector<Node> nodes_;
+            size_t size_ = 0;
+            std::vector<ProverTerm> flat_;
+            std::vector<std::uint32_t> ends_;
+        };
+    } // namespace detail
+
+    // --- Demostrador ---
+    class SuperpositionSolver
+    {
+    public:
+        static constexpr ClauseId npos = ~ClauseId{0};
+
+        SuperpositionSolver()
+            : substitution_(terms_), subterms_(terms_), left_sides_(terms_), demodulators_(terms_), first_literals_(terms_), all_literals_(terms_)
+        {
+            equation_ = terms_.predicate("$=", 2);
+            disequation_ = terms_.predicate("$≠", 2);
+        }
+
+        ProverTerms &terms() { return terms_; }
+        const ProverTerms &terms() const { return terms_; }
+
+        // Añade una cláusula de entrada con variables ProverTerms::variable(i).
+        // Devuelve su identificador, o npos si es una tautología.
+        ClauseId add_clause(std::span<const ProverLiteral> literals)
+        {
+            begin_conclusion();
+            for (const ProverLiteral &literal : literals)
+                conclusion_.push_back({instantiate(literal.left, 0), instantiate(literal.right, 0), literal.positive});
+            const ClauseId id = finish(ProverRule::Input, {});
+            --stats_.generated;
+            stats_.input += id != npos;
+            return id;
+        }
+
+        ClauseId add_clause(std::initializer_list<ProverLiteral> literals) { return add_clause(std::span(literals.begin(), literals.size())); }
+
+        // Bucle "given clause": se elige una cláusula pendiente, se
+        // simplifica con las activas, se activa y se combina con ellas
+        ProverResult prove(const ProverOptions &options = {})
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            const auto elapsed = [&] { return std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count(); };
+            ProverResult result = ProverResult::Unknown;
+            for (std::uint64_t picks = 0;; ++picks)
+            {
+                if (empty_ != npos)
+                {
+                    result = ProverResult::Proved;
+                    break;
+                }
+                if (stats_.given >= options.max_given || clauses_.size() >= options.max_clauses || elapsed() > options.max_seconds)
+                    break;
+                ClauseId given = pick(options.age_ratio != 0 && picks % options.age_ratio == 0);
+                if (given == npos)
+                {
+                    result = ProverResult::Saturated;
+                    break;
+                }
+                clauses_[given].state = State::Retired;
+                given = simplify(given);
+                if (given == npos || empty_ != npos)
+                    continue;
+                if (forward_subsumed(given))
+                {
+                    clauses_[given].state = State::Retired;
+                    ++stats_.forward_subsumed;
+                    continue;
+                }
+                backward_subsume(given);
+                activate(given);
+                generate(given);
+            }
+            stats_.seconds += elapsed();
+            return result;
+        }
+
+        const ProverStats &stats() const { return stats_; }
+        size_t clauses() const { return clauses_.size(); }
+        ClauseId empty_clause() const { return empty_; }
+
+        std::span<const ProverLiteral> literals(ClauseId id) const
+        {
+            return std::span(literals_).subspan(clauses_[id].first, clauses_[id].size);
+        }
+
+        ProverRule rule(ClauseId id) const { return clauses_[id].rule; }
+
+        std::span<const ClauseId> parents(ClauseId id) const
+        {
+            return std::span(parents_).subspan(clauses_[id].first_parent, clauses_[id].parent_count);
+        }
+
+        // Las cláusulas de las que sale la vacía, cada una después de sus
+        // premisas; vacío si no se ha demostrado nada
+        std::vector<ClauseId> proof() const
+        {
+            if (empty_ == npos)
+                return {};
+            std::vector<char> needed(clauses_.size(), 0);
+            std::vector<ClauseId> pending{empty_};
+            needed[empty_] = 1;
+            while (!pending.empty())
+            {
+                const ClauseId id = pending.back();
+                pending.pop_back();
+                for (const ClauseId parent : parents(id))
+                    if (!needed[parent])
+                    {
+                        needed[parent] = 1;
+                        pending.push_back(parent);
+                    }
+            }
+            std::vector<ClauseId> out;
+            for (ClauseId id = 0; id < clauses_.size(); ++id)
+                if (needed[id])
+                    out.push_back(id);
+            return out;
+        }
+
+        // P(a) ∨ ¬Q(x0) ∨ f(x0) = b; ⊥ la vacía
+        std::string text(ClauseId id) const
+        {
+            std::string out;
+            for (const ProverLiteral &literal : literals(id))
+            {
+                if (!out.empty())
+                    out += " ∨ ";
+                if (literal.right == terms_.truth())
+                {
+                    if (!literal.positive)
+                        out += "¬";
+                    terms_.write(out, literal.left);
+                    continue;
+                }
+                terms_.write(out, literal.left);
+                out += literal.positive ? " = " : " ≠ ";
+                terms_.write(out, literal.right);
+            }
+            return out.empty() ? "⊥" : out;
+        }
+
+    private:
+        enum class State : std::uint8_t
+        {
+            Passive, // En la cola
+            Active,  // Indexada; participa en las inferencias
+            Retired  // Elegida y descartada (simplificada o subsumida)
+        };
+
+        struct Clause
+        {
+            std::uint32_t first, size; // En literals_
+            std::uint32_t first_parent, parent_count;
+            std::uint32_t weight;
+            std::uint32_t selected; // Literal negativo seleccionado, o npos
+            ProverRule rule;
+            State state;
+            // Vector de características para la subsunción
+            std::uint16_t positive, negative;
+            std::uint64_t symbols;
+        };
+
+        // Subtérmino de un lado elegible de un literal activo (destino de una superposición)
+        struct Position
+        {
+            ClauseId clause;
+            std::uint32_t literal : 31;
+            std::uint32_t side : 1;
+            ProverTerm subterm;
+        };
+
+        // Lado izquierdo l de una ecuación positiva l = r (origen de una superposición o demodulador)
+        struct Rewriter
+        {
+            ClauseId clause;
+            std::uint32_t literal : 31;
+            std::uint32_t side : 1;
+        };
+
+        struct Replacement
+        {
+            ProverTerm from;
+            std::uint8_t from_bank;
+            ProverTerm to;
+            std::uint8_t to_bank;
+        };
+
+        const ProverLiteral &literal(ClauseId id, std::uint32_t index) const { return literals_[clauses_[id].first + index]; }
+        bool active(ClauseId id) const { return clauses_[id].state == State::Active; }
+        bool eligible(ClauseId id, std::uint32_t index) const { return eligible_[clauses_[id].first + index] != 0; }
+
+        ProverTerm side(const ProverLiteral &literal, std::uint32_t side) const { return side ? literal.right : literal.left; }
+
+        // Lados que pueden ser máximos: el izquierdo siempre (el derecho no
+        // es mayor) y el derecho si no son comparables
+        std::uint32_t sides(const ProverLiteral &literal) const
+        {
+            return terms_.compare(literal.left, literal.right) == ProverTerms::Order::Greater ? 1 : 2;
+        }
+
+        ProverTerm literal_term(const ProverLiteral &literal, bool flipped = false)
+        {
+            const std::array<ProverTerm, 2> args{flipped ? literal.right : literal.left, flipped ? literal.left : literal.right};
+            return terms_.apply(literal.positive ? equation_ : disequation_, args);
+        }
+
+        // --- Conclusiones ---
+        // Las variables de la conclusión se numeran 0, 1, ... por orden de
+        // aparición, sean del banco que sean
+        void begin_conclusion()
+        {
+            conclusion_.clear();
+            for (auto &renaming : renaming_)
+                std::ranges::fill(renaming, npos);
+            next_variable_ = 0;
+        }
+
+        ProverTerm instantiate(ProverTerm term, std::uint8_t bank)
+        {
+            if (replacing_ && term == replacement_.from && bank == replacement_.from_bank)
+                return instantiate(replacement_.to, replacement_.to_bank);
+            if (ProverTerms::is_variable(term))
+            {
+                const auto [bound, bound_bank] = substitution_.deref(term, bank);
+                if (!ProverTerms::is_variable(bound))
+                    return instantiate(bound, bound_bank);
+                if (keep_variables_ && bound_bank == 1)
+                    return bound;
+                std::vector<ClauseId> &renaming = renaming_[bound_bank];
+                const std::uint32_t index = ProverTerms::index(bound);
+                if (index >= renaming.size())
+                    renaming.resize(index + 1, npos);
+                if (renaming[index] == npos)
+                    renaming[index] = next_variable_++;
+                return ProverTerms::variable(renaming[index]);
+            }
+            if (terms_.ground(term) &&
+                (!replacing_ || !terms_.ground(replacement_.from) || terms_.weight(term) < terms_.weight(replacement_.from)))
+                return term;
+            const size_t base = scratch_.size();
+            for (const ProverTerm arg : terms_.args(term))
+            {
+                const ProverTerm instance = instantiate(arg, bank);
+                scratch_.push_back(instance);
+            }
+            const ProverTerm out = terms_.apply(terms_.head(term), std::span(scratch_).subspan(base));
+            scratch_.resize(base);
+            return out;
+        }
+
+        // Copia los literales de id instanciados, salvo el `skip`
+        void copy_literals(ClauseId id, std::uint32_t skip, std::uint8_t bank)
+        {
+            for (std::uint32_t i = 0; i < clauses_[id].size; ++i)
+                if (i != skip)
+                {
+                    const ProverLiteral source = literal(id, i);
+                    conclusion_.push_back({instantiate(source.left, bank), instantiate(source.right, bank), source.positive});
+                }
+        }
+
+        // Normaliza conclusion_ y la guarda: orienta cada literal (el lado
+        // mayor a la izquierda; si no son comparables, el de menor número),
+        // quita t ≠ t y los repetidos y descarta las tautologías
+        ClauseId finish(ProverRule rule, std::initializer_list<ClauseId> parents)
+        {
+            return finish(rule, std::span(parents.begin(), parents.size()));
+        }
+
+        ClauseId finish(ProverRule rule, std::span<const ClauseId> parents)
+        {
+            ++stats_.generated;
+            size_t kept = 0;
+            for (ProverLiteral current : conclusion_)
+            {
+                if (current.left == current.right)
+                {
+                    if (current.positive)
+                        return trivial();
+                    continue;
+                }
+                const ProverTerms::Order order = terms_.compare(current.left, current.right);
+                if (order == ProverTerms::Order::Less || (order == ProverTerms::Order::Incomparable && current.right < current.left))
+                    std::swap(current.left, current.right);
+                bool repeated = false;
+                for (size_t i = 0; i < kept; ++i)
+                    if (conclusion_[i].left == current.left && conclusion_[i].right == current.right)
+                    {
+                        if (conclusion_[i].positive != current.positive)
+                            return trivial();
+                        repeated = true;
+                    }
+                if (!repeated)
+                    conclusion_[kept++] = current;
+            }
+            conclusion_.resize(kept);
+
+            Clause clause{static_cast<std::uint32_t>(literals_.size()),
+                          static_cast<std::uint32_t>(kept),
+                          static_cast<std::uint32_t>(parents_.size()),
+                          static_cast<std::uint32_t>(parents.size()),
+                          0,
+                          npos,
+                          rule,
+                          State::Passive,
+                          0,
+                          0,
+                          0};
+            for (const ProverLiteral &current : conclusion_)
+            {
+                clause.weight += terms_.weight(current.left) + terms_.weight(current.right);
+                ++(current.positive ? clause.positive : clause.negative);
+                clause.symbols |= terms_.symbol_mask(current.left) | terms_.symbol_mask(current.right);
+            }
+            literals_.insert(literals_.end(), conclusion_.begin(), conclusion_.end());
+            eligible_.resize(literals_.size(), 0);
+            parents_.insert(parents_.end(), parents.begin(), parents.end());
+
+            const auto id = static_cast<ClauseId>(clauses_.size());
+            clauses_.push_back(clause);
+            by_weight_.push(std::uint64_t{clause.weight} << 32 | id);
+            if (kept == 0 && empty_ == npos)
+                empty_ = id;
+            return id;
+        }
+
+        ClauseId trivial()
+        {
+            ++stats_.trivial;
+            return npos;
+        }
+
+        // --- Cola ---
+        ClauseId pick(bool oldest)
+        {
+            if (oldest)
+            {
+                for (; next_oldest_ < clauses_.size(); ++next_oldest_)
+                    if (clauses_[next_oldest_].state == State::Passive)
+                        return next_oldest_++;
+                return npos;
+            }
+            while (!by_weight_.empty())
+            {
+                const auto id = static_cast<ClauseId>(by_weight_.top() & 0xffffffff);
+                by_weight_.pop();
+                if (clauses_[id].state == State::Passive)
+                    return id;
+            }
+            return pick(true);
+        }
+
+        // --- Simplificación ---
+        // Reescribe la cláusula con las ecuaciones unitarias activas l = r con
+        // l > r hasta la forma normal; si cambia, la nueva (ya retirada de
+        // la cola) sustituye a la elegida
+        ClauseId simplify(ClauseId id)
+        {
+            if (demodulators_.size() == 0)
+                return id;
+            used_.clear();
+            std::vector<ProverLiteral> rewritten(literals(id).begin(), literals(id).end());
+            bool changed = false;
+            for (ProverLiteral &current : rewritten)
+            {
+                const ProverLiteral before = current;
+                current.left = normalize(current.left);
+                current.right = normalize(current.right);
+                changed |= current != before;
+            }
+            if (!changed)
+                return id;
+
+            conclusion_ = std::move(rewritten);
+            used_.insert(used_.begin(), id);
+            const ClauseId out = finish(ProverRule::Demodulation, used_);
+            --stats_.generated;
+            if (out != npos)
+                clauses_[out].state = State::Retired;
+            return out;
+        }
+
+        // Forma normal de un término (el banco 1 es la cláusula; el 0, el
+        // demodulador): primero los argumentos y después la raíz
+        ProverTerm normalize(ProverTerm term)
+        {
+            if (ProverTerms::is_variable(term))
+                return term;
+            const std::span<const ProverTerm> arguments = terms_.args(term);
+            if (!arguments.empty())
+            {
+                std::vector<ProverTerm> normal(arguments.begin(), arguments.end());
+                bool changed = false;
+                for (ProverTerm &arg : normal)
+                {
+                    const ProverTerm before = arg;
+                    arg = normalize(arg);
+                    changed |= arg != before;
+                }
+                if (changed)
+                    term = terms_.apply(terms_.head(term), normal);
+            }
+
+            ProverTerm result = term;
+            ClauseId used = npos;
+            demodulators_.generalizations(term, [&](const Rewriter &rewriter) {
+                if (!active(rewriter.clause))
+                    return true;
+                const ProverLiteral &equation = literal(rewriter.clause, 0);
+                const size_t mark = substitution_.mark();
+                if (substitution_.match(equation.left, 0, term, 1))
+                {
+                    keep_variables_ = true;
+                    result = instantiate(equation.right, 0);
+                    keep_variables_ = false;
+                    used = rewriter.clause;
+                }
+                substitution_.undo(mark);
+                return used == npos;
+            });
+            if (used == npos)
+                return term;
+            ++stats_.rewrites;
+            if (std::ranges::find(used_, used) == used_.end())
+                used_.push_back(used);
+            return normalize(result);
+        }
+
+        // ¿subsumer subsume a target? Cada literal de subsumer encaja con
+        // uno distinto de target con la misma sustitución
+        bool subsumes(ClauseId subsumer, ClauseId target)
+        {
+            const Clause &small = clauses_[subsumer], &large = clauses_[target];
+            if (small.size > large.size || small.positive > large.positive || small.negative > large.negative ||
+                (small.symbols & ~large.symbols) != 0)
+                return false;
+            taken_.assign(large.size, 0);
+            const size_t mark = substitution_.mark();
+            const bool found = subsume_from(subsumer, target, 0);
+            substitution_.undo(mark);
+            return found;
+        }
+
+        bool subsume_from(ClauseId subsumer, ClauseId target, std::uint32_t at)
+        {
+            if (at == clauses_[subsumer].size)
+                return true;
+            const ProverLiteral &pattern = literal(subsumer, at);
+            for (std::uint32_t i = 0; i < clauses_[target].size; ++i)
+            {
+                const ProverLiteral &candidate = literal(target, i);
+                if (taken_[i] || candidate.positive != pattern.positive)
+                    continue;
+                for (const bool flipped : {false, true})
+                {
+                    if (flipped && pattern.right == terms_.truth())
+                        break;
+                    const size_t mark = substitution_.mark();
+                    if (substitution_.match(pattern.left, 0, flipped ? candidate.right : candidate.left, 1) &&
+                        substitution_.match(pattern.right, 0, flipped ? candidate.left : candidate.right, 1))
+                    {
+                        taken_[i] = 1;
+                        if (subsume_from(subsumer, target, at + 1))
+                            return true;
+                        taken_[i] = 0;
+                    }
+                    substitution_.undo(mark);
+                }
+            }
+            return false;
+        }
+
+        // Las activas se indexan por su primer literal: si una subsume a
+        // la nueva, ese literal generaliza alguno de los de la nueva
+        bool forward_subsumed(ClauseId id)
+        {
+            ++stamp_;
+            seen_.resize(clauses_.size(), 0);
+            bool subsumed = false;
+            for (std::uint32_t i = 0; i < clauses_[id].size && !subsumed; ++i)
+                first_literals_.generalizations(literal_term(literal(id, i)), [&](ClauseId candidate) {
+                    if (!active(candidate) || seen_[candidate] == stamp_)
+                        return true;
+                    seen_[candidate] = stamp_;
+                    subsumed = subsumes(candidate, id);
+                    return !subsumed;
+                });
+            return subsumed;
+        }
+
+        // Todos los literales de las activas están en all_literals_: si la
+        // nueva subsume a una, su primer literal tiene una instancia allí
+        void backward_subsume(ClauseId id)
+        {
+            if (clauses_[id].size == 0)
+                return;
+            ++stamp_;
+            seen_.resize(clauses_.size(), 0);
+            std::vector<ClauseId> candidates;
+            all_literals_.instances(literal_term(literal(id, 0)), [&](ClauseId candidate) {
+                if (active(candidate) && seen_[candidate] != stamp_)
+                {
+                    seen_[candidate] = stamp_;
+                    candidates.push_back(candidate);
+                }
+                return true;
+            });
+            for (const ClauseId candidate : candidates)
+                if (subsumes(id, candidate))
+                {
+                    clauses_[candidate].state = State::Retired;
+                    ++stats_.backward_subsumed;
+                }
+        }
+
+        // --- Activación ---
+        // Un literal es literalmente mayor que otro según la extensión a
+        // multiconjuntos del orden: {s, t} si es positivo, {s, s, t, t} si
+        // es negativo
+        bool literal_greater(const ProverLiteral &a, const ProverLiteral &b) const
+        {
+            std::array<ProverTerm, 4> left{a.left, a.right, a.left, a.right}, right{b.left, b.right, b.left, b.right};
+            size_t left_size = a.positive ? 2 : 4, right_size = b.positive ? 2 : 4;
+            for (size_t i = 0; i < left_size;)
+            {
+                const auto common = std::find(right.begin(), right.begin() + right_size, left[i]);
+                if (common == right.begin() + right_size)
+                {
+                    ++i;
+                    continue;
+                }
+                *common = right[--right_size];
+                left[i] = left[--left_size];
+            }
+            if (left_size == 0)
+                return false;
+            for (size_t j = 0; j < right_size; ++j)
+            {
+                bool dominated = false;
+                for (size_t i = 0; i < left_size && !dominated; ++i)
+                    dominated = terms_.compare(left[i], right[j]) == ProverTerms::Order::Greater;
+                if (!dominated)
+                    return false;
+            }
+            return true;
+        }
+
+        void activate(ClauseId id)
+        {
+            Clause &clause = clauses_[id];
+            clause.state = State::Active;
+            ++stats_.given;
+
+            // Se selecciona el literal negativo más pesado; sin negativos
+            // son elegibles los maximales
+            std::uint32_t heaviest = 0;
+            for (std::uint32_t i = 0; i < clause.size; ++i)
+            {
+                const ProverLiteral &current = literal(id, i);
+                const std::uint32_t weight = terms_.weight(current.left) + terms_.weight(current.right);
+                if (!current.positive && (clause.selected == npos || weight > heaviest))
+                {
+                    clause.selected = i;
+                    heaviest = weight;
+                }
+            }
+            for (std::uint32_t i = 0; i < clause.size; ++i)
+            {
+                bool maximal = clause.selected == npos ? true : i == clause.selected;
+                for (std::uint32_t j = 0; j < clause.size && maximal && clause.selected == npos; ++j)
+                    maximal = j == i || !literal_greater(literal(id, j), literal(id, i));
+                eligible_[clause.first + i] = maximal;
+            }
+
+            for (std::uint32_t i = 0; i < clause.size; ++i)
+            {
+                const ProverLiteral current = literal(id, i);
+                if (eligible(id, i))
+                    for (std::uint32_t s = 0; s < sides(current); ++s)
+                    {
+                        const ProverTerm top = side(current, s);
+                        collect_subterms(top);
+                        for (const ProverTerm subterm : subterm_list_)
+                            subterms_.insert(subterm, Position{id, i, s, subterm});
+                        if (current.positive && clauses_[id].selected == npos && !ProverTerms::is_variable(top))
+                            left_sides_.insert(top, Rewriter{id, i, s});
+                    }
+                all_literals_.insert(literal_term(current), id);
+                if (current.right != terms_.truth())
+                    all_literals_.insert(literal_term(current, true), id);
+            }
+            if (clauses_[id].size == 0)
+                return;
+            const ProverLiteral first = literal(id, 0);
+            first_literals_.insert(literal_term(first), id);
+            if (first.right != terms_.truth())
+                first_literals_.insert(literal_term(first, true), id);
+            if (clauses_[id].size == 1 && first.positive && terms_.compare(first.left, first.right) == ProverTerms::Order::Greater)
+                demodulators_.insert(first.left, Rewriter{id, 0, 0});
+        }
+
+        // Subtérminos distintos que no son variables, en preorden
+        void collect_subterms(ProverTerm term)
+        {
+            subterm_list_.clear();
+            std::vector<ProverTerm> pending{term};
+            while (!pending.empty())
+            {
+                const ProverTerm current = pending.back();
+                pending.pop_back();
+                if (ProverTerms::is_variable(current) || std::ranges::find(subterm_list_, current) != subterm_list_.end())
+                    continue;
+                subterm_list_.push_back(current);
+                const std::span<const ProverTerm> arguments = terms_.args(current);
+                pending.insert(pending.end(), arguments.rbegin(), arguments.rend());
+            }
+        }
+
+        // --- Inferencias ---
+        // La elegida va en el banco 0 y la otra premisa en el 1
+        void generate(ClauseId given)
+        {
+            for (std::uint32_t i = 0; i < clauses_[given].size; ++i)
+            {
+                if (!eligible(given, i))
+                    continue;
+                const ProverLiteral current = literal(given, i);
+                if (!current.positive)
+                    equality_resolution(given, i);
+                else
+                    equality_factoring(given, i);
+
+                for (std::uint32_t s = 0; s < sides(current); ++s)
+                {
+                    const ProverTerm top = side(current, s);
+                    // Desde la elegida: l = r en los subtérminos de las activas
+                    if (current.positive && clauses_[given].selected == npos && !ProverTerms::is_variable(top))
+                    {
+                        std::vector<Position> targets;
+                        subterms_.unifiable(top, [&](const Position &position) {
+                            if (active(position.clause))
+                                targets.push_back(position);
+                            return true;
+                        });
+                        for (const Position &target : targets)
+                        {
+                            if (!active(target.clause))
+                                continue;
+                            ++stats_.unifications;
+                            const size_t mark = substitution_.mark();
+                            if (substitution_.unify(top, 0, target.subterm, 1))
+                                superpose(given, i, s, 0, target.clause, target.literal, target.side, target.subterm, 1);
+                            substitution_.undo(mark);
+                        }
+                    }
+
+                    // Hacia la elegida: las ecuaciones activas en sus subtérminos
+                    collect_subterms(top);
+                    const std::vector<ProverTerm> into = subterm_list_;
+                    for (const ProverTerm subterm : into)
+                    {
+                        std::vector<Rewriter> sources;
+                        left_sides_.unifiable(subterm, [&](const Rewriter &rewriter) {
+                            if (rewriter.clause != given && active(rewriter.clause))
+                                sources.push_back(rewriter);
+                            return true;
+                        });
+                        for (const Rewriter &source : sources)
+                        {
+                            if (!active(source.clause))
+                                continue;
+                            ++stats_.unifications;
+                            const size_t mark = substitution_.mark();
+                            if (substitution_.unify(side(literal(source.clause, source.literal), source.side), 1, subterm, 0))
+                                superpose(source.clause, source.literal, source.side, 1, given, i, s, subterm, 0);
+                            substitution_.undo(mark);
+                        }
+                    }
+                }
+            }
+        }
+
+        // C ∨ l = r y D ∨ L[u], σ = mgu(l, u)  ⊢  (C ∨ D ∨ L[r])σ
+        void superpose(ClauseId from, std::uint32_t from_literal, std::uint32_t from_side, std::uint8_t from_bank, ClauseId into,
+                       std::uint32_t into_literal, std::uint32_t into_side, ProverTerm subterm, std::uint8_t into_bank)
+        {
+            const ProverLiteral equation = literal(from, from_literal), target = literal(into, into_literal);
+            // P(x̄) = ⊤ en la raíz de un P(t̄) = ⊤ da ⊤ = ⊤
+            if (equation.right == terms_.truth() && target.positive && subterm == target.left)
+                return;
+            begin_conclusion();
+            copy_literals(from, from_literal, from_bank);
+            copy_literals(into, into_literal, into_bank);
+            replacement_ = {subterm, into_bank, side(equation, 1 - from_side), from_bank};
+            replacing_ = true;
+            const ProverTerm rewritten = instantiate(side(target, into_side), into_bank);
+            replacing_ = false;
+            conclusion_.push_back({rewritten, instantiate(side(target, 1 - into_side), into_bank), target.positive});
+            finish(ProverRule::Superposition, {from, into});
+        }
+
+        // C ∨ s ≠ t, σ = mgu(s, t)  ⊢  Cσ
+        void equality_resolution(ClauseId given, std::uint32_t index)
+        {
+            const ProverLiteral current = literal(given, index);
+            const size_t mark = substitution_.mark();
+            if (substitution_.unify(current.left, 0, current.right, 0))
+            {
+                begin_conclusion();
+                copy_literals(given, index, 0);
+                finish(ProverRule::EqualityResolution, {given});
+            }
+            substitution_.undo(mark);
+        }
+
+        // C ∨ s = t ∨ s' = t', σ = mgu(s, s')  ⊢  (C ∨ t ≠ t' ∨ s' = t')σ
+        void equality_factoring(ClauseId given, std::uint32_t index)
+        {
+            const ProverLiteral current = literal(given, index);
+            for (std::uint32_t s = 0; s < sides(current); ++s)
+                for (std::uint32_t j = 0; j < clauses_[given].size; ++j)
+                {
+                    const ProverLiteral other = literal(given, j);
+                    if (j == index || !other.positive)
+                        continue;
+                    for (std::uint32_t t = 0; t < 2; ++t)
+                    {
+                        const size_t mark = substitution_.mark();
+                        if (substitution_.unify(side(current, s), 0, side(other, t), 0))
+                        {
+                            begin_conclusion();
+                            copy_literals(given, index, 0);
+                            conclusion_.push_back({instantiate(side(current, 1 - s), 0), instantiate(side(other, 1 - t), 0), false});
+                            finish(ProverRule::EqualityFactoring, {given});
+                        }
+                        substitution_.undo(mark);
+                    }
+                }
+        }
+
+        ProverTerms terms_;
+        detail::Substitution substitution_;
+        ProverSymbol equation_ = 0, disequation_ = 0; // Cabezas de los literales como términos (subsunción)
+
+        std::vector<Clause> clauses_;
+        std::vector<ProverLiteral> literals_;
+        std::vector<char> eligible_;
+        std::vector<ClauseId> parents_;
+        ClauseId empty_ = npos;
+
+        std::priority_queue<std::uint64_t, std::vector<std::uint64_t>, std::greater<>> by_weight_; // (peso, id)
+        ClauseId next_oldest_ = 0;
+
+        detail::DiscriminationTree<Position> subterms_;
+        detail::DiscriminationTree<Rewriter> left_sides_;
+        detail::DiscriminationTree<Rewriter> demodulators_;
+        detail::DiscriminationTree<ClauseId> first_literals_;
+        detail::DiscriminationTree<ClauseId> all_literals_;
+
+        // Conclusión en construcción
+        std::vector<ProverLiteral> conclusion_;
+        std::array<std::vector<ClauseId>, 2> renaming_;
+        std::uint32_t next_variable_ = 0;
+        std::vector<ProverTerm> scratch_;
+        Replacement replacement_{};
+        bool replacing_ = false;
+        bool keep_variables_ = false; // Las variables del banco 1 no se renombran (demodulación)
+
+        std::vector<ClauseId> used_; // Demoduladores usados
+        std::vector<char> taken_;
+        std::vector<std::uint64_t> seen_;
+        std::uint64_t stamp_ = 0;
+        std::vector<ProverTerm> subterm_list_;
+
+        ProverStats stats_;
+    };
+
+    // --- Cláusulas de una fórmula ---
+    template <typename Store>
+    class BasicClausifier
+    {
+    public:
+        static constexpr size_t max_clauses = 100000; // Por fórmula, tras distribuir
+
+        BasicClausifier(const Store &store, SuperpositionSolver &solver, std::string_view equality = "Equal", std::string_view falsum = "False")
+            : store_(store), solver_(solver), equality_(equality), falsum_(falsum)
+        {
+        }
+
+        // Añade las cláusulas de la fórmula (o de su negación) y devuelve
+        // cuántas. Las variables libres de la fórmula son universales: en
+        // la negación quedan como constantes de Skolem.
+        size_t add(NodeId formula, bool positive = true)
+        {
+            nodes_.clear();
+            scope_.clear();
+            universals_.clear();
+            next_variable_ = 0;
+
+            std::vector<SymbolId> free;
+            free_variables(formula, free);
+            for (const SymbolId variable : free)
+                scope_.push_back({variable, positive ? universal() : skolem()});
+
+            const std::vector<std::vector<ProverLiteral>> clauses = cnf(nnf(formula, positive));
+            for (const std::vector<ProverLiteral> &clause : clauses)
+                solver_.add_clause(clause);
+            return clauses.size();
+        }
+
+    private:
+        struct Nnf
+        {
+            enum class Kind : std::uint8_t
+            {
+                Literal,
+                And,
+                Or,
+                True,
+                False
+            } kind;
+            ProverLiteral literal;
+            std::uint32_t left = 0, right = 0;
+        };
+
+        ProverTerms &terms() { return solver_.terms(); }
+
+        std::uint32_t push(Nnf node)
+        {
+            nodes_.push_back(node);
+            return static_cast<std::uint32_t>(nodes_.size() - 1);
+        }
+
+        std::uint32_t connective(typename Nnf::Kind kind, std::uint32_t left, std::uint32_t right) { return push({kind, {}, left, right}); }
+
+        void free_variables(NodeId id, std::vector<SymbolId> &out)
+        {
+            const Node &node = store_[id];
+            if (node.op == NodeOp::Variable)
+            {
+                const bool bound = std::ranges::find(bound_, node.symbol) != bound_.end();
+                if (!bound && std::ranges::find(out, node.symbol) == out.end())
+                    out.push_back(node.symbol);
+                return;
+            }
+            if (is_binder(node.op))
+                bound_.push_back(node.symbol);
+            for (const NodeId child : store_.children(id))
+                free_variables(child, out);
+            if (is_binder(node.op))
+                bound_.pop_back();
+        }
+
+        ProverTerm universal()
+        {
+            universals_.push_back(ProverTerms::variable(next_variable_++));
+            return universals_.back();
+        }
+
+        // f(x̄) con las universales en alcance
+        ProverTerm skolem() { return terms().apply(terms().fresh_symbol("sk", static_cast<std::uint32_t>(universals_.size())), universals_); }
+
+        // Forma normal negativa de la fórmula con esa polaridad; los
+        // cuantificadores desaparecen (variables o términos de Skolem)
+        std::uint32_t nnf(NodeId id, bool positive)
+        {
+            using Kind = typename Nnf::Kind;
+            const Node &node = store_[id];
+            const std::span<const NodeId> children = store_.children(id);
+            switch (node.op)
+            {
+            case NodeOp::Not:
+                return nnf(children[0], !positive);
+            case NodeOp::And:
+            case NodeOp::Or: {
+                const std::uint32_t left = nnf(children[0], positive), right = nnf(children[1], positive);
+                return connective((node.op == NodeOp::And) == positive ? Kind::And : Kind::Or, left, right);
+            }
+            case NodeOp::Implies: {
+                const std::uint32_t left = nnf(children[0], !positive), right = nnf(children[1], positive);
+                return connective(positive ? Kind::Or : Kind::And, left, right);
+            }
+            case NodeOp::Equiv: {
+                // a ↔ b: (¬a ∨ b) ∧ (a ∨ ¬b); ¬(a ↔ b): (a ∨ b) ∧ (¬a ∨ ¬b)
+                const std::uint32_t first = connective(Kind::Or, nnf(children[0], !positive), nnf(children[1], true));
+                const std::uint32_t second = connective(Kind::Or, nnf(children[0], positive), nnf(children[1], false));
+                return connective(Kind::And, first, second);
+            }
+            case NodeOp::Forall:
+            case NodeOp::Exists: {
+                const bool universal_here = (node.op == NodeOp::Forall) == positive;
+                const size_t universals = universals_.size();
+                scope_.push_back({node.symbol, universal_here ? universal() : skolem()});
+                const std::uint32_t body = nnf(children[0], positive);
+                scope_.pop_back();
+                universals_.resize(universals);
+                return body;
+            }
+            case NodeOp::Atom:
+                if (children.empty() && store_.label(id) == falsum_)
+                    return push({positive ? Kind::False : Kind::True, {}});
+                if (children.size() == 2 && store_.label(id) == equality_)
+                    return push({Kind::Literal, {term(children[0]), term(children[1]), positive}});
+                return push({Kind::Literal, {atom(id), terms().truth(), positive}});
+            default:
+                throw std::invalid_argument("Clausifier: un término no es una fórmula");
+            }
+        }
+
+        ProverTerm term(NodeId id)
+        {
+            const Node &node = store_[id];
+            switch (node.op)
+            {
+            case NodeOp::Variable:
+                for (auto entry = scope_.rbegin(); entry != scope_.rend(); ++entry)
+                    if (entry->first == node.symbol)
+                        return entry->second;
+                throw std::logic_error("Clausifier: variable sin cuantificar");
+            case NodeOp::Constant:
+                return terms().apply(terms().symbol(store_.label(id), 0), {});
+            case NodeOp::Atom: {
+                std::vector<ProverTerm> args;
+                for (const NodeId child : store_.children(id))
+                    args.push_back(term(child));
+                return terms().apply(terms().symbol(store_.label(id), static_cast<std::uint32_t>(args.size())), args);
+            }
+            default:
+                throw std::invalid_argument("Clausifier: una fórmula dentro de un término");
+            }
+        }
+
+        ProverTerm atom(NodeId id)
+        {
+            std::vector<ProverTerm> args;
+            for (const NodeId child : store_.children(id))
+                args.push_back(term(child));
+            return terms().apply(terms().predicate(store_.label(id), static_cast<std::uint32_t>(args.size())), args);
+        }
+
+        // Distribución de ∨ sobre ∧
+        std::vector<std::vector<ProverLiteral>> cnf(std::uint32_t index)
+        {
+            using Kind = typename Nnf::Kind;
+            const Nnf node = nodes_[index];
+            switch (node.kind)
+            {
+            case Kind::Literal:
+                return {{node.literal}};
+            case Kind::True:
+                return {};
+            case Kind::False:
+                return {{}};
+            case Kind::And: {
+                std::vector<std::vector<ProverLiteral>> left = cnf(node.left), right = cnf(node.right);
+                left.insert(left.end(), std::make_move_iterator(right.begin()), std::make_move_iterator(right.end()));
+                return left;
+            }
+            default: {
+                const std::vector<std::vector<ProverLiteral>> left = cnf(node.left), right = cnf(node.right);
+                if (left.size() * right.size() > max_clauses)
+                    throw std::length_error("Clausifier: demasiadas cláusulas");
+                std::vector<std::vector<ProverLiteral>> out;
+                out.reserve(left.size() * right.size());
+                for (const std::vector<ProverLiteral> &a : left)
+                    for (const std::vector<ProverLiteral> &b : right)
+                    {
+                        out.push_back(a);
+                        out.back().insert(out.back().end(), b.begin(), b.end());
+                    }
+                return out;
+            }
+            }
+        }
+
+        const Store &store_;
+        SuperpositionSolver &solver_;
+        std::string equality_, falsum_;
+
+        std::vector<Nnf> nodes_;
+        std::vector<std::pair<SymbolId, ProverTerm>> scope_; // Variable del almacén → variable o término de Skolem
+        std::vector<ProverTerm> universals_;
+        std::vector<SymbolId> bound_;
+        std::uint32_t next_variable_ = 0;
+    };
+
+    // Refutación: axiomas ∧ ¬objetivo es insatisfacible si y solo si el
+    // objetivo se sigue de los axiomas
+    template <typename Store>
+    class BasicResolutionProver
+    {
+    public:
+        explicit BasicResolutionProver(const Store &store, std::string_view equality = "Equal") : clausifier_(store, solver_, equality) {}
+
+        // El clausificador guarda una referencia al demostrador
+        BasicResolutionProver(const BasicResolutionProver &) = delete;
+        BasicResolutionProver &operator=(const BasicResolutionProver &) = delete;
+
+        size_t add_axiom(NodeId formula) { return clausifier_.add(formula, true); }
+
+        // Solo un objetivo: con varios se demostraría su disyunción
+        size_t add_goal(NodeId formula) { return clausifier_.add(formula, false); }
+
+        ProverResult prove(const ProverOptions &options = {}) { return solver_.prove(options); }
+
+        const SuperpositionSolver &solver() const { return solver_; }
+        const ProverStats &stats() const { return solver_.stats(); }
+        std::vector<ClauseId> proof() const { return solver_.proof(); }
+
+    private:
+        SuperpositionSolver solver_;
+        BasicClausifier<Store> clausifier_;
+    };
+
+    using Clausifier = BasicClausifier<TermStore>;
+    using ResolutionProver = BasicResolutionProver<TermStore>;
+
+} // namespace logic::runtime
@@ -0,0 +1,820 @@
+#pragma once
+
+#include "term_store.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// =========================================================
+// === SAT (CDCL + Tseitin) ===
+// =========================================================
+//
+// La tabla de verdad recorre las 2^n asignaciones y no pasa de unos 30
+// átomos. SatSolver es un resolvedor CDCL (conflict-driven clause
+// learning) al estilo de MiniSat/Glucose:
+//
+//   - dos literales vigilados por cláusula (con un literal "bloqueador"
+//     en cada vigilancia para no tocar la cláusula si ya está satisfecha);
+//   - aprendizaje por el primer UIP con minimización de la cláusula;
+//   - VSIDS (un montículo de variables por actividad) y fase guardada;
+//   - reinicios según la sucesión de Luby;
+//   - una base de cláusulas aprendidas que se reduce a la mitad
+//     periódicamente, conservando las de menor LBD (número de niveles de
+//     decisión distintos) y las que son razón de una asignación.
+//
+// BasicTseitinEncoder traduce una fórmula de un TermStore a cláusulas con
+// una variable nueva por conectiva binaria (¬ no crea variable), con los
+// mismos átomos que la tabla de verdad: predicados, igualdades y
+// cuantificadores, salvo un cuantificador cuyo cuerpo es válido, que vale
+// como verdadero. BasicSatProver decide si la fórmula es válida
+// comprobando que su negación es insatisfacible, y si no lo es devuelve
+// un contraejemplo.
+
+namespace logic::runtime
+{
+
+    using SatVariable = std::uint32_t;
+
+    // Literal: 2 · variable, más 1 si está negado
+    struct SatLiteral
+    {
+        std::uint32_t code = 0;
+
+        static constexpr SatLiteral positive(SatVariable variable) { return {variable << 1}; }
+        static constexpr SatLiteral negative(SatVariable variable) { return {variable << 1 | 1}; }
+
+        constexpr SatVariable variable() const { return code >> 1; }
+        constexpr bool negated() const { return code & 1; }
+        constexpr SatLiteral operator~() const { return {code ^ 1}; }
+        friend constexpr bool operator==(SatLiteral, SatLiteral) = default;
+    };
+
+    enum class SatResult : std::uint8_t
+    {
+        Satisfiable,
+        Unsatisfiable,
+        Unknown // Se acabó el límite de conflictos
+    };
+
+    struct SatStats
+    {
+        std::uint64_t decisions = 0;
+        std::uint64_t propagations = 0;
+        std::uint64_t conflicts = 0;
+        std::uint64_t restarts = 0;
+        std::uint64_t learned = 0; // Cláusulas aprendidas, en total
+        std::uint64_t deleted = 0; // Aprendidas borradas al reducir la base
+    };
+
+    namespace detail
+    {
+        // Montículo de máximos de variables por actividad: la siguiente
+        // decisión de VSIDS. Recibe las actividades en cada operación para
+        // que SatSolver se pueda copiar y mover.
+        class ActivityHeap
+        {
+        public:
+            bool empty() const { return heap_.empty(); }
+            bool contains(SatVariable variable) const { return variable < index_.size() && index_[variable] != absent; }
+
+            void insert(SatVariable variable, const std::vector<double> &activity)
+            {
+                if (variable >= index_.size())
+                    index_.resize(variable + 1, absent);
+                if (contains(variable))
+                    return;
+                index_[variable] = static_cast<std::uint32_t>(heap_.size());
+                heap_.push_back(variable);
+                up(index_[variable], activity);
+            }
+
+            // La actividad de `variable` ha crecido
+            void increased(SatVariable variable, const std::vector<double> &activity)
+            {
+                if (contains(variable))
+                    up(index_[variable], activity);
+            }
+
+            SatVariable pop(const std::vector<double> &activity)
+            {
+                const SatVariable top = heap_[0];
+                heap_[0] = heap_.back();
+                index_[heap_[0]] = 0;
+                index_[top] = absent;
+                heap_.pop_back();
+                if (!heap_.empty())
+                    down(0, activity);
+                return top;
+            }
+
+        private:
+            static constexpr std::uint32_t absent = std::numeric_limits<std::uint32_t>::max();
+
+            void up(std::uint32_t position, const std::vector<double> &activity)
+            {
+                const SatVariable variable = heap_[position];
+                while (position > 0)
+                {
+                    const std::uint32_t parent = (position - 1) / 2;
+                    if (activity[heap_[parent]] >= activity[variable])
+                        break;
+                    heap_[position] = heap_[parent];
+                    index_[heap_[position]] = position;
+                    position = parent;
+                }
+                heap_[position] = variable;
+                index_[variable] = position;
+            }
+
+            void down(std::uint32_t position, const std::vector<double> &activity)
+            {
+                const SatVariable variable = heap_[position];
+                for (;;)
+                {
+                    std::uint32_t child = 2 * position + 1;
+                    if (child >= heap_.size())
+                        break;
+                    if (child + 1 < heap_.size() && activity[heap_[child + 1]] > activity[heap_[child]])
+                        ++child;
+                    if (activity[heap_[child]] <= activity[variable])
+                        break;
+                    heap_[position] = heap_[child];
+                    index_[heap_[position]] = position;
+                    position = child;
+                }
+                heap_[position] = variable;
+                index_[variable] = position;
+            }
+
+            std::vector<SatVariable> heap_;
+            std::vector<std::uint32_t> index_; // Posición de cada variable en heap_
+        };
+    } // namespace detail
+
+    class SatSolver
+    {
+    public:
+        static constexpr std::uint64_t unlimited = std::numeric_limits<std::uint64_t>::max();
+
+        SatVariable new_variable()
+        {
+            const auto variable = static_cast<SatVariable>(level_.size());
+            values_.insert(values_.end(), 2, undefined);
+            watches_.resize(values_.size());
+            level_.push_back(0);
+            reason_.push_back(no_clause);
+            activity_.push_back(0);
+            phase_.push_back(1); // Primero se prueba falso, como MiniSat
+            seen_.push_back(0);
+            heap_.insert(variable, activity_);
+            return variable;
+        }
+
+        size_t variables() const { return level_.size(); }
+        size_t clauses() const { return clauses_.size(); }
+        size_t learned_clauses() const { return learnts_.size(); }
+        const SatStats &stats() const { return stats_; }
+
+        // Añade una cláusula (entre dos llamadas a solve()); false si la
+        // fórmula ya es insatisfacible
+        bool add_clause(std::span<const SatLiteral> literals)
+        {
+            if (!ok_)
+                return false;
+            std::vector<SatLiteral> clause(literals.begin(), literals.end());
+            for (const SatLiteral literal : clause)
+                if (literal.variable() >= variables())
+                    throw std::out_of_range("SatSolver: variable no declarada");
+
+            // Ordenados, l y ¬l quedan juntos: se quitan los repetidos y los
+            // falsos en el nivel 0; sobra la cláusula con l y ¬l o con un
+            // literal ya verdadero
+            std::ranges::sort(clause, {}, &SatLiteral::code);
+            size_t kept = 0;
+            for (size_t i = 0; i < clause.size(); ++i)
+            {
+                const SatLiteral literal = clause[i];
+                if (value(literal) == yes || (i + 1 < clause.size() && clause[i + 1] == ~literal))
+                    return true;
+                if (value(literal) == no || (kept > 0 && clause[kept - 1] == literal))
+                    continue;
+                clause[kept++] = literal;
+            }
+            clause.resize(kept);
+
+            if (clause.empty())
+                return ok_ = false;
+            if (clause.size() == 1)
+                assign(clause[0], no_clause);
+            else
+            {
+                const ClauseRef ref = allocate(clause, false, 0);
+                clauses_.push_back(ref);
+                attach(ref);
+            }
+            return true;
+        }
+
+        bool add_clause(std::initializer_list<SatLiteral> literals) { return add_clause(std::span(literals.begin(), literals.size())); }
+
+        // Con Satisfiable, model_value() da el modelo encontrado
+        SatResult solve(std::uint64_t max_conflicts = unlimited)
+        {
+            model_.clear();
+            if (!ok_)
+                return SatResult::Unsatisfiable;
+            if (propagate() != no_clause)
+            {
+                ok_ = false;
+                return SatResult::Unsatisfiable;
+            }
+
+            const std::uint64_t limit = max_conflicts > unlimited - stats_.conflicts ? unlimited : stats_.conflicts + max_conflicts;
+            SatResult result = SatResult::Unknown;
+            for (std::uint32_t restart = 0; result == SatResult::Unknown && stats_.conflicts < limit; ++restart)
+                result = search(luby(restart) * restart_unit, limit);
+            backtrack(0);
+            if (result == SatResult::Unsatisfiable)
+                ok_ = false;
+            return result;
+        }
+
+        bool model_value(SatVariable variable) const { return model_[variable]; }
+        bool model_value(SatLiteral literal) const { return model_[literal.variable()] != literal.negated(); }
+
+    private:
+        using ClauseRef = std::uint32_t; // Posición de la cabecera en arena_
+
+        struct Watch
+        {
+            ClauseRef clause;
+            SatLiteral blocker; // Otro literal de la cláusula: si es verdadero, no hace falta mirarla
+        };
+
+        static constexpr ClauseRef no_clause = std::numeric_limits<ClauseRef>::max();
+        static constexpr SatVariable no_variable = std::numeric_limits<SatVariable>::max();
+        static constexpr std::int8_t yes = 1, no = -1, undefined = 0;
+
+        // Cabecera de cada cláusula en arena_: tamaño, indicadores (aprendida,
+        // borrada) con el LBD y la actividad (float); luego los literales
+        static constexpr size_t header = 3;
+        static constexpr std::uint32_t learnt_flag = 1, deleted_flag = 2;
+
+        static constexpr std::uint64_t restart_unit = 100;
+        static constexpr std::uint64_t first_reduce = 2000, reduce_increment = 300;
+        static constexpr double variable_decay = 0.95, clause_decay = 0.999;
+
+        // 1, 1, 2, 1, 1, 2, 4, 1, 1, 2, 1, 1, 2, 4, 8, ...
+        static std::uint64_t luby(std::uint32_t index)
+        {
+            std::uint64_t size = 1;
+            std::uint32_t sequence = 0;
+            while (size < std::uint64_t{index} + 1)
+            {
+                ++sequence;
+                size = 2 * size + 1;
+            }
+            std::uint64_t x = index;
+            while (size - 1 != x)
+            {
+                size = (size - 1) >> 1;
+                --sequence;
+                x %= size;
+            }
+            return std::uint64_t{1} << sequence;
+        }
+
+        std::int8_t value(SatLiteral literal) const { return values_[literal.code]; }
+        std::uint32_t decision_level() const { return static_cast<std::uint32_t>(trail_limits_.size()); }
+
+        std::span<SatLiteral> literals(ClauseRef ref)
+        {
+            return {reinterpret_cast<SatLiteral *>(arena_.data() + ref + header), arena_[ref]};
+        }
+        bool learnt(ClauseRef ref) const { return arena_[ref + 1] & learnt_flag; }
+        std::uint32_t lbd(ClauseRef ref) const { return arena_[ref + 1] >> 2; }
+        float activity(ClauseRef ref) const { return std::bit_cast<float>(arena_[ref + 2]); }
+        void set_activity(ClauseRef ref, float activity) { arena_[ref + 2] = std::bit_cast<std::uint32_t>(activity); }
+
+        ClauseRef allocate(std::span<const SatLiteral> clause, bool learnt, std::uint32_t lbd)
+        {
+            const auto ref = static_cast<ClauseRef>(arena_.size());
+            arena_.push_back(static_cast<std::uint32_t>(clause.size()));
+            arena_.push_back((learnt ? learnt_flag : 0) | lbd << 2);
+            arena_.push_back(std::bit_cast<std::uint32_t>(0.0f));
+            for (const SatLiteral literal : clause)
+                arena_.push_back(literal.code);
+            return ref;
+        }
+
+        void attach(ClauseRef ref)
+        {
+            const std::span<SatLiteral> clause = literals(ref);
+            watches_[clause[0].code].push_back({ref, clause[1]});
+            watches_[clause[1].code].push_back({ref, clause[0]});
+        }
+
+        void assign(SatLiteral literal, ClauseRef reason)
+        {
+            values_[literal.code] = yes;
+            values_[(~literal).code] = no;
+            level_[literal.variable()] = decision_level();
+            reason_[literal.variable()] = reason;
+            trail_.push_back(literal);
+        }
+
+        // Propaga las asignaciones pendientes; devuelve la cláusula en
+        // conflicto o no_clause. La cláusula que implica un literal lo tiene
+        // en la posición 0 (analyze lo salta).
+        ClauseRef propagate()
+        {
+            ClauseRef conflict = no_clause;
+            while (head_ < trail_.size())
+            {
+                const SatLiteral false_literal = ~trail_[head_++];
+                ++stats_.propagations;
+                std::vector<Watch> &watches = watches_[false_literal.code];
+                size_t i = 0, j = 0;
+                while (i < watches.size())
+                {
+                    const Watch watch = watches[i];
+                    if (value(watch.blocker) == yes)
+                    {
+                        watches[j++] = watches[i++];
+                        continue;
+                    }
+                    const std::span<SatLiteral> clause = literals(watch.clause);
+                    if (clause[0] == false_literal)
+                        std::swap(clause[0], clause[1]);
+                    ++i;
+
+                    const SatLiteral first = clause[0];
+                    const Watch kept{watch.clause, first};
+                    if (first != watch.blocker && value(first) == yes)
+                    {
+                        watches[j++] = kept;
+                        continue;
+                    }
+
+                    // Otro literal que no sea falso pasa a vigilarse
+                    bool moved = false;
+                    for (size_t k = 2; k < clause.size(); ++k)
+                        if (value(clause[k]) != no)
+                        {
+                            clause[1] = clause[k];
+                            clause[k] = false_literal;
+                            watches_[clause[1].code].push_back(kept);
+                            moved = true;
+                            break;
+                        }
+                    if (moved)
+                        continue;
+
+                    // Unitaria o en conflicto
+                    watches[j++] = kept;
+                    if (value(first) == no)
+                    {
+                        conflict = watch.clause;
+                        head_ = trail_.size();
+                        while (i < watches.size())
+                            watches[j++] = watches[i++];
+                    }
+                    else
+                        assign(first, watch.clause);
+                }
+                watches.resize(j);
+            }
+            return conflict;
+        }
+
+        void bump_variable(SatVariable variable)
+        {
+            if ((activity_[variable] += variable_increment_) > 1e100)
+            {
+                for (double &activity : activity_)
+                    activity *= 1e-100;
+                variable_increment_ *= 1e-100;
+            }
+            heap_.increased(variable, activity_);
+        }
+
+        void bump_clause(ClauseRef ref)
+        {
+            set_activity(ref, activity(ref) + static_cast<float>(clause_increment_));
+            if (activity(ref) > 1e20f)
+            {
+                for (const ClauseRef learnt : learnts_)
+                    set_activity(learnt, activity(learnt) * 1e-20f);
+                clause_increment_ *= 1e-20;
+            }
+        }
+
+        // Primer UIP: deja en learnt_ la cláusula aprendida, con el literal
+        // que se asigna tras el salto en la posición 0 y uno del nivel del
+        // salto en la 1, y devuelve ese nivel
+        std::uint32_t analyze(ClauseRef conflict)
+        {
+            learnt_.assign(1, SatLiteral{});
+            std::uint32_t paths = 0;
+            SatLiteral implied{};
+            size_t index = trail_.size();
+            ClauseRef clause = conflict;
+            bool first = true;
+            do
+            {
+                if (learnt(clause))
+                    bump_clause(clause);
+                const std::span<SatLiteral> reason = literals(clause);
+                for (size_t j = first ? 0 : 1; j < reason.size(); ++j)
+                {
+                    const SatVariable variable = reason[j].variable();
+                    if (!seen_[variable] && level_[variable] > 0)
+                    {
+                        bump_variable(variable);
+                        seen_[variable] = 1;
+                        if (level_[variable] >= decision_level())
+                            ++paths;
+                        else
+                            learnt_.push_back(reason[j]);
+                    }
+                }
+                while (!seen_[trail_[--index].variable()])
+                {
+                }
+                implied = trail_[index];
+                clause = reason_[implied.variable()];
+                seen_[implied.variable()] = 0;
+                first = false;
+            } while (--paths > 0);
+            learnt_[0] = ~implied;
+
+            // Minimización: sobra un literal cuya razón solo tiene literales
+            // que ya están en la cláusula (o del nivel 0)
+            analyzed_ = learnt_;
+            size_t kept = 1;
+            for (size_t i = 1; i < learnt_.size(); ++i)
+            {
+                const ClauseRef reason = reason_[learnt_[i].variable()];
+                bool redundant = reason != no_clause;
+                if (redundant)
+                    for (const SatLiteral literal : literals(reason).subspan(1))
+                        if (!seen_[literal.variable()] && level_[literal.variable()] > 0)
+                        {
+                            redundant = false;
+                            break;
+                        }
+                if (!redundant)
+                    learnt_[kept++] = learnt_[i];
+            }
+            learnt_.resize(kept);
+            for (const SatLiteral literal : analyzed_)
+                seen_[literal.variable()] = 0;
+
+            if (learnt_.size() == 1)
+                return 0;
+            size_t highest = 1;
+            for (size_t i = 2; i < learnt_.size(); ++i)
+                if (level_[learnt_[i].variable()] > level_[learnt_[highest].variable()])
+                    highest = i;
+            std::swap(learnt_[1], learnt_[highest]);
+            return level_[learnt_[1].variable()];
+        }
+
+        // Niveles de decisión distintos de learnt_
+        std::uint32_t literal_block_distance()
+        {
+            if (level_stamps_.size() <= decision_level())
+                level_stamps_.resize(decision_level() + 1, 0);
+            ++stamp_;
+            std::uint32_t distinct = 0;
+            for (const SatLiteral literal : learnt_)
+            {
+                std::uint64_t &stamp = level_stamps_[level_[literal.variable()]];
+                if (stamp != stamp_)
+                {
+                    stamp = stamp_;
+                    ++distinct;
+                }
+            }
+            return distinct;
+        }
+
+        void backtrack(std::uint32_t level)
+        {
+            if (decision_level() <= level)
+                return;
+            for (size_t i = trail_.size(); i-- > trail_limits_[level];)
+            {
+                const SatLiteral literal = trail_[i];
+                const SatVariable variable = literal.variable();
+                values_[literal.code] = values_[(~literal).code] = undefined;
+                reason_[variable] = no_clause;
+                phase_[variable] = literal.negated();
+                heap_.insert(variable, activity_);
+            }
+            trail_.resize(trail_limits_[level]);
+            trail_limits_.resize(level);
+            head_ = trail_.size();
+        }
+
+        // La cláusula es la razón de su literal 0
+        bool locked(ClauseRef ref)
+        {
+            const SatLiteral first = literals(ref)[0];
+            return reason_[first.variable()] == ref && value(first) == yes;
+        }
+
+        // Borra la peor mitad de las aprendidas (más LBD y menos actividad),
+        // salvo las de LBD ≤ 2 y las que son razón de una asignación
+        void reduce()
+        {
+            std::ranges::sort(learnts_, [&](ClauseRef a, ClauseRef b) {
+                return lbd(a) != lbd(b) ? lbd(a) > lbd(b) : activity(a) < activity(b);
+            });
+            const size_t half = learnts_.size() / 2;
+            for (size_t i = 0; i < half; ++i)
+                if (lbd(learnts_[i]) > 2 && !locked(learnts_[i]))
+                {
+                    arena_[learnts_[i] + 1] |= deleted_flag;
+                    ++stats_.deleted;
+                }
+            std::erase_if(learnts_, [&](ClauseRef ref) { return arena_[ref + 1] & deleted_flag; });
+            collect_garbage();
+        }
+
+        // Compacta arena_: cada cláusula viva se copia y su nueva posición
+        // queda en la cabecera vieja para corregir las razones; las
+        // vigilancias se rehacen (los literales 0 y 1 siguen siendo los
+        // vigilados)
+        void collect_garbage()
+        {
+            std::vector<std::uint32_t> arena;
+            arena.reserve(arena_.size());
+            const auto move = [&](ClauseRef &ref) {
+                const auto moved = static_cast<ClauseRef>(arena.size());
+                arena.insert(arena.end(), arena_.begin() + ref, arena_.begin() + ref + header + arena_[ref]);
+                arena_[ref + 2] = moved;
+                ref = moved;
+            };
+            for (ClauseRef &ref : clauses_)
+                move(ref);
+            for (ClauseRef &ref : learnts_)
+                move(ref);
+            for (const SatLiteral literal : trail_)
+                if (ClauseRef &reason = reason_[literal.variable()]; reason != no_clause)
+                    reason = arena_[reason + 2];
+            arena_ = std::move(arena);
+
+            for (std::vector<Watch> &watches : watches_)
+                watches.clear();
+            for (const ClauseRef ref : clauses_)
+                attach(ref);
+            for (const ClauseRef ref : learnts_)
+                attach(ref);
+        }
+
+        SatResult search(std::uint64_t restart_limit, std::uint64_t limit)
+        {
+            std::uint64_t conflicts = 0;
+            for (;;)
+            {
+                if (const ClauseRef conflict = propagate(); conflict != no_clause)
+                {
+                    ++stats_.conflicts;
+                    ++conflicts;
+                    if (decision_level() == 0)
+                        return SatResult::Unsatisfiable;
+                    const std::uint32_t backjump = analyze(conflict);
+                    const std::uint32_t distance = literal_block_distance();
+                    backtrack(backjump);
+                    if (learnt_.size() == 1)
+                        assign(learnt_[0], no_clause);
+                    else
+                    {
+                        const ClauseRef ref = allocate(learnt_, true, distance);
+                        learnts_.push_back(ref);
+                        attach(ref);
+                        bump_clause(ref);
+                        assign(learnt_[0], ref);
+                    }
+                    ++stats_.learned;
+                    variable_increment_ /= variable_decay;
+                    clause_increment_ /= clause_decay;
+                    continue;
+                }
+
+                if (conflicts >= restart_limit || stats_.conflicts >= limit)
+                {
+                    backtrack(0);
+                    ++stats_.restarts;
+                    return SatResult::Unknown;
+                }
+                if (stats_.conflicts >= next_reduce_)
+                {
+                    reduce_interval_ += reduce_increment;
+                    next_reduce_ = stats_.conflicts + reduce_interval_;
+                    reduce();
+                }
+
+                // Decisión: la variable libre más activa, con su última fase
+                SatVariable next = no_variable;
+                while (!heap_.empty() && next == no_variable)
+                    if (const SatVariable variable = heap_.pop(activity_); value(SatLiteral::positive(variable)) == undefined)
+                        next = variable;
+                if (next == no_variable)
+                {
+                    model_.resize(variables());
+                    for (SatVariable variable = 0; variable < variables(); ++variable)
+                        model_[variable] = value(SatLiteral::positive(variable)) == yes;
+                    return SatResult::Satisfiable;
+                }
+                ++stats_.decisions;
+                trail_limits_.push_back(static_cast<std::uint32_t>(trail_.size()));
+                assign(phase_[next] ? SatLiteral::negative(next) : SatLiteral::positive(next), no_clause);
+            }
+        }
+
+        std::vector<std::uint32_t> arena_;
+        std::vector<ClauseRef> clauses_, learnts_;
+        std::vector<std::vector<Watch>> watches_; // Por literal: las cláusulas que lo vigilan
+
+        std::vector<std::int8_t> values_; // Por literal
+        std::vector<std::uint32_t> level_;
+        std::vector<ClauseRef> reason_;
+        std::vector<std::uint8_t> phase_; // 1 = la última vez fue falsa
+        std::vector<std::uint8_t> seen_;
+        std::vector<SatLiteral> trail_;
+        std::vector<std::uint32_t> trail_limits_; // Comienzo de cada nivel en trail_
+        size_t head_ = 0;                         // Siguiente de trail_ por propagar
+
+        std::vector<double> activity_;
+        detail::ActivityHeap heap_;
+        double variable_increment_ = 1, clause_increment_ = 1;
+
+        std::vector<SatLiteral> learnt_, analyzed_;
+        std::vector<std::uint64_t> level_stamps_;
+        std::uint64_t stamp_ = 0;
+        std::uint64_t next_reduce_ = first_reduce, reduce_interval_ = first_reduce;
+
+        std::vector<bool> model_;
+        SatStats stats_;
+        bool ok_ = true;
+    };
+
+    template <typename Store>
+    class BasicSatProver;
+
+    // Cada subfórmula distinta se codifica una vez (con hash-consing, las
+    // compartidas comparten variable), con las cláusulas de x ↔ (a ∘ b)
+    template <typename Store>
+    class BasicTseitinEncoder
+    {
+    public:
+        BasicTseitinEncoder(const Store &store, SatSolver &solver) : store_(store), solver_(solver) {}
+
+        // Un literal equivalente a la fórmula. El recorrido usa una pila
+        // propia: las obligaciones generadas pueden anidar cientos de miles
+        // de conectivas.
+        SatLiteral encode(NodeId formula)
+        {
+            std::vector<std::pair<NodeId, bool>> pending{{formula, false}}; // (nodo, hijos ya apilados)
+            while (!pending.empty())
+            {
+                const auto [id, expanded] = pending.back();
+                if (literals_.contains(id))
+                {
+                    pending.pop_back();
+                    continue;
+                }
+                const Node &node = store_[id];
+                const bool binary = node.op == NodeOp::And || node.op == NodeOp::Or || node.op == NodeOp::Implies || node.op == NodeOp::Equiv;
+                if (!expanded && (binary || node.op == NodeOp::Not))
+                {
+                    pending.back().second = true;
+                    pending.push_back({node.operands[0], false});
+                    if (binary)
+                        pending.push_back({node.operands[1], false});
+                    continue;
+                }
+                pending.pop_back();
+
+                SatLiteral literal;
+                if (node.op == NodeOp::Not)
+                    literal = ~literals_.at(node.operands[0]);
+                else if (binary)
+                    literal = gate(node.op, literals_.at(node.operands[0]), literals_.at(node.operands[1]));
+                else if (node.op == NodeOp::Forall || node.op == NodeOp::Exists)
+                    literal = BasicSatProver<Store>(store_, node.operands[0]).valid() ? truth() : atom(id);
+                else
+                    literal = atom(id);
+                literals_.emplace(id, literal);
+            }
+            return literals_.at(formula);
+        }
+
+        // Los átomos, en el orden en que aparecen, y su variable
+        std::span<const NodeId> atoms() const { return atoms_; }
+        SatVariable variable(size_t atom) const { return atom_variables_[atom]; }
+
+    private:
+        SatLiteral atom(NodeId id)
+        {
+            atoms_.push_back(id);
+            atom_variables_.push_back(solver_.new_variable());
+            return SatLiteral::positive(atom_variables_.back());
+        }
+
+        SatLiteral truth()
+        {
+            if (!truth_)
+            {
+                truth_ = SatLiteral::positive(solver_.new_variable());
+                solver_.add_clause({*truth_});
+            }
+            return *truth_;
+        }
+
+        SatLiteral gate(NodeOp op, SatLiteral a, SatLiteral b)
+        {
+            const SatLiteral x = SatLiteral::positive(solver_.new_variable());
+            switch (op)
+            {
+            case NodeOp::And: // x ↔ a ∧ b
+                solver_.add_clause({~x, a});
+                solver_.add_clause({~x, b});
+                solver_.add_clause({x, ~a, ~b});
+                break;
+            case NodeOp::Or: // x ↔ a ∨ b
+                solver_.add_clause({x, ~a});
+                solver_.add_clause({x, ~b});
+                solver_.add_clause({~x, a, b});
+                break;
+            case NodeOp::Implies: // x ↔ ¬a ∨ b
+                solver_.add_clause({x, a});
+                solver_.add_clause({x, ~b});
+                solver_.add_clause({~x, ~a, b});
+                break;
+            default: // x ↔ (a ↔ b)
+                solver_.add_clause({~x, ~a, b});
+                solver_.add_clause({~x, a, ~b});
+                solver_.add_clause({x, a, b});
+                solver_.add_clause({x, ~a, ~b});
+            }
+            return x;
+        }
+
+        const Store &store_;
+        SatSolver &solver_;
+        std::unordered_map<NodeId, SatLiteral> literals_;
+        std::vector<NodeId> atoms_;
+        std::vector<SatVariable> atom_variables_;
+        std::optional<SatLiteral> truth_;
+    };
+
+    // Validez proposicional: la fórmula es válida si y solo si su negación
+    // es insatisfacible
+    template <typename Store>
+    class BasicSatProver
+    {
+    public:
+        BasicSatProver(const Store &store, NodeId formula) : encoder_(store, solver_) { solver_.add_clause({~encoder_.encode(formula)}); }
+
+        // El codificador guarda una referencia al resolvedor
+        BasicSatProver(const BasicSatProver &) = delete;
+        BasicSatProver &operator=(const BasicSatProver &) = delete;
+
+        std::span<const NodeId> atoms() const { return encoder_.atoms(); }
+
+        // Valores de atoms() que hacen falsa la fórmula, o nullopt si es válida
+        std::optional<std::vector<bool>> counterexample()
+        {
+            if (solver_.solve() != SatResult::Satisfiable)
+                return std::nullopt;
+            std::vector<bool> values(atoms().size());
+            for (size_t atom = 0; atom < values.size(); ++atom)
+                values[atom] = solver_.model_value(encoder_.variable(atom));
+            return values;
+        }
+
+        bool valid() { return !counterexample().has_value(); }
+
+        const SatSolver &solver() const { return solver_; }
+
+    private:
+        SatSolver solver_;
+        BasicTseitinEncoder<Store> encoder_;
+    };
+
+    using TseitinEncoder = BasicTseitinEncoder<TermStore>;
+    using SatProver = BasicSatProver<TermStore>;
+
+} // namespace logic::runtime
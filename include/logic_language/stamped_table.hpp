@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace logic::runtime::detail
+{
+
+    // =========================================================
+    // === STAMPED HASH TABLES ===
+    // =========================================================
+    //
+    // Tabla hash abierta (sondeo lineal, carga ≤ 1/2) de identificadores
+    // densos cuya clave cambia con el tiempo: las firmas de la congruencia
+    // (congruence.hpp) y los e-nodos canónicos del e-grafo (egraph.hpp)
+    // dependen de find() de sus hijos. Cada entrada guarda el identificador
+    // y su sello; cada búsqueda de un identificador cambia su sello, así
+    // que sus entradas anteriores (con la clave de antes de una unión)
+    // quedan muertas: no coinciden con nada y se descartan al crecer la
+    // tabla, sin borrar nunca.
+    class StampedTable
+    {
+    public:
+        static constexpr std::uint32_t npos = ~std::uint32_t{0};
+
+        // Otro identificador vivo con la misma clave que id (npos si no
+        // hay); si no lo hay, id entra en la tabla. hash(u) es la clave
+        // actual de u y same(u, id) compara dos claves con el mismo hueco.
+        template <typename Hash, typename Same>
+        std::uint32_t lookup(std::uint32_t id, Hash &&hash, Same &&same)
+        {
+            if (stamps_.size() <= id)
+                stamps_.resize(id + 1, 0);
+            const std::uint32_t stamp = ++stamps_[id];
+            if (2 * (used_ + 1) > slots_.size())
+                grow(hash);
+
+            const size_t mask = slots_.size() - 1;
+            size_t at = hash(id) & mask;
+            for (; slots_[at].id != npos; at = (at + 1) & mask)
+            {
+                const Slot &slot = slots_[at];
+                if (slot.stamp == stamps_[slot.id] && slot.id != id && same(slot.id, id))
+                    return slot.id;
+            }
+            slots_[at] = {id, stamp};
+            ++used_;
+            return npos;
+        }
+
+    private:
+        struct Slot
+        {
+            std::uint32_t id = npos;
+            std::uint32_t stamp = 0;
+        };
+
+        bool live(const Slot &slot) const { return slot.id != npos && slot.stamp == stamps_[slot.id]; }
+
+        // Solo las entradas vivas pasan a la tabla nueva, con sitio para el
+        // doble de ellas
+        template <typename Hash>
+        void grow(Hash &hash)
+        {
+            std::vector<Slot> old = std::move(slots_);
+            size_t count = 0;
+            for (const Slot &slot : old)
+                count += live(slot);
+            size_t capacity = 16;
+            while (capacity < 4 * (count + 1))
+                capacity *= 2;
+            slots_.assign(capacity, Slot{});
+            used_ = count;
+            for (const Slot &slot : old)
+                if (live(slot))
+                {
+                    size_t at = hash(slot.id) & (capacity - 1);
+                    while (slots_[at].id != npos)
+                        at = (at + 1) & (capacity - 1);
+                    slots_[at] = slot;
+                }
+        }
+
+        std::vector<Slot> slots_;
+        std::vector<std::uint32_t> stamps_; // Por identificador
+        size_t used_ = 0;
+    };
+
+} // namespace logic::runtime::detail
@@ -0,0 +1,430 @@
+#pragma once
+
+#include "formula_arena.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+namespace logic::runtime
+{
+
+    // =========================================================
+    // === HASH-CONSED TERM STORE ===
+    // =========================================================
+    //
+    // TermStore guarda cada subfórmula distinta una sola vez: construir un
+    // nodo que ya existe devuelve el mismo NodeId, así que dos fórmulas son
+    // iguales si y solo si sus identificadores lo son, y los términos que se
+    // repiten en muchos enunciados (IsNat(n), Plus(n, m, k), ...) se
+    // comparten. Tiene la misma interfaz de construcción que FormulaArena,
+    // de modo que reify<F>(store) baja fórmulas del kernel directamente.
+    //
+    // Varios hilos pueden construir a la vez: la tabla de internado está
+    // repartida en shards según el hash del nodo, cada uno con su cerrojo,
+    // su tabla hash y su almacén de nodos. Los nodos no se mueven nunca, así
+    // que leer un nodo ya devuelto no necesita cerrojo.
+
+    namespace detail
+    {
+        // Vector de solo añadir con direcciones estables: bloques de tamaño
+        // First, 2·First, 4·First, ... en un directorio fijo, de modo que
+        // añadir no invalida los elementos que otros hilos estén leyendo. Las
+        // escrituras las serializa el dueño.
+        template <typename T, size_t First = 256>
+        class ChunkedVector
+        {
+        public:
+            T &operator[](size_t index) const
+            {
+                const size_t chunk = chunk_of(index);
+                return chunks_[chunk][index - chunk_begin(chunk)];
+            }
+
+            size_t size() const { return size_; }
+
+            size_t push_back(const T &value) { return append(std::span<const T>(&value, 1)); }
+
+            // Añade un rango contiguo y devuelve la posición del primero; si no
+            // cabe en el bloque actual empieza en el siguiente
+            size_t append(std::span<const T> values)
+            {
+                if (values.empty())
+                    return size_;
+                size_t chunk = chunk_of(size_);
+                while (size_ + values.size() > chunk_begin(chunk + 1))
+                    size_ = chunk_begin(++chunk);
+                if (chunk >= max_chunks)
+                    throw std::length_error("ChunkedVector: capacidad agotada");
+                if (!chunks_[chunk])
+                    chunks_[chunk] = std::make_unique<T[]>(First << chunk);
+                std::copy(values.begin(), values.end(), &chunks_[chunk][size_ - chunk_begin(chunk)]);
+                const size_t first = size_;
+                size_ += values.size();
+                return first;
+            }
+
+            size_t bytes() const
+            {
+                size_t total = 0;
+                for (size_t chunk = 0; chunk < max_chunks && chunks_[chunk]; ++chunk)
+                    total += (First << chunk) * sizeof(T);
+                return total;
+            }
+
+        private:
+            static constexpr size_t max_chunks = 32;
+
+            // El bloque k cubre [First·(2^k − 1), First·(2^(k+1) − 1))
+            static constexpr size_t chunk_of(size_t index) { return std::bit_width(index / First + 1) - 1; }
+            static constexpr size_t chunk_begin(size_t chunk) { return First * ((size_t{1} << chunk) - 1); }
+
+            std::array<std::unique_ptr<T[]>, max_chunks> chunks_;
+            size_t size_ = 0;
+        };
+
+        // Hash de un nodo a partir del de su símbolo y el de sus hijos, el
+        // mismo que formula_hash_v. Cualquier almacén que lo use da el mismo
+        // hash a la misma fórmula (los certificados binarios lo guardan).
+        struct NodeHash
+        {
+            using Hash = logic::detail::HashAlgebra;
+
+            static std::uint64_t leaf(NodeKind kind, std::uint64_t symbol) { return Hash::mix(symbol, static_cast<std::uint64_t>(kind)); }
+
+            // Los argumentos se añaden después con argument()
+            static std::uint64_t atom(std::uint64_t symbol) { return leaf(NodeKind::Compound, symbol); }
+            static std::uint64_t argument(std::uint64_t hash, std::uint64_t arg) { return Hash::mix(hash, arg); }
+
+            static std::uint64_t unary(NodeOp op, std::uint64_t operand)
+            {
+                return Hash::mix(Hash::leaf({NodeKind::Compound, op_symbol(op)}), operand);
+            }
+
+            static std::uint64_t binary(NodeOp op, std::uint64_t left, std::uint64_t right)
+            {
+                return Hash::mix(Hash::mix(Hash::leaf({NodeKind::Compound, op_symbol(op)}), left), right);
+            }
+
+            static std::uint64_t binder(NodeOp op, std::uint64_t variable, std::uint64_t body)
+            {
+                return Hash::bind({NodeKind::Binder, op_symbol(op)}, leaf(NodeKind::Variable, variable), body);
+            }
+        };
+    } // namespace detail
+
+    // --- Símbolos compartidos ---
+    // Como SymbolTable, pero para varios hilos: las búsquedas toman el
+    // cerrojo en modo compartido y solo los nombres nuevos lo toman en
+    // exclusiva. Guarda también el hash de cada nombre, que TermStore usa
+    // para el hash de los nodos.
+    class SharedSymbolTable
+    {
+    public:
+        static constexpr SymbolId npos = SymbolTable::npos;
+
+        SymbolId intern(std::string_view name)
+        {
+            const std::uint64_t hash = logic::detail::fnv1a(name);
+            {
+                std::shared_lock lock(mutex_);
+                if (const SymbolId id = lookup(name, hash); id != npos)
+                    return id;
+            }
+            std::unique_lock lock(mutex_);
+            if (const SymbolId id = lookup(name, hash); id != npos)
+                return id;
+
+            const SymbolId id = static_cast<SymbolId>(entries_.size());
+            const size_t first = text_.append(std::span<const char>(name.data(), name.size()));
+            entries_.push_back({std::string_view(name.empty() ? nullptr : &text_[first], name.size()), hash});
+            if (2 * entries_.size() > slots_.size())
+                rehash(std::max<size_t>(64, 2 * slots_.size()));
+            else
+                slots_[find_slot(name, hash)] = id;
+            return id;
+        }
+
+        SymbolId find(std::string_view name) const
+        {
+            std::shared_lock lock(mutex_);
+            return lookup(name, logic::detail::fnv1a(name));
+        }
+
+        // Sin cerrojo: los nombres no se mueven
+        std::string_view name(SymbolId id) const { return entries_[id].name; }
+        std::uint64_t hash(SymbolId id) const { return entries_[id].hash; }
+
+        size_t size() const
+        {
+            std::shared_lock lock(mutex_);
+            return entries_.size();
+        }
+
+        size_t bytes() const
+        {
+            std::shared_lock lock(mutex_);
+            return text_.bytes() + entries_.bytes() + slots_.capacity() * sizeof(SymbolId);
+        }
+
+    private:
+        struct Entry
+        {
+            std::string_view name;
+            std::uint64_t hash;
+        };
+
+        SymbolId lookup(std::string_view name, std::uint64_t hash) const
+        {
+            return slots_.empty() ? npos : slots_[find_slot(name, hash)];
+        }
+
+        size_t find_slot(std::string_view name, std::uint64_t hash) const
+        {
+            const size_t mask = slots_.size() - 1;
+            size_t slot = hash & mask;
+            while (slots_[slot] != npos && entries_[slots_[slot]].name != name)
+                slot = (slot + 1) & mask;
+            return slot;
+        }
+
+        void rehash(size_t capacity)
+        {
+            slots_.assign(capacity, npos);
+            for (SymbolId id = 0; id < entries_.size(); ++id)
+                slots_[find_slot(entries_[id].name, entries_[id].hash)] = id;
+        }
+
+        detail::ChunkedVector<char, 4096> text_;
+        detail::ChunkedVector<Entry> entries_;
+        std::vector<SymbolId> slots_;
+        mutable std::shared_mutex mutex_;
+    };
+
+    // --- Estadísticas ---
+    struct TermStoreStats
+    {
+        size_t nodes = 0;   // Nodos distintos
+        size_t symbols = 0; // Nombres distintos
+        size_t lookups = 0; // Nodos construidos (pedidos)
+        size_t hits = 0;    // ... que ya existían
+        size_t bytes = 0;   // Memoria reservada (nodos, argumentos, tablas y nombres)
+
+        double hit_rate() const { return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups); }
+    };
+
+    // --- Almacén ---
+    // Un NodeId lleva el shard en los bits bajos y la posición dentro del
+    // shard en los altos. Los hijos deben ser identificadores de este mismo
+    // almacén. hash(id) coincide con formula_hash_v de la fórmula tipo.
+    class TermStore
+    {
+    public:
+        // shards se redondea a potencia de dos
+        explicit TermStore(size_t shards = 16)
+            : shard_bits_(static_cast<unsigned>(std::bit_width(std::bit_ceil(std::max<size_t>(shards, 1)) - 1))),
+              shards_(std::make_unique<Shard[]>(size_t{1} << shard_bits_))
+        {
+        }
+
+        NodeId variable(std::string_view name) { return leaf(NodeOp::Variable, NodeKind::Variable, symbols_.intern(name)); }
+        NodeId constant(std::string_view name) { return leaf(NodeOp::Constant, NodeKind::Constant, symbols_.intern(name)); }
+
+        NodeId atom(std::string_view name, std::span<const NodeId> args)
+        {
+            const SymbolId symbol = symbols_.intern(name);
+            std::uint64_t hash = detail::NodeHash::atom(symbols_.hash(symbol));
+            for (NodeId arg : args)
+                hash = detail::NodeHash::argument(hash, this->hash(check(arg)));
+            return intern({NodeOp::Atom, symbol, {0, static_cast<NodeId>(args.size())}}, hash, args);
+        }
+
+        NodeId unary(NodeOp op, NodeId operand)
+        {
+            expect(arity(op) == 1 && !is_binder(op), "TermStore::unary: operador no unario");
+            return intern({op, SymbolTable::npos, {operand, 0}}, detail::NodeHash::unary(op, hash(check(operand))), {});
+        }
+
+        NodeId binary(NodeOp op, NodeId left, NodeId right)
+        {
+            expect(arity(op) == 2, "TermStore::binary: operador no binario");
+            return intern({op, SymbolTable::npos, {left, right}}, detail::NodeHash::binary(op, hash(check(left)), hash(check(right))), {});
+        }
+
+        NodeId binder(NodeOp op, std::string_view variable, NodeId body)
+        {
+            expect(is_binder(op), "TermStore::binder: no es un cuantificador");
+            const SymbolId symbol = symbols_.intern(variable);
+            return intern({op, symbol, {body, 0}}, detail::NodeHash::binder(op, symbols_.hash(symbol), hash(check(body))), {});
+        }
+
+        const Node &operator[](NodeId id) const { return entry(id).node; }
+        // ¿Es un nodo ya creado de este almacén? (identificadores que llegan de fuera)
+        bool contains(NodeId id) const { return (id >> shard_bits_) < shard(id).published.load(std::memory_order_acquire); }
+        std::uint64_t hash(NodeId id) const { return entry(id).hash; }
+
+        std::span<const NodeId> children(NodeId id) const
+        {
+            const Node &node = entry(id).node;
+            if (node.op != NodeOp::Atom)
+                return std::span<const NodeId>(node.operands.data(), arity(node.op));
+            if (node.operands[1] == 0)
+                return {};
+            return std::span<const NodeId>(&shard(id).arguments[node.operands[0]], node.operands[1]);
+        }
+
+        std::string_view label(NodeId id) const
+        {
+            const Node &node = entry(id).node;
+            return node.op <= NodeOp::Atom ? symbols_.name(node.symbol) : op_symbol(node.op);
+        }
+
+        const SharedSymbolTable &symbols() const { return symbols_; }
+
+        std::string text(NodeId id) const
+        {
+            std::string out;
+            detail::write_text(*this, out, id);
+            return out;
+        }
+
+        TermStoreStats stats() const
+        {
+            TermStoreStats stats{.symbols = symbols_.size(), .bytes = symbols_.bytes()};
+            for (size_t i = 0; i < shard_count(); ++i)
+            {
+                Shard &shard = shards_[i];
+                std::lock_guard lock(shard.mutex);
+                stats.nodes += shard.nodes.size();
+                stats.lookups += shard.lookups;
+                stats.hits += shard.hits;
+                stats.bytes += shard.nodes.bytes() + shard.arguments.bytes() + shard.slots.capacity() * sizeof(Slot);
+            }
+            return stats;
+        }
+
+        size_t shard_count() const { return size_t{1} << shard_bits_; }
+
+    private:
+        struct Entry
+        {
+            Node node;
+            std::uint64_t hash;
+        };
+
+        struct Slot
+        {
+            std::uint64_t hash;
+            NodeId id;
+        };
+
+        struct alignas(64) Shard
+        {
+            std::mutex mutex;
+            detail::ChunkedVector<Entry> nodes;
+            detail::ChunkedVector<NodeId> arguments;
+            std::vector<Slot> slots;
+            std::atomic<size_t> published{0}; // Nodos visibles para check()
+            size_t lookups = 0;
+            size_t hits = 0;
+        };
+
+        static constexpr NodeId empty_slot = SymbolTable::npos;
+
+        static void expect(bool condition, const char *message)
+        {
+            if (!condition)
+                throw std::invalid_argument(message);
+        }
+
+        Shard &shard(NodeId id) const { return shards_[id & (shard_count() - 1)]; }
+        const Entry &entry(NodeId id) const { return shard(id).nodes[id >> shard_bits_]; }
+
+        NodeId check(NodeId id) const
+        {
+            if (!contains(id))
+                throw std::out_of_range("TermStore: el hijo no existe");
+            return id;
+        }
+
+        NodeId leaf(NodeOp op, NodeKind kind, SymbolId symbol)
+        {
+            return intern({op, symbol, {0, 0}}, detail::NodeHash::leaf(kind, symbols_.hash(symbol)), {});
+        }
+
+        bool same(const Shard &shard, const Node &stored, const Node &node, std::span<const NodeId> args) const
+        {
+            if (stored.op != node.op || stored.symbol != node.symbol)
+                return false;
+            if (node.op != NodeOp::Atom)
+                return stored.operands == node.operands;
+            if (stored.operands[1] != args.size())
+                return false;
+            for (size_t i = 0; i < args.size(); ++i)
+                if (shard.arguments[stored.operands[0] + i] != args[i])
+                    return false;
+            return true;
+        }
+
+        // Busca el nodo en su shard y lo crea si no existe
+        NodeId intern(Node node, std::uint64_t hash, std::span<const NodeId> args)
+        {
+            const size_t index = (hash >> 32) & (shard_count() - 1);
+            Shard &shard = shards_[index];
+            std::lock_guard lock(shard.mutex);
+            ++shard.lookups;
+
+            if (shard.slots.empty())
+                shard.slots.assign(64, {0, empty_slot});
+            size_t mask = shard.slots.size() - 1;
+            size_t slot = hash & mask;
+            for (; shard.slots[slot].id != empty_slot; slot = (slot + 1) & mask)
+            {
+                const Slot &candidate = shard.slots[slot];
+                if (candidate.hash == hash && same(shard, entry(candidate.id).node, node, args))
+                {
+                    ++shard.hits;
+                    return candidate.id;
+                }
+            }
+
+            const size_t local = shard.nodes.size();
+            if (local >= (size_t{1} << (32 - shard_bits_)) - 1)
+                throw std::length_error("TermStore: demasiados nodos");
+            if (node.op == NodeOp::Atom)
+                node.operands[0] = static_cast<NodeId>(shard.arguments.append(args));
+            shard.nodes.push_back({node, hash});
+            shard.published.store(local + 1, std::memory_order_release);
+
+            const NodeId id = static_cast<NodeId>((local << shard_bits_) | index);
+            shard.slots[slot] = {hash, id};
+            if (2 * shard.nodes.size() > shard.slots.size())
+                rehash(shard, 2 * shard.slots.size());
+            return id;
+        }
+
+        static void rehash(Shard &shard, size_t capacity)
+        {
+            std::vector<Slot> slots(capacity, Slot{0, empty_slot});
+            const size_t mask = capacity - 1;
+            for (const Slot &old : shard.slots)
+            {
+                if (old.id == empty_slot)
+                    continue;
+                size_t slot = old.hash & mask;
+                while (slots[slot].id != empty_slot)
+                    slot = (slot + 1) & mask;
+                slots[slot] = old;
+            }
+            shard.slots = std::move(slots);
+        }
+
+        unsigned shard_bits_;
+        std::unique_ptr<Shard[]> shards_;
+        SharedSymbolTable symbols_;
+    };
+
+} // namespace logic::runtime
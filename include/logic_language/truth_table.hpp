@@ -0,0 +1,445 @@
+#pragma once
+
+#include "term_store.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// =========================================================
+// === TRUTH TABLES (Propositional Validity) ===
+// =========================================================
+//
+// is_tautology<T>() solo mira que el contexto de un teorema esté vacío, y
+// BY_AXIOM(φ) da ⊢ φ → φ sea φ lo que sea. Aquí se evalúa la validez
+// proposicional de una fórmula: las conectivas (¬, ∧, ∨, →, ↔) se evalúan y
+// todo lo demás (predicados, igualdades, cuantificadores) es un átomo
+// proposicional; dos apariciones del mismo átomo son la misma variable.
+// Un cuantificador cuyo cuerpo es una tautología vale como verdadero (∀x. φ
+// y ∃x. φ son válidas si φ lo es). Es correcto pero incompleto para la
+// lógica de primer orden: si dice que sí, la fórmula es válida; si dice que
+// no, solo lo es su esqueleto proposicional.
+//
+// Las asignaciones se evalúan en paralelo de bits: la variable i < 6 es el
+// patrón de bits 0xAAAA..., 0xCCCC..., 0xF0F0..., ... y cada palabra de 64
+// bits cubre 64 asignaciones con una instrucción por conectiva.
+
+namespace logic
+{
+
+    // --- En los tipos ---
+    // propositional_tautology_v<F> en tiempo de compilación (hasta
+    // max_type_atoms átomos, por el límite de pasos de constexpr) y
+    // PropositionalAtoms_t<F>, sus átomos sin repetir.
+    namespace detail
+    {
+        inline constexpr size_t max_type_atoms = 20;
+
+        template <typename F>
+        struct PropositionalAtoms;
+
+        template <typename F>
+        struct Evaluate;
+    } // namespace detail
+
+    template <typename F>
+    using PropositionalAtoms_t = CanonicalContext_t<typename detail::PropositionalAtoms<F>::type>;
+
+    namespace detail
+    {
+        // Patrón de la variable i < 6 en una palabra: el bit j vale el bit i de j
+        inline constexpr std::array<std::uint64_t, 6> truth_patterns = {
+            0xAAAAAAAAAAAAAAAAull, 0xCCCCCCCCCCCCCCCCull, 0xF0F0F0F0F0F0F0F0ull,
+            0xFF00FF00FF00FF00ull, 0xFFFF0000FFFF0000ull, 0xFFFFFFFF00000000ull};
+
+        template <typename F>
+        consteval bool type_tautology();
+
+        template <template <typename...> class Op>
+        inline constexpr bool binary_connective = false;
+        template <>
+        inline constexpr bool binary_connective<And> = true;
+        template <>
+        inline constexpr bool binary_connective<Or> = true;
+        template <>
+        inline constexpr bool binary_connective<Implies> = true;
+        template <>
+        inline constexpr bool binary_connective<Equiv> = true;
+
+        template <typename F>
+        struct PropositionalAtoms
+        {
+            using type = TypeList<F>;
+        };
+
+        template <typename T>
+        struct PropositionalAtoms<Not<T>> : PropositionalAtoms<T>
+        {
+        };
+
+        template <template <typename, typename> class Op, typename L, typename R>
+            requires binary_connective<Op>
+        struct PropositionalAtoms<Op<L, R>>
+        {
+            using type = typename ConcatLists<typename PropositionalAtoms<L>::type, typename PropositionalAtoms<R>::type>::type;
+        };
+
+        template <template <typename, typename> class Q, typename V, typename Body>
+            requires Quantifier<Q>
+        struct PropositionalAtoms<Q<V, Body>>
+        {
+            using type = std::conditional_t<type_tautology<Body>(), TypeList<>, TypeList<Q<V, Body>>>;
+        };
+
+        template <typename F, typename... Atoms>
+        constexpr size_t atom_index(TypeList<Atoms...>)
+        {
+            size_t index = 0;
+            ((std::is_same_v<F, Atoms> ? false : (++index, true)) && ...);
+            return index;
+        }
+
+        // Una palabra de la tabla: values[i] es la palabra del átomo i
+        template <typename F>
+        struct Evaluate
+        {
+            template <typename Atoms>
+            static constexpr std::uint64_t word(const std::uint64_t *values, Atoms atoms)
+            {
+                return values[atom_index<F>(atoms)];
+            }
+        };
+
+        template <typename T>
+        struct Evaluate<Not<T>>
+        {
+            template <typename Atoms>
+            static constexpr std::uint64_t word(const std::uint64_t *values, Atoms atoms)
+            {
+                return ~Evaluate<T>::word(values, atoms);
+            }
+        };
+
+        template <typename L, typename R>
+        struct Evaluate<And<L, R>>
+        {
+            template <typename Atoms>
+            static constexpr std::uint64_t word(const std::uint64_t *values, Atoms atoms)
+            {
+                return Evaluate<L>::word(values, atoms) & Evaluate<R>::word(values, atoms);
+            }
+        };
+
+        template <typename L, typename R>
+        struct Evaluate<Or<L, R>>
+        {
+            template <typename Atoms>
+            static constexpr std::uint64_t word(const std::uint64_t *values, Atoms atoms)
+            {
+                return Evaluate<L>::word(values, atoms) | Evaluate<R>::word(values, atoms);
+            }
+        };
+
+        template <typename L, typename R>
+        struct Evaluate<Implies<L, R>>
+        {
+            template <typename Atoms>
+            static constexpr std::uint64_t word(const std::uint64_t *values, Atoms atoms)
+            {
+                return ~Evaluate<L>::word(values, atoms) | Evaluate<R>::word(values, atoms);
+            }
+        };
+
+        template <typename L, typename R>
+        struct Evaluate<Equiv<L, R>>
+        {
+            template <typename Atoms>
+            static constexpr std::uint64_t word(const std::uint64_t *values, Atoms atoms)
+            {
+                return ~(Evaluate<L>::word(values, atoms) ^ Evaluate<R>::word(values, atoms));
+            }
+        };
+
+        template <template <typename, typename> class Q, typename V, typename Body>
+            requires Quantifier<Q>
+        struct Evaluate<Q<V, Body>>
+        {
+            template <typename Atoms>
+            static constexpr std::uint64_t word(const std::uint64_t *values, Atoms atoms)
+            {
+                if constexpr (type_tautology<Body>())
+                    return ~std::uint64_t{0};
+                else
+                    return values[atom_index<Q<V, Body>>(atoms)];
+            }
+        };
+
+        // La primera asignación que hace falsa F (bit i = valor del átomo i)
+        template <typename F>
+        consteval std::optional<std::uint64_t> type_counterexample()
+        {
+            using Atoms = PropositionalAtoms_t<F>;
+            constexpr size_t n = Atoms::size;
+            static_assert(n <= max_type_atoms, "ERROR: demasiados átomos para evaluar la tabla de verdad en tiempo de compilación; "
+                                               "usa runtime::TruthTable");
+            const std::uint64_t valid = n >= 6 ? ~std::uint64_t{0} : (std::uint64_t{1} << (std::uint64_t{1} << n)) - 1;
+            std::uint64_t values[n + 1] = {};
+            for (std::uint64_t word = 0; word < (n > 6 ? std::uint64_t{1} << (n - 6) : 1); ++word)
+            {
+                for (size_t i = 0; i < n; ++i)
+                    values[i] = i < 6 ? truth_patterns[i] : ((word >> (i - 6)) & 1 ? ~std::uint64_t{0} : 0);
+                if (const std::uint64_t falsified = ~Evaluate<F>::word(values, Atoms{}) & valid)
+                    return word << 6 | static_cast<std::uint64_t>(std::countr_zero(falsified));
+            }
+            return std::nullopt;
+        }
+
+        template <typename F>
+        consteval bool type_tautology()
+        {
+            return !type_counterexample<F>().has_value();
+        }
+    } // namespace detail
+
+    template <typename F>
+    inline constexpr bool propositional_tautology_v = detail::type_tautology<F>();
+
+    // Contraejemplo de F (bit i = valor del i-ésimo de PropositionalAtoms_t<F>)
+    template <typename F>
+    inline constexpr std::optional<std::uint64_t> propositional_counterexample_v = detail::type_counterexample<F>();
+
+} // namespace logic
+
+namespace logic::runtime
+{
+
+    // --- En tiempo de ejecución ---
+    // La fórmula se compila a un programa en forma SSA (un registro por
+    // subfórmula distinta; en un almacén con hash-consing las subfórmulas
+    // compartidas se evalúan una vez) que se interpreta por bloques de
+    // block_words palabras (4096 asignaciones): cada instrucción es un bucle
+    // sobre el bloque, que el compilador vectoriza (128 asignaciones por
+    // instrucción con SSE2, 256 con AVX2). Los átomos 6 a 11 varían dentro
+    // del bloque y los siguientes entre bloques. Con muchos átomos los
+    // bloques se reparten entre varios hilos.
+    //
+    // Los átomos se identifican por NodeId: con un almacén sin hash-consing
+    // (FormulaArena) dos apariciones iguales serían átomos distintos, lo que
+    // sigue siendo correcto pero pierde tautologías.
+    template <typename Store>
+    class BasicTruthTable
+    {
+    public:
+        static constexpr size_t max_atoms = 63;
+        static constexpr size_t block_words = 64;
+
+        BasicTruthTable(const Store &store, NodeId formula) : store_(store) { result_ = compile(formula); }
+
+        // Los átomos en el orden de los bits de counterexample()
+        std::span<const NodeId> atoms() const { return atoms_; }
+        size_t instructions() const { return program_.size(); }
+
+        // La primera asignación (en orden numérico) que hace falsa la fórmula
+        std::optional<std::uint64_t> counterexample(size_t threads = std::thread::hardware_concurrency()) const
+        {
+            const std::uint64_t blocks = atoms_.size() > inner_bits ? std::uint64_t{1} << (atoms_.size() - inner_bits) : 1;
+            std::atomic<std::uint64_t> found{none};
+            const std::uint64_t workers = std::max<std::uint64_t>(1, std::min<std::uint64_t>(threads, blocks / chunk_blocks));
+            if (workers == 1)
+                scan(0, blocks, found);
+            else
+            {
+                std::atomic<std::uint64_t> next{0};
+                std::vector<std::jthread> pool;
+                for (std::uint64_t worker = 0; worker < workers; ++worker)
+                    pool.emplace_back([&] {
+                        for (std::uint64_t first; (first = next.fetch_add(chunk_blocks, std::memory_order_relaxed)) < blocks;)
+                            if (!scan(first, std::min(blocks, first + chunk_blocks), found))
+                                break;
+                    });
+            }
+            const std::uint64_t assignment = found.load();
+            if (assignment == none)
+                return std::nullopt;
+            return assignment;
+        }
+
+        bool tautology(size_t threads = std::thread::hardware_concurrency()) const { return !counterexample(threads).has_value(); }
+
+        // Valor del átomo `atom` en una asignación
+        static bool value(std::uint64_t assignment, size_t atom) { return (assignment >> atom) & 1; }
+
+    private:
+        static constexpr size_t inner_bits = 6 + std::countr_zero(block_words); // Átomos dentro de un bloque
+        static constexpr std::uint64_t chunk_blocks = 64;                         // Bloques por tarea
+        static constexpr std::uint64_t none = std::numeric_limits<std::uint64_t>::max();
+
+        enum class Op : std::uint8_t
+        {
+            Atom,
+            True,
+            Not,
+            And,
+            Or,
+            Implies,
+            Equiv
+        };
+
+        struct Instruction
+        {
+            Op op;
+            std::uint32_t left;  // Registro (o número de átomo en Atom)
+            std::uint32_t right;
+        };
+
+        using Block = std::array<std::uint64_t, block_words>;
+
+        std::uint32_t emit(Instruction instruction)
+        {
+            program_.push_back(instruction);
+            return static_cast<std::uint32_t>(program_.size() - 1);
+        }
+
+        std::uint32_t atom(NodeId id)
+        {
+            if (atoms_.size() == max_atoms)
+                throw std::length_error("TruthTable: más de 63 átomos");
+            atoms_.push_back(id);
+            return emit({Op::Atom, static_cast<std::uint32_t>(atoms_.size() - 1), 0});
+        }
+
+        // Postorden sobre el DAG; una subfórmula ya compilada reutiliza su registro
+        std::uint32_t compile(NodeId id)
+        {
+            if (const auto found = registers_.find(id); found != registers_.end())
+                return found->second;
+            const Node &node = store_[id];
+            std::uint32_t reg;
+            switch (node.op)
+            {
+            case NodeOp::Not:
+                reg = emit({Op::Not, compile(node.operands[0]), 0});
+                break;
+            case NodeOp::And:
+            case NodeOp::Or:
+            case NodeOp::Implies:
+            case NodeOp::Equiv:
+            {
+                const std::uint32_t left = compile(node.operands[0]);
+                const std::uint32_t right = compile(node.operands[1]);
+                const Op op = node.op == NodeOp::And ? Op::And : node.op == NodeOp::Or ? Op::Or : node.op == NodeOp::Implies ? Op::Implies : Op::Equiv;
+                reg = emit({op, left, right});
+                break;
+            }
+            case NodeOp::Forall:
+            case NodeOp::Exists:
+                reg = BasicTruthTable(store_, node.operands[0]).tautology(1) ? emit({Op::True, 0, 0}) : atom(id);
+                break;
+            default:
+                reg = atom(id);
+            }
+            registers_.emplace(id, reg);
+            return reg;
+        }
+
+        // Evalúa los bloques [first, last); false si encuentra un
+        // contraejemplo o ya hay uno anterior a `first`
+        bool scan(std::uint64_t first, std::uint64_t last, std::atomic<std::uint64_t> &found) const
+        {
+            const size_t n = atoms_.size();
+            const std::uint64_t valid = n >= 6 ? ~std::uint64_t{0} : (std::uint64_t{1} << (std::uint64_t{1} << n)) - 1;
+            std::vector<Block> registers(program_.size());
+            for (std::uint64_t block = first; block < last; ++block)
+            {
+                if (found.load(std::memory_order_relaxed) < block << inner_bits)
+                    return false;
+                run(block, registers);
+                const Block &result = registers[result_];
+                for (size_t word = 0; word < block_words; ++word)
+                    if (const std::uint64_t falsified = ~result[word] & valid)
+                    {
+                        const std::uint64_t assignment = block << inner_bits | word << 6 | static_cast<std::uint64_t>(std::countr_zero(falsified));
+                        std::uint64_t current = found.load(std::memory_order_relaxed);
+                        while (assignment < current && !found.compare_exchange_weak(current, assignment, std::memory_order_relaxed))
+                        {
+                        }
+                        return false;
+                    }
+            }
+            return true;
+        }
+
+        // Cada conectiva se calcula en un bloque local: sin posible solapamiento
+        // con los operandos, el compilador vectoriza el bucle también en -O2
+        template <typename Connective>
+        static void apply(Block &out, const Block &left, const Block &right, Connective connective)
+        {
+            Block value;
+            for (size_t word = 0; word < block_words; ++word)
+                value[word] = connective(left[word], right[word]);
+            out = value;
+        }
+
+        void run(std::uint64_t block, std::vector<Block> &registers) const
+        {
+            for (size_t i = 0; i < program_.size(); ++i)
+            {
+                const Instruction &instruction = program_[i];
+                Block &out = registers[i];
+                const Block &left = registers[instruction.left];
+                const Block &right = registers[instruction.right];
+                switch (instruction.op)
+                {
+                case Op::Atom:
+                    for (size_t word = 0; word < block_words; ++word)
+                        out[word] = atom_word(instruction.left, block, word);
+                    break;
+                case Op::True:
+                    out.fill(~std::uint64_t{0});
+                    break;
+                case Op::Not:
+                    apply(out, left, left, [](std::uint64_t a, std::uint64_t) { return ~a; });
+                    break;
+                case Op::And:
+                    apply(out, left, right, [](std::uint64_t a, std::uint64_t b) { return a & b; });
+                    break;
+                case Op::Or:
+                    apply(out, left, right, [](std::uint64_t a, std::uint64_t b) { return a | b; });
+                    break;
+                case Op::Implies:
+                    apply(out, left, right, [](std::uint64_t a, std::uint64_t b) { return ~a | b; });
+                    break;
+                case Op::Equiv:
+                    apply(out, left, right, [](std::uint64_t a, std::uint64_t b) { return ~(a ^ b); });
+                    break;
+                }
+            }
+        }
+
+        static std::uint64_t atom_word(size_t atom, std::uint64_t block, size_t word)
+        {
+            if (atom < 6)
+                return logic::detail::truth_patterns[atom];
+            const std::uint64_t index = atom < inner_bits ? word >> (atom - 6) : block >> (atom - inner_bits);
+            return index & 1 ? ~std::uint64_t{0} : 0;
+        }
+
+        const Store &store_;
+        std::vector<Instruction> program_;
+        std::vector<NodeId> atoms_;
+        std::unordered_map<NodeId, std::uint32_t> registers_;
+        std::uint32_t result_ = 0;
+    };
+
+    using TruthTable = BasicTruthTable<TermStore>;
+
+} // namespace logic::runtime
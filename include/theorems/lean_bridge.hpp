@@ -67,9 +67,9 @@ namespace logic::lean_bridge {
     // Función para validar que una traducción es correcta
     template<typename LeanTheorem, typename CppTheorem>
     constexpr bool validate_translation() {
-        // Verificar que los tipos coinciden estructuralmente
-        return std::is_same_v<typename LeanTheorem::formula_type, 
-                             typename CppTheorem::formula_type>;
+        // Verificar que las fórmulas coinciden módulo renombrado de variables ligadas
+        return alpha_equivalent_v<typename LeanTheorem::formula_type, 
+                                  typename CppTheorem::formula_type>;
     }
     
     // Macro para documentar la correspondencia con Lean4
@@ -81,6 +81,9 @@ namespace logic::lean_bridge {
     struct TheoremLibrary {
         static constexpr size_t count = sizeof...(Theorems);
         using theorems = std::tuple<Theorems...>;
+        // Lemas distintos módulo α (sin duplicados por renombrado)
+        using canonical_theorems = CanonicalContext_t<TypeList<CanonicalTheorem_t<Theorems>...>>;
+        static constexpr size_t unique_count = canonical_theorems::size;
     };
     
     // Ejemplo de uso:
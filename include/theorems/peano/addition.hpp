@@ -4,6 +4,8 @@
 #include "order.hpp"
 
 namespace logic::peano::addition {
+    using order::Le;
+    using strict_order::Lt;
     
     // =========================================================
     // === SUMA (Traducido de PeanoNatAdd.lean) ===
@@ -22,8 +24,8 @@ namespace logic::peano::addition {
     
     // add_succ: Add(n, m, k) → Add(n, S(m), S(k))
     constexpr auto add_succ() {
-        return BY_AXIOM(forall(n, forall(m, forall(k,
-            Add(n, m, k) >> Add(n, S(m), S(k))))));
+        return BY_AXIOM(forall(n, m, k,
+            Add(n, m, k) >> Add(n, S(m), S(k))));
     }
     
     // Teoremas fundamentales de la suma
@@ -35,52 +37,54 @@ namespace logic::peano::addition {
     
     // add_comm: Add(n, m, k) ↔ Add(m, n, k)
     constexpr auto add_comm() {
-        return BY_AXIOM(forall(n, forall(m, forall(k,
-            Add(n, m, k) == Add(m, n, k)))));
+        return BY_AXIOM(forall(n, m, k,
+            Add(n, m, k) == Add(m, n, k)));
     }
     
-    // add_assoc: Add(n, m, p) ∧ Add(p, k, r) ↔ Add(m, k, q) ∧ Add(n, q, r)
+    // add_assoc: (∃p. Add(n, m, p) ∧ Add(p, k, r)) ↔ (∃q. Add(m, k, q) ∧ Add(n, q, r))
+    // Con p y q universales el enunciado sería falso: afirmaría Add(m, k, q)
+    // para todo q, y con él el corpus sería contradictorio.
     constexpr auto add_assoc() {
-        return BY_AXIOM(forall(n, forall(m, forall(k, forall("p"_var, forall("q"_var, forall("r"_var,
-            (Add(n, m, "p"_var) && Add("p"_var, k, "r"_var)) == 
-            (Add(m, k, "q"_var) && Add(n, "q"_var, "r"_var)))))))));
+        return BY_AXIOM(forall(n, m, k, "r"_var,
+            exists("p"_var, Add(n, m, "p"_var) && Add("p"_var, k, "r"_var)) == 
+            exists("q"_var, Add(m, k, "q"_var) && Add(n, "q"_var, "r"_var))));
     }
     
     // add_cancelation: Add(n, m, k) ∧ Add(n, p, k) → m = p
     constexpr auto add_cancelation() {
-        return BY_AXIOM(forall(n, forall(m, forall(k, forall("p"_var,
-            (Add(n, m, k) && Add(n, "p"_var, k)) >> Eq(m, "p"_var))))));
+        return BY_AXIOM(forall(n, m, k, "p"_var,
+            (Add(n, m, k) && Add(n, "p"_var, k)) >> Eq(m, "p"_var)));
     }
     
     // le_self_add: Le(n, k) donde Add(n, m, k)
     constexpr auto le_self_add() {
-        return BY_AXIOM(forall(n, forall(m, forall(k,
-            Add(n, m, k) >> Le(n, k)))));
+        return BY_AXIOM(forall(n, m, k,
+            Add(n, m, k) >> Le(n, k)));
     }
     
     // lt_self_add: m ≠ 0 ∧ Add(n, m, k) → Lt(n, k)
     constexpr auto lt_self_add() {
-        return BY_AXIOM(forall(n, forall(m, forall(k,
-            (!Eq(m, Zero) && Add(n, m, k)) >> Lt(n, k)))));
+        return BY_AXIOM(forall(n, m, k,
+            (!Eq(m, Zero) && Add(n, m, k)) >> Lt(n, k)));
     }
     
     // add_lt_add_left: Lt(a, b) → Lt(Add(c, a), Add(c, b))
     constexpr auto add_lt_add_left() {
-        return BY_AXIOM(forall("a"_var, forall("b"_var, forall("c"_var, forall("ca"_var, forall("cb"_var,
+        return BY_AXIOM(forall("a"_var, "b"_var, "c"_var, "ca"_var, "cb"_var,
             (Lt("a"_var, "b"_var) && Add("c"_var, "a"_var, "ca"_var) && Add("c"_var, "b"_var, "cb"_var)) >> 
-            Lt("ca"_var, "cb"_var)))))));
+            Lt("ca"_var, "cb"_var)));
     }
     
     // le_then_exists_add: Le(a, b) → ∃p. Add(a, p, b)
     constexpr auto le_then_exists_add() {
-        return BY_AXIOM(forall("a"_var, forall("b"_var,
-            Le("a"_var, "b"_var) >> exists("p"_var, Add("a"_var, "p"_var, "b"_var)))));
+        return BY_AXIOM(forall("a"_var, "b"_var,
+            Le("a"_var, "b"_var) >> exists("p"_var, Add("a"_var, "p"_var, "b"_var))));
     }
     
     // lt_then_exists_add_succ: Lt(a, b) → ∃p. Add(a, S(p), b)
     constexpr auto lt_then_exists_add_succ() {
-        return BY_AXIOM(forall("a"_var, forall("b"_var,
-            Lt("a"_var, "b"_var) >> exists("p"_var, Add("a"_var, S("p"_var), "b"_var)))));
+        return BY_AXIOM(forall("a"_var, "b"_var,
+            Lt("a"_var, "b"_var) >> exists("p"_var, Add("a"_var, S("p"_var), "b"_var))));
     }
     
 } // namespace logic::peano::addition
@@ -71,15 +71,15 @@ namespace logic::peano {
     
     // PA4: S es inyectiva (AXIOM_succ_inj)
     constexpr auto PA4() {
-        return BY_AXIOM(forall(n, forall(m, 
-            (IsNat(n) && IsNat(m) && Eq(S(n), S(m))) >> Eq(n, m))));
+        return BY_AXIOM(forall(n, m, 
+            (IsNat(n) && IsNat(m) && Eq(S(n), S(m))) >> Eq(n, m)));
     }
     
     // PA5: Esquema de Inducción (AXIOM_induction_on_PeanoNat)
     template<typename Formula>
     constexpr auto PA5_induction(Formula phi) {
         auto base_case = phi; // φ(0)
-        auto inductive_step = forall(n, phi >> Substitute_t<Formula, decltype(n), decltype(S(n))>);
+        auto inductive_step = forall(n, phi >> Substitute_t<Formula, decltype(n), decltype(S(n))>{});
         auto conclusion = forall(n, phi);
         return BY_AXIOM((base_case && inductive_step) >> conclusion);
     }
@@ -114,9 +114,9 @@ namespace logic::peano {
     
     // Suma con sucesor: n + S(m) = S(n + m)
     constexpr auto plus_succ() {
-        return BY_AXIOM(forall(n, forall(m, forall(k,
+        return BY_AXIOM(forall(n, m, k,
             (IsNat(n) && IsNat(m) && Plus(n, m, k)) >> 
-            Plus(n, S(m), S(k))))));
+            Plus(n, S(m), S(k))));
     }
     
     // =========================================================
@@ -130,9 +130,9 @@ namespace logic::peano {
     
     // Multiplicación por sucesor: n * S(m) = (n * m) + n
     constexpr auto times_succ() {
-        return BY_AXIOM(forall(n, forall(m, forall(k, forall("p"_var,
+        return BY_AXIOM(forall(n, m, k, "p"_var,
             (IsNat(n) && IsNat(m) && Times(n, m, k) && Plus(k, n, "p"_var)) >>
-            Times(n, S(m), "p"_var))))));
+            Times(n, S(m), "p"_var)));
     }
     
 } // namespace logic::peano
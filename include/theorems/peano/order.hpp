@@ -4,6 +4,7 @@
 #include "strict_order.hpp"
 
 namespace logic::peano::order {
+    using strict_order::Lt;
     
     // =========================================================
     // === ORDEN PARCIAL (Traducido de PeanoNatOrder.lean) ===
@@ -15,8 +16,8 @@ namespace logic::peano::order {
     
     // Definición: Le n m ≡ Lt n m ∨ n = m
     constexpr auto le_definition() {
-        return BY_AXIOM(forall(n, forall(m,
-            Le(n, m) == (Lt(n, m) || Eq(n, m)))));
+        return BY_AXIOM(forall(n, m,
+            Le(n, m) == (Lt(n, m) || Eq(n, m))));
     }
     
     // Teoremas fundamentales del orden parcial
@@ -33,38 +34,38 @@ namespace logic::peano::order {
     
     // le_trans: Le n m → Le m k → Le n k
     constexpr auto le_trans() {
-        return BY_AXIOM(forall(n, forall(m, forall(k,
-            (Le(n, m) && Le(m, k)) >> Le(n, k)))));
+        return BY_AXIOM(forall(n, m, k,
+            (Le(n, m) && Le(m, k)) >> Le(n, k)));
     }
     
     // le_antisymm: Le n m → Le m n → n = m
     constexpr auto le_antisymm() {
-        return BY_AXIOM(forall(n, forall(m,
-            (Le(n, m) && Le(m, n)) >> Eq(n, m))));
+        return BY_AXIOM(forall(n, m,
+            (Le(n, m) && Le(m, n)) >> Eq(n, m)));
     }
     
     // le_total: Le n m ∨ Le m n
     constexpr auto le_total() {
-        return BY_AXIOM(forall(n, forall(m,
-            Le(n, m) || Le(m, n))));
+        return BY_AXIOM(forall(n, m,
+            Le(n, m) || Le(m, n)));
     }
     
     // succ_le_succ_iff: Le (S n) (S m) ↔ Le n m
     constexpr auto succ_le_succ_iff() {
-        return BY_AXIOM(forall(n, forall(m,
-            Le(S(n), S(m)) == Le(n, m))));
+        return BY_AXIOM(forall(n, m,
+            Le(S(n), S(m)) == Le(n, m)));
     }
     
     // le_iff_lt_succ: Le n m ↔ Lt n (S m)
     constexpr auto le_iff_lt_succ() {
-        return BY_AXIOM(forall(n, forall(m,
-            Le(n, m) == Lt(n, S(m)))));
+        return BY_AXIOM(forall(n, m,
+            Le(n, m) == Lt(n, S(m))));
     }
     
     // lt_imp_le: Lt n m → Le n m
     constexpr auto lt_imp_le() {
-        return BY_AXIOM(forall(n, forall(m,
-            Lt(n, m) >> Le(n, m))));
+        return BY_AXIOM(forall(n, m,
+            Lt(n, m) >> Le(n, m)));
     }
     
     // le_succ_self: Le n (S n)
@@ -16,25 +16,25 @@ namespace logic::peano::strict_order {
     
     // lt_then_neq: Lt n m → n ≠ m
     constexpr auto lt_then_neq() {
-        return BY_AXIOM(forall(n, forall(m, Lt(n, m) >> !Eq(n, m))));
+        return BY_AXIOM(forall(n, m, Lt(n, m) >> !Eq(n, m)));
     }
     
     // neq_then_lt_or_gt: n ≠ m → (Lt n m ∨ Lt m n)
     constexpr auto neq_then_lt_or_gt() {
-        return BY_AXIOM(forall(n, forall(m, 
-            !Eq(n, m) >> (Lt(n, m) || Lt(m, n)))));
+        return BY_AXIOM(forall(n, m, 
+            !Eq(n, m) >> (Lt(n, m) || Lt(m, n))));
     }
     
     // trichotomy: (Lt n m) ∨ (n = m) ∨ (Lt m n)
     constexpr auto trichotomy() {
-        return BY_AXIOM(forall(n, forall(m,
-            Lt(n, m) || Eq(n, m) || Lt(m, n))));
+        return BY_AXIOM(forall(n, m,
+            Lt(n, m) || Eq(n, m) || Lt(m, n)));
     }
     
     // lt_asymm: Lt n m → ¬(Lt m n)
     constexpr auto lt_asymm() {
-        return BY_AXIOM(forall(n, forall(m,
-            Lt(n, m) >> !Lt(m, n))));
+        return BY_AXIOM(forall(n, m,
+            Lt(n, m) >> !Lt(m, n)));
     }
     
     // lt_irrefl: ¬(Lt n n)
@@ -44,8 +44,8 @@ namespace logic::peano::strict_order {
     
     // lt_trans: Lt n m → Lt m k → Lt n k
     constexpr auto lt_trans() {
-        return BY_AXIOM(forall(n, forall(m, forall(k,
-            (Lt(n, m) && Lt(m, k)) >> Lt(n, k)))));
+        return BY_AXIOM(forall(n, m, k,
+            (Lt(n, m) && Lt(m, k)) >> Lt(n, k)));
     }
     
     // lt_succ_self: Lt n (S n)
@@ -65,14 +65,14 @@ namespace logic::peano::strict_order {
     
     // lt_succ_iff_lt_or_eq: Lt n (S m) ↔ Lt n m ∨ n = m
     constexpr auto lt_succ_iff_lt_or_eq() {
-        return BY_AXIOM(forall(n, forall(m,
-            Lt(n, S(m)) == (Lt(n, m) || Eq(n, m)))));
+        return BY_AXIOM(forall(n, m,
+            Lt(n, S(m)) == (Lt(n, m) || Eq(n, m))));
     }
     
     // succ_lt_succ_iff: Lt (S n) (S m) ↔ Lt n m
     constexpr auto succ_lt_succ_iff() {
-        return BY_AXIOM(forall(n, forall(m,
-            Lt(S(n), S(m)) == Lt(n, m))));
+        return BY_AXIOM(forall(n, m,
+            Lt(S(n), S(m)) == Lt(n, m)));
     }
     
 } // namespace logic::peano::strict_order
@@ -47,7 +47,7 @@ namespace logic::zfc {
     constexpr auto axiom_extensionality() {
         auto premise = forall(x, In(x, A) == In(x, B));
         auto conclusion = Equal_Set(A, B);
-        return BY_AXIOM(forall(A, forall(B, premise >> conclusion)));
+        return BY_AXIOM(forall(A, B, premise >> conclusion));
     }
     
     // Axioma del Conjunto Vacío
@@ -61,7 +61,7 @@ namespace logic::zfc {
     // ∀A∀B∃C∀x(x ∈ C ↔ (x = A ∨ x = B))
     constexpr auto axiom_pairing() {
         auto pair_property = forall(x, In(x, C) == (Equal_Set(x, A) || Equal_Set(x, B)));
-        return BY_AXIOM(forall(A, forall(B, exists(C, pair_property))));
+        return BY_AXIOM(forall(A, B, exists(C, pair_property)));
     }
     
     // Axioma de Unión
@@ -0,0 +1,475 @@
+"""
+Benchmark de tiempo de compilación del kernel a nivel de tipos.
+
+Compila benchmarks/compile_time/kernel_benchmark.cpp una vez por escenario y
+tamaño (depth x width) y registra, para cada combinación:
+  - tiempo de pared de la compilación,
+  - pico de memoria residente del compilador (RSS),
+  - número de instanciaciones (a partir de -ftime-trace, si el compilador lo soporta).
+
+Subcomandos:
+  run       Mide y escribe un JSON con los resultados.
+  compare   Compara un JSON de resultados contra una línea base y marca regresiones.
+  spelling  Compara el DSL con los literales de texto (Formula_t<"...">) sobre los
+            enunciados de peano/ (SPELLING_STATEMENTS), en unidades generadas.
+
+Ejemplos:
+  python scripts/compile_benchmark.py run --compiler g++ --output build/gcc/compile_benchmark.json
+  python scripts/compile_benchmark.py compare --baseline benchmarks/compile_time/baselines/gcc.json \\
+         --current build/gcc/compile_benchmark.json
+  python scripts/compile_benchmark.py spelling --compiler g++ --copies 8,32
+"""
+
+import argparse
+import json
+import os
+import platform
+import signal
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+# --- CONFIGURACIÓN ---
+SCENARIOS = ["substitute", "substitute_sparse", "discharge", "merge", "mp_chain", "forall_nest", "instantiate_all", "deduction"]
+
+# (depth, width) para cada punto de la curva de escalado
+DEFAULT_SIZES = [(8, 4), (32, 8), (64, 16), (128, 16)]
+
+# Puntos adicionales por escenario (solo cuando no se pasa --sizes).
+# discharge: contextos de 2048, 4096 y 8192 hipótesis con 4 descargas
+SCENARIO_EXTRA_SIZES = {
+    "discharge": [(4, 512), (4, 1024), (4, 2048)],
+}
+
+# Tolerancias por defecto para marcar una regresión
+DEFAULT_TIME_TOLERANCE = 0.25   # +25 % de tiempo de pared
+DEFAULT_RSS_TOLERANCE = 0.20    # +20 % de memoria pico
+DEFAULT_INST_TOLERANCE = 0.05   # +5 % de instanciaciones
+MIN_TIME_DELTA = 0.10           # Ignorar diferencias de menos de 100 ms (ruido)
+MIN_RSS_DELTA_KB = 8 * 1024     # Ignorar diferencias de menos de 8 MB (ruido)
+DEFAULT_TIMEOUT = 300           # Segundos máximos por compilación
+EXIT_MISSING_BASELINE = 2       # compare sin línea base (distinto de regresión, 1)
+
+# Enunciados de theorems/peano/ (axioms.hpp y order.hpp) en las dos escrituras,
+# (DSL, texto); n, m, k y p son las variables que cada copia renombra
+SPELLING_STATEMENTS = [
+    ("IsNat(Zero)", "Natural(0)"),
+    ("forall(n, IsNat(n) >> IsNat(S(n)))", "forall n. Natural(n) -> Natural(S(n))"),
+    ("forall(n, IsNat(n) >> !Eq(S(n), Zero))", "forall n. Natural(n) -> ~(S(n) = 0)"),
+    ("forall(n, m, (IsNat(n) && IsNat(m) && Eq(S(n), S(m))) >> Eq(n, m))",
+     "forall n m. Natural(n) & Natural(m) & S(n) = S(m) -> n = m"),
+    ("forall(k, !Eq(k, S(k)))", "forall k. ~(k = S(k))"),
+    ("forall(n, !Eq(S(n), Zero))", "forall n. ~(S(n) = 0)"),
+    ("forall(n, IsNat(n) >> Plus(n, Zero, n))", "forall n. Natural(n) -> Plus(n, 0, n)"),
+    ("forall(n, m, k, (IsNat(n) && IsNat(m) && Plus(n, m, k)) >> Plus(n, S(m), S(k)))",
+     "forall n m k. Natural(n) & Natural(m) & Plus(n, m, k) -> Plus(n, S(m), S(k))"),
+    ("forall(n, IsNat(n) >> Times(n, Zero, Zero))", "forall n. Natural(n) -> Times(n, 0, 0)"),
+    ("forall(n, m, k, p, (IsNat(n) && IsNat(m) && Times(n, m, k) && Plus(k, n, p)) >> Times(n, S(m), p))",
+     "forall n m k p. Natural(n) & Natural(m) & Times(n, m, k) & Plus(k, n, p) -> Times(n, S(m), p)"),
+    ("forall(n, m, Le(n, m) == (Lt(n, m) || Eq(n, m)))", "forall n m. Le(n, m) <-> Lt(n, m) | n = m"),
+    ("forall(n, m, k, (Le(n, m) && Le(m, k)) >> Le(n, k))", "forall n m k. Le(n, m) & Le(m, k) -> Le(n, k)"),
+    ("forall(n, m, (Le(n, m) && Le(m, n)) >> Eq(n, m))", "forall n m. Le(n, m) & Le(m, n) -> n = m"),
+    ("forall(n, m, Le(n, m) || Le(m, n))", "forall n m. Le(n, m) | Le(m, n)"),
+    ("forall(n, m, Le(S(n), S(m)) == Le(n, m))", "forall n m. Le(S(n), S(m)) <-> Le(n, m)"),
+    ("forall(n, Le(n, Zero) == Eq(n, Zero))", "forall n. Le(n, 0) <-> n = 0"),
+]
+SPELLING_VARIABLES = "nmkp"
+
+
+def get_project_root():
+    """Calcula la raíz del proyecto basándose en la ubicación de este script."""
+    return os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def parse_sizes(text):
+    """Convierte '8x4,32x8' en [(8, 4), (32, 8)]."""
+    sizes = []
+    for item in text.split(","):
+        depth, _, width = item.strip().partition("x")
+        sizes.append((int(depth), int(width or depth)))
+    return sizes
+
+
+def detect_compiler_family(compiler, compiler_id):
+    """Devuelve 'msvc', 'clang' o 'gcc' para elegir la sintaxis de flags."""
+    if compiler_id:
+        cid = compiler_id.lower()
+        if cid == "msvc":
+            return "msvc"
+        if "clang" in cid or cid == "intelllvm":
+            return "clang"
+        return "gcc"
+    name = os.path.basename(compiler).lower()
+    if name.startswith("cl") and not name.startswith("clang"):
+        return "msvc"
+    try:
+        version = subprocess.run([compiler, "--version"], capture_output=True, text=True).stdout.lower()
+    except OSError:
+        version = ""
+    if "clang" in version or "icx" in name:
+        return "clang"
+    return "gcc"
+
+
+def build_command(family, compiler, source, obj, include_dir, scenario, depth, width, time_trace, extra):
+    defines = [
+        f"LOGIC_BENCH_SCENARIO={scenario}",
+        f"LOGIC_BENCH_DEPTH={depth}",
+        f"LOGIC_BENCH_WIDTH={width}",
+    ]
+    if family == "msvc":
+        cmd = [compiler, "/nologo", "/std:c++latest", "/EHsc", "/utf-8", "/c", source, f"/Fo{obj}", f"/I{include_dir}"]
+        cmd += [f"/D{d}" for d in defines]
+    else:
+        cmd = [compiler, "-std=c++23", "-fextended-identifiers", "-finput-charset=UTF-8",
+               "-c", source, "-o", obj, f"-I{include_dir}"]
+        cmd += [f"-D{d}" for d in defines]
+        if time_trace:
+            cmd += ["-ftime-trace", "-ftime-trace-granularity=0"]
+    return cmd + list(extra)
+
+
+def run_and_measure(cmd, timeout):
+    """Ejecuta el compilador y devuelve (returncode, segundos, rss_kb, salida).
+
+    Si la compilación supera `timeout` segundos se mata el proceso y el
+    código de retorno es None.
+    """
+    # La salida va a un fichero temporal: con tuberías, un error con tipos
+    # enormes llenaría el buffer y bloquearía al compilador.
+    log = tempfile.TemporaryFile(mode="w+", encoding="utf-8", errors="replace")
+    start = time.perf_counter()
+    # En POSIX el compilador va en su propio grupo de procesos: al matar solo
+    # el driver, cc1plus seguiría vivo y falsearía las medidas siguientes.
+    posix = hasattr(os, "killpg")
+    proc = subprocess.Popen(cmd, stdout=log, stderr=subprocess.STDOUT, start_new_session=posix)
+    timed_out = threading.Event()
+
+    def kill_on_timeout():
+        timed_out.set()
+        if posix:
+            try:
+                os.killpg(proc.pid, signal.SIGKILL)
+            except ProcessLookupError:
+                pass
+        else:
+            proc.kill()
+
+    watchdog = threading.Timer(timeout, kill_on_timeout)
+    watchdog.start()
+
+    rss_kb = None
+    if hasattr(os, "wait4"):
+        # wait4 devuelve el uso de recursos del proceso y de sus hijos ya
+        # esperados (el driver lanza cc1plus / clang -cc1 como hijo).
+        _, status, usage = os.wait4(proc.pid, 0)
+        elapsed = time.perf_counter() - start
+        returncode = os.waitstatus_to_exitcode(status)
+        proc.returncode = returncode
+        rss_kb = usage.ru_maxrss
+        if platform.system() == "Darwin":
+            rss_kb //= 1024  # macOS reporta bytes
+    else:
+        # Windows: sin wait4; si psutil está disponible se muestrea el RSS
+        # del compilador y de sus hijos hasta que termine.
+        try:
+            import psutil
+        except ImportError:
+            psutil = None
+        if psutil is not None:
+            peak = 0
+            try:
+                watched = psutil.Process(proc.pid)
+                while proc.poll() is None:
+                    procs = [watched] + watched.children(recursive=True)
+                    peak = max(peak, sum(p.memory_info().rss for p in procs))
+                    time.sleep(0.01)
+            except psutil.Error:
+                pass
+            rss_kb = peak // 1024 if peak else None
+        proc.wait()
+        elapsed = time.perf_counter() - start
+        returncode = proc.returncode
+    watchdog.cancel()
+    if timed_out.is_set():
+        returncode = None
+    log.seek(0)
+    output = log.read(64 * 1024)
+    log.close()
+    return returncode, elapsed, rss_kb, output
+
+
+def count_instantiations(trace_path):
+    """Cuenta eventos de instanciación en un fichero de -ftime-trace."""
+    if not os.path.exists(trace_path):
+        return None
+    with open(trace_path, encoding="utf-8") as fh:
+        data = json.load(fh)
+    counts = {"class": 0, "function": 0}
+    for event in data.get("traceEvents", []):
+        name = event.get("name", "")
+        if name == "InstantiateClass":
+            counts["class"] += 1
+        elif name == "InstantiateFunction":
+            counts["function"] += 1
+    counts["total"] = counts["class"] + counts["function"]
+    return counts
+
+
+def cmd_run(args):
+    root = get_project_root()
+    source = os.path.join(root, "benchmarks", "compile_time", "kernel_benchmark.cpp")
+    include_dir = args.include or os.path.join(root, "include")
+    family = detect_compiler_family(args.compiler, args.compiler_id)
+    time_trace = family == "clang"
+    sizes = parse_sizes(args.sizes) if args.sizes else None
+    scenarios = args.scenarios.split(",") if args.scenarios else SCENARIOS
+
+    results = []
+    with tempfile.TemporaryDirectory(prefix="logic_bench_") as workdir:
+        for scenario in scenarios:
+            for depth, width in sizes or DEFAULT_SIZES + SCENARIO_EXTRA_SIZES.get(scenario, []):
+                obj = os.path.join(workdir, f"{scenario}_{depth}x{width}" + (".obj" if family == "msvc" else ".o"))
+                cmd = build_command(family, args.compiler, source, obj, include_dir,
+                                    scenario, depth, width, time_trace, args.extra_flag or [])
+                best = None
+                for _ in range(max(1, args.repeat)):
+                    returncode, elapsed, rss_kb, output = run_and_measure(cmd, args.timeout)
+                    if best is None or (returncode == 0 and elapsed < best[1]):
+                        best = (returncode, elapsed, rss_kb, output)
+                returncode, elapsed, rss_kb, output = best
+
+                entry = {
+                    "scenario": scenario,
+                    "depth": depth,
+                    "width": width,
+                    "status": "ok" if returncode == 0 else ("timeout" if returncode is None else "error"),
+                    "wall_time_s": round(elapsed, 4),
+                    "peak_rss_kb": rss_kb,
+                    "instantiations": count_instantiations(os.path.splitext(obj)[0] + ".json") if time_trace else None,
+                }
+                if returncode not in (0, None):
+                    # Primera línea de error: típicamente -ftemplate-depth
+                    entry["error"] = next((l for l in output.splitlines() if "error" in l), output[:200])
+                results.append(entry)
+
+                rss_text = f"{rss_kb / 1024:.1f} MB" if rss_kb else "n/a"
+                inst = entry["instantiations"]["total"] if entry["instantiations"] else "n/a"
+                print(f"  {scenario:<12} {depth:>5}x{width:<5} {entry['status']:<6} "
+                      f"{elapsed:8.3f} s  {rss_text:>10}  inst={inst}")
+
+    report = {
+        "preset": args.preset,
+        "compiler": args.compiler,
+        "compiler_family": family,
+        "results": results,
+    }
+    os.makedirs(os.path.dirname(os.path.abspath(args.output)), exist_ok=True)
+    with open(args.output, "w", encoding="utf-8") as fh:
+        json.dump(report, fh, indent=2)
+    print(f"[Benchmark] Resultados escritos en {args.output}")
+    return 0
+
+
+def spelling_source(spelling, copies):
+    """Unidad de traducción con `copies` copias de SPELLING_STATEMENTS.
+
+    Cada copia usa variables distintas (n0, n1, ...) para que ninguna
+    instanciación se reutilice entre copias; 'none' solo incluye las
+    cabeceras y 'check' comprueba que las dos escrituras dan el mismo tipo.
+    """
+    lines = ["#include <logic_language/formula_literal.hpp>",
+             "#include <theorems/peano/order.hpp>",
+             "#include <type_traits>",
+             "",
+             "using namespace logic;",
+             "using namespace logic::peano;",
+             "using order::Le;",
+             "using strict_order::Lt;",
+             ""]
+    for copy in range(copies):
+        lines.append(f"namespace copy{copy}\n{{")
+        if spelling in ("dsl", "check"):
+            lines += [f'    constexpr auto {v} = "{v}{copy}"_var;' for v in SPELLING_VARIABLES]
+        for i, (dsl, text) in enumerate(SPELLING_STATEMENTS):
+            text = "".join(f"{c}{copy}" if c in SPELLING_VARIABLES and (j == 0 or not text[j - 1].isalnum())
+                           and (j + 1 == len(text) or not text[j + 1].isalnum()) else c
+                           for j, c in enumerate(text))
+            if spelling == "dsl":
+                lines.append(f"    using s{i} = decltype({dsl});")
+            elif spelling == "text":
+                lines.append(f'    using s{i} = Formula_t<"{text}">;')
+            elif spelling == "check":
+                lines.append(f'    static_assert(std::is_same_v<decltype({dsl}), Formula_t<"{text}">>, "{text}");')
+        if spelling in ("dsl", "text"):
+            sizes = " + ".join(f"sizeof(s{i})" for i in range(len(SPELLING_STATEMENTS)))
+            lines.append(f"    constexpr size_t total = {sizes};")
+        lines.append("}")
+    lines.append("")
+    lines.append("int main() { return 0; }")
+    return "\n".join(lines) + "\n"
+
+
+def spelling_command(family, compiler, source, obj, include_dir, extra):
+    if family == "msvc":
+        cmd = [compiler, "/nologo", "/std:c++latest", "/EHsc", "/utf-8", "/c", source, f"/Fo{obj}", f"/I{include_dir}"]
+    else:
+        cmd = [compiler, "-std=c++23", "-fextended-identifiers", "-finput-charset=UTF-8",
+               "-c", source, "-o", obj, f"-I{include_dir}"]
+    return cmd + list(extra)
+
+
+def cmd_spelling(args):
+    """Tiempo por enunciado de cada escritura, descontando las cabeceras (none)."""
+    root = get_project_root()
+    include_dir = args.include or os.path.join(root, "include")
+    family = detect_compiler_family(args.compiler, args.compiler_id)
+    statements = len(SPELLING_STATEMENTS)
+
+    with tempfile.TemporaryDirectory(prefix="logic_bench_") as workdir:
+        obj = os.path.join(workdir, "spelling" + (".obj" if family == "msvc" else ".o"))
+        extra = args.extra_flag or []
+
+        def compile_source(spelling, copies):
+            source = os.path.join(workdir, f"spelling_{spelling}_{copies}.cpp")
+            with open(source, "w", encoding="utf-8") as fh:
+                fh.write(spelling_source(spelling, copies))
+            return run_and_measure(spelling_command(family, args.compiler, source, obj, include_dir, extra), args.timeout)
+
+        returncode, _, _, output = compile_source("check", 1)
+        if returncode != 0:
+            print(f"[Benchmark] Las dos escrituras no coinciden:\n{output}")
+            return 1
+
+        for copies in [int(c) for c in args.copies.split(",")]:
+            measured = {}
+            for spelling in ("none", "dsl", "text"):
+                best = None
+                for _ in range(max(1, args.repeat)):
+                    returncode, elapsed, rss_kb, output = compile_source(spelling, copies)
+                    if returncode != 0:
+                        print(f"[Benchmark] {spelling} x{copies} falló:\n{output}")
+                        return 1
+                    if best is None or elapsed < best[0]:
+                        best = (elapsed, rss_kb)
+                measured[spelling] = best
+
+            base = measured["none"][0]
+            print(f"  {copies * statements} enunciados (cabeceras: {base:.3f} s)")
+            for spelling in ("dsl", "text"):
+                elapsed, rss_kb = measured[spelling]
+                per_statement = (elapsed - base) / (copies * statements) * 1000
+                rss_text = f"{rss_kb / 1024:.1f} MB" if rss_kb else "n/a"
+                print(f"    {spelling:<5} {elapsed:8.3f} s  {per_statement:7.2f} ms/enunciado  {rss_text:>10}")
+    return 0
+
+
+def _regressed(base, current, tolerance, min_delta):
+    if base is None or current is None:
+        return False
+    return current > base * (1.0 + tolerance) and (current - base) > min_delta
+
+
+def compare_reports(baseline, current, time_tol, rss_tol, inst_tol):
+    """Devuelve la lista de regresiones (texto) de current respecto a baseline."""
+    key = lambda e: (e["scenario"], e["depth"], e["width"])
+    base_index = {key(e): e for e in baseline.get("results", [])}
+    regressions = []
+    for entry in current.get("results", []):
+        base = base_index.get(key(entry))
+        if base is None:
+            continue
+        label = f"{entry['scenario']} {entry['depth']}x{entry['width']}"
+        if base["status"] == "ok" and entry["status"] != "ok":
+            regressions.append(f"{label}: antes compilaba, ahora falla ({entry.get('error', '')})")
+            continue
+        if entry["status"] != "ok":
+            continue
+        if _regressed(base["wall_time_s"], entry["wall_time_s"], time_tol, MIN_TIME_DELTA):
+            regressions.append(f"{label}: tiempo {base['wall_time_s']:.3f} s -> {entry['wall_time_s']:.3f} s")
+        if _regressed(base.get("peak_rss_kb"), entry.get("peak_rss_kb"), rss_tol, MIN_RSS_DELTA_KB):
+            regressions.append(f"{label}: RSS {base['peak_rss_kb']} KB -> {entry['peak_rss_kb']} KB")
+        base_inst = (base.get("instantiations") or {}).get("total")
+        cur_inst = (entry.get("instantiations") or {}).get("total")
+        if _regressed(base_inst, cur_inst, inst_tol, 0):
+            regressions.append(f"{label}: instanciaciones {base_inst} -> {cur_inst}")
+    return regressions
+
+
+def cmd_compare(args):
+    with open(args.current, encoding="utf-8") as fh:
+        current = json.load(fh)
+
+    # La línea base solo se escribe cuando se pide: si falta, se informa y se
+    # falla, para que una comparación nunca pase sin haber comparado nada
+    if args.update_baseline:
+        os.makedirs(os.path.dirname(os.path.abspath(args.baseline)), exist_ok=True)
+        # CRLF, como el resto de ficheros del repositorio
+        with open(args.baseline, "w", encoding="utf-8", newline="\r\n") as fh:
+            json.dump(current, fh, indent=2)
+            fh.write("\n")
+        print(f"[Benchmark] Línea base guardada en {args.baseline}")
+        return 0
+
+    if not os.path.exists(args.baseline):
+        print(f"[ERROR] No existe la línea base {args.baseline}; "
+              f"genérala con --update-baseline", file=sys.stderr)
+        return EXIT_MISSING_BASELINE
+
+    with open(args.baseline, encoding="utf-8") as fh:
+        baseline = json.load(fh)
+
+    regressions = compare_reports(baseline, current, args.time_tolerance, args.rss_tolerance, args.inst_tolerance)
+    if regressions:
+        print(f"[REGRESIÓN] {len(regressions)} regresiones de tiempo de compilación ({current.get('preset')}):")
+        for line in regressions:
+            print(f"  - {line}")
+        return 1
+    print(f"[Benchmark] Sin regresiones respecto a {args.baseline}")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Benchmark de tiempo de compilación del kernel lógico")
+    sub = parser.add_subparsers(dest="command", required=True)
+
+    run = sub.add_parser("run", help="Medir y escribir resultados en JSON")
+    run.add_argument("--compiler", required=True, help="Ruta del compilador C++")
+    run.add_argument("--compiler-id", default="", help="CMAKE_CXX_COMPILER_ID (opcional)")
+    run.add_argument("--include", default="", help="Directorio include de la librería")
+    run.add_argument("--preset", default="local", help="Nombre del preset (para el informe)")
+    run.add_argument("--output", required=True, help="Fichero JSON de salida")
+    run.add_argument("--sizes", default="", help="Lista de tamaños DEPTHxWIDTH separados por comas")
+    run.add_argument("--scenarios", default="", help="Escenarios separados por comas")
+    run.add_argument("--repeat", type=int, default=1, help="Repeticiones por punto (se toma el mínimo)")
+    run.add_argument("--timeout", type=int, default=DEFAULT_TIMEOUT, help="Segundos máximos por compilación")
+    run.add_argument("--extra-flag", action="append", help="Flag adicional para el compilador")
+    run.set_defaults(func=cmd_run)
+
+    cmp_ = sub.add_parser("compare", help="Comparar resultados contra una línea base")
+    cmp_.add_argument("--baseline", required=True)
+    cmp_.add_argument("--current", required=True)
+    cmp_.add_argument("--update-baseline", action="store_true", help="Escribir (o sobrescribir) la línea base con los resultados actuales")
+    cmp_.add_argument("--time-tolerance", type=float, default=DEFAULT_TIME_TOLERANCE)
+    cmp_.add_argument("--rss-tolerance", type=float, default=DEFAULT_RSS_TOLERANCE)
+    cmp_.add_argument("--inst-tolerance", type=float, default=DEFAULT_INST_TOLERANCE)
+    cmp_.set_defaults(func=cmd_compare)
+
+    spell = sub.add_parser("spelling", help="Comparar el DSL con los literales de texto")
+    spell.add_argument("--compiler", required=True, help="Ruta del compilador C++")
+    spell.add_argument("--compiler-id", default="", help="CMAKE_CXX_COMPILER_ID (opcional)")
+    spell.add_argument("--include", default="", help="Directorio include de la librería")
+    spell.add_argument("--copies", default="8,32", help="Copias de los enunciados de peano/, separadas por comas")
+    spell.add_argument("--repeat", type=int, default=3, help="Repeticiones por punto (se toma el mínimo)")
+    spell.add_argument("--timeout", type=int, default=DEFAULT_TIMEOUT, help="Segundos máximos por compilación")
+    spell.add_argument("--extra-flag", action="append", help="Flag adicional para el compilador")
+    spell.set_defaults(func=cmd_spelling)
+
+    args = parser.parse_args()
+    sys.exit(args.func(args))
+
+
+if __name__ == "__main__":
+    main()
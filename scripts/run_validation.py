@@ -1,3 +1,4 @@
+import argparse
 import subprocess
 import sys
 import os
@@ -150,7 +151,43 @@ def run_command(command, description, env=None):
         print("Deteniendo ejecución para evitar errores en cascada.")
         sys.exit(result.returncode)
 
+def run_compile_benchmark(preset, root_dir, update_baseline, env=None):
+    """
+    Construye el target compile_benchmark del preset y compara el resultado con
+    benchmarks/compile_time/baselines/<preset>.json.
+    Devuelve el código de compile_benchmark.py compare: 0 sin regresiones,
+    1 con regresiones y 2 si el preset no tiene línea base.
+    """
+    run_command(["cmake", "--build", "--preset", preset, "--target", "compile_benchmark"],
+                f"Benchmark de compilación {preset}", env=env)
+
+    current = os.path.join(root_dir, "build", preset, "compile_benchmark.json")
+    baseline = os.path.join(root_dir, "benchmarks", "compile_time", "baselines", f"{preset}.json")
+    command = [sys.executable, os.path.join(root_dir, "scripts", "compile_benchmark.py"), "compare",
+               "--baseline", baseline, "--current", current]
+    if update_baseline:
+        command.append("--update-baseline")
+
+    print(f"\n[Ejecutando] Comparación con la línea base ({preset})")
+    result = subprocess.run(command, text=True, env=env)
+    return result.returncode
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Validación cruzada de LogicLanguage")
+    parser.add_argument("--benchmark", action="store_true",
+                        help="Medir el tiempo de compilación del kernel y marcar regresiones por preset")
+    parser.add_argument("--update-baseline", action="store_true",
+                        help="Con --benchmark: sobrescribir la línea base con los resultados actuales")
+    parser.add_argument("--presets", default=",".join(PRESETS),
+                        help="Presets a validar, separados por comas")
+    return parser.parse_args()
+
 def main():
+    args = parse_args()
+    presets = [p for p in args.presets.split(",") if p]
+    regressed_presets = []
+    missing_baselines = []
+
     print("="*70)
     print("   VALIDACIÓN CRUZADA: GCC, CLANG, MSVC e INTEL oneAPI")
     print("="*70)
@@ -164,7 +201,7 @@ def main():
         print("Error crítico: No se encuentra CMakePresets.json en la raíz detectada.")
         sys.exit(1)
 
-    for preset in PRESETS:
+    for preset in presets:
         print(f"\n" + "-"*50)
         print(f" PROCESANDO PRESET: {preset.upper()}")
         print("-"*50)
@@ -196,6 +233,23 @@ def main():
             
         run_command(test_cmd, f"Tests {preset}", env=current_env)
 
+        # D. Benchmark de tiempo de compilación (opcional)
+        if args.benchmark:
+            status = run_compile_benchmark(preset, root_dir, args.update_baseline, env=current_env)
+            if status == 2:
+                missing_baselines.append(preset)
+            elif status != 0:
+                regressed_presets.append(preset)
+
+    if regressed_presets or missing_baselines:
+        print("\n" + "="*70)
+        if regressed_presets:
+            print(f" REGRESIONES DE TIEMPO DE COMPILACIÓN EN: {', '.join(regressed_presets)}")
+        if missing_baselines:
+            print(f" SIN LÍNEA BASE (usa --update-baseline): {', '.join(missing_baselines)}")
+        print("="*70)
+        sys.exit(1)
+
     print("\n" + "="*70)
     print(" ¡ÉXITO! El DSL compila y pasa validaciones en todos los entornos.")
     print("="*70)
@@ -0,0 +1,142 @@
+#include <logic_language/auto_prove.hpp>
+
+#include <type_traits>
+#include <utility>
+
+using namespace logic;
+
+using X = Var<"x">;
+using Y = Var<"y">;
+using Z = Var<"z">;
+using N = Var<"n">;
+
+using A = Predicate<"A">;
+using B = Predicate<"B">;
+using C = Predicate<"C">;
+
+// Contexto como conjunto: MergeContexts ordena las hipótesis
+template <typename Thm, typename... Hyps>
+constexpr bool has_context = std::is_same_v<typename Thm::context_type, CanonicalContext_t<TypeList<Hyps...>>>;
+
+// Escalera: P(i) → P(i + 1), P(i) → Q(i + 1) y Q(i + 1) → P(i + 1). Cada
+// P(i + 1) tiene dos caminos hasta P(i): sin memoria, 2^n ramas
+template <size_t I>
+using Rung = TypeList<Implies<Predicate<"P", Natural<I>>, Predicate<"P", Natural<I + 1>>>,
+                      Implies<Predicate<"P", Natural<I>>, Predicate<"Q", Natural<I + 1>>>,
+                      Implies<Predicate<"Q", Natural<I + 1>>, Predicate<"P", Natural<I + 1>>>>;
+
+template <typename Seq>
+struct Ladder;
+
+template <size_t... Is>
+struct Ladder<std::index_sequence<Is...>>
+{
+    using type = typename detail::ConcatAll<TypeList<>, Rung<Is>...>::type;
+};
+
+int main()
+{
+    // ==========================================
+    // TEST 1: Silogismo de Sócrates
+    // ==========================================
+    {
+        using Socrates = Var<"socrates">;
+        using HumanMortal = Forall<X, Implies<Predicate<"Human", X>, Predicate<"Mortal", X>>>;
+        using HumanSocrates = Predicate<"Human", Socrates>;
+        using MortalSocrates = Predicate<"Mortal", Socrates>;
+
+        constexpr auto thm = auto_prove<MortalSocrates, TypeList<HumanMortal, HumanSocrates>>();
+        static_assert(std::is_same_v<decltype(thm)::formula_type, MortalSocrates>, "Sócrates es mortal");
+        static_assert(has_context<decltype(thm), HumanMortal, HumanSocrates>, "Usa las dos premisas");
+        static_assert(auto_prove_stats<MortalSocrates, TypeList<HumanMortal, HumanSocrates>>.steps == 4, "assume, ∀-elim, assume, MP");
+
+        // Sin hipótesis: las dos se descargan con implies_intro
+        using Statement = Implies<HumanMortal, Implies<HumanSocrates, MortalSocrates>>;
+        constexpr auto closed = auto_prove<Statement>();
+        static_assert(std::is_same_v<std::remove_cv_t<decltype(closed)>, Theorem<TypeList<>, Statement>>, "Teorema sin contexto");
+
+        // Una hipótesis que sobra no aparece en el contexto
+        static_assert(has_context<AutoProof_t<MortalSocrates, TypeList<A, HumanMortal, B, HumanSocrates>>, HumanMortal, HumanSocrates>,
+                      "Solo las hipótesis usadas");
+    }
+
+    // ==========================================
+    // TEST 2: Lógica implicativa
+    // ==========================================
+    {
+        static_assert(std::is_same_v<AutoProof_t<Implies<A, A>>, Theorem<TypeList<>, Implies<A, A>>>, "Identidad");
+        static_assert(auto_provable_v<Implies<A, Implies<B, A>>>, "K");
+        static_assert(auto_provable_v<Implies<Implies<A, Implies<B, C>>, Implies<Implies<A, B>, Implies<A, C>>>>, "S");
+        static_assert(auto_provable_v<Implies<Implies<A, B>, Implies<Implies<B, C>, Implies<A, C>>>>, "Silogismo hipotético");
+
+        // Clásicas: no salen con estas reglas
+        static_assert(auto_prove_stats<Implies<Implies<Implies<A, B>, A>, A>>.status == AutoProveStatus::Failed, "Peirce");
+        static_assert(auto_prove_stats<Or<A, Not<A>>>.status == AutoProveStatus::Failed, "Tercero excluido");
+        static_assert(!auto_provable_v<B, TypeList<A, Implies<B, A>>>, "La recíproca no");
+    }
+
+    // ==========================================
+    // TEST 3: Cuantificadores
+    // ==========================================
+    {
+        using a = Var<"a">;
+        using b = Var<"b">;
+        using c = Var<"c">;
+        using d = Var<"d">;
+
+        // y no aparece en la conclusión: se prueba con los términos de la entrada
+        using Transitive = Forall<X, Forall<Y, Forall<Z, Implies<Predicate<"R", X, Y>, Implies<Predicate<"R", Y, Z>, Predicate<"R", X, Z>>>>>>;
+        using Facts = TypeList<Transitive, Predicate<"R", a, b>, Predicate<"R", b, c>, Predicate<"R", c, d>>;
+        constexpr auto thm = auto_prove<Predicate<"R", a, d>, Facts>();
+        static_assert(std::is_same_v<decltype(thm)::formula_type, Predicate<"R", a, d>>, "Transitividad dos veces");
+        static_assert(!auto_provable_v<Predicate<"R", d, a>, Facts>, "Sin simetría");
+
+        // Términos compuestos: Natural(S(S(S(0)))) desde Natural(0)
+        using IsNat = Forall<N, Implies<Predicate<"Natural", N>, Predicate<"Natural", Succ<N>>>>;
+        using Three = Predicate<"Natural", Succ<Succ<Succ<Natural<0>>>>>;
+        constexpr auto three = auto_prove<Three, TypeList<IsNat, Predicate<"Natural", Natural<0>>>>();
+        static_assert(has_context<decltype(three), IsNat, Predicate<"Natural", Natural<0>>>, "Natural(3)");
+
+        // ∀ sin uso en el cuerpo: se instancia con su propia variable
+        static_assert(auto_provable_v<A, TypeList<Forall<X, A>>>, "∀x. A ⊢ A");
+
+        // Un ∀ de la conclusión se encaja tal cual
+        using Body = Forall<Y, Predicate<"R", X, Y>>;
+        static_assert(auto_provable_v<Forall<Y, Predicate<"R", a, Y>>, TypeList<Forall<X, Body>>>, "∀x∀y. R(x, y) ⊢ ∀y. R(a, y)");
+
+        // x := y bajo el ∀y del objetivo capturaría y: no hay demostración
+        // (y la reproducción en el kernel no llega a instanciarse)
+        using Diagonal = Forall<Y, Predicate<"R", Y, Y>>;
+        static_assert(auto_prove_stats<Diagonal, TypeList<Forall<X, Body>>>.status == AutoProveStatus::Failed,
+                      "∀x∀y. R(x, y) no da ∀y. R(y, y) por encaje");
+        static_assert(!auto_provable_v<Forall<Y, And<Predicate<"R", Y>, Predicate<"Q", Y>>>,
+                                       TypeList<Forall<X, Forall<Y, And<Predicate<"R", X>, Predicate<"Q", Y>>>>>>,
+                      "Captura en el cuerpo de un ∀");
+    }
+
+    // ==========================================
+    // TEST 4: Memoria y presupuesto
+    // ==========================================
+    {
+        // 3·n hipótesis y P(0) sin demostrar: sin la tabla serían 2^n ramas
+        constexpr size_t n = 12;
+        using Hyps = typename Ladder<std::make_index_sequence<n>>::type;
+        constexpr AutoProveStats failed = auto_prove_stats<Predicate<"P", Natural<n>>, Hyps>;
+        static_assert(failed.status == AutoProveStatus::Failed, "Sin P(0) no hay demostración");
+        static_assert(failed.expanded < 32 * n, "Cada subobjetivo, una vez por pasada");
+
+        using WithBase = typename detail::ConcatAll<TypeList<Predicate<"P", Natural<0>>>, Hyps>::type;
+        static_assert(auto_provable_v<Predicate<"P", Natural<n>>, WithBase>, "Con P(0), la escalera entera");
+
+        // P(0) ← P(S(0)) ← P(S(S(0))) ← ...: infinitos subobjetivos distintos
+        using Regress = Forall<N, Implies<Predicate<"P", Succ<N>>, Predicate<"P", N>>>;
+        constexpr AutoProveStats regress = auto_prove_stats<Predicate<"P", Natural<0>>, TypeList<Regress>, 64>;
+        static_assert(regress.status == AutoProveStatus::BudgetExhausted && regress.expanded == 64, "Presupuesto agotado");
+
+        // Un ciclo A → B → A se corta sin gastar el presupuesto
+        constexpr AutoProveStats cycle = auto_prove_stats<A, TypeList<Implies<B, A>, Implies<A, B>>>;
+        static_assert(cycle.status == AutoProveStatus::Failed && cycle.expanded <= 4, "Ciclo");
+    }
+
+    return 0;
+}
@@ -0,0 +1,207 @@
+#include <logic_language/bdd.hpp>
+#include <theorems/peano/addition.hpp>
+#include "test_support.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+using X = Var<"x">;
+using A = Predicate<"P">;
+using B = Predicate<"Q">;
+using C = Predicate<"R">;
+using Px = Predicate<"P", X>;
+
+// Orden de las variables en los tipos: primera aparición
+static_assert(std::is_same_v<BddOrder_t<And<B, Or<A, Not<B>>>>, TypeList<B, A>>, "Primera aparición");
+static_assert(BddOrder_t<Forall<X, Implies<Px, Px>>>::size == 0, "∀ de una tautología");
+
+// El cuerpo bajo los ∀ del principio
+template <typename F>
+struct Matrix
+{
+    using type = F;
+};
+
+template <typename V, typename Body>
+struct Matrix<Forall<V, Body>> : Matrix<Body>
+{
+};
+
+template <typename F>
+struct Sides;
+
+template <typename L, typename R>
+struct Sides<Equiv<L, R>>
+{
+    using left = L;
+    using right = R;
+};
+
+// El φ (sin los ∀) de un BY_AXIOM(φ)
+template <typename Thm>
+using Statement = typename Matrix<StatementOf<Thm>>::type;
+
+int main()
+{
+    logic::test::Checker check;
+
+    // ==========================================
+    // TEST 1: Operaciones y forma canónica
+    // ==========================================
+    {
+        BddManager manager;
+        const Bdd x = manager.variable(0), y = manager.variable(1), z = manager.variable(2);
+        check(manager.node_count(x) == 2 && manager.node_count(x & y) == 3, "Número de nodos");
+        check(~~x == x && manager.node_count(~x) == manager.node_count(x), "¬ es una arista complementada");
+        check((x ^ x).is_false() && (x | ~x).is_true() && (x & ~x).is_false(), "Constantes");
+        check((x & (y | z)) == ((x & y) | (x & z)), "Distributividad");
+        check(~(x & y) == (~x | ~y) && x.implies(y) == (~x | y), "De Morgan e implicación");
+        check(x.equiv(y) == ~(x ^ y) && manager.ite(x, y, z) == ((x & y) | (~x & z)), "↔ e ite");
+
+        const auto assignment = manager.satisfying_assignment(x & ~y & z);
+        check(assignment && (*assignment)[0] && !(*assignment)[1] && (*assignment)[2], "Asignación que la satisface");
+        check(!manager.satisfying_assignment(x & ~x), "Falsa: sin asignación");
+    }
+
+    // ==========================================
+    // TEST 2: Desde los tipos
+    // ==========================================
+    {
+        BddManager manager;
+        check(type_bdd<Or<A, Not<A>>>(manager).is_true(), "Tercero excluido");
+        check(type_bdd<Implies<Implies<Implies<A, B>, A>, A>>(manager).is_true(), "Ley de Peirce");
+        check(type_bdd<Forall<X, Implies<Px, Px>>>(manager).is_true(), "∀ de una tautología");
+
+        using Atoms = BddOrder_t<And<Not<And<A, B>>, C>>;
+        check(type_bdd<Not<And<A, B>>, Atoms>(manager) == type_bdd<Or<Not<A>, Not<B>>, Atoms>(manager), "De Morgan, la misma lista de átomos");
+        check(type_bdd<Implies<A, B>, Atoms>(manager) != type_bdd<Implies<B, A>, Atoms>(manager), "La recíproca no es equivalente");
+
+        // Lemas ↔ de peano: los dos lados son átomos distintos, su
+        // esqueleto proposicional no es una equivalencia
+        using LeDefinition = Sides<Statement<decltype(peano::order::le_definition())>>;
+        using AddComm = Sides<Statement<decltype(peano::addition::add_comm())>>;
+        using Both = BddOrder_t<And<Statement<decltype(peano::order::le_definition())>, Statement<decltype(peano::addition::add_comm())>>>;
+        const Bdd le_left = type_bdd<typename LeDefinition::left, Both>(manager);
+        const Bdd le_right = type_bdd<typename LeDefinition::right, Both>(manager);
+        check(le_left != le_right && manager.node_count(le_right) == 3, "le_definition: Le ↔ Lt ∨ Eq");
+        check(type_bdd<typename AddComm::left, Both>(manager) != type_bdd<typename AddComm::right, Both>(manager), "add_comm");
+        check(manager.satisfying_assignment(le_left ^ le_right).has_value(), "Asignación que distingue los lados");
+    }
+
+    // ==========================================
+    // TEST 3: Fórmulas aleatorias frente a la tabla de verdad
+    // ==========================================
+    {
+        TermStore store;
+        BddManager manager;
+        BddBuilder builder(store, manager);
+        std::mt19937 random(2024);
+        std::vector<NodeId> atoms;
+        for (int i = 0; i < 10; ++i)
+            atoms.push_back(store.atom("p" + std::to_string(i), {}));
+        const auto generate = [&](auto &self, int depth) -> NodeId {
+            const unsigned choice = random() % 7;
+            if (depth == 0 || choice == 0)
+                return atoms[random() % atoms.size()];
+            if (choice == 1)
+                return store.unary(NodeOp::Not, self(self, depth - 1));
+            const NodeOp ops[] = {NodeOp::And, NodeOp::Or, NodeOp::Implies, NodeOp::Equiv};
+            return store.binary(ops[choice % 4], self(self, depth - 1), self(self, depth - 1));
+        };
+
+        bool agree = true, canonical = true;
+        size_t valid = 0, equivalent = 0;
+        for (int round = 0; round < 300; ++round)
+        {
+            NodeId formula = generate(generate, 6);
+            if (round % 3 == 0)
+                formula = store.binary(NodeOp::Or, formula, store.binary(NodeOp::Implies, formula, generate(generate, 3)));
+            const Bdd bdd = builder.build(formula);
+            agree &= bdd.is_true() == TruthTable(store, formula).tautology(1);
+            valid += bdd.is_true();
+
+            // La asignación que hace falsa la fórmula, en los átomos del constructor
+            if (const auto assignment = manager.satisfying_assignment(~bdd))
+            {
+                NodeId instance = formula;
+                for (size_t atom = 0; atom < builder.atoms().size(); ++atom)
+                    instance = store.binary(NodeOp::And, instance,
+                                            (*assignment)[atom] ? builder.atoms()[atom] : store.unary(NodeOp::Not, builder.atoms()[atom]));
+                agree &= TruthTable(store, store.unary(NodeOp::Not, instance)).tautology(1);
+            }
+
+            // Mismo nodo si y solo si son equivalentes
+            const NodeId other = round % 2 ? generate(generate, 4) : store.unary(NodeOp::Not, store.unary(NodeOp::Not, formula));
+            const bool same = builder.build(other) == bdd;
+            canonical &= same == TruthTable(store, store.binary(NodeOp::Equiv, formula, other)).tautology(1);
+            equivalent += same;
+        }
+        check(agree, "Coincide con la tabla de verdad y la asignación hace falsa la fórmula");
+        check(canonical && equivalent >= 150, "Forma canónica");
+        check(valid > 0, "Hay fórmulas válidas entre las generadas");
+    }
+
+    // ==========================================
+    // TEST 4: Orden de las variables y recolección de basura
+    // ==========================================
+    {
+        // (x0 ∧ y0) ∨ ... ∨ (x11 ∧ y11): lineal con x0 y0 x1 y1 ...,
+        // exponencial con todas las x antes que las y
+        constexpr size_t n = 12;
+        TermStore store;
+        std::vector<NodeId> xs, ys;
+        for (size_t i = 0; i < n; ++i)
+        {
+            xs.push_back(store.atom("x" + std::to_string(i), {}));
+            ys.push_back(store.atom("y" + std::to_string(i), {}));
+        }
+        NodeId sum = store.binary(NodeOp::And, xs[0], ys[0]);
+        for (size_t i = 1; i < n; ++i)
+            sum = store.binary(NodeOp::Or, sum, store.binary(NodeOp::And, xs[i], ys[i]));
+
+        BddManager good_manager;
+        BddBuilder good(store, good_manager);
+        const size_t good_nodes = good_manager.node_count(good.build(sum));
+
+        BddManager bad_manager;
+        BddBuilder bad(store, bad_manager);
+        for (size_t i = 0; i < n; ++i)
+            bad.declare(xs[i]);
+        const size_t bad_nodes = bad_manager.node_count(bad.build(sum));
+        check(good_nodes == 2 * n + 1 && bad_nodes > 4096, "Heurística de orden");
+
+        // Los átomos del cuerpo de un ∀ válido no son átomos de la fórmula
+        {
+            BddManager manager;
+            BddBuilder builder(store, manager);
+            const NodeId q = store.atom("q", {});
+            const NodeId valid = store.binder(NodeOp::Forall, "z", store.binary(NodeOp::Implies, q, q));
+            const Bdd bdd = builder.build(store.binary(NodeOp::And, xs[0], valid));
+            check(builder.atoms().size() == 1 && bdd == builder.declare(xs[0]), "El cuerpo de un ∀ no entra en atoms()");
+        }
+
+        // Los nodos de los Bdd destruidos se liberan; los vivos no cambian
+        BddManager manager;
+        std::vector<Bdd> variables;
+        for (size_t i = 0; i < 2 * n; ++i)
+            variables.push_back(manager.variable(i));
+        Bdd kept = manager.zero();
+        for (size_t i = 0; i < n; ++i)
+            kept = kept | (variables[i] & variables[n + i]);
+        const size_t kept_nodes = manager.node_count(kept);
+        manager.collect_garbage();
+        const size_t live = manager.stats().nodes;
+        Bdd rebuilt = manager.zero();
+        for (size_t i = 0; i < n; ++i)
+            rebuilt = rebuilt | (variables[i] & variables[n + i]);
+        check(rebuilt == kept && manager.node_count(kept) == kept_nodes, "El Bdd vivo sobrevive a la recolección");
+        check(live < manager.stats().peak_nodes && manager.stats().collections == 1, "Se liberan nodos");
+        check(manager.stats().unique_hits > 0 && manager.stats().cache_lookups > 0 && manager.stats().bytes > 0, "Estadísticas");
+    }
+
+    return check.exit_code();
+}
@@ -0,0 +1,202 @@
+// Las demostraciones de este fichero se escriben con las macros con traza
+#define LOGIC_TRACE_PROOFS 1
+
+#include <logic_language/certificate_file.hpp>
+#include "test_support.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+using X = Var<"x">;
+using S = Var<"socrates">;
+using Hx = Predicate<"Human", X>;
+using Mx = Predicate<"Mortal", X>;
+using Hs = Predicate<"Human", S>;
+using AllHM = Forall<X, Implies<Hx, Mx>>;
+
+// El silogismo de examples/socrates_proof.cpp
+constexpr auto socrates()
+{
+    auto premise1 = ASSUME(AllHM{});
+    auto premise2 = ASSUME(Hs{});
+    auto conclusion = APPLY_MP(premise2, FORALL_ELIM(premise1, S{}));
+    return DISCHARGE(AllHM{}, DISCHARGE(Hs{}, conclusion));
+}
+
+// ⊢ ∀x. (Human(x) → Human(x)), citando dos veces el mismo axioma
+constexpr auto shared()
+{
+    auto identity = BY_AXIOM(Hx{});
+    auto twice = APPLY_MP(APPLY_MP(ASSUME(Hx{}), identity), identity);
+    return FORALL_INTRO(X{}, DISCHARGE(Hx{}, twice));
+}
+
+// Γ ⊢ φ comprobado frente al teorema del kernel de tipos
+template <typename Store, typename... Hyps, typename Formula>
+bool same_theorem(Store &store, const CheckedTheorem &checked, Theorem<TypeList<Hyps...>, Formula>)
+{
+    std::vector<NodeId> context{reify<Hyps>(store)...};
+    std::ranges::sort(context);
+    return checked.formula == reify<Formula>(store) && checked.context == context;
+}
+
+// ¿Lanza CertificateFormatError al abrir o validar?
+bool rejects(const std::filesystem::path &path, const std::vector<char> &bytes)
+{
+    std::ofstream(path, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    try
+    {
+        CertificateFile(path.string()).validate();
+    }
+    catch (const CertificateFormatError &)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    logic::test::Checker check;
+
+    constexpr auto syllogism = socrates();
+    constexpr auto lemma = shared();
+    static_assert(std::is_base_of_v<Theorem<TypeList<>, Implies<AllHM, Implies<Hs, Predicate<"Mortal", S>>>>, decltype(syllogism)>,
+                  "Un Traced es el mismo teorema");
+    static_assert(std::is_same_v<decltype(modus_ponens(assume<Hx>(), traced_assume<Implies<Hx, Mx>>())),
+                                 decltype(modus_ponens(assume<Hx>(), assume<Implies<Hx, Mx>>()))>,
+                  "Una premisa sin traza da un Theorem normal");
+
+    // ==========================================
+    // TEST 1: Exportación desde el kernel de tipos
+    // ==========================================
+    TermStore store;
+    ProofCertificate certificate;
+    ProofExporter exporter(store, certificate);
+    const StepId syllogism_step = exporter.add(syllogism);
+    const size_t before = certificate.size();
+    const StepId lemma_step = exporter.add(lemma);
+    {
+        ProofChecker checker(store);
+        const std::vector<StepId> roots{syllogism_step, lemma_step};
+        const std::vector<CheckedTheorem> theorems = checker.check(certificate.steps(), roots);
+        check(same_theorem(store, theorems[0], syllogism), "El silogismo exportado es el mismo teorema");
+        check(same_theorem(store, theorems[1], lemma), "Mismo teorema con generalization y axiom_identity");
+        check(syllogism_step == 5, "Seis pasos en el silogismo");
+        check(certificate.size() - before == 6, "axiom_identity se emite una sola vez aunque se cite dos veces");
+        check(exporter.add(syllogism) == syllogism_step && certificate.size() - before == 6, "Volver a exportar no añade pasos");
+    }
+
+    // ==========================================
+    // TEST 2: Ida y vuelta por el fichero
+    // ==========================================
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / "logic_certificate_tests.bin";
+    const NamedStep lemmas[] = {{"socrates", syllogism_step}, {"shared", lemma_step}};
+    write_certificate(path.string(), store, certificate, lemmas);
+    {
+        const CertificateFile file(path.string());
+        file.validate();
+        check(file.steps().size() == certificate.size() && file.lemmas().size() == 2, "Mismos pasos y lemas");
+        check(file.name(file.lemmas()[0].name) == "socrates" && file.roots() == std::vector<StepId>{syllogism_step, lemma_step},
+              "Lemas con nombre");
+        check(reinterpret_cast<std::uintptr_t>(file.steps().data()) % alignof(std::uint64_t) == 0, "Tablas alineadas");
+
+        CertificateStore view(file);
+        const std::vector<CheckedTheorem> theorems = BasicProofChecker<CertificateStore>(view).check(file.steps(), file.roots());
+        check(same_theorem(view, theorems[0], syllogism), "El certificado del fichero demuestra el silogismo");
+        check(same_theorem(view, theorems[1], lemma), "... y el segundo lema");
+        check(view.text(theorems[0].formula) == to_string(decltype(syllogism)::formula_type{}), "Misma fórmula como texto");
+
+        // Las hipótesis están en el fichero; las conclusiones nuevas, en memoria
+        check(view.contains(theorems[0].formula) && theorems[0].formula >= file.nodes().size(), "Conclusión creada en memoria");
+        check(reify<AllHM>(view) < file.nodes().size() && view.created() > 0, "Los nodos del fichero se encuentran en su índice");
+        const size_t created = view.created();
+        reify<Implies<AllHM, Implies<Hs, Predicate<"Mortal", S>>>>(view);
+        check(view.created() == created, "Compartición también en los nodos nuevos");
+    }
+
+    // ==========================================
+    // TEST 3: Ficheros inválidos
+    // ==========================================
+    {
+        const std::vector<char> good = encode_certificate(store, certificate, lemmas);
+        const std::filesystem::path bad = std::filesystem::temp_directory_path() / "logic_certificate_bad.bin";
+        check(!rejects(bad, good), "El fichero bueno se acepta");
+
+        std::vector<char> bytes = good;
+        bytes[0] = 'X';
+        check(rejects(bad, bytes), "Magia incorrecta");
+
+        bytes = good;
+        bytes[8] = 2;
+        check(rejects(bad, bytes), "Versión no soportada");
+
+        check(rejects(bad, std::vector<char>(good.begin(), good.end() - 8)), "Fichero truncado");
+        check(rejects(bad, {}), "Fichero vacío");
+
+        // Un nombre cambiado deja de coincidir con su hash: sin validate() la
+        // máscara de variables libres de la sustitución no sería fiable
+        certificate_format::Header header;
+        std::memcpy(&header, good.data(), sizeof(header));
+        bytes = good;
+        bytes[header.text.offset] ^= 1;
+        check(rejects(bad, bytes), "Hash de nombre incorrecto");
+
+        // El relleno de nodos y pasos se escribe a cero
+        bool zero_padding = true;
+        for (size_t i = 0; i < header.nodes.count; ++i)
+            for (size_t b = offsetof(Node, op) + 1; b < offsetof(Node, symbol); ++b)
+                zero_padding = zero_padding && good[header.nodes.offset + i * sizeof(certificate_format::Entry) + b] == 0;
+        for (size_t i = 0; i < header.steps.count; ++i)
+            for (size_t b = offsetof(ProofStep, rule) + 1; b < offsetof(ProofStep, formula); ++b)
+                zero_padding = zero_padding && good[header.steps.offset + i * sizeof(ProofStep) + b] == 0;
+        check(zero_padding, "Relleno a cero");
+
+        // Un hijo que apunta hacia delante
+        bytes = good;
+        certificate_format::Entry entry;
+        const size_t last = header.nodes.offset + (header.nodes.count - 1) * sizeof(entry);
+        std::memcpy(&entry, bytes.data() + last, sizeof(entry));
+        entry.node = {NodeOp::Not, SymbolTable::npos, {static_cast<NodeId>(header.nodes.count), 0}};
+        std::memcpy(bytes.data() + last, &entry, sizeof(entry));
+        check(rejects(bad, bytes), "Hijo después del padre");
+
+        // Índices sin huecos o con identificadores repetidos: las búsquedas
+        // de CertificateStore no terminarían
+        auto fill_index = [&](const certificate_format::Section &section, auto value) {
+            std::vector<char> filled = good;
+            for (std::uint32_t i = 0; i < section.count; ++i)
+            {
+                const std::uint32_t id = value(i);
+                std::memcpy(filled.data() + section.offset + i * sizeof(id), &id, sizeof(id));
+            }
+            return filled;
+        };
+        check(rejects(bad, fill_index(header.node_index, [](std::uint32_t) { return 0u; })), "Índice de nodos lleno de ceros");
+        check(rejects(bad, fill_index(header.symbol_index, [](std::uint32_t) { return 0u; })), "Índice de nombres lleno de ceros");
+        check(rejects(bad, fill_index(header.node_index,
+                                      [&](std::uint32_t i) { return static_cast<std::uint32_t>(i % header.nodes.count); })),
+              "Índice de nodos saturado");
+
+        // Mismo número de casillas ocupadas, pero un id repetido y otro ausente
+        bytes = good;
+        std::vector<std::uint32_t> slots(header.node_index.count);
+        std::memcpy(slots.data(), bytes.data() + header.node_index.offset, slots.size() * sizeof(std::uint32_t));
+        const auto first = std::ranges::find_if(slots, [](std::uint32_t id) { return id != certificate_format::empty_slot; });
+        const auto second = std::find_if(first + 1, slots.end(), [](std::uint32_t id) { return id != certificate_format::empty_slot; });
+        *second = *first;
+        std::memcpy(bytes.data() + header.node_index.offset, slots.data(), slots.size() * sizeof(std::uint32_t));
+        check(rejects(bad, bytes), "Índice de nodos con un id repetido");
+
+        std::filesystem::remove(bad);
+    }
+
+    std::filesystem::remove(path);
+    return check.exit_code();
+}
@@ -3,6 +3,7 @@
 
 #include <logic_language/logic_language.hpp>
 #include <type_traits>
+#include <utility>
 
 using namespace logic;
 
@@ -12,6 +13,18 @@ constexpr bool check_type = std::is_same_v<std::remove_cv_t<T>, std::remove_cv_t
 template <typename T>
 using clean_t = std::remove_cv_t<T>;
 
+// Contexto de prueba: A(i % 10) para i en [0, N)
+template <size_t... Is>
+auto big_context(std::index_sequence<Is...>) -> TypeList<Predicate<"A", Natural<Is % 10>>...>;
+
+// Mismo contexto sin A(0): el índice j salta los múltiplos de 10
+template <size_t... Js>
+auto big_context_without_zero(std::index_sequence<Js...>) -> TypeList<Predicate<"A", Natural<Js % 9 + 1>>...>;
+
+// Contexto A(Offset), ..., A(Offset + N - 1)
+template <size_t Offset, size_t... Is>
+auto range_context(std::index_sequence<Is...>) -> TypeList<Predicate<"A", Natural<Offset + Is>>...>;
+
 int main()
 {
     // Variables de prueba
@@ -101,7 +114,7 @@ int main()
     constexpr auto thm_Q_derived = modus_ponens(thm_P_assumed, thm_P_impl_Q);
     
     using Context_MP_Fusion = typename decltype(thm_Q_derived)::context_type;
-    using Expected_Fusion = TypeList<P_x, P_implies_Q>;
+    using Expected_Fusion = CanonicalContext_t<TypeList<P_x, P_implies_Q>>;
     
     static_assert(std::is_same_v<Context_MP_Fusion, Expected_Fusion>, 
                   "MP debe fusionar contextos correctamente");
@@ -114,7 +127,7 @@ int main()
     constexpr auto thm_R_final = modus_ponens(thm_Q_derived, thm_Q_impl_R);
     
     using Context_Chain = typename decltype(thm_R_final)::context_type;
-    using Expected_Chain = TypeList<P_x, P_implies_Q, Q_implies_R>;
+    using Expected_Chain = CanonicalContext_t<TypeList<P_x, P_implies_Q, Q_implies_R>>;
     
     static_assert(std::is_same_v<Context_Chain, Expected_Chain>, 
                   "MP en cadena debe acumular todos los contextos");
@@ -210,6 +223,79 @@ int main()
     static_assert(std::is_same_v<Shadowed, Quantified>, 
                   "Sustitución debe respetar shadowing en cuantificadores");
 
+    // Test 6.4: Variables libres
+    using X = clean_t<decltype(x)>;
+    using Y = clean_t<decltype(y)>;
+    using Z = clean_t<decltype(z)>;
+    using Open_Formula = Forall<X, decltype(P(x, y))>;
+    static_assert(occurs_free_v<Y, Open_Formula> && !occurs_free_v<X, Open_Formula>,
+                  "La variable ligada no aparece libre; las demás sí");
+    static_assert(std::is_same_v<FreeVars_t<Open_Formula>, TypeList<Y>>,
+                  "FreeVars_t descuenta la variable ligada");
+    static_assert(std::is_same_v<FreeVars_t<Implies<P_z, decltype(P(y, z))>>, CanonicalContext_t<TypeList<Y, Z>>>,
+                  "FreeVars_t es un conjunto canónico");
+
+    // Test 6.5: Los subárboles sin el objetivo se devuelven tal cual
+    using Untouched = Substitute_t<Open_Formula, Z, Natural<0>>;
+    static_assert(std::is_same_v<Untouched, Open_Formula>,
+                  "Sustituir una variable ausente no debe cambiar la fórmula");
+
+    // Test 6.6: Sustitución sin captura
+    // (∀y. P(x, y))[x := y] = ∀y'. P(y, y')
+    using Captured = Substitute_t<Forall<Y, decltype(P(x, y))>, X, Y>;
+    static_assert(std::is_same_v<Captured, Forall<Var<"y'">, decltype(P(y, Var<"y'">{}))>>,
+                  "La variable ligada debe renombrarse para no capturar y");
+    using Captured_Twice = Substitute_t<Exists<Y, decltype(P(x, y, Var<"y'">{}))>, X, Y>;
+    static_assert(std::is_same_v<Captured_Twice, Exists<Var<"y''">, decltype(P(y, Var<"y''">{}, Var<"y'">{}))>>,
+                  "El nombre nuevo no puede ser una variable libre del cuerpo");
+
+    // Test 6.7: Objetivo const (decltype de una variable constexpr) y términos
+    static_assert(check_type<Substitute_t<P_x, decltype(x), Natural<0>>, decltype(P(Natural<0>{}))>,
+                  "El objetivo se compara sin const");
+    static_assert(check_type<Substitute_t<decltype(P(Succ<X>{})), X, Natural<0>>, decltype(P(Succ<Natural<0>>{}))>,
+                  "La sustitución desciende por Succ");
+
+    // Test 6.8: Sustitución simultánea (el intercambio x <-> y no se encadena)
+    using Swapped = SubstituteAll_t<decltype(P(x, y)), TypeList<Binding<X, Y>, Binding<Y, X>>>;
+    static_assert(std::is_same_v<Swapped, decltype(P(y, x))>,
+                  "Todas las variables del mapa se sustituyen a la vez");
+    using Captured_Map = SubstituteAll_t<Forall<Y, decltype(P(x, y, z))>, TypeList<Binding<X, Y>, Binding<Z, X>>>;
+    static_assert(std::is_same_v<Captured_Map, Forall<Var<"y'">, decltype(P(y, Var<"y'">{}, x))>>,
+                  "El mapa también evita la captura");
+
+    // Test 6.9: instantiate_all equivale a encadenar universal_instantiation
+    constexpr auto nested = Theorem<TypeList<>, Forall<X, Forall<Y, decltype(P(x, y, z))>>>{};
+    static_assert(check_type<decltype(instantiate_all(nested, y, Succ<X>{})),
+                             decltype(universal_instantiation(universal_instantiation(nested, y), Succ<X>{}))>,
+                  "instantiate_all debe coincidir con la instanciación paso a paso");
+    static_assert(check_type<decltype(FORALL_ELIM_ALL(nested, Natural<1>{})),
+                             Theorem<TypeList<>, Forall<Y, decltype(P(Natural<1>{}, y, z))>>>,
+                  "Con menos términos solo se eliminan los ∀ exteriores");
+    constexpr auto shadowing = Theorem<TypeList<>, Forall<X, Forall<X, P_x>>>{};
+    static_assert(check_type<decltype(instantiate_all(shadowing, Natural<1>{}, Natural<2>{})),
+                             Theorem<TypeList<>, decltype(P(Natural<2>{}))>>,
+                  "El ∀ interior oculta al exterior con el mismo nombre");
+
+    // Test 6.10: Ligadores variádicos
+    static_assert(check_type<decltype(forall(x, y, z, P(x, y, z))), Forall<X, Forall<Y, Forall<Z, decltype(P(x, y, z))>>>>,
+                  "forall(x, y, z, A) debe anidar los cuantificadores en orden");
+    static_assert(check_type<decltype(exists(x, y, P(x, y))), Exists<X, Exists<Y, decltype(P(x, y))>>>,
+                  "exists(x, y, A) debe anidar los cuantificadores en orden");
+    static_assert(check_type<decltype(forall(x, y, [](auto a, auto b) { return P(a, b); })), Forall<X, Forall<Y, decltype(P(x, y))>>>,
+                  "El cuerpo puede ser una función de las variables ligadas");
+
+    // Test 6.11: Símbolos (nombres en el tipo y tabla inversa)
+    static_assert(name_of<X> == "x" && name_of<decltype(P(x))> == "P",
+                  "name_of debe recuperar el nombre original");
+    static_assert(name_of<Var<"demasiado_largo">> == "demasiado_largo",
+                  "Los nombres largos también se recuperan");
+    static_assert(name_of<Captured::Variable> == "y'",
+                  "El nombre derivado al renombrar se recupera igual");
+#if LOGIC_COMPACT_NAMES
+    static_assert(std::is_same_v<X, Variable<std::uint64_t{'x'}>>,
+                  "Con LOGIC_COMPACT_NAMES un nombre corto se guarda como entero");
+#endif
+
     // ==========================================
     // SECCIÓN 7: STRESS TESTS Y LÍMITES
     // ==========================================
@@ -233,5 +319,152 @@ int main()
     static_assert(Large_Context::size == 5, 
                   "TypeList debe contar correctamente el número de elementos");
 
+    // Test 7.3: Descarga en contextos que superan un bloque del filtro
+    // (100 hipótesis, duplicados repartidos entre bloques, orden preservado)
+    using Big_Context = decltype(big_context(std::make_index_sequence<100>{}));
+    using Big_Discharged = DischargeContext_t<Predicate<"A", Natural<0>>, Big_Context>;
+    static_assert(Big_Discharged::size == 90, 
+                  "Descargar A(0) debe eliminar sus 10 apariciones");
+    static_assert(std::is_same_v<Big_Discharged, decltype(big_context_without_zero(std::make_index_sequence<90>{}))>, 
+                  "La descarga debe preservar el orden del resto de hipótesis");
+    static_assert(std::is_same_v<DischargeContext_t<Q_x, Big_Context>, Big_Context>, 
+                  "Descargar una hipótesis ausente debe devolver el mismo contexto");
+
+    // ==========================================
+    // SECCIÓN 8: CONTEXTOS CANÓNICOS (CONJUNTOS)
+    // ==========================================
+
+    // Test 8.1: El orden de la fusión no cambia el contexto
+    using Merge_PQ = MergeContexts_t<TypeList<P_x>, TypeList<Q_x>>;
+    using Merge_QP = MergeContexts_t<TypeList<Q_x>, TypeList<P_x>>;
+    static_assert(std::is_same_v<Merge_PQ, Merge_QP>, 
+                  "Fusionar {P} con {Q} o {Q} con {P} debe dar el mismo contexto");
+    static_assert(Merge_PQ::size == 2, 
+                  "La fusión de hipótesis distintas debe conservarlas todas");
+
+    // Test 8.2: Las hipótesis repetidas se fusionan en una sola
+    using Merge_Dup = MergeContexts_t<TypeList<P_x, Q_x>, TypeList<Q_x, P_x, P_y>>;
+    static_assert(std::is_same_v<Merge_Dup, CanonicalContext_t<TypeList<P_y, Q_x, P_x>>>, 
+                  "La fusión debe eliminar duplicados");
+    static_assert(Merge_Dup::size == 3, 
+                  "El contexto debe crecer con las hipótesis distintas, no con los pasos");
+
+    // Test 8.3: El mismo teorema por dos derivaciones distintas es el mismo tipo
+    constexpr auto thm_order_1 = modus_ponens(assume<P_x>(), assume<P_implies_Q>());
+    constexpr auto thm_order_2 = modus_ponens(
+        modus_ponens(assume<P_x>(), assume<Implies<P_x, P_x>>()), assume<P_implies_Q>());
+    constexpr auto thm_order_3 = modus_ponens(assume<P_x>(), modus_ponens(assume<P_x>(), assume<Implies<P_x, P_implies_Q>>()));
+    static_assert(std::is_same_v<decltype(thm_order_1)::context_type, 
+                                 MergeContexts_t<TypeList<P_implies_Q>, TypeList<P_x>>>, 
+                  "MP debe producir el contexto canónico de sus premisas");
+    static_assert(std::is_same_v<DischargeContext_t<Implies<P_x, P_x>, decltype(thm_order_2)::context_type>, 
+                                 decltype(thm_order_1)::context_type>, 
+                  "Descargar la hipótesis extra debe dejar el mismo contexto canónico");
+    static_assert(std::is_same_v<DischargeContext_t<Implies<P_x, P_implies_Q>, decltype(thm_order_3)::context_type>, 
+                                 TypeList<P_x>>, 
+                  "P usada dos veces debe aparecer una sola vez en el contexto");
+
+    // Test 8.4: Fusión de contextos canónicos grandes que se solapan
+    using Range_Low = CanonicalContext_t<decltype(range_context<0>(std::make_index_sequence<60>{}))>;
+    using Range_High = CanonicalContext_t<decltype(range_context<30>(std::make_index_sequence<70>{}))>;
+    using Range_All = CanonicalContext_t<decltype(range_context<0>(std::make_index_sequence<100>{}))>;
+    static_assert(std::is_same_v<MergeContexts_t<Range_Low, Range_High>, Range_All>, 
+                  "La fusión de contextos canónicos debe ser la unión canónica");
+    static_assert(std::is_same_v<MergeContexts_t<Range_High, Range_Low>, Range_All>, 
+                  "La unión no depende del orden de los operandos");
+    static_assert(std::is_same_v<MergeContexts_t<Range_All, Range_Low>, Range_All>, 
+                  "Fusionar con un subconjunto no cambia el contexto");
+    static_assert(std::is_same_v<CanonicalContext_t<Big_Context>, 
+                                 CanonicalContext_t<decltype(range_context<0>(std::make_index_sequence<10>{}))>>, 
+                  "Canonicalizar elimina los duplicados de cualquier lista");
+
+    // Test 8.5: Casos triviales
+    static_assert(std::is_same_v<CanonicalContext_t<TypeList<>>, TypeList<>>, 
+                  "El contexto vacío es canónico");
+    static_assert(std::is_same_v<CanonicalContext_t<TypeList<P_x, P_x, P_x>>, TypeList<P_x>>, 
+                  "Un contexto de una sola hipótesis repetida se reduce a ella");
+
+    // Test 8.6: El orden sale de la estructura de las fórmulas (los
+    // numerales por su valor), no del compilador
+    using N_1 = Predicate<"N", Natural<1>>;
+    using N_2 = Predicate<"N", Natural<2>>;
+    using N_3 = Predicate<"N", Natural<3>>;
+    using N_300 = Predicate<"N", Natural<300>>;
+    static_assert(std::is_same_v<CanonicalContext_t<TypeList<N_300, N_2, N_1>>, TypeList<N_1, N_2, N_300>>,
+                  "Los numerales se ordenan por su valor");
+    static_assert(std::is_same_v<MergeContexts_t<TypeList<N_1, N_300>, TypeList<N_2>>, TypeList<N_1, N_2, N_300>>,
+                  "Una hipótesis nueva entre dos del contexto");
+    static_assert(std::is_same_v<MergeContexts_t<TypeList<N_1, N_3>, TypeList<N_300, N_2, N_3>>, TypeList<N_1, N_2, N_3, N_300>>,
+                  "Hipótesis nuevas en varios huecos, con el segundo contexto desordenado");
+
+    // ==========================================
+    // SECCIÓN 9: FORMA CANÓNICA MÓDULO α (DE BRUIJN)
+    // ==========================================
+
+    // Test 9.1: Renombrar variables ligadas no cambia la forma canónica
+    static_assert(alpha_equivalent(forall(x, P_x{}), forall(y, P_y{})),
+                  "∀x. P(x) y ∀y. P(y) son α-equivalentes");
+    static_assert(alpha_equivalent(forall(x, exists(y, P(x, y))), forall(y, exists(x, P(y, x)))),
+                  "El intercambio de nombres ligados es α-equivalente");
+    static_assert(!alpha_equivalent(forall(x, exists(y, P(x, y))), forall(y, exists(x, P(x, y)))),
+                  "Cambiar qué cuantificador liga cada posición no es α-equivalente");
+    static_assert(!alpha_equivalent(forall(x, P(x, z)), forall(y, P(y, x))),
+                  "Las variables libres conservan su nombre");
+
+    // Test 9.2: Niveles de De Bruijn y shadowing
+    static_assert(std::is_same_v<DeBruijn_t<decltype(forall(x, P_x{} >> forall(x, Q_x{})))>,
+                                 Forall<BoundVar<0>, Implies<decltype(P(BoundVar<0>{})), Forall<BoundVar<1>, decltype(Q(BoundVar<1>{}))>>>>,
+                  "Cada cuantificador liga el nivel de su profundidad y el interior oculta al exterior");
+    static_assert(std::is_same_v<DeBruijn_t<decltype(forall(x, P(succ(x), Natural<2>{})))>,
+                                 Forall<BoundVar<0>, decltype(P(succ(BoundVar<0>{}), Natural<2>{}))>>,
+                  "La forma canónica desciende por Succ y deja las constantes");
+
+    // Test 9.3: Teorema canónico: el contexto se deduplica módulo renombrado
+    using Alpha_Theorem = Theorem<TypeList<decltype(forall(x, P_x{})), decltype(forall(y, P_y{}))>, decltype(exists(z, Q(z)))>;
+    static_assert(std::is_same_v<CanonicalTheorem_t<Alpha_Theorem>,
+                                 Theorem<TypeList<Forall<BoundVar<0>, decltype(P(BoundVar<0>{}))>>,
+                                         Exists<BoundVar<0>, decltype(Q(BoundVar<0>{}))>>>,
+                  "Las hipótesis α-equivalentes se funden en una");
+    static_assert(check_type<decltype(canonical(Alpha_Theorem{})), CanonicalTheorem_t<Alpha_Theorem>>,
+                  "canonical() devuelve el representante canónico");
+
+    // ==========================================
+    // SECCIÓN 10: RECORRIDOS GENÉRICOS (FOLD)
+    // ==========================================
+
+    // Test 10.1: Succ y Natural son nodos como los demás
+    using Step = Implies<Predicate<"P", X>, Predicate<"P", Succ<X>>>;
+    static_assert(std::is_same_v<Substitute_t<Step, X, Succ<X>>,
+                                 Implies<Predicate<"P", Succ<X>>, Predicate<"P", Succ<Succ<X>>>>>,
+                  "φ(n) → φ(S(n)) con n := S(n), como en el paso de inducción");
+    static_assert(std::is_same_v<FreeVars_t<Predicate<"P", Succ<X>, Natural<3>>>, TypeList<X>>,
+                  "FreeVars_t desciende por Succ e ignora las constantes");
+    static_assert(occurs_free_v<X, Forall<Y, Predicate<"P", Succ<X>, Y>>> &&
+                      !occurs_free_v<X, Forall<X, Predicate<"P", Succ<X>>>>,
+                  "OccursFree desciende por Succ y respeta el cuantificador");
+
+    // Test 10.2: Tamaño y profundidad
+    using R = Predicate<"R">;
+    using Measured = Forall<X, Implies<P_x, Exists<Y, And<Predicate<"Q", X, Y>, Not<R>>>>>;
+    using Renamed = Forall<Y, Implies<P_y, Exists<X, And<Predicate<"Q", Y, X>, Not<R>>>>>;
+    static_assert(formula_size_v<Measured> == 11, "Tamaño: nodos sin contar la variable de cada cuantificador");
+    static_assert(formula_depth_v<Measured> == 6, "Profundidad: el camino más largo hasta una hoja");
+    static_assert(formula_size_v<Predicate<"P", Succ<Succ<Natural<0>>>>> == 4 && formula_depth_v<Natural<7>> == 1,
+                  "Los términos también se miden");
+
+    // Test 10.3: Hash estructural
+    static_assert(formula_hash_v<Measured> != formula_hash_v<Renamed>, "El hash distingue los nombres ligados");
+    static_assert(formula_hash_v<DeBruijn_t<Measured>> == formula_hash_v<DeBruijn_t<Renamed>>,
+                  "En forma canónica, fórmulas α-equivalentes comparten hash");
+    static_assert(formula_hash_v<Predicate<"P", X, Y>> != formula_hash_v<Predicate<"P", Y, X>> &&
+                      formula_hash_v<And<P_x, Q_x>> != formula_hash_v<Or<P_x, Q_x>>,
+                  "El hash depende del orden de los hijos y del operador");
+
+    // Test 10.4: Impresión
+    static_assert(to_string(Measured{}) == "∀x. (P(x) → ∃y. (Q(x, y) ∧ ¬R))", "Notación de conectivas y cuantificadores");
+    static_assert(to_string(Predicate<"Eq", Succ<Succ<Natural<0>>>, Natural<42>>{}) == "Eq(S(S(0)), 42)",
+                  "Succ y Natural se imprimen como términos");
+    static_assert(std::is_same_v<BoundVar<12>, Var<"#12">>, "Los nombres canónicos admiten varios dígitos");
+
     return 0;
 }
@@ -0,0 +1,209 @@
+#include <logic_language/congruence.hpp>
+#include "test_support.hpp"
+
+#include <algorithm>
+#include <initializer_list>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+int main()
+{
+    logic::test::Checker check;
+
+    // ==========================================
+    // TEST 1: Frente al punto fijo ingenuo
+    // ==========================================
+    {
+        // Símbolos: 0..3 constantes, 4 = f/1, 5 = g/2, 6 = s/1 (inyectivo)
+        std::mt19937 random(3);
+        bool agree = true, explained = true;
+        for (int round = 0; round < 40; ++round)
+        {
+            CongruenceClosure cc;
+            cc.set_injective(6);
+            std::vector<CongruenceTerm> terms;
+            for (std::uint32_t c = 0; c < 4; ++c)
+                terms.push_back(cc.term(c, {}));
+            for (int i = 0; i < 40; ++i)
+            {
+                const std::uint32_t choice = random() % 3;
+                const CongruenceTerm a = terms[random() % terms.size()], b = terms[random() % terms.size()];
+                if (choice == 0)
+                    terms.push_back(cc.term(4, {{a}}));
+                else if (choice == 1)
+                    terms.push_back(cc.term(5, {{a, b}}));
+                else
+                    terms.push_back(cc.term(6, {{a}}));
+            }
+            std::vector<std::pair<CongruenceTerm, CongruenceTerm>> equations;
+            for (std::uint32_t i = 0; i < 12; ++i)
+            {
+                equations.emplace_back(terms[random() % terms.size()], terms[random() % terms.size()]);
+                cc.merge(equations.back().first, equations.back().second, i);
+            }
+
+            // Punto fijo: ecuaciones, congruencia e inyectividad hasta que no cambie nada
+            const size_t n = cc.size();
+            std::vector<size_t> naive(n);
+            std::iota(naive.begin(), naive.end(), 0);
+            const auto find = [&](size_t t) {
+                while (naive[t] != t)
+                    t = naive[t];
+                return t;
+            };
+            bool changed = true;
+            const auto unite = [&](size_t a, size_t b) {
+                a = find(a);
+                b = find(b);
+                if (a != b)
+                {
+                    naive[a] = b;
+                    changed = true;
+                }
+            };
+            while (changed)
+            {
+                changed = false;
+                for (const auto &[a, b] : equations)
+                    unite(a, b);
+                for (CongruenceTerm s = 0; s < n; ++s)
+                    for (CongruenceTerm t = 0; t < n; ++t)
+                    {
+                        if (cc.symbol(s) != cc.symbol(t) || cc.args(s).empty())
+                            continue;
+                        bool same = true;
+                        for (size_t i = 0; i < cc.args(s).size(); ++i)
+                            same &= find(cc.args(s)[i]) == find(cc.args(t)[i]);
+                        if (same)
+                            unite(s, t);
+                        if (cc.symbol(s) == 6 && find(s) == find(t))
+                            unite(cc.args(s)[0], cc.args(t)[0]);
+                    }
+            }
+
+            for (CongruenceTerm s = 0; s < n; ++s)
+                for (CongruenceTerm t = 0; t < n; ++t)
+                    agree &= cc.equal(s, t) == (find(s) == find(t));
+
+            // Con solo las ecuaciones de la explicación también sale
+            for (int query = 0; query < 10; ++query)
+            {
+                const CongruenceTerm s = random() % n, t = random() % n;
+                if (!cc.equal(s, t))
+                    continue;
+                CongruenceClosure small;
+                small.set_injective(6);
+                std::vector<CongruenceTerm> copy(n);
+                for (CongruenceTerm u = 0; u < n; ++u)
+                {
+                    std::vector<CongruenceTerm> args;
+                    for (const CongruenceTerm arg : cc.args(u))
+                        args.push_back(copy[arg]);
+                    copy[u] = small.term(cc.symbol(u), args);
+                }
+                for (const std::uint32_t tag : cc.explain(s, t))
+                    small.merge(copy[equations[tag].first], copy[equations[tag].second], tag);
+                explained &= small.equal(copy[s], copy[t]);
+            }
+        }
+        check(agree, "Mismas clases que el punto fijo ingenuo");
+        check(explained, "La explicación basta");
+    }
+
+    // ==========================================
+    // TEST 2: Desde un TermStore, con certificados
+    // ==========================================
+    {
+        TermStore store;
+        CongruenceProver prover(store);
+        prover.injective("S");
+        const NodeId a = store.constant("a"), b = store.constant("b"), c = store.constant("c"), zero = store.constant("0");
+        const auto apply = [&](std::string_view f, std::initializer_list<NodeId> args) { return store.atom(f, std::span(args.begin(), args.size())); };
+        const auto f = [&](NodeId x) { return apply("f", {x}); };
+        const auto S = [&](NodeId x) { return apply("S", {x}); };
+
+        // f³(a) = a y f⁵(a) = a dan f(a) = a
+        const NodeId three = prover.equation(f(f(f(a))), a), five = prover.equation(f(f(f(f(f(a))))), a);
+        prover.add(store.binary(NodeOp::And, three, five));
+        check(prover.equal(f(a), a) && !prover.equal(a, b), "f³(a) = a ∧ f⁵(a) = a ⊢ f(a) = a");
+        const std::vector<NodeId> why = prover.explain(f(a), a);
+        check(why.size() == 2, "Explicación con las dos ecuaciones");
+
+        // Un certificado que el ProofChecker acepta
+        ProofChecker checker(store);
+        const auto certified = [&](NodeId x, NodeId y, std::initializer_list<NodeId> inputs) {
+            ProofCertificate certificate;
+            prover.certify(x, y, certificate);
+            const CheckedTheorem theorem = checker.check(certificate);
+            bool ok = theorem.formula == prover.equation(x, y);
+            for (const NodeId hypothesis : theorem.context)
+                ok &= store[hypothesis].op == NodeOp::Forall || std::ranges::find(inputs, hypothesis) != inputs.end();
+            for (const NodeId input : inputs)
+                ok &= std::ranges::find(theorem.context, input) != theorem.context.end();
+            return ok;
+        };
+        check(certified(f(a), a, {three, five}), "Certificado de f(a) = a");
+        check(certified(a, f(f(a)), {three, five}), "Certificado de a = f(f(a))");
+        check(certified(b, b, {}), "Certificado de b = b (reflexividad)");
+
+        // S inyectiva (PA4): S(S(b)) = S(S(c)) da b = c, y con ¬Equal(b, c) hay conflicto
+        const NodeId succ = prover.equation(S(S(b)), S(S(c)));
+        prover.add(succ);
+        check(prover.equal(b, c) && prover.equal(S(b), S(c)), "Inyectividad");
+        check(certified(c, b, {succ}), "Certificado de c = b por PA4");
+        check(prover.conflict() == SymbolTable::npos, "Sin conflicto");
+        const NodeId differ = store.unary(NodeOp::Not, prover.equation(b, c));
+        prover.add(differ);
+        check(prover.conflict() == prover.equation(b, c), "¬Equal(b, c) contradice las ecuaciones");
+
+        // Congruencia con términos creados después de las ecuaciones
+        check(prover.equal(apply("g", {b, f(a)}), apply("g", {c, a})) && !prover.equal(apply("g", {b, a}), apply("g", {a, b})), "Términos nuevos");
+        check(certified(apply("g", {b, f(a)}), apply("g", {c, a}), {three, five, succ}), "Certificado con congruencia binaria");
+        check(!prover.equal(S(a), zero), "S(a) y 0 son distintos");
+
+        const auto rejects = [&](NodeId formula) {
+            try
+            {
+                prover.add(formula);
+                return false;
+            }
+            catch (const std::invalid_argument &)
+            {
+                return true;
+            }
+        };
+        check(rejects(store.binary(NodeOp::Or, three, five)), "∨ no se admite");
+        check(rejects(prover.equation(store.variable("x"), a)), "Solo términos cerrados");
+        check(prover.stats().injections >= 2 && prover.stats().congruences > 0 && prover.stats().inputs == 3, "Estadísticas");
+    }
+
+    // ==========================================
+    // TEST 3: Cadenas de congruencia profundas
+    // ==========================================
+    {
+        // a = b da f^n(a) = f^n(b) con n congruencias anidadas; el
+        // certificado se escribe sin recursión
+        constexpr size_t n = 20000;
+        TermStore store;
+        CongruenceProver prover(store);
+        NodeId left = store.constant("a"), right = store.constant("b");
+        prover.add(prover.equation(left, right));
+        for (size_t i = 0; i < n; ++i)
+        {
+            left = store.atom("f", std::span(&left, 1));
+            right = store.atom("f", std::span(&right, 1));
+            prover.equal(left, right);
+        }
+        ProofCertificate certificate;
+        prover.certify(left, right, certificate);
+        check(ProofChecker(store).check(certificate).formula == prover.equation(left, right), "Certificado de f^n(a) = f^n(b)");
+    }
+
+    return check.exit_code();
+}
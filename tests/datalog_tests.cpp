@@ -0,0 +1,179 @@
+#include <logic_language/datalog.hpp>
+#include <theorems/peano/order.hpp>
+#include "test_support.hpp"
+
+#include <initializer_list>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+int main()
+{
+    logic::test::Checker check;
+
+    // ==========================================
+    // TEST 1: Relaciones columnares e índices
+    // ==========================================
+    {
+        runtime::detail::DatalogRelation relation("R", 3);
+        std::mt19937 random(11);
+        std::vector<std::vector<DatalogValue>> rows;
+        for (int i = 0; i < 5000; ++i)
+        {
+            const std::vector<DatalogValue> tuple{static_cast<DatalogValue>(random() % 20), static_cast<DatalogValue>(random() % 20),
+                                                  static_cast<DatalogValue>(random() % 20)};
+            bool repeated = false;
+            for (const auto &row : rows)
+                repeated |= row == tuple;
+            if (relation.insert(tuple) == repeated)
+                check(false, "insert() dice si la fila es nueva");
+            if (!repeated)
+                rows.push_back(tuple);
+        }
+        check(relation.size() == rows.size() && relation.column(2).size() == rows.size(), "Sin filas repetidas");
+        check(relation.contains(rows[17]) && !relation.contains(std::vector<DatalogValue>{20, 0, 0}), "contains()");
+
+        // Índice sobre las columnas 0 y 2, extendido a trozos
+        const std::uint32_t mask = 0b101;
+        bool agree = true;
+        for (const DatalogValue a : {0u, 3u, 19u})
+            for (const DatalogValue c : {1u, 7u})
+            {
+                relation.prepare(mask);
+                const std::vector<DatalogValue> key{a, c};
+                std::vector<std::uint32_t> found, expected;
+                for (std::uint32_t row = relation.first(mask, key, runtime::detail::DatalogRelation::hash(key)); row != runtime::detail::DatalogRelation::npos;
+                     row = relation.next(mask, row))
+                    found.push_back(row);
+                for (std::uint32_t row = relation.size(); row-- > 0;)
+                    if (relation.at(row, 0) == a && relation.at(row, 2) == c)
+                        expected.push_back(row);
+                agree &= found == expected;
+                relation.insert(std::vector<DatalogValue>{a, 100, c});
+            }
+        check(agree, "El índice da las filas de la clave, de la última a la primera");
+    }
+
+    // ==========================================
+    // TEST 2: Reglas desde un TermStore
+    // ==========================================
+    {
+        TermStore store;
+        const NodeId x = store.variable("x");
+        const auto P = [&](std::string_view name, std::initializer_list<NodeId> args) { return store.atom(name, std::span(args.begin(), args.size())); };
+        const NodeId socrates = store.constant("socrates"), plato = store.constant("plato");
+
+        Datalog datalog(store);
+        datalog.add(store.binder(NodeOp::Forall, "x", store.binary(NodeOp::Implies, P("Human", {x}), P("Mortal", {x}))));
+        datalog.add(store.binary(NodeOp::And, P("Human", {socrates}), P("Human", {plato})));
+        const DatalogStats stats = datalog.run(1);
+        check(datalog.holds(P("Mortal", {socrates})) && datalog.holds(P("Mortal", {plato})), "Sócrates y Platón son mortales");
+        check(stats.derived == 2 && stats.facts == 4 && datalog.count("Mortal", 1) == 2, "Estadísticas");
+
+        // Hechos añadidos después: la siguiente ejecución solo parte de ellos
+        const NodeId aristotle = store.constant("aristotle");
+        datalog.add(P("Human", {aristotle}));
+        const DatalogStats again = datalog.run(1);
+        check(datalog.holds(P("Mortal", {aristotle})) && again.derived == 1 && again.lookups == 0, "Incremental");
+
+        // → encadenadas, varias conclusiones y ↔
+        const NodeId y = store.variable("y");
+        datalog.add(store.binary(NodeOp::Implies, P("Parent", {x, y}),
+                                 store.binary(NodeOp::Implies, P("Human", {y}), store.binary(NodeOp::And, P("Child", {y, x}), P("HasChild", {x})))));
+        datalog.add(store.binary(NodeOp::Equiv, P("Child", {x, y}), P("Offspring", {x, y})));
+        datalog.add(P("Parent", {socrates, plato}));
+        datalog.run(1);
+        check(datalog.holds(P("Child", {plato, socrates})) && datalog.holds(P("HasChild", {socrates})) && datalog.holds(P("Offspring", {plato, socrates})),
+              "→ encadenadas, ∧ en la conclusión y ↔");
+        check(!datalog.holds(P("HasChild", {plato})), "Sin conclusiones de más");
+
+        const auto rejects = [&](NodeId formula) {
+            try
+            {
+                datalog.add(formula);
+                return false;
+            }
+            catch (const std::invalid_argument &)
+            {
+                return true;
+            }
+        };
+        check(rejects(store.binary(NodeOp::Or, P("Human", {x}), P("Mortal", {x}))), "∨ no es de Horn");
+        check(rejects(store.binary(NodeOp::Implies, P("Human", {x}), P("Likes", {x, y}))), "Variable de la conclusión fuera del cuerpo");
+        check(rejects(statement_of<decltype(peano::order::succ_le_succ_iff())>(store)), "S(n) con variables");
+        check(rejects(statement_of<decltype(peano::order::zero_le())>(store)), "∀n. Le(0, n) no es un hecho cerrado");
+    }
+
+    // ==========================================
+    // TEST 3: Clausura transitiva frente a Floyd-Warshall
+    // ==========================================
+    {
+        constexpr size_t n = 60;
+        TermStore store;
+        std::vector<NodeId> nodes;
+        for (size_t i = 0; i < n; ++i)
+            nodes.push_back(store.constant("v" + std::to_string(i)));
+        std::mt19937 random(5);
+        std::vector<std::vector<bool>> reach(n, std::vector<bool>(n, false));
+        std::vector<std::pair<size_t, size_t>> edges;
+        for (size_t e = 0; e < 2 * n; ++e)
+        {
+            const size_t a = random() % n, b = random() % n;
+            edges.emplace_back(a, b);
+            reach[a][b] = true;
+        }
+        for (size_t k = 0; k < n; ++k)
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j < n; ++j)
+                    if (reach[i][k] && reach[k][j])
+                        reach[i][j] = true;
+        size_t closure = 0;
+        for (const auto &row : reach)
+            for (const bool r : row)
+                closure += r;
+
+        // lt_trans (no lineal) y su variante lineal, con 1 y 4 hilos
+        const auto solve = [&](bool linear, size_t threads, std::vector<DatalogValue> &order) {
+            Datalog datalog(store);
+            if (linear)
+            {
+                using X = Var<"x">;
+                using Y = Var<"y">;
+                using Z = Var<"z">;
+                datalog.add(reify<Forall<X, Forall<Y, Implies<Predicate<"Edge", X, Y>, Predicate<"Lt", X, Y>>>>>(store));
+                datalog.add(reify<Forall<X, Forall<Y, Forall<Z, Implies<And<Predicate<"Edge", X, Y>, Predicate<"Lt", Y, Z>>, Predicate<"Lt", X, Z>>>>>>(store));
+            }
+            else
+                datalog.add(statement_of<decltype(peano::strict_order::lt_trans())>(store));
+            for (const auto &[a, b] : edges)
+            {
+                const NodeId args[] = {nodes[a], nodes[b]};
+                datalog.add(store.atom(linear ? "Edge" : "Lt", args));
+            }
+            datalog.add(statement_of<decltype(peano::order::lt_imp_le())>(store));
+            const DatalogStats stats = datalog.run(threads);
+
+            bool agree = datalog.count("Lt", 2) == closure && datalog.count("Le", 2) == closure;
+            for (size_t i = 0; i < n; ++i)
+                for (size_t j = 0; j < n; ++j)
+                {
+                    const NodeId args[] = {nodes[i], nodes[j]};
+                    agree &= datalog.holds(store.atom("Le", args)) == reach[i][j];
+                }
+            const auto &facts = datalog.engine().facts(datalog.engine().find("Lt", 2));
+            order.assign(facts.column(0).begin(), facts.column(0).end());
+            order.insert(order.end(), facts.column(1).begin(), facts.column(1).end());
+            return agree && stats.iterations > 1 && stats.lookups > 0;
+        };
+        std::vector<DatalogValue> one, four, linear;
+        check(solve(false, 1, one), "lt_trans y lt_imp_le: la clausura");
+        check(solve(false, 4, four) && four == one, "Con 4 hilos, los mismos hechos en el mismo orden");
+        check(solve(true, 4, linear) && linear.size() == one.size(), "Variante lineal");
+    }
+
+    return check.exit_code();
+}
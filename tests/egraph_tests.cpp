@@ -0,0 +1,175 @@
+#include <logic_language/egraph.hpp>
+#include <theorems/peano/addition.hpp>
+#include "test_support.hpp"
+
+#include <array>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+int main()
+{
+    logic::test::Checker check;
+
+    // ==========================================
+    // TEST 1: Uniones, reconstrucción y búsqueda
+    // ==========================================
+    {
+        // Símbolos: 0 = a, 1 = b, 2 = f/1, 3 = g/2
+        EGraph graph;
+        const EClassId a = graph.add(0, {}), b = graph.add(1, {});
+        const EClassId fa = graph.add(2, {{a}}), fb = graph.add(2, {{b}});
+        const EClassId gab = graph.add(3, {{a, b}}), gba = graph.add(3, {{b, a}});
+        check(graph.add(2, {{a}}) == fa && graph.nodes() == 6 && graph.classes() == 6, "Nodos compartidos");
+
+        check(graph.merge(a, b) && !graph.merge(b, a), "merge() dice si une algo");
+        check(!graph.equal(fa, fb), "La congruencia espera a rebuild()");
+        graph.rebuild();
+        check(graph.equal(fa, fb) && graph.equal(gab, gba) && graph.classes() == 3 && graph.nodes() == 4, "rebuild() une los congruentes");
+        check(graph.add(2, {{b}}) == graph.find(fa), "Tras rebuild() f(b) es f(a)");
+
+        // g(x, x) coincide una vez (a y b son la misma clase); g(x, y) también
+        EPattern same;
+        const std::uint32_t x = same.variable(0);
+        const std::uint32_t xx[] = {x, x};
+        same.node(3, xx);
+        size_t found = 0;
+        graph.search(same, [&](EClassId c, std::span<const EClassId> substitution) {
+            found += graph.equal(c, gab) && substitution.size() == 1 && graph.equal(substitution[0], a);
+            return true;
+        });
+        check(found == 1, "Patrón con una variable repetida");
+
+        // instantiate: f(g(x, x)) con x = a
+        EPattern build;
+        const std::uint32_t v = build.variable(0);
+        const std::uint32_t vv[] = {v, v};
+        const std::uint32_t g = build.node(3, vv);
+        build.node(2, std::span<const std::uint32_t>(&g, 1));
+        const EClassId fg = graph.instantiate(build, std::span<const EClassId>(&a, 1));
+        check(graph.symbol(graph.members(fg)[0]) == 2 && graph.equal(graph.children(graph.members(fg)[0])[0], gab), "instantiate()");
+    }
+
+    // ==========================================
+    // TEST 2: Reglas de peano/ y extracción
+    // ==========================================
+    {
+        using namespace logic::peano;
+        TermStore store;
+        EqualitySaturation saturation(store);
+        check(saturation.add_equivalence("succ_lt_succ_iff", statement_of<decltype(strict_order::succ_lt_succ_iff())>(store)) == 2, "Dos reglas");
+        check(saturation.add_equivalence("succ_le_succ_iff", statement_of<decltype(order::succ_le_succ_iff())>(store)) == 2, "Dos reglas de Le");
+        check(saturation.add_equivalence("le_iff_lt_succ", statement_of<decltype(order::le_iff_lt_succ())>(store)) == 2, "le_iff_lt_succ");
+        check(saturation.add_equivalence("add_comm", statement_of<decltype(addition::add_comm())>(store)) == 2, "add_comm");
+        check(saturation.add_equivalence("add_assoc", statement_of<decltype(addition::add_assoc())>(store)) == 2, "add_assoc con ∃");
+        // ∀x. P(x) ↔ Q: solo P(x) → Q liga todas las variables del otro lado
+        const NodeId px = store.atom("P", std::span<const NodeId>(std::array{store.variable("x")}));
+        check(saturation.add_equivalence("p_iff_q", store.binder(NodeOp::Forall, "x", store.binary(NodeOp::Equiv, px, store.atom("Q", {})))) == 1,
+              "Una sola dirección");
+
+        bool rejected = false;
+        try
+        {
+            saturation.add_equivalence("add_zero", statement_of<decltype(addition::add_zero())>(store));
+        }
+        catch (const std::invalid_argument &)
+        {
+            rejected = true;
+        }
+        check(rejected, "Solo lemas ∀x̄. L ↔ R");
+
+        const NodeId a = store.constant("a"), b = store.constant("b"), c = store.constant("c"), d = store.constant("d");
+        const auto apply = [&](std::string_view f, std::initializer_list<NodeId> args) { return store.atom(f, std::span(args.begin(), args.size())); };
+        const auto S = [&](NodeId x) { return apply("S", {x}); };
+        const NodeId deep = apply("Lt", {S(S(S(a))), S(S(S(b)))});
+        const NodeId le = apply("Le", {S(a), b});
+        const NodeId p = store.variable("p"), q = store.variable("q");
+        const NodeId left = store.binder(NodeOp::Exists, "p", store.binary(NodeOp::And, apply("Add", {a, b, p}), apply("Add", {p, c, d})));
+        const NodeId right = store.binder(NodeOp::Exists, "q", store.binary(NodeOp::And, apply("Add", {b, c, q}), apply("Add", {a, q, d})));
+        // Con una q libre, ∃q en la derecha la capturaría
+        const NodeId free_q = store.binder(NodeOp::Exists, "p", store.binary(NodeOp::And, apply("Add", {q, b, p}), apply("Add", {p, c, d})));
+        for (const NodeId term : {deep, le, left, free_q})
+            saturation.add(term);
+
+        // succ_lt_succ_iff ← da Lt(S(n), S(m)) desde Lt(n, m) sin fin: se
+        // para por el número de vueltas
+        SaturationOptions options;
+        options.max_iterations = 10;
+        const SaturationReport report = saturation.saturate(options);
+        check(report.stop == SaturationStop::IterationLimit && report.iterations == 10 && report.history.size() == 10, "Límite de vueltas");
+        check(report.nodes == saturation.engine().nodes() && report.classes == saturation.engine().classes() && report.unions > 0 &&
+                  report.history.back().nodes == report.nodes,
+              "Informe");
+        check(saturation.equivalent(deep, apply("Lt", {a, b})), "Lt(S³a, S³b) ↔ Lt(a, b)");
+        check(saturation.extract(deep) == apply("Lt", {a, b}), "Extrae Lt(a, b)");
+        check(saturation.equivalent(le, apply("Lt", {a, b})) && saturation.extract(le) == apply("Lt", {a, b}), "Le(S(a), b) ↔ Lt(a, b)");
+        check(saturation.equivalent(left, right), "add_assoc bajo ∃");
+        const NodeId swapped = store.binder(NodeOp::Exists, "p", store.binary(NodeOp::And, apply("Add", {b, a, p}), apply("Add", {c, p, d})));
+        check(saturation.equivalent(left, swapped), "add_comm bajo ∃");
+        const NodeId captured = store.binder(NodeOp::Exists, "q", store.binary(NodeOp::And, apply("Add", {b, c, q}), apply("Add", {q, q, d})));
+        check(!saturation.equivalent(free_q, captured), "Sin captura de variables");
+
+        // Con Lt cara, la forma más barata de Lt(a, b) es Le(S(a), b)
+        saturation.weight("Lt", 10.0);
+        check(saturation.extract(deep) == le, "Pesos en la extracción");
+    }
+
+    // ==========================================
+    // TEST 3: Retroceso y límites
+    // ==========================================
+    {
+        // x ∧ y ↔ y ∧ x y (x ∧ y) ∧ z ↔ x ∧ (y ∧ z) sobre una conjunción de 8
+        // átomos: el número de formas crece deprisa
+        TermStore store;
+        const NodeId x = store.variable("x"), y = store.variable("y"), z = store.variable("z");
+        const auto conj = [&](NodeId l, NodeId r) { return store.binary(NodeOp::And, l, r); };
+        const auto rules = [&](EqualitySaturation &saturation) {
+            saturation.add_rewrite("and_comm", conj(x, y), conj(y, x));
+            saturation.add_rewrite("and_assoc", conj(conj(x, y), z), conj(x, conj(y, z)));
+            saturation.add_rewrite("and_assoc ←", conj(x, conj(y, z)), conj(conj(x, y), z));
+        };
+        NodeId formula = store.atom("P0", {});
+        for (int i = 1; i < 8; ++i)
+            formula = conj(formula, store.atom("P" + std::to_string(i), {}));
+
+        EqualitySaturation banned(store);
+        rules(banned);
+        check(!banned.add_rewrite("var", x, conj(x, x)) && !banned.add_rewrite("free", conj(x, y), z) && banned.rules().size() == 3, "Reglas inválidas");
+        banned.add(formula);
+        SaturationOptions options;
+        options.match_limit = 50;
+        options.max_iterations = 12;
+        const SaturationReport report = banned.saturate(options);
+        size_t bans = 0;
+        for (const SaturationIteration &step : report.history)
+            bans += step.banned;
+        check(bans > 0, "Las reglas con demasiadas coincidencias se prohíben");
+        check(banned.extract(formula) != SymbolTable::npos && banned.engine().cost(banned.add(formula)) == 15.0, "El tamaño no cambia");
+
+        // Con 4 átomos satura: una clase por cada conjunto no vacío de átomos
+        EqualitySaturation small(store);
+        rules(small);
+        const NodeId four = conj(conj(conj(store.atom("P0", {}), store.atom("P1", {})), store.atom("P2", {})), store.atom("P3", {}));
+        small.add(four);
+        const SaturationReport saturated = small.saturate();
+        check(saturated.stop == SaturationStop::Saturated && saturated.history.back().unions == 0 && saturated.classes == 15, "Satura");
+        check(small.equivalent(four, conj(store.atom("P3", {}), conj(store.atom("P1", {}), conj(store.atom("P2", {}), store.atom("P0", {}))))),
+              "Conmutativa y asociativa");
+
+        EqualitySaturation limited(store);
+        rules(limited);
+        limited.add(formula);
+        options.match_limit = 1000000;
+        options.max_nodes = 500;
+        options.max_iterations = 100;
+        const SaturationReport stopped = limited.saturate(options);
+        check(stopped.stop == SaturationStop::NodeLimit && stopped.nodes > 500, "Límite de nodos");
+    }
+
+    return check.exit_code();
+}
@@ -0,0 +1,130 @@
+#include <logic_language/formula_arena.hpp>
+#include <type_traits>
+
+using namespace logic;
+using namespace logic::runtime;
+
+using X = Var<"x">;
+using Y = Var<"y">;
+using R = Predicate<"R">;
+using F = Forall<X, Implies<Predicate<"P", X>, Exists<Y, And<Predicate<"Q", X, Y>, Not<R>>>>>;
+using T = Predicate<"Eq", Succ<Succ<Natural<0>>>, Natural<42>>;
+
+// Construcción a mano en el mismo postorden que reify<F>()
+constexpr FormulaArena by_hand()
+{
+    FormulaArena arena;
+    const NodeId x = arena.variable("x");
+    const NodeId px = arena.atom("P", std::array{x});
+    const NodeId x2 = arena.variable("x");
+    const NodeId y = arena.variable("y");
+    const NodeId qxy = arena.atom("Q", std::array{x2, y});
+    const NodeId r = arena.atom("R", {});
+    const NodeId body = arena.binary(NodeOp::And, qxy, arena.unary(NodeOp::Not, r));
+    arena.binder(NodeOp::Forall, "x", arena.binary(NodeOp::Implies, px, arena.binder(NodeOp::Exists, "y", body)));
+    return arena;
+}
+
+constexpr bool same_nodes(const FormulaArena &a, const FormulaArena &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (NodeId id = 0; id < a.size(); ++id)
+    {
+        if (a[id].op != b[id].op || a.label(id) != b.label(id) || !std::ranges::equal(a.children(id), b.children(id)))
+            return false;
+        if (is_binder(a[id].op) && a.symbols().name(a[id].symbol) != b.symbols().name(b[id].symbol))
+            return false;
+    }
+    return true;
+}
+
+// Un índice que todavía no existe no es una expresión constante
+template <NodeId Child>
+constexpr bool accepts_child()
+{
+    FormulaArena arena;
+    arena.variable("x");
+    arena.unary(NodeOp::Not, Child);
+    return true;
+}
+
+template <NodeId Child>
+concept ValidChild = requires { typename std::integral_constant<bool, accepts_child<Child>()>; };
+
+int main()
+{
+    // ==========================================
+    // TEST 1: Tabla de símbolos
+    // ==========================================
+    static_assert([] {
+        SymbolTable table;
+        const SymbolId x = table.intern("x");
+        const SymbolId p = table.intern("P");
+        return x == 0 && p == 1 && table.intern("x") == x && table.size() == 2 && table.name(p) == "P" &&
+               table.find("Q") == SymbolTable::npos;
+    }(), "Cada nombre distinto recibe un identificador denso");
+
+    static_assert([] {
+        SymbolTable table;
+        for (int i = 0; i < 300; ++i)
+            table.intern(std::string(1 + i % 7, static_cast<char>('a' + i % 26)) + static_cast<char>('0' + i / 26));
+        for (int i = 0; i < 300; ++i)
+            if (table.find(std::string(1 + i % 7, static_cast<char>('a' + i % 26)) + static_cast<char>('0' + i / 26)) != SymbolId(i))
+                return false;
+        return table.size() == 300;
+    }(), "La tabla conserva los identificadores al crecer");
+
+    // ==========================================
+    // TEST 2: Reificación
+    // ==========================================
+    static_assert(sizeof(Node) == 16, "Nodos de 16 bytes");
+    static_assert(reify<F>().size() == formula_size_v<F>, "Un nodo por subfórmula (las variables ligadas son símbolos)");
+    static_assert(same_nodes(reify<F>(), by_hand()), "reify<F>() produce el postorden de F");
+    static_assert(reify<F>()[reify<F>().root()].op == NodeOp::Forall, "La raíz es el último nodo");
+    static_assert(reify<F>().symbols().size() == 5, "x, P, y, Q y R se internan una sola vez");
+
+    static_assert([] {
+        const FormulaArena arena = reify<F>();
+        for (NodeId id = 0; id < arena.size(); ++id)
+            for (NodeId child : arena.children(id))
+                if (child >= id)
+                    return false;
+        return true;
+    }(), "Los hijos siempre preceden al padre");
+
+    // Succ es un símbolo de función y Natural<N> una constante
+    static_assert([] {
+        const FormulaArena arena = reify<T>();
+        return arena.size() == 5 && arena[0].op == NodeOp::Constant && arena.label(0) == "0" &&
+               arena[1].op == NodeOp::Atom && arena.label(1) == "S" && arena.label(3) == "42";
+    }(), "Succ y Natural también se reifican");
+
+    // ==========================================
+    // TEST 3: Texto
+    // ==========================================
+    static_assert(reify<F>().text() == to_string(F{}), "Misma notación que to_string");
+    static_assert(reify(T{}).text() == "Eq(S(S(0)), 42)", "Los términos se imprimen como llamadas");
+    static_assert([] {
+        FormulaArena arena;
+        const NodeId p = reify<Predicate<"P", X>>(arena);
+        const NodeId q = reify<Predicate<"Q", Y>>(arena);
+        return arena.text(p) == "P(x)" && arena.text(q) == "Q(y)" && arena.text() == "Q(y)";
+    }(), "Varias fórmulas comparten arena y tabla de símbolos");
+    static_assert([] {
+        FormulaArena arena;
+        const std::array<NodeId, 2> xs{arena.variable("x"), arena.variable("x")};
+        NodeId atom = arena.atom("P", xs);
+        for (int i = 0; i < 64; ++i)
+            atom = arena.atom("P", arena.children(atom));
+        return arena.text(atom) == "P(x, x)";
+    }(), "Un átomo puede tomar los argumentos de otro de la misma arena");
+
+    // ==========================================
+    // TEST 4: Errores
+    // ==========================================
+    static_assert(ValidChild<0>, "Un hijo existente se acepta");
+    static_assert(!ValidChild<1>, "Un hijo que todavía no existe se rechaza");
+
+    return 0;
+}
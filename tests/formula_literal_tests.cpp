@@ -0,0 +1,77 @@
+#include <logic_language/formula_literal.hpp>
+#include <theorems/peano/axioms.hpp>
+#include <type_traits>
+
+using namespace logic;
+
+// BY_AXIOM(φ) demuestra φ → φ: el enunciado es el consecuente
+template <typename Thm>
+using formula_of = typename Thm::formula_type::Right;
+
+using X = Var<"x">;
+using Y = Var<"y">;
+
+// ==========================================
+// TEST 1: Los axiomas de peano/ escritos como texto
+// ==========================================
+static_assert(std::is_same_v<Formula_t<"Natural(0)">, formula_of<decltype(peano::PA1())>>, "PA1");
+static_assert(std::is_same_v<Formula_t<"forall n. Natural(n) -> Natural(S(n))">, formula_of<decltype(peano::PA2())>>, "PA2");
+static_assert(std::is_same_v<Formula_t<"forall n. Natural(n) -> ~(S(n) = 0)">, formula_of<decltype(peano::PA3())>>, "PA3");
+static_assert(std::is_same_v<Formula_t<"forall n m. Natural(n) & Natural(m) & S(n) = S(m) -> n = m">, formula_of<decltype(peano::PA4())>>,
+              "PA4");
+static_assert(std::is_same_v<Formula_t<"forall k. ~(k = S(k))">, formula_of<decltype(peano::neq_succ())>>, "neq_succ");
+static_assert(std::is_same_v<Formula_t<"forall n m k. Natural(n) & Natural(m) & Plus(n, m, k) -> Plus(n, S(m), S(k))">,
+                             formula_of<decltype(peano::plus_succ())>>,
+              "plus_succ");
+static_assert(std::is_same_v<Formula_t<"forall n m k p. Natural(n) & Natural(m) & Times(n, m, k) & Plus(k, n, p) -> Times(n, S(m), p)">,
+                             formula_of<decltype(peano::times_succ())>>,
+              "times_succ");
+
+// La sintaxis del DSL también vale
+static_assert(std::is_same_v<Formula_t<"forall(n, m, (Natural(n) && Natural(m) && Equal(S(n), S(m))) >> Equal(n, m))">,
+                             formula_of<decltype(peano::PA4())>>,
+              "Mismo tipo con la sintaxis de C++");
+
+// ==========================================
+// TEST 2: Conectivas y precedencia
+// ==========================================
+using Px = Predicate<"P", X>;
+using Qx = Predicate<"Q", X>;
+using R = Predicate<"R">;
+
+static_assert(std::is_same_v<Formula_t<"P(x) -> Q(x) -> R">, Implies<Px, Implies<Qx, R>>>, "-> asocia por la derecha");
+static_assert(std::is_same_v<Formula_t<"P(x) | Q(x) & R <-> R">, Equiv<Or<Px, And<Qx, R>>, R>>, "<-> < | < &");
+static_assert(std::is_same_v<Formula_t<"P(x) & Q(x) || R">, And<Px, Or<Qx, R>>>, "La notación matemática liga menos que la de C++");
+static_assert(std::is_same_v<Formula_t<"∀x. ∃y. (Q(x, y) ∧ ¬R)">, Forall<X, Exists<Y, And<Predicate<"Q", X, Y>, Not<R>>>>>,
+              "Notación de to_string");
+static_assert(std::is_same_v<Formula_t<"(forall x. P(x)) & R">, And<Forall<X, Px>, R>>, "El cuerpo de forall x. llega hasta el final");
+static_assert(std::is_same_v<Formula_t<"to_string(x)">, Predicate<"to_string", X>>, "Cualquier predicado");
+
+// ==========================================
+// TEST 3: Términos
+// ==========================================
+static_assert(std::is_same_v<Formula_t<"Le(S(S(0)), 42)">, Predicate<"Le", Succ<Succ<Natural<0>>>, Natural<42>>>, "Numerales y sucesor");
+static_assert(std::is_same_v<Formula_t<"S(x)">, Predicate<"S", X>>, "En posición de fórmula S es un predicado");
+static_assert(std::is_same_v<Formula_t<"P(f(x, y))">, Predicate<"P", Predicate<"f", X, Y>>>, "Otros símbolos de función");
+static_assert(std::is_same_v<Formula_t<"x = y">, Equal<X, Y>>, "Igualdad entre variables");
+
+// ==========================================
+// TEST 4: Literales en el DSL
+// ==========================================
+static_assert(std::is_same_v<decltype("P(x) >> Q(x)"_formula >> R{}), Implies<Implies<Px, Qx>, R>>, "Se combinan con los operadores");
+static_assert(to_string("forall n. n = n"_formula) == "∀n. Equal(n, n)", "Y se imprimen como cualquier fórmula");
+
+// ==========================================
+// TEST 5: Mismo árbol que runtime::parse_formula
+// ==========================================
+template <FixedString Source>
+constexpr bool agrees = runtime::reify<Formula_t<Source>>().text() == runtime::parse_formula(Source.buf).text();
+
+static_assert(agrees<"forall n m. ~P(n) & Q(m) | R -> n = S(m) <-> 0 = m">, "Notación matemática");
+static_assert(agrees<"exists(x, y, P(x) >> !Q(y) || R == R)">, "Notación de C++");
+static_assert(agrees<"∀x. (P(x) → ∃y. ¬(x = y))">, "Notación de to_string");
+
+int main()
+{
+    return 0;
+}
@@ -0,0 +1,183 @@
+#include <logic_language/lemma_batch.hpp>
+#include "test_support.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+using A = Predicate<"A">;
+using B = Predicate<"B">;
+using C = Predicate<"C">;
+using D = Predicate<"D">;
+
+// Γ ⊢ conclusion por modus ponens de dos hipótesis asumidas
+ProofCertificate mp(TermStore &store, NodeId antecedent, NodeId conclusion)
+{
+    ProofCertificate certificate;
+    certificate.modus_ponens(certificate.assume(antecedent), certificate.assume(store.binary(NodeOp::Implies, antecedent, conclusion)));
+    return certificate;
+}
+
+int main()
+{
+    logic::test::Checker check;
+
+    // ==========================================
+    // TEST 1: Work stealing
+    // ==========================================
+    {
+        // Un árbol binario de 2^12 − 1 tareas que nacen unas de otras
+        WorkStealingPool pool(4);
+        std::vector<std::atomic<int>> runs(4096);
+        const std::uint32_t root = 1;
+        pool.run(std::span<const std::uint32_t>(&root, 1), [&](std::uint32_t task, size_t worker) {
+            runs[task].fetch_add(1);
+            if (2 * task + 1 < runs.size())
+            {
+                pool.push(worker, 2 * task);
+                pool.push(worker, 2 * task + 1);
+            }
+        });
+        bool once = true;
+        for (std::uint32_t task = 1; task < runs.size(); ++task)
+            once &= runs[task].load() == 1;
+        check(once && runs[0].load() == 0, "Cada tarea se ejecuta una vez");
+
+        bool thrown = false;
+        try
+        {
+            WorkStealingPool(2).run(std::span<const std::uint32_t>(&root, 1), [](std::uint32_t, size_t) { throw std::runtime_error("x"); });
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        check(thrown, "Las excepciones de las tareas llegan al que llama");
+
+        // Mientras una tarea espera, los otros tres hilos duermen en vez de
+        // girar: el proceso apenas gasta CPU
+        const std::clock_t start = std::clock();
+        WorkStealingPool(4).run(std::span<const std::uint32_t>(&root, 1),
+                                [](std::uint32_t, size_t) { std::this_thread::sleep_for(std::chrono::milliseconds(300)); });
+        check(static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC < 0.1, "Los hilos sin trabajo no gastan CPU");
+    }
+
+    // ==========================================
+    // TEST 2: DAG de lemas
+    // ==========================================
+    {
+        TermStore store;
+        const NodeId a = reify<A>(store), b = reify<B>(store), c = reify<C>(store), d = reify<D>(store);
+        LemmaLibrary library(store);
+        library.axiom(a);
+        library.axiom(store.binary(NodeOp::Implies, a, b));
+        library.axiom(store.binary(NodeOp::Implies, b, c));
+
+        const auto later = library.add("c_from_b", c, mp(store, b, c));     // Depende de b_from_a, añadido después
+        const auto first = library.add("b_from_a", b, mp(store, a, b));     // Solo axiomas
+        const auto wrong = library.add("wrong", d, mp(store, a, b));        // Concluye B, no D
+        const auto skipped = library.add("skipped", c, mp(store, d, c));    // Asume D, el enunciado de wrong
+        const auto loose = library.add("loose", c, mp(store, a, c));        // A → C no es axioma ni lema
+        const auto cycle1 = library.add("cycle1", store.binary(NodeOp::And, a, d), mp(store, store.binary(NodeOp::Or, a, d), store.binary(NodeOp::And, a, d)));
+        const auto cycle2 = library.add("cycle2", store.binary(NodeOp::Or, a, d), mp(store, store.binary(NodeOp::And, a, d), store.binary(NodeOp::Or, a, d)));
+        const auto identity = library.add("identity", traced_axiom_identity(A{}));
+
+        for (size_t threads : {size_t{1}, size_t{4}})
+        {
+            const BatchReport report = library.check(threads);
+            const auto &lemmas = report.lemmas;
+            check(report.threads == threads && lemmas.size() == library.size(), "Un resultado por lema");
+            check(lemmas[first].status == LemmaStatus::Valid && lemmas[later].status == LemmaStatus::Valid, "Lemas válidos");
+            check(lemmas[later].dependencies == std::vector<std::uint32_t>{first}, "Dependencia deducida de las hipótesis");
+            check(lemmas[later].start >= lemmas[first].finish && lemmas[later].ready == lemmas[first].finish,
+                  "Un lema empieza cuando termina su dependencia");
+            check(lemmas[wrong].status == LemmaStatus::Invalid, "Conclusión distinta del enunciado");
+            check(lemmas[skipped].status == LemmaStatus::Skipped && lemmas[skipped].dependencies == std::vector<std::uint32_t>{wrong},
+                  "Un lema que depende de uno inválido no se comprueba");
+            check(lemmas[loose].status == LemmaStatus::Invalid && lemmas[loose].message.starts_with("hipótesis sin justificar"),
+                  "Hipótesis que no es axioma ni lema");
+            check(lemmas[cycle1].status == LemmaStatus::Circular && lemmas[cycle2].status == LemmaStatus::Circular, "Ciclo");
+            check(lemmas[identity].status == LemmaStatus::Valid, "Lema exportado del kernel de tipos");
+            check(report.count(LemmaStatus::Valid) == 3 && report.seconds >= lemmas[later].finish, "Resumen del lote");
+        }
+    }
+
+    // ==========================================
+    // TEST 3: Comprobación incremental
+    // ==========================================
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "logic_lemma_cache_tests.bin";
+        std::filesystem::remove(path);
+
+        // Cada ejecución usa un almacén nuevo, como un proceso nuevo: las
+        // claves no dependen de los NodeId. `detour` cambia la demostración
+        // de b_from_a (pasa por ⊢ A → A) sin cambiar su enunciado.
+        auto run = [&](bool detour, bool with_axiom, LemmaCache &cache) {
+            TermStore store;
+            const NodeId a = reify<A>(store), b = reify<B>(store), c = reify<C>(store);
+            const NodeId ab = store.binary(NodeOp::Implies, a, b);
+            LemmaLibrary library(store);
+            if (with_axiom)
+                library.axiom(a);
+            library.axiom(ab);
+            library.axiom(store.binary(NodeOp::Implies, b, c));
+
+            ProofCertificate first;
+            StepId antecedent = first.assume(a);
+            if (detour)
+                antecedent = first.modus_ponens(antecedent, first.axiom_identity(a));
+            first.modus_ponens(antecedent, first.assume(ab));
+            library.add("b_from_a", b, std::move(first));
+            library.add("c_from_b", c, mp(store, b, c));
+            library.add("identity", traced_axiom_identity(A{}));
+            return library.check(cache, 2);
+        };
+
+        LemmaCache cold(path.string());
+        check(cold.size() == 0, "Sin fichero, caché vacía");
+        BatchReport report = run(false, true, cold);
+        check(report.count(LemmaStatus::Valid) == 3 && report.cached() == 0 && cold.size() == 3, "Primera ejecución: se comprueba todo");
+        cold.save();
+
+        LemmaCache warm(path.string());
+        check(warm.size() == 3, "La caché se lee del disco");
+        report = run(false, true, warm);
+        check(report.count(LemmaStatus::Valid) == 3 && report.cached() == 3, "Sin cambios no se comprueba nada");
+
+        report = run(true, true, warm);
+        check(report.count(LemmaStatus::Valid) == 3 && report.cached() == 2 && !report.lemmas[0].cached,
+              "Otra demostración del mismo enunciado: solo se comprueba ese lema");
+        check(warm.size() == 3 && warm.contains(report.lemmas[0].key), "La caché guarda la clave nueva");
+
+        report = run(true, false, warm);
+        check(report.lemmas[0].status == LemmaStatus::Invalid && report.lemmas[1].status == LemmaStatus::Skipped &&
+                  report.lemmas[2].cached,
+              "Sin el axioma la clave cambia y el dependiente se omite aunque esté en la caché");
+
+        // Un fichero truncado o de otra versión es una caché vacía
+        const auto size = std::filesystem::file_size(path);
+        std::filesystem::resize_file(path, size - 1);
+        check(LemmaCache(path.string()).size() == 0, "Fichero truncado");
+        std::ofstream(path, std::ios::binary) << "LOGICCHK";
+        check(LemmaCache(path.string()).size() == 0, "Cabecera incompleta");
+        {
+            // Cabecera válida que anuncia más claves de las que hay
+            std::ofstream out(path, std::ios::binary);
+            const std::uint64_t fields[2] = {1, std::uint64_t{1} << 60};
+            out.write("LOGICCHK", 8);
+            out.write(reinterpret_cast<const char *>(fields), sizeof(fields));
+        }
+        check(LemmaCache(path.string()).size() == 0, "Cuenta mayor que el fichero");
+
+        std::filesystem::remove(path);
+    }
+
+    return check.exit_code();
+}
@@ -59,8 +59,8 @@ int main()
 
     // Verificar fusión de contextos
     using ResultContext = typename decltype(thm_result)::context_type;
-    // El orden depende de la implementación de Concat, normalmente {P, P->Q}
-    using ExpectedContext = TypeList<P_x, ImpliesPQ>;
+    // El contexto es canónico: mismo conjunto {P, P->Q}, orden fijado por la clave de tipo
+    using ExpectedContext = CanonicalContext_t<TypeList<P_x, ImpliesPQ>>;
     
     static_assert(std::is_same_v<ResultContext, ExpectedContext>, "Modus Ponens debería fusionar contextos");
     static_assert(check_type<typename decltype(thm_result)::formula_type, Q_x>, "MP debería deducir Q(x)");
@@ -85,5 +85,31 @@ int main()
        (Esto requeriría regla de Monotonicidad/Debilitamiento: Gamma |- P => Gamma, Delta |- P)
     */
 
+
+    // ==========================================
+    // TEST 4: Reutilización de lemas módulo α
+    // ==========================================
+    // Con LOGIC_ALPHA_CANONICAL las reglas trabajan sobre formas canónicas:
+    // asumir ∀x. P(x) o ∀y. P(y) da el mismo teorema, y MP acepta premisas
+    // que solo coinciden módulo renombrado.
+    constexpr auto y = "y"_var;
+    using All_P_x = decltype(forall(x, P(x)));
+    using All_P_y = decltype(forall(y, P(y)));
+    static_assert(alpha_equivalent_v<All_P_x, All_P_y>, "∀x. P(x) y ∀y. P(y) deberían ser α-equivalentes");
+
+#if LOGIC_ALPHA_CANONICAL
+    constexpr auto thm_all_x = assume<All_P_x>();
+    static_assert(check_type<decltype(thm_all_x), decltype(assume<All_P_y>())>,
+                  "Hipótesis α-equivalentes deberían dar el mismo teorema");
+
+    constexpr auto thm_all_impl = assume<Implies<All_P_y, Q_x>>();
+    constexpr auto thm_alpha_mp = modus_ponens(thm_all_x, thm_all_impl);
+    static_assert(check_type<typename decltype(thm_alpha_mp)::formula_type, Q_x>, "MP debería aplicarse módulo α");
+
+    constexpr auto thm_inst = universal_instantiation(generalization(y, thm_all_x), Natural<0>{});
+    static_assert(std::is_same_v<typename decltype(thm_inst)::formula_type, DeBruijn_t<All_P_x>>,
+                  "El resultado de cada regla debería estar en forma canónica");
+#endif
+
     return 0;
 }
\ No newline at end of file
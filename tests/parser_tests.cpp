@@ -0,0 +1,147 @@
+#include <logic_language/mapped_file.hpp>
+#include <logic_language/parser.hpp>
+#include <logic_language/term_store.hpp>
+#include <theorems/peano/axioms.hpp>
+#include "test_support.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+using namespace logic;
+using namespace logic::runtime;
+
+// BY_AXIOM(φ) demuestra φ → φ: el enunciado es el consecuente
+template <typename Thm>
+using formula_of = typename Thm::formula_type::Right;
+
+using X = Var<"x">;
+using Y = Var<"y">;
+using F = Forall<X, Implies<Predicate<"P", X>, Exists<Y, And<Predicate<"Q", X, Y>, Not<Predicate<"R">>>>>>;
+
+// ¿Lanza ParseError en la línea y columna dadas?
+bool fails_at(std::string_view text, size_t line, size_t column)
+{
+    try
+    {
+        parse_formula(text);
+    }
+    catch (const ParseError &error)
+    {
+        return error.line() == line && error.column() == column;
+    }
+    return false;
+}
+
+int main()
+{
+    logic::test::Checker check;
+
+    // ==========================================
+    // TEST 1: Sintaxis del DSL (en compilación)
+    // ==========================================
+    static_assert(parse_formula("forall(x, P(x) >> exists(y, Q(x, y) && !R))").text() == to_string(F{}),
+                  "Misma fórmula que el DSL");
+    static_assert(parse_formula("forall(n, m, Eq(S(n), S(m)) >> Eq(n, m))").text() == "∀n. ∀m. (Eq(S(n), S(m)) → Eq(n, m))",
+                  "forall con varias variables anida un cuantificador por variable");
+    static_assert(parse_formula("a && b >> c || d == e").text() == "((a ∧ (b → c)) ∨ (d ↔ e))",
+                  "Precedencia de C++: >> antes que ==, && y ||");
+    static_assert(parse_formula("a >> b >> c").text() == "((a → b) → c)", "Asociatividad por la izquierda, como en C++");
+    static_assert(parse_formula("!!P(x, 42)").text() == "¬¬P(x, 42)", "Negación y numerales");
+    static_assert(parse_formula(to_string(F{})).text() == to_string(F{}), "También lee la notación de to_string");
+    static_assert(parse_formula("// comentario\n  P(x') ").text() == "P(x')", "Espacios, comentarios y nombres con '");
+    static_assert(parse_formula("forall n m. ~P(n) & Q(m) | R -> n = S(m) <-> 0 = m").text() ==
+                      "∀n. ∀m. ((((¬P(n) ∧ Q(m)) ∨ R) → Equal(n, S(m))) ↔ Equal(0, m))",
+                  "Notación matemática: <-> < -> < | < &, ~, = y forall x y.");
+    static_assert(parse_formula("a -> b -> c").text() == "(a → (b → c))", "-> asocia por la derecha");
+    static_assert(parse_formula("a & b && c").text() == "(a ∧ (b ∧ c))", "La notación matemática liga menos que la de C++");
+
+    // Más argumentos y variables que los que la pila guarda sin memoria dinámica
+    static_assert(parse_formula("forall(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q, "
+                                "P(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q, S(q)))")
+                          .text() == "∀a. ∀b. ∀c. ∀d. ∀e. ∀f. ∀g. ∀h. ∀i. ∀j. ∀k. ∀l. ∀m. ∀n. ∀o. ∀p. ∀q. "
+                                     "P(a, b, c, d, e, f, g, h, i, j, k, l, m, n, o, p, q, S(q))",
+                  "Diecisiete variables y dieciocho argumentos");
+
+    // Un nombre solo es un predicado en posición de fórmula y una variable
+    // en posición de término
+    static_assert([] {
+        const FormulaArena arena = parse_formula("R(R) && R");
+        return arena[0].op == NodeOp::Variable && arena[1].op == NodeOp::Atom && arena[2].op == NodeOp::Atom &&
+               arena.children(2).empty();
+    }(), "Variables y predicados sin argumentos");
+
+    // ==========================================
+    // TEST 2: Mismos nodos que reify
+    // ==========================================
+    {
+        TermStore store;
+        using PA3 = formula_of<decltype(peano::PA3())>;
+        using PlusSucc = formula_of<decltype(peano::plus_succ())>;
+        check(parse_formula("forall(n, Natural(n) >> !Equal(S(n), 0))", store) == reify<PA3>(store),
+              "El texto de PA3 y el tipo de PA3 son el mismo nodo");
+        check(parse_formula("forall(n, m, k, (Natural(n) && Natural(m) && Plus(n, m, k)) >> Plus(n, S(m), S(k)))", store) ==
+                  reify<PlusSucc>(store),
+              "También con guardas conjuntivas y varias variables");
+        check(parse_formula(to_string(PlusSucc{}), store) == reify<PlusSucc>(store), "to_string y parse son inversas");
+    }
+
+    // ==========================================
+    // TEST 3: Documentos
+    // ==========================================
+    {
+        FormulaArena arena;
+        const std::string_view source = "// Peano\n"
+                                        "PA1: Natural(0);\n"
+                                        "PA2: forall(n, Natural(n) >> Natural(S(n)));;\n"
+                                        "P(x) || Q(x)";
+        const std::vector<Statement> statements = parse_statements(source, arena);
+        check(statements.size() == 3, "Tres enunciados");
+        check(statements[0].name == "PA1" && statements[1].name == "PA2" && statements[2].name.empty(), "Nombres opcionales");
+        check(statements[0].name.data() == source.data() + 9, "Los nombres son vistas sobre la fuente");
+        check(arena.text(statements[1].formula) == "∀n. (Natural(n) → Natural(S(n)))", "Cada enunciado tiene su raíz");
+
+        Parser<FormulaArena> parser("a; b", arena);
+        check(parser.next() && parser.next() && !parser.next() && parser.done(), "Lectura incremental");
+    }
+
+    // ==========================================
+    // TEST 4: Errores
+    // ==========================================
+    check(fails_at("P(x) >> ", 1, 9), "Fórmula incompleta");
+    check(fails_at("P(x)\n  $ Q", 2, 3), "Carácter inesperado en la línea 2");
+    check(fails_at("forall(P(x))", 1, 8), "forall sin variables");
+    check(fails_at("P(x) Q(x)", 1, 6), "Falta ';' entre enunciados");
+    check(fails_at("forall x y P(x)", 1, 13), "forall x y. sin '.'");
+    check(fails_at("P(x) - Q(x)", 1, 6), "'-' sin '>'");
+    check(fails_at("0 & P", 1, 3), "Un número solo no es una fórmula");
+    check(fails_at(std::string(Parser<FormulaArena>::max_depth + 1, '(') + "P", 1, Parser<FormulaArena>::max_depth + 1),
+          "Anidamiento limitado");
+
+    // ==========================================
+    // TEST 5: Ficheros proyectados en memoria
+    // ==========================================
+    {
+        const std::filesystem::path path = std::filesystem::temp_directory_path() / "logic_parser_tests.txt";
+        std::ofstream(path, std::ios::binary) << "PA3: forall(n, Natural(n) >> !Equal(S(n), 0));\n";
+        {
+            const MappedFile file(path.string());
+            FormulaArena arena;
+            const std::vector<Statement> statements = parse_statements(file.text(), arena);
+            check(statements.size() == 1 && arena.text() == "∀n. (Natural(n) → ¬Equal(S(n), 0))", "Parser sobre un fichero proyectado");
+        }
+        std::filesystem::remove(path);
+
+        bool missing = false;
+        try
+        {
+            MappedFile file((std::filesystem::temp_directory_path() / "logic_parser_tests_missing.txt").string());
+        }
+        catch (const std::system_error &)
+        {
+            missing = true;
+        }
+        check(missing, "Un fichero inexistente lanza std::system_error");
+    }
+
+    return check.exit_code();
+}
@@ -0,0 +1,174 @@
+#include <logic_language/proof_checker.hpp>
+#include "test_support.hpp"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+using X = Var<"x">;
+using Y = Var<"y">;
+using A = Var<"a">;
+using Px = Predicate<"P", X>;
+using Qx = Predicate<"Q", X>;
+using Pa = Predicate<"P", A>;
+using AllPQ = Forall<X, Implies<Px, Qx>>;
+
+// ¿El teorema comprobado es el mismo Γ ⊢ φ que el del kernel de tipos?
+template <typename... Hyps, typename Formula>
+bool same_theorem(TermStore &store, const CheckedTheorem &checked, Theorem<TypeList<Hyps...>, Formula>)
+{
+    std::vector<NodeId> context{reify<Hyps>(store)...};
+    std::ranges::sort(context);
+    return checked.formula == reify<Formula>(store) && checked.context == context;
+}
+
+// ¿Lanza ProofError en el paso dado?
+bool fails_at(TermStore &store, const ProofCertificate &certificate, StepId step)
+{
+    try
+    {
+        ProofChecker(store).check(certificate);
+    }
+    catch (const ProofError &error)
+    {
+        return error.step() == step;
+    }
+    return false;
+}
+
+int main()
+{
+    logic::test::Checker check;
+
+    // ==========================================
+    // TEST 1: Las seis reglas, como en el kernel de tipos
+    // ==========================================
+    {
+        constexpr auto h1 = assume<AllPQ>();
+        constexpr auto h2 = assume<Pa>();
+        constexpr auto inst = universal_instantiation(h1, A{});
+        constexpr auto q = modus_ponens(h2, inst);
+        constexpr auto d = implies_intro<Pa>(q);
+        constexpr auto g = generalization(A{}, d);
+        constexpr auto e = implies_intro<AllPQ>(g);
+        constexpr auto id = axiom_identity(decltype(e)::formula_type{});
+        constexpr auto r = modus_ponens(e, id);
+
+        TermStore store;
+        ProofCertificate certificate;
+        const StepId s_h1 = certificate.assume(reify<AllPQ>(store));
+        const StepId s_h2 = certificate.assume(reify<Pa>(store));
+        const StepId s_inst = certificate.universal_instantiation(s_h1, reify<A>(store));
+        const StepId s_q = certificate.modus_ponens(s_h2, s_inst);
+        const StepId s_d = certificate.implies_intro(reify<Pa>(store), s_q);
+        const StepId s_g = certificate.generalization(reify<A>(store), s_d);
+        const StepId s_e = certificate.implies_intro(reify<AllPQ>(store), s_g);
+        const StepId s_id = certificate.axiom_identity(reify<decltype(e)::formula_type>(store));
+        certificate.modus_ponens(s_e, s_id);
+
+        ProofChecker checker(store);
+        const CheckedTheorem theorem = checker.check(certificate);
+        check(same_theorem(store, theorem, r), "Mismo teorema que el kernel de tipos");
+        check(checker.formula(s_q) == reify<decltype(q)::formula_type>(store), "Conclusión de modus_ponens");
+        check(checker.formula(s_inst) == reify<decltype(inst)::formula_type>(store), "Conclusión de universal_instantiation");
+        check(checker.formula(s_g) == reify<decltype(g)::formula_type>(store), "Conclusión de generalization");
+
+        // El mismo prefijo termina en Q(a) con las dos hipótesis
+        const ProofCertificate prefix(std::vector<ProofStep>(certificate.steps().begin(), certificate.steps().begin() + s_q + 1));
+        check(same_theorem(store, checker.check(prefix), q), "Contexto de modus_ponens: unión de los contextos");
+    }
+
+    // ==========================================
+    // TEST 2: Sustitución sin captura (Substitute_t)
+    // ==========================================
+    {
+        TermStore store;
+        ProofChecker checker(store);
+        auto substitutes_like_kernel = [&]<typename F, typename V, typename T>(F, V, T) {
+            return checker.substitute(reify<F>(store), reify<V>(store), reify<T>(store)) == reify<Substitute_t<F, V, T>>(store);
+        };
+        using Yp = Var<"y'">;
+        using Pxy = Predicate<"P", X, Y>;
+        check(substitutes_like_kernel(Forall<Y, Pxy>{}, X{}, Y{}), "∀y. P(x, y) [x := y] renombra y a y'");
+        check(substitutes_like_kernel(Forall<Y, And<Pxy, Predicate<"R", Yp>>>{}, X{}, Y{}), "y' ya libre: se usa y''");
+        check(substitutes_like_kernel(Forall<X, Px>{}, X{}, Y{}), "La variable ligada oculta a la sustituida");
+        check(substitutes_like_kernel(Exists<Y, Predicate<"Q", Y>>{}, X{}, Y{}), "Sin x libre en el cuerpo no se renombra");
+        check(substitutes_like_kernel(And<Px, Forall<Y, Pxy>>{}, X{}, Succ<Y>{}), "Términos compuestos");
+        check(substitutes_like_kernel(Forall<Y, Exists<X, Implies<Pxy, Predicate<"Q", X, Y>>>>{}, X{}, Y{}),
+              "Cuantificadores anidados");
+    }
+
+    // ==========================================
+    // TEST 3: Pasos compartidos (DAG)
+    // ==========================================
+    {
+        TermStore store;
+        const NodeId p = reify<Px>(store);
+        const NodeId pq = reify<Implies<Px, Qx>>(store);
+        const NodeId ppq = reify<Implies<Implies<Px, Px>, Qx>>(store);
+        ProofCertificate certificate;
+        const StepId hp = certificate.assume(p);
+        const StepId q1 = certificate.modus_ponens(hp, certificate.assume(pq));               // {P, P → Q} ⊢ Q
+        const StepId q2 = certificate.modus_ponens(hp, certificate.axiom_identity(p));        // {P} ⊢ P
+        const StepId pp = certificate.implies_intro(p, q2);                                  // ⊢ P → P
+        const StepId q3 = certificate.modus_ponens(pp, certificate.assume(ppq));              // {(P → P) → Q} ⊢ Q
+        const StepId all = certificate.modus_ponens(q1, certificate.implies_intro(reify<Qx>(store), q3)); // Unión de las dos ramas
+
+        ProofChecker checker(store);
+        const CheckedTheorem theorem = checker.check(certificate);
+        std::vector<NodeId> expected{p, pq, ppq};
+        std::ranges::sort(expected);
+        check(theorem.formula == reify<Qx>(store) && theorem.context == expected, "Descargar P(x) en una rama no lo quita de la otra");
+        check(checker.formula(q1) == reify<Qx>(store) && checker.formula(q2) == p && checker.formula(pp) == reify<Implies<Px, Px>>(store),
+              "Cada paso conserva su conclusión");
+
+        // Como raíces, los contextos compartidos no se ven afectados por los
+        // pasos que los citan después
+        const std::array<StepId, 3> roots{q1, pp, all};
+        const std::vector<CheckedTheorem> theorems = checker.check(certificate.steps(), roots);
+        std::vector<NodeId> q1_context{p, pq};
+        std::ranges::sort(q1_context);
+        check(theorems[0].context == q1_context && theorems[1].context.empty() && theorems[2].context == expected,
+              "Raíces con contextos compartidos");
+    }
+
+    // ==========================================
+    // TEST 4: Certificados inválidos
+    // ==========================================
+    {
+        TermStore store;
+        const NodeId p = reify<Px>(store);
+        const NodeId q = reify<Qx>(store);
+        const NodeId x = reify<X>(store);
+
+        ProofCertificate not_implication;
+        not_implication.modus_ponens(not_implication.assume(p), not_implication.assume(q));
+        check(fails_at(store, not_implication, 2), "modus_ponens sin implicación");
+
+        ProofCertificate wrong_antecedent;
+        wrong_antecedent.modus_ponens(wrong_antecedent.assume(q), wrong_antecedent.axiom_identity(p));
+        check(fails_at(store, wrong_antecedent, 2), "modus_ponens con otro antecedente");
+
+        ProofCertificate not_forall;
+        not_forall.universal_instantiation(not_forall.assume(p), x);
+        check(fails_at(store, not_forall, 1), "universal_instantiation sin ∀");
+
+        ProofCertificate not_variable;
+        not_variable.generalization(p, not_variable.assume(p));
+        check(fails_at(store, not_variable, 1), "generalization sin variable");
+
+        ProofCertificate forward(std::vector<ProofStep>{{Rule::Assume, p, {}}, {Rule::ImpliesIntro, p, {2, 0}}, {Rule::Assume, q, {}}});
+        check(fails_at(store, forward, 1), "Un paso no puede citar pasos posteriores");
+
+        ProofCertificate missing;
+        missing.assume(p + (1u << 20));
+        check(fails_at(store, missing, 0), "Fórmula que no está en el TermStore");
+
+        check(fails_at(store, ProofCertificate{}, 0), "Certificado vacío");
+    }
+
+    return check.exit_code();
+}
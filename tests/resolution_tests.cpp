@@ -0,0 +1,205 @@
+#include <logic_language/resolution.hpp>
+#include <theorems/peano/addition.hpp>
+#include "test_support.hpp"
+
+#include <initializer_list>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+int main()
+{
+    logic::test::Checker check;
+
+    ProverOptions options;
+    options.max_seconds = 20;
+
+    // ==========================================
+    // TEST 1: Términos, KBO e índice
+    // ==========================================
+    {
+        ProverTerms terms;
+        const ProverSymbol f = terms.symbol("f", 2), g = terms.symbol("g", 1);
+        const ProverTerm a = terms.apply(terms.symbol("a", 0), {}), b = terms.apply(terms.symbol("b", 0), {});
+        const ProverTerm x = ProverTerms::variable(0), y = ProverTerms::variable(1);
+        const auto F = [&](ProverTerm l, ProverTerm r) { return terms.apply(f, {{l, r}}); };
+        const auto G = [&](ProverTerm t) { return terms.apply(g, {{t}}); };
+
+        check(F(x, a) == F(x, a) && F(x, a) != F(a, x), "Términos compartidos");
+        check(terms.weight(F(G(x), a)) == 4 && terms.ground(F(a, b)) && !terms.ground(F(x, a)), "Peso y términos cerrados");
+        check(terms.compare(G(x), x) == ProverTerms::Order::Greater && terms.compare(F(x, y), F(y, x)) == ProverTerms::Order::Incomparable,
+              "KBO: subtérmino y variables");
+        check(terms.compare(b, a) == ProverTerms::Order::Greater && terms.compare(G(a), F(a, a)) == ProverTerms::Order::Less, "KBO: peso y precedencia");
+        check(terms.text(F(G(x), b)) == "f(g(x0), b)", "Texto");
+
+        // Los candidatos del árbol contienen todo lo que encaja o unifica
+        std::mt19937 random(7);
+        const auto generate = [&](auto &self, int depth) -> ProverTerm {
+            const unsigned choice = random() % 6;
+            if (depth == 0 || choice < 2)
+                return choice % 2 ? ProverTerms::variable(random() % 3) : (random() % 2 ? a : b);
+            return choice < 4 ? G(self(self, depth - 1)) : F(self(self, depth - 1), self(self, depth - 1));
+        };
+        std::vector<ProverTerm> stored;
+        runtime::detail::DiscriminationTree<std::uint32_t> tree(terms);
+        for (std::uint32_t i = 0; i < 400; ++i)
+        {
+            stored.push_back(generate(generate, 4));
+            tree.insert(stored.back(), i);
+        }
+
+        runtime::detail::Substitution substitution(terms);
+        bool complete = true;
+        size_t pruned = 0, found = 0;
+        for (int round = 0; round < 200; ++round)
+        {
+            const ProverTerm query = generate(generate, 4);
+            std::set<std::uint32_t> general, instance, unifiable;
+            tree.generalizations(query, [&](std::uint32_t i) { return general.insert(i), true; });
+            tree.instances(query, [&](std::uint32_t i) { return instance.insert(i), true; });
+            tree.unifiable(query, [&](std::uint32_t i) { return unifiable.insert(i), true; });
+            for (std::uint32_t i = 0; i < stored.size(); ++i)
+            {
+                const auto test = [&](bool ok) {
+                    substitution.undo(0);
+                    return ok;
+                };
+                if (test(substitution.match(stored[i], 0, query, 1)))
+                    complete &= general.count(i) == 1;
+                if (test(substitution.match(query, 1, stored[i], 0)))
+                    complete &= instance.count(i) == 1;
+                if (test(substitution.unify(stored[i], 0, query, 1)))
+                {
+                    complete &= unifiable.count(i) == 1;
+                    ++found;
+                }
+            }
+            pruned += stored.size() - unifiable.size();
+        }
+        check(complete, "Árbol de discriminación frente a fuerza bruta");
+        check(found > 0 && pruned > 200 * stored.size() / 2, "El árbol descarta candidatos");
+    }
+
+    // ==========================================
+    // TEST 2: Primer orden sin igualdad
+    // ==========================================
+    {
+        TermStore store;
+        const NodeId x = store.variable("x"), y = store.variable("y");
+        const NodeId socrates = store.constant("socrates");
+        const auto P = [&](std::string_view name, std::initializer_list<NodeId> args) { return store.atom(name, std::span(args.begin(), args.size())); };
+        const auto forall = [&](std::string_view v, NodeId body) { return store.binder(NodeOp::Forall, v, body); };
+        const auto exists = [&](std::string_view v, NodeId body) { return store.binder(NodeOp::Exists, v, body); };
+        const auto implies = [&](NodeId l, NodeId r) { return store.binary(NodeOp::Implies, l, r); };
+
+        {
+            ResolutionProver prover(store);
+            prover.add_axiom(forall("x", implies(P("Man", {x}), P("Mortal", {x}))));
+            prover.add_axiom(P("Man", {socrates}));
+            prover.add_goal(P("Mortal", {socrates}));
+            check(prover.prove(options) == ProverResult::Proved && prover.proof().size() == 5, "Sócrates");
+            check(prover.solver().text(prover.proof().back()) == "⊥", "La demostración acaba en ⊥");
+        }
+        {
+            // Paradoja del bebedor: ∃x. (D(x) → ∀y. D(y)), sin axiomas
+            ResolutionProver prover(store);
+            prover.add_goal(exists("x", implies(P("D", {x}), forall("y", P("D", {y})))));
+            check(prover.prove(options) == ProverResult::Proved, "Paradoja del bebedor");
+        }
+        {
+            // ∀x∃y. R(x, y) no da ∃y∀x. R(x, y)
+            ResolutionProver prover(store);
+            prover.add_axiom(forall("x", exists("y", P("R", {x, y}))));
+            prover.add_goal(exists("y", forall("x", P("R", {x, y}))));
+            check(prover.prove(options) == ProverResult::Saturated, "Los cuantificadores no se intercambian");
+        }
+        {
+            // Y al revés sí
+            ResolutionProver prover(store);
+            prover.add_axiom(exists("y", forall("x", P("R", {x, y}))));
+            prover.add_goal(forall("x", exists("y", P("R", {x, y}))));
+            check(prover.prove(options) == ProverResult::Proved, "∃∀ → ∀∃");
+        }
+    }
+
+    // ==========================================
+    // TEST 3: Igualdad
+    // ==========================================
+    {
+        // Grupos: (xy)z = x(yz), ex = x, i(x)x = e
+        const auto group = [&](int goal, ProverResult expected) {
+            SuperpositionSolver solver;
+            ProverTerms &terms = solver.terms();
+            const ProverSymbol mul = terms.symbol("mul", 2), inv = terms.symbol("i", 1);
+            const ProverTerm e = terms.apply(terms.symbol("e", 0), {}), a = terms.apply(terms.symbol("a", 0), {}), b = terms.apply(terms.symbol("b", 0), {});
+            const ProverTerm x = ProverTerms::variable(0), y = ProverTerms::variable(1), z = ProverTerms::variable(2);
+            const auto M = [&](ProverTerm l, ProverTerm r) { return terms.apply(mul, {{l, r}}); };
+            const auto I = [&](ProverTerm t) { return terms.apply(inv, {{t}}); };
+            solver.add_clause({{M(M(x, y), z), M(x, M(y, z)), true}});
+            solver.add_clause({{M(e, x), x, true}});
+            solver.add_clause({{M(I(x), x), e, true}});
+            if (goal == 0)
+                solver.add_clause({{M(a, e), a, false}});
+            else if (goal == 1)
+                solver.add_clause({{M(a, I(a)), e, false}});
+            else
+                solver.add_clause({{M(a, b), M(b, a), false}});
+            const ProverResult result = solver.prove(options);
+            return result == expected && (result != ProverResult::Proved || solver.empty_clause() != SuperpositionSolver::npos);
+        };
+        check(group(0, ProverResult::Proved), "Grupos: x·e = x");
+        check(group(1, ProverResult::Proved), "Grupos: x·i(x) = e");
+        check(group(2, ProverResult::Saturated), "Grupos: no son conmutativos");
+
+        // Cadena a0 = a1 = ... = a29 y una función: f(a0) = f(a29)
+        SuperpositionSolver solver;
+        ProverTerms &terms = solver.terms();
+        const ProverSymbol f = terms.symbol("f", 1);
+        std::vector<ProverTerm> chain;
+        for (int i = 0; i < 30; ++i)
+            chain.push_back(terms.apply(terms.symbol("a" + std::to_string(i), 0), {}));
+        for (int i = 0; i + 1 < 30; ++i)
+            solver.add_clause({{chain[i], chain[i + 1], true}});
+        solver.add_clause({{terms.apply(f, {{chain[0]}}), terms.apply(f, {{chain[29]}}), false}});
+        check(solver.prove(options) == ProverResult::Proved && solver.stats().rewrites > 0, "Cadena de igualdades por demodulación");
+    }
+
+    // ==========================================
+    // TEST 4: Lemas de peano a partir de otros
+    // ==========================================
+    {
+        using namespace peano;
+        TermStore store;
+        const auto prove = [&](NodeId goal, std::initializer_list<NodeId> axioms) {
+            ResolutionProver prover(store);
+            for (const NodeId axiom : axioms)
+                prover.add_axiom(axiom);
+            prover.add_goal(goal);
+            return prover.prove(options);
+        };
+
+        const NodeId lt_irrefl = statement_of<decltype(strict_order::lt_irrefl())>(store);
+        const NodeId lt_trans = statement_of<decltype(strict_order::lt_trans())>(store);
+        const NodeId le_definition = statement_of<decltype(order::le_definition())>(store);
+        const NodeId trichotomy = statement_of<decltype(strict_order::trichotomy())>(store);
+        const NodeId lt_zero = statement_of<decltype(strict_order::lt_zero())>(store);
+
+        check(prove(statement_of<decltype(strict_order::lt_asymm())>(store), {lt_trans, lt_irrefl}) == ProverResult::Proved, "lt_asymm");
+        check(prove(statement_of<decltype(strict_order::lt_then_neq())>(store), {lt_irrefl}) == ProverResult::Proved, "lt_then_neq");
+        check(prove(statement_of<decltype(order::le_refl())>(store), {le_definition}) == ProverResult::Proved, "le_refl");
+        check(prove(statement_of<decltype(order::le_trans())>(store), {le_definition, lt_trans}) == ProverResult::Proved, "le_trans");
+        check(prove(statement_of<decltype(order::le_total())>(store), {le_definition, trichotomy}) == ProverResult::Proved, "le_total");
+        check(prove(statement_of<decltype(order::le_antisymm())>(store), {le_definition, lt_trans, lt_irrefl}) == ProverResult::Proved, "le_antisymm");
+        check(prove(statement_of<decltype(order::le_zero_eq_zero())>(store), {le_definition, lt_zero}) == ProverResult::Proved, "le_zero_eq_zero");
+        check(prove(statement_of<decltype(order::zero_le())>(store), {le_definition}) == ProverResult::Saturated, "zero_le no sale de le_definition");
+        check(prove(statement_of<decltype(addition::zero_add())>(store),
+                    {statement_of<decltype(addition::add_zero())>(store), statement_of<decltype(addition::add_comm())>(store)}) == ProverResult::Proved,
+              "zero_add");
+    }
+
+    return check.exit_code();
+}
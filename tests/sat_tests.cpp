@@ -0,0 +1,248 @@
+#include <logic_language/sat.hpp>
+#include <logic_language/truth_table.hpp>
+#include "test_support.hpp"
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+using Clause = std::vector<SatLiteral>;
+
+// Resultado y modelo del resolvedor para un conjunto de cláusulas
+SatResult solve(size_t variables, const std::vector<Clause> &clauses, std::vector<bool> *model = nullptr)
+{
+    SatSolver solver;
+    for (size_t i = 0; i < variables; ++i)
+        solver.new_variable();
+    for (const Clause &clause : clauses)
+        solver.add_clause(clause);
+    const SatResult result = solver.solve();
+    if (model && result == SatResult::Satisfiable)
+        for (SatVariable variable = 0; variable < variables; ++variable)
+            model->push_back(solver.model_value(variable));
+    return result;
+}
+
+bool satisfies(const std::vector<bool> &model, const std::vector<Clause> &clauses)
+{
+    for (const Clause &clause : clauses)
+        if (std::ranges::none_of(clause, [&](SatLiteral literal) { return model[literal.variable()] != literal.negated(); }))
+            return false;
+    return true;
+}
+
+// n + 1 palomas en n agujeros: insatisfacible
+std::vector<Clause> pigeonhole(size_t holes)
+{
+    const auto var = [&](size_t pigeon, size_t hole) { return static_cast<SatVariable>(pigeon * holes + hole); };
+    std::vector<Clause> clauses;
+    for (size_t pigeon = 0; pigeon <= holes; ++pigeon)
+    {
+        Clause some;
+        for (size_t hole = 0; hole < holes; ++hole)
+            some.push_back(SatLiteral::positive(var(pigeon, hole)));
+        clauses.push_back(some);
+    }
+    for (size_t hole = 0; hole < holes; ++hole)
+        for (size_t a = 0; a <= holes; ++a)
+            for (size_t b = a + 1; b <= holes; ++b)
+                clauses.push_back({SatLiteral::negative(var(a, hole)), SatLiteral::negative(var(b, hole))});
+    return clauses;
+}
+
+int main()
+{
+    logic::test::Checker check;
+
+    const SatLiteral a = SatLiteral::positive(0), b = SatLiteral::positive(1), c = SatLiteral::positive(2);
+
+    // ==========================================
+    // TEST 1: Cláusulas pequeñas
+    // ==========================================
+    {
+        std::vector<bool> model;
+        const std::vector<Clause> clauses = {{a, b}, {~a, c}, {~b, c}, {~c, ~a}};
+        check(solve(3, clauses, &model) == SatResult::Satisfiable && satisfies(model, clauses), "Satisfacible, con modelo");
+        check(solve(2, {{a, b}, {~a, b}, {a, ~b}, {~a, ~b}}) == SatResult::Unsatisfiable, "Las cuatro cláusulas de dos variables");
+        check(solve(1, {{a, ~a}}) == SatResult::Satisfiable, "Tautología");
+        check(solve(1, {{a}, {~a}}) == SatResult::Unsatisfiable, "Unitarias contradictorias");
+        check(solve(1, {{}}) == SatResult::Unsatisfiable, "Cláusula vacía");
+        check(solve(30, pigeonhole(5)) == SatResult::Unsatisfiable, "Palomar de 6 en 5");
+
+        // Incremental: más cláusulas tras resolver
+        SatSolver solver;
+        for (int i = 0; i < 3; ++i)
+            solver.new_variable();
+        solver.add_clause({a, b, c});
+        check(solver.solve() == SatResult::Satisfiable, "Incremental (1)");
+        solver.add_clause({~a});
+        solver.add_clause({~b});
+        check(solver.solve() == SatResult::Satisfiable && solver.model_value(c), "Incremental (2)");
+        solver.add_clause({~c});
+        check(solver.solve() == SatResult::Unsatisfiable && !solver.add_clause({a}), "Incremental (3)");
+
+        bool thrown = false;
+        try
+        {
+            SatSolver().add_clause({a});
+        }
+        catch (const std::out_of_range &)
+        {
+            thrown = true;
+        }
+        check(thrown, "Variable no declarada");
+    }
+
+    // ==========================================
+    // TEST 2: 3-SAT aleatorio frente a la búsqueda exhaustiva
+    // ==========================================
+    {
+        std::mt19937 random(2024);
+        constexpr size_t n = 14;
+        bool agree = true;
+        size_t satisfiable = 0;
+        for (int round = 0; round < 200; ++round)
+        {
+            std::vector<Clause> clauses(static_cast<size_t>(n * (3.5 + (round % 3) * 0.5)));
+            for (Clause &clause : clauses)
+                for (int k = 0; k < 3; ++k)
+                {
+                    const auto variable = static_cast<SatVariable>(random() % n);
+                    clause.push_back(random() % 2 ? SatLiteral::positive(variable) : SatLiteral::negative(variable));
+                }
+            bool expected = false;
+            for (std::uint32_t assignment = 0; assignment < 1u << n && !expected; ++assignment)
+            {
+                std::vector<bool> model(n);
+                for (size_t i = 0; i < n; ++i)
+                    model[i] = (assignment >> i) & 1;
+                expected = satisfies(model, clauses);
+            }
+            std::vector<bool> model;
+            const SatResult result = solve(n, clauses, &model);
+            agree &= expected ? result == SatResult::Satisfiable && satisfies(model, clauses) : result == SatResult::Unsatisfiable;
+            satisfiable += expected;
+        }
+        check(agree, "Coincide con la búsqueda exhaustiva y el modelo satisface las cláusulas");
+        check(satisfiable > 20 && satisfiable < 180, "Hay casos satisfacibles e insatisfacibles");
+
+        // Suficientes conflictos para reinicios y reducciones de la base
+        std::vector<Clause> clauses(static_cast<size_t>(120 * 4.26));
+        for (Clause &clause : clauses)
+            for (int k = 0; k < 3; ++k)
+            {
+                const auto variable = static_cast<SatVariable>(random() % 120);
+                clause.push_back(random() % 2 ? SatLiteral::positive(variable) : SatLiteral::negative(variable));
+            }
+        SatSolver solver;
+        for (int i = 0; i < 120; ++i)
+            solver.new_variable();
+        for (const Clause &clause : clauses)
+            solver.add_clause(clause);
+        const SatResult result = solver.solve();
+        std::vector<bool> model;
+        for (SatVariable variable = 0; variable < 120 && result == SatResult::Satisfiable; ++variable)
+            model.push_back(solver.model_value(variable));
+        check(result == SatResult::Unsatisfiable || satisfies(model, clauses), "3-SAT de 120 variables");
+
+        SatSolver limited;
+        for (int i = 0; i < 56; ++i)
+            limited.new_variable();
+        for (const Clause &clause : pigeonhole(7))
+            limited.add_clause(clause);
+        check(limited.solve(10) == SatResult::Unknown && limited.solve() == SatResult::Unsatisfiable, "Límite de conflictos");
+    }
+
+    // ==========================================
+    // TEST 3: Validez con Tseitin, frente a la tabla de verdad
+    // ==========================================
+    {
+        using X = Var<"x">;
+        using P = Predicate<"P", X>;
+        using Q = Predicate<"Q", X>;
+
+        TermStore store;
+        check(SatProver(store, reify<Implies<Implies<Implies<P, Q>, P>, P>>(store)).valid(), "Ley de Peirce");
+        check(SatProver(store, reify<Forall<X, Implies<P, P>>>(store)).valid(), "∀ de una tautología");
+        check(!SatProver(store, reify<Forall<X, P>>(store)).valid(), "∀ opaco");
+
+        SatProver converse(store, reify<Equiv<Implies<P, Q>, Implies<Q, P>>>(store));
+        const auto counterexample = converse.counterexample();
+        check(counterexample && converse.atoms().size() == 2 && (*counterexample)[0] != (*counterexample)[1], "Contraejemplo de la recíproca");
+
+        std::mt19937 random(7);
+        std::vector<NodeId> atoms;
+        for (int i = 0; i < 10; ++i)
+            atoms.push_back(store.atom("p" + std::to_string(i), {}));
+        const auto generate = [&](auto &self, int depth) -> NodeId {
+            const unsigned choice = random() % 7;
+            if (depth == 0 || choice == 0)
+                return atoms[random() % atoms.size()];
+            if (choice == 1)
+                return store.unary(NodeOp::Not, self(self, depth - 1));
+            const NodeOp ops[] = {NodeOp::And, NodeOp::Or, NodeOp::Implies, NodeOp::Equiv};
+            return store.binary(ops[choice % 4], self(self, depth - 1), self(self, depth - 1));
+        };
+
+        bool agree = true;
+        size_t valid = 0;
+        for (int round = 0; round < 300; ++round)
+        {
+            NodeId formula = generate(generate, 6);
+            if (round % 3 == 0)
+                formula = store.binary(NodeOp::Or, formula, store.binary(NodeOp::Implies, formula, generate(generate, 3)));
+            const TruthTable table(store, formula);
+            SatProver prover(store, formula);
+            const auto found = prover.counterexample();
+            agree &= found.has_value() == !table.tautology(1);
+            if (found)
+            {
+                // Con los átomos fijados como dice el contraejemplo, la fórmula es falsa
+                NodeId instance = formula;
+                for (size_t atom = 0; atom < prover.atoms().size(); ++atom)
+                    instance = store.binary(NodeOp::And, instance, (*found)[atom] ? prover.atoms()[atom] : store.unary(NodeOp::Not, prover.atoms()[atom]));
+                agree &= TruthTable(store, store.unary(NodeOp::Not, instance)).tautology(1);
+            }
+            valid += !found;
+        }
+        check(agree, "Coincide con la tabla de verdad y los contraejemplos son correctos");
+        check(valid > 0, "Hay fórmulas válidas entre las generadas");
+    }
+
+    // ==========================================
+    // TEST 4: Muchos átomos
+    // ==========================================
+    {
+        TermStore store;
+        std::vector<NodeId> p;
+        for (int i = 0; i < 400; ++i)
+            p.push_back(store.atom("p" + std::to_string(i), {}));
+
+        // (p0 → p1) ∧ ... ∧ (p398 → p399) → (p0 → p399)
+        NodeId chain = store.binary(NodeOp::Implies, p[0], p[1]);
+        for (size_t i = 1; i + 1 < p.size(); ++i)
+            chain = store.binary(NodeOp::And, chain, store.binary(NodeOp::Implies, p[i], p[i + 1]));
+        check(SatProver(store, store.binary(NodeOp::Implies, chain, store.binary(NodeOp::Implies, p[0], p.back()))).valid(), "Silogismo de 400 átomos");
+
+        // Sin p200 → p201 no se sigue: el contraejemplo rompe la cadena ahí
+        NodeId broken = store.binary(NodeOp::Implies, p[0], p[1]);
+        for (size_t i = 1; i + 1 < p.size(); ++i)
+            if (i != 200)
+                broken = store.binary(NodeOp::And, broken, store.binary(NodeOp::Implies, p[i], p[i + 1]));
+        SatProver prover(store, store.binary(NodeOp::Implies, broken, store.binary(NodeOp::Implies, p[0], p.back())));
+        const auto counterexample = prover.counterexample();
+        bool ok = counterexample.has_value() && counterexample->size() == p.size();
+        for (size_t atom = 0; ok && atom < prover.atoms().size(); ++atom)
+        {
+            const size_t index = static_cast<size_t>(std::stoul(store.text(prover.atoms()[atom]).substr(1)));
+            ok = (*counterexample)[atom] == (index <= 200);
+        }
+        check(ok, "Contraejemplo de la cadena rota");
+    }
+
+    return check.exit_code();
+}
@@ -0,0 +1,115 @@
+#include <logic_language/term_store.hpp>
+#include <theorems/peano/axioms.hpp>
+#include "test_support.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+// BY_AXIOM(φ) demuestra φ → φ: el enunciado es el consecuente
+template <typename Thm>
+using formula_of = typename Thm::formula_type::Right;
+
+using PA2 = formula_of<decltype(peano::PA2())>;
+using PA3 = formula_of<decltype(peano::PA3())>;
+using PA4 = formula_of<decltype(peano::PA4())>;
+using PlusSucc = formula_of<decltype(peano::plus_succ())>;
+using TimesSucc = formula_of<decltype(peano::times_succ())>;
+
+// Reifica todos los enunciados y devuelve sus raíces
+template <typename... Fs>
+std::vector<NodeId> reify_all(TermStore &store)
+{
+    return {reify<Fs>(store)...};
+}
+
+// S(S(...S(0)...)) con depth sucesores, construido a mano
+NodeId numeral(TermStore &store, size_t depth)
+{
+    NodeId term = store.constant("0");
+    for (size_t i = 0; i < depth; ++i)
+        term = store.atom("S", std::array{term});
+    return term;
+}
+
+int main()
+{
+    logic::test::Checker check;
+
+    // ==========================================
+    // TEST 1: Compartición estructural
+    // ==========================================
+    {
+        TermStore store;
+        const NodeId pa2 = reify<PA2>(store);
+        const NodeId is_nat_n = reify<decltype(peano::IsNat(peano::n))>(store);
+        check(reify<PA2>(store) == pa2, "La misma fórmula recibe el mismo NodeId");
+        check(store.children(store.children(pa2)[0])[0] == is_nat_n, "IsNat(n) dentro de PA2 es el mismo nodo");
+        check(reify<PA3>(store) != pa2, "Fórmulas distintas reciben NodeId distintos");
+
+        const TermStoreStats before = store.stats();
+        reify_all<PA4, PlusSucc, TimesSucc>(store);
+        const TermStoreStats after = store.stats();
+        check(after.hits > before.hits, "Los guardas IsNat(n), IsNat(m), ... se comparten entre axiomas");
+        check(after.nodes < formula_size_v<PA2> + formula_size_v<PA3> + formula_size_v<PA4> + formula_size_v<PlusSucc> +
+                                formula_size_v<TimesSucc> + formula_size_v<decltype(peano::IsNat(peano::n))>,
+              "Menos nodos que la suma de los tamaños");
+        check(after.lookups == after.nodes + after.hits, "Cada construcción es un acierto o un nodo nuevo");
+        check(after.hit_rate() > 0.0 && after.hit_rate() < 1.0, "Tasa de aciertos");
+        check(after.bytes > 0 && after.symbols == store.symbols().size(), "Memoria y símbolos");
+    }
+
+    // ==========================================
+    // TEST 2: Hash e impresión coinciden con el kernel
+    // ==========================================
+    {
+        TermStore store;
+        check(store.hash(reify<PlusSucc>(store)) == formula_hash_v<PlusSucc>, "hash(id) == formula_hash_v");
+        check(store.hash(reify<PA3>(store)) == formula_hash_v<PA3>, "También a través de Succ y Natural");
+        check(store.text(reify<PA4>(store)) == std::string(to_string(PA4{})), "text(id) == to_string");
+        check(store.text(numeral(store, 2)) == "S(S(0))", "Construcción directa");
+        check(numeral(store, 3) == reify<Succ<Succ<Succ<Natural<0>>>>>(store), "Construcción directa y reify comparten nodos");
+    }
+
+    // ==========================================
+    // TEST 3: Varios hilos internando a la vez
+    // ==========================================
+    {
+        constexpr size_t threads = 4;
+        constexpr size_t depth = 2000;
+        TermStore store;
+        std::vector<std::vector<NodeId>> roots(threads);
+        std::vector<std::thread> workers;
+        for (size_t t = 0; t < threads; ++t)
+            workers.emplace_back([&store, &roots, t] {
+                for (size_t i = 0; i < depth; ++i)
+                {
+                    const NodeId n = numeral(store, i % 64);
+                    roots[t].push_back(store.atom("Plus", std::array{n, store.variable("x" + std::to_string(i)), n}));
+                }
+                const std::vector<NodeId> axioms = reify_all<PA2, PA3, PA4, PlusSucc, TimesSucc>(store);
+                roots[t].insert(roots[t].end(), axioms.begin(), axioms.end());
+            });
+        for (std::thread &worker : workers)
+            worker.join();
+
+        bool same_roots = true;
+        for (size_t t = 1; t < threads; ++t)
+            same_roots = same_roots && roots[t] == roots[0];
+        check(same_roots, "Todos los hilos obtienen los mismos NodeId");
+
+        TermStore sequential(1);
+        for (size_t i = 0; i < depth; ++i)
+        {
+            const NodeId n = numeral(sequential, i % 64);
+            sequential.atom("Plus", std::array{n, sequential.variable("x" + std::to_string(i)), n});
+        }
+        reify_all<PA2, PA3, PA4, PlusSucc, TimesSucc>(sequential);
+        check(store.stats().nodes == sequential.stats().nodes, "Mismos nodos que construyendo en un solo hilo");
+        check(store.text(roots[0][5]) == "Plus(S(S(S(S(S(0))))), x5, S(S(S(S(S(0))))))", "Los nodos construidos en paralelo se leen bien");
+    }
+
+    return check.exit_code();
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdio>
+
+namespace logic::test
+{
+
+    // Contador de fallos de los tests: check(ok, qué) anota cada fallo en
+    // stderr y sigue, y exit_code() da el código de salida para ctest.
+    class Checker
+    {
+    public:
+        void operator()(bool ok, const char *what)
+        {
+            if (!ok)
+            {
+                std::fprintf(stderr, "FALLO: %s\n", what);
+                ++failures_;
+            }
+        }
+
+        int failures() const { return failures_; }
+        int exit_code() const { return failures_ == 0 ? 0 : 1; }
+
+    private:
+        int failures_ = 0;
+    };
+
+} // namespace logic::test
@@ -0,0 +1,171 @@
+#include <logic_language/truth_table.hpp>
+#include "test_support.hpp"
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace logic;
+using namespace logic::runtime;
+
+using X = Var<"x">;
+using A = Predicate<"P">;
+using B = Predicate<"Q">;
+using C = Predicate<"R">;
+using Px = Predicate<"P", X>;
+
+// --- En los tipos ---
+static_assert(propositional_tautology_v<Or<A, Not<A>>>, "Tercero excluido");
+static_assert(propositional_tautology_v<Implies<Implies<Implies<A, B>, A>, A>>, "Ley de Peirce");
+static_assert(propositional_tautology_v<Equiv<Not<And<A, B>>, Or<Not<A>, Not<B>>>>, "De Morgan");
+static_assert(propositional_tautology_v<Implies<And<Implies<A, B>, Implies<B, C>>, Implies<A, C>>>, "Silogismo hipotético");
+static_assert(!propositional_tautology_v<A> && !propositional_tautology_v<Implies<A, B>>, "No son tautologías");
+static_assert(!propositional_tautology_v<Equiv<Implies<A, B>, Implies<B, A>>>, "Recíproca");
+static_assert(PropositionalAtoms_t<And<A, Or<B, Not<A>>>>::size == 2, "Átomos sin repetir");
+
+// Los cuantificadores son átomos, salvo si su cuerpo es una tautología
+static_assert(propositional_tautology_v<Forall<X, Implies<Px, Px>>>, "∀ de una tautología");
+static_assert(!propositional_tautology_v<Forall<X, Px>>, "∀ opaco");
+static_assert(propositional_tautology_v<Implies<Forall<X, Px>, Forall<X, Px>>>, "El mismo cuantificador es el mismo átomo");
+
+// A → B solo es falsa con A verdadero y B falso
+constexpr auto pq_counterexample = propositional_counterexample_v<Implies<A, B>>;
+static_assert(pq_counterexample && ((*pq_counterexample >> logic::detail::atom_index<A>(PropositionalAtoms_t<Implies<A, B>>{})) & 1) == 1 &&
+                  ((*pq_counterexample >> logic::detail::atom_index<B>(PropositionalAtoms_t<Implies<A, B>>{})) & 1) == 0,
+              "Contraejemplo de A → B");
+
+// Valor de una fórmula en una asignación, recorriendo el árbol (la referencia)
+bool evaluate(const TermStore &store, const TruthTable &table, NodeId id, std::uint64_t assignment)
+{
+    const Node &node = store[id];
+    const auto child = [&](size_t i) { return evaluate(store, table, node.operands[i], assignment); };
+    switch (node.op)
+    {
+    case NodeOp::Not:
+        return !child(0);
+    case NodeOp::And:
+        return child(0) && child(1);
+    case NodeOp::Or:
+        return child(0) || child(1);
+    case NodeOp::Implies:
+        return !child(0) || child(1);
+    case NodeOp::Equiv:
+        return child(0) == child(1);
+    default:
+        for (size_t atom = 0; atom < table.atoms().size(); ++atom)
+            if (table.atoms()[atom] == id)
+                return TruthTable::value(assignment, atom);
+        return true; // Cuantificador de una tautología
+    }
+}
+
+int main()
+{
+    logic::test::Checker check;
+
+    // ==========================================
+    // TEST 1: Los mismos resultados que en los tipos
+    // ==========================================
+    {
+        TermStore store;
+        check(TruthTable(store, reify<Implies<Implies<Implies<A, B>, A>, A>>(store)).tautology(), "Ley de Peirce");
+        check(TruthTable(store, reify<Forall<X, Implies<Px, Px>>>(store)).tautology(), "∀ de una tautología");
+        check(TruthTable(store, reify<Implies<Forall<X, Px>, Forall<X, Px>>>(store)).atoms().size() == 1, "Un átomo por subfórmula");
+
+        const TruthTable pq(store, reify<Implies<A, B>>(store));
+        const auto counterexample = pq.counterexample();
+        check(counterexample && pq.atoms().size() == 2 && TruthTable::value(*counterexample, 0) && !TruthTable::value(*counterexample, 1),
+              "Contraejemplo de A → B");
+    }
+
+    // ==========================================
+    // TEST 2: Fórmulas aleatorias frente a la evaluación una a una
+    // ==========================================
+    {
+        TermStore store;
+        std::mt19937 random(2024);
+        std::vector<NodeId> atoms;
+        for (int i = 0; i < 12; ++i)
+            atoms.push_back(store.atom("p" + std::to_string(i), {}));
+
+        const auto generate = [&](auto &self, int depth) -> NodeId {
+            const unsigned choice = random() % 7;
+            if (depth == 0 || choice == 0)
+                return atoms[random() % atoms.size()];
+            if (choice == 1)
+                return store.unary(NodeOp::Not, self(self, depth - 1));
+            const NodeOp ops[] = {NodeOp::And, NodeOp::Or, NodeOp::Implies, NodeOp::Equiv};
+            return store.binary(ops[choice % 4], self(self, depth - 1), self(self, depth - 1));
+        };
+
+        bool agree = true;
+        size_t tautologies = 0;
+        for (int round = 0; round < 300; ++round)
+        {
+            NodeId formula = generate(generate, 6);
+            if (round % 3 == 0) // φ ∨ ¬φ' con φ' = φ en forma de →: más tautologías
+                formula = store.binary(NodeOp::Or, formula, store.binary(NodeOp::Implies, formula, generate(generate, 3)));
+            const TruthTable table(store, formula);
+            std::optional<std::uint64_t> expected;
+            for (std::uint64_t assignment = 0; assignment < std::uint64_t{1} << table.atoms().size() && !expected; ++assignment)
+                if (!evaluate(store, table, formula, assignment))
+                    expected = assignment;
+            agree &= table.counterexample(1) == expected;
+            tautologies += !expected;
+        }
+        check(agree, "El primer contraejemplo coincide con la evaluación una a una");
+        check(tautologies > 0, "Hay tautologías entre las fórmulas generadas");
+    }
+
+    // ==========================================
+    // TEST 3: Muchos átomos y varios hilos
+    // ==========================================
+    {
+        TermStore store;
+        std::vector<NodeId> p;
+        for (int i = 0; i < 22; ++i)
+            p.push_back(store.atom("p" + std::to_string(i), {}));
+
+        // (p0 → p1) ∧ ... ∧ (p20 → p21) → (p0 → p21)
+        NodeId chain = store.binary(NodeOp::Implies, p[0], p[1]);
+        for (size_t i = 1; i + 1 < p.size(); ++i)
+            chain = store.binary(NodeOp::And, chain, store.binary(NodeOp::Implies, p[i], p[i + 1]));
+        const TruthTable syllogism(store, store.binary(NodeOp::Implies, chain, store.binary(NodeOp::Implies, p[0], p.back())));
+        check(syllogism.tautology(1) && syllogism.tautology(4), "Cadena de 22 átomos");
+
+        // ¬(p0 ∧ ... ∧ p21): solo es falsa con todo verdadero, la última asignación
+        NodeId all = p[0];
+        for (size_t i = 1; i < p.size(); ++i)
+            all = store.binary(NodeOp::And, all, p[i]);
+        const TruthTable last(store, store.unary(NodeOp::Not, all));
+        const std::uint64_t everything = (std::uint64_t{1} << p.size()) - 1;
+        check(last.counterexample(1) == everything && last.counterexample(4) == everything, "Contraejemplo en el último bloque");
+
+        // (p0 ∧ ... ∧ p19 → p0 ∧ ... ∧ p19) ∧ (¬p20 ∨ p21): los átomos se
+        // numeran en el orden en que aparecen, y la fórmula es falsa en
+        // muchos bloques; con varios hilos se devuelve igualmente la menor
+        NodeId twenty = p[0];
+        for (size_t i = 1; i < 20; ++i)
+            twenty = store.binary(NodeOp::And, twenty, p[i]);
+        const TruthTable first(store, store.binary(NodeOp::And, store.binary(NodeOp::Implies, twenty, twenty),
+                                                   store.binary(NodeOp::Or, store.unary(NodeOp::Not, p[20]), p[21])));
+        check(first.counterexample(4) == std::uint64_t{1} << 20 && first.counterexample(1) == std::uint64_t{1} << 20,
+              "El menor contraejemplo con varios hilos");
+
+        bool thrown = false;
+        NodeId big = store.atom("q0", {});
+        for (int i = 1; i < 64; ++i)
+            big = store.binary(NodeOp::Or, big, store.atom("q" + std::to_string(i), {}));
+        try
+        {
+            TruthTable(store, big);
+        }
+        catch (const std::length_error &)
+        {
+            thrown = true;
+        }
+        check(thrown, "Más de 63 átomos");
+    }
+
+    return check.exit_code();
+}